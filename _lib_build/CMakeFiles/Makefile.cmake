@@ -0,0 +1,113 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeASMCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "generated"
+  "generated/.config"
+  "/root/repo/scripts/cmake/defconfigs.cmake"
+  "/root/repo/scripts/cmake/dist.cmake"
+  "/root/repo/scripts/cmake/git-hooks.cmake"
+  "/root/repo/scripts/cmake/kconfig.cmake"
+  "/root/repo/scripts/cmake/misc.cmake"
+  "/root/repo/scripts/cmake/version-build-counter.cmake"
+  "/root/repo/scripts/cmake/version.cmake"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/arch/CMakeLists.txt"
+  "/root/repo/src/arch/host/CMakeLists.txt"
+  "/root/repo/src/audio/CMakeLists.txt"
+  "/root/repo/src/ipc/CMakeLists.txt"
+  "/root/repo/src/lib/CMakeLists.txt"
+  "/root/repo/src/platform/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeASMInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-ASM.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/platform/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/arch/host/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/ipc/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/audio/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/lib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/check_version_h.dir/DependInfo.cmake"
+  "CMakeFiles/dist.dir/DependInfo.cmake"
+  "CMakeFiles/library_defconfig.dir/DependInfo.cmake"
+  "CMakeFiles/menuconfig.dir/DependInfo.cmake"
+  "CMakeFiles/overrideconfig.dir/DependInfo.cmake"
+  "CMakeFiles/genconfig.dir/DependInfo.cmake"
+  "CMakeFiles/olddefconfig.dir/DependInfo.cmake"
+  "CMakeFiles/alldefconfig.dir/DependInfo.cmake"
+  "CMakeFiles/savedefconfig.dir/DependInfo.cmake"
+  "CMakeFiles/sof.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_volume.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_volume_sse42.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_volume_avx.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_volume_avx2.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_volume_fma.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_src.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_src_sse42.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_src_avx.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_src_avx2.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_src_fma.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_mixer.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_mixer_sse42.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_mixer_avx.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_mixer_avx2.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_mixer_fma.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_eq_fir.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_eq_fir_sse42.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_eq_fir_avx.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_eq_fir_avx2.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_eq_fir_fma.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_eq_iir.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_eq_iir_sse42.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_eq_iir_avx.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_eq_iir_avx2.dir/DependInfo.cmake"
+  "src/audio/CMakeFiles/sof_eq_iir_fma.dir/DependInfo.cmake"
+  )
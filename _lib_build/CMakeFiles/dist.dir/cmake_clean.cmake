@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "\$TARBALL_VERSION_BINARY_PATH"
+  "CMakeFiles/dist"
+  "sof-v0.0-0-g0000.tar"
+  "sof-v0.0-0-g0000.tgz"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/dist.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/genconfig"
+  "generated/include/config.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/genconfig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
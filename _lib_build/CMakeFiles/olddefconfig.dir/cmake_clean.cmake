@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/olddefconfig"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/olddefconfig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/savedefconfig"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/savedefconfig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,5 @@
+#define SOF_MAJOR 0
+#define SOF_MINOR 0
+#define SOF_MICRO 0
+#define SOF_TAG "0bd48"
+#define SOF_BUILD 1
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/math/fft.c" "src/audio/CMakeFiles/sof_eq_fir.dir/__/math/fft.c.o" "gcc" "src/audio/CMakeFiles/sof_eq_fir.dir/__/math/fft.c.o.d"
+  "/root/repo/src/math/fft_avx2.c" "src/audio/CMakeFiles/sof_eq_fir.dir/__/math/fft_avx2.c.o" "gcc" "src/audio/CMakeFiles/sof_eq_fir.dir/__/math/fft_avx2.c.o.d"
+  "/root/repo/src/math/fft_sse42.c" "src/audio/CMakeFiles/sof_eq_fir.dir/__/math/fft_sse42.c.o" "gcc" "src/audio/CMakeFiles/sof_eq_fir.dir/__/math/fft_sse42.c.o.d"
+  "/root/repo/src/audio/eq_fir.c" "src/audio/CMakeFiles/sof_eq_fir.dir/eq_fir.c.o" "gcc" "src/audio/CMakeFiles/sof_eq_fir.dir/eq_fir.c.o.d"
+  "/root/repo/src/audio/fir.c" "src/audio/CMakeFiles/sof_eq_fir.dir/fir.c.o" "gcc" "src/audio/CMakeFiles/sof_eq_fir.dir/fir.c.o.d"
+  "/root/repo/src/audio/fir_avx2.c" "src/audio/CMakeFiles/sof_eq_fir.dir/fir_avx2.c.o" "gcc" "src/audio/CMakeFiles/sof_eq_fir.dir/fir_avx2.c.o.d"
+  "/root/repo/src/audio/fir_fft.c" "src/audio/CMakeFiles/sof_eq_fir.dir/fir_fft.c.o" "gcc" "src/audio/CMakeFiles/sof_eq_fir.dir/fir_fft.c.o.d"
+  "/root/repo/src/audio/fir_sse42.c" "src/audio/CMakeFiles/sof_eq_fir.dir/fir_sse42.c.o" "gcc" "src/audio/CMakeFiles/sof_eq_fir.dir/fir_sse42.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sof_eq_fir.dir/__/math/fft.c.o"
+  "CMakeFiles/sof_eq_fir.dir/__/math/fft.c.o.d"
+  "CMakeFiles/sof_eq_fir.dir/__/math/fft_avx2.c.o"
+  "CMakeFiles/sof_eq_fir.dir/__/math/fft_avx2.c.o.d"
+  "CMakeFiles/sof_eq_fir.dir/__/math/fft_sse42.c.o"
+  "CMakeFiles/sof_eq_fir.dir/__/math/fft_sse42.c.o.d"
+  "CMakeFiles/sof_eq_fir.dir/eq_fir.c.o"
+  "CMakeFiles/sof_eq_fir.dir/eq_fir.c.o.d"
+  "CMakeFiles/sof_eq_fir.dir/fir.c.o"
+  "CMakeFiles/sof_eq_fir.dir/fir.c.o.d"
+  "CMakeFiles/sof_eq_fir.dir/fir_avx2.c.o"
+  "CMakeFiles/sof_eq_fir.dir/fir_avx2.c.o.d"
+  "CMakeFiles/sof_eq_fir.dir/fir_fft.c.o"
+  "CMakeFiles/sof_eq_fir.dir/fir_fft.c.o.d"
+  "CMakeFiles/sof_eq_fir.dir/fir_sse42.c.o"
+  "CMakeFiles/sof_eq_fir.dir/fir_sse42.c.o.d"
+  "libsof_eq_fir.pdb"
+  "libsof_eq_fir.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sof_eq_fir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,22 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/audio/src.c" "src/audio/CMakeFiles/sof_src.dir/src.c.o" "gcc" "src/audio/CMakeFiles/sof_src.dir/src.c.o.d"
+  "/root/repo/src/audio/src_avx2.c" "src/audio/CMakeFiles/sof_src.dir/src_avx2.c.o" "gcc" "src/audio/CMakeFiles/sof_src.dir/src_avx2.c.o.d"
+  "/root/repo/src/audio/src_generic.c" "src/audio/CMakeFiles/sof_src.dir/src_generic.c.o" "gcc" "src/audio/CMakeFiles/sof_src.dir/src_generic.c.o.d"
+  "/root/repo/src/audio/src_sse42.c" "src/audio/CMakeFiles/sof_src.dir/src_sse42.c.o" "gcc" "src/audio/CMakeFiles/sof_src.dir/src_sse42.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
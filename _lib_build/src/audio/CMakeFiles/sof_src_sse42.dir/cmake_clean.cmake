@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sof_src_sse42.dir/src.c.o"
+  "CMakeFiles/sof_src_sse42.dir/src.c.o.d"
+  "CMakeFiles/sof_src_sse42.dir/src_avx2.c.o"
+  "CMakeFiles/sof_src_sse42.dir/src_avx2.c.o.d"
+  "CMakeFiles/sof_src_sse42.dir/src_generic.c.o"
+  "CMakeFiles/sof_src_sse42.dir/src_generic.c.o.d"
+  "CMakeFiles/sof_src_sse42.dir/src_sse42.c.o"
+  "CMakeFiles/sof_src_sse42.dir/src_sse42.c.o.d"
+  "libsof_src_sse42.pdb"
+  "libsof_src_sse42.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sof_src_sse42.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sof_volume_fma.dir/volume.c.o"
+  "CMakeFiles/sof_volume_fma.dir/volume.c.o.d"
+  "CMakeFiles/sof_volume_fma.dir/volume_avx2.c.o"
+  "CMakeFiles/sof_volume_fma.dir/volume_avx2.c.o.d"
+  "CMakeFiles/sof_volume_fma.dir/volume_generic.c.o"
+  "CMakeFiles/sof_volume_fma.dir/volume_generic.c.o.d"
+  "CMakeFiles/sof_volume_fma.dir/volume_sse42.c.o"
+  "CMakeFiles/sof_volume_fma.dir/volume_sse42.c.o.d"
+  "libsof_volume_fma.pdb"
+  "libsof_volume_fma.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sof_volume_fma.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sof_ep"
+  "CMakeFiles/sof_ep-complete"
+  "sof_ep/install/lib/libsof.so"
+  "sof_ep/src/sof_ep-stamp/sof_ep-build"
+  "sof_ep/src/sof_ep-stamp/sof_ep-configure"
+  "sof_ep/src/sof_ep-stamp/sof_ep-defconfig"
+  "sof_ep/src/sof_ep-stamp/sof_ep-download"
+  "sof_ep/src/sof_ep-stamp/sof_ep-install"
+  "sof_ep/src/sof_ep-stamp/sof_ep-mkdir"
+  "sof_ep/src/sof_ep-stamp/sof_ep-patch"
+  "sof_ep/src/sof_ep-stamp/sof_ep-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/sof_ep.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/testbench/alloc.c" "CMakeFiles/testbench.dir/alloc.c.o" "gcc" "CMakeFiles/testbench.dir/alloc.c.o.d"
+  "/root/repo/tools/testbench/batch.c" "CMakeFiles/testbench.dir/batch.c.o" "gcc" "CMakeFiles/testbench.dir/batch.c.o.d"
+  "/root/repo/tools/testbench/common_test.c" "CMakeFiles/testbench.dir/common_test.c.o" "gcc" "CMakeFiles/testbench.dir/common_test.c.o.d"
+  "/root/repo/tools/testbench/core.c" "CMakeFiles/testbench.dir/core.c.o" "gcc" "CMakeFiles/testbench.dir/core.c.o.d"
+  "/root/repo/tools/testbench/edf_schedule.c" "CMakeFiles/testbench.dir/edf_schedule.c.o" "gcc" "CMakeFiles/testbench.dir/edf_schedule.c.o.d"
+  "/root/repo/tools/testbench/file.c" "CMakeFiles/testbench.dir/file.c.o" "gcc" "CMakeFiles/testbench.dir/file.c.o.d"
+  "/root/repo/tools/testbench/ipc.c" "CMakeFiles/testbench.dir/ipc.c.o" "gcc" "CMakeFiles/testbench.dir/ipc.c.o.d"
+  "/root/repo/tools/testbench/ll_schedule.c" "CMakeFiles/testbench.dir/ll_schedule.c.o" "gcc" "CMakeFiles/testbench.dir/ll_schedule.c.o.d"
+  "/root/repo/tools/testbench/panic.c" "CMakeFiles/testbench.dir/panic.c.o" "gcc" "CMakeFiles/testbench.dir/panic.c.o.d"
+  "/root/repo/tools/testbench/profiler.c" "CMakeFiles/testbench.dir/profiler.c.o" "gcc" "CMakeFiles/testbench.dir/profiler.c.o.d"
+  "/root/repo/tools/testbench/sched_bench.c" "CMakeFiles/testbench.dir/sched_bench.c.o" "gcc" "CMakeFiles/testbench.dir/sched_bench.c.o.d"
+  "/root/repo/tools/testbench/schedule.c" "CMakeFiles/testbench.dir/schedule.c.o" "gcc" "CMakeFiles/testbench.dir/schedule.c.o.d"
+  "/root/repo/tools/testbench/simd_check.c" "CMakeFiles/testbench.dir/simd_check.c.o" "gcc" "CMakeFiles/testbench.dir/simd_check.c.o.d"
+  "/root/repo/tools/testbench/testbench.c" "CMakeFiles/testbench.dir/testbench.c.o" "gcc" "CMakeFiles/testbench.dir/testbench.c.o.d"
+  "/root/repo/tools/testbench/topology.c" "CMakeFiles/testbench.dir/topology.c.o" "gcc" "CMakeFiles/testbench.dir/topology.c.o.d"
+  "/root/repo/tools/testbench/trace.c" "CMakeFiles/testbench.dir/trace.c.o" "gcc" "CMakeFiles/testbench.dir/trace.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
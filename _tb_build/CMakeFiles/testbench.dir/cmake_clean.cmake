@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/testbench.dir/alloc.c.o"
+  "CMakeFiles/testbench.dir/alloc.c.o.d"
+  "CMakeFiles/testbench.dir/batch.c.o"
+  "CMakeFiles/testbench.dir/batch.c.o.d"
+  "CMakeFiles/testbench.dir/common_test.c.o"
+  "CMakeFiles/testbench.dir/common_test.c.o.d"
+  "CMakeFiles/testbench.dir/core.c.o"
+  "CMakeFiles/testbench.dir/core.c.o.d"
+  "CMakeFiles/testbench.dir/edf_schedule.c.o"
+  "CMakeFiles/testbench.dir/edf_schedule.c.o.d"
+  "CMakeFiles/testbench.dir/file.c.o"
+  "CMakeFiles/testbench.dir/file.c.o.d"
+  "CMakeFiles/testbench.dir/ipc.c.o"
+  "CMakeFiles/testbench.dir/ipc.c.o.d"
+  "CMakeFiles/testbench.dir/ll_schedule.c.o"
+  "CMakeFiles/testbench.dir/ll_schedule.c.o.d"
+  "CMakeFiles/testbench.dir/panic.c.o"
+  "CMakeFiles/testbench.dir/panic.c.o.d"
+  "CMakeFiles/testbench.dir/profiler.c.o"
+  "CMakeFiles/testbench.dir/profiler.c.o.d"
+  "CMakeFiles/testbench.dir/sched_bench.c.o"
+  "CMakeFiles/testbench.dir/sched_bench.c.o.d"
+  "CMakeFiles/testbench.dir/schedule.c.o"
+  "CMakeFiles/testbench.dir/schedule.c.o.d"
+  "CMakeFiles/testbench.dir/simd_check.c.o"
+  "CMakeFiles/testbench.dir/simd_check.c.o.d"
+  "CMakeFiles/testbench.dir/testbench.c.o"
+  "CMakeFiles/testbench.dir/testbench.c.o.d"
+  "CMakeFiles/testbench.dir/topology.c.o"
+  "CMakeFiles/testbench.dir/topology.c.o.d"
+  "CMakeFiles/testbench.dir/trace.c.o"
+  "CMakeFiles/testbench.dir/trace.c.o.d"
+  "testbench"
+  "testbench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/testbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
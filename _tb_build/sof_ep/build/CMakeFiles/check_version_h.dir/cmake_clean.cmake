@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/check_version_h"
+  "generated/include/version.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/check_version_h.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
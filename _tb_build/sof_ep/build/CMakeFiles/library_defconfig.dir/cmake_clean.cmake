@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/library_defconfig"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/library_defconfig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
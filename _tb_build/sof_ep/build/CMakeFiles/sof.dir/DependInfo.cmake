@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/arch/host/cpu.c" "CMakeFiles/sof.dir/src/arch/host/cpu.c.o" "gcc" "CMakeFiles/sof.dir/src/arch/host/cpu.c.o.d"
+  "/root/repo/src/audio/buffer.c" "CMakeFiles/sof.dir/src/audio/buffer.c.o" "gcc" "CMakeFiles/sof.dir/src/audio/buffer.c.o.d"
+  "/root/repo/src/audio/component.c" "CMakeFiles/sof.dir/src/audio/component.c.o" "gcc" "CMakeFiles/sof.dir/src/audio/component.c.o.d"
+  "/root/repo/src/audio/pipeline.c" "CMakeFiles/sof.dir/src/audio/pipeline.c.o" "gcc" "CMakeFiles/sof.dir/src/audio/pipeline.c.o.d"
+  "/root/repo/src/ipc/batch.c" "CMakeFiles/sof.dir/src/ipc/batch.c.o" "gcc" "CMakeFiles/sof.dir/src/ipc/batch.c.o.d"
+  "/root/repo/src/ipc/ipc.c" "CMakeFiles/sof.dir/src/ipc/ipc.c.o" "gcc" "CMakeFiles/sof.dir/src/ipc/ipc.c.o.d"
+  "/root/repo/src/lib/edf_queue.c" "CMakeFiles/sof.dir/src/lib/edf_queue.c.o" "gcc" "CMakeFiles/sof.dir/src/lib/edf_queue.c.o.d"
+  "/root/repo/src/lib/lib.c" "CMakeFiles/sof.dir/src/lib/lib.c.o" "gcc" "CMakeFiles/sof.dir/src/lib/lib.c.o.d"
+  "/root/repo/src/lib/ll_wheel.c" "CMakeFiles/sof.dir/src/lib/ll_wheel.c.o" "gcc" "CMakeFiles/sof.dir/src/lib/ll_wheel.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sof.dir/src/arch/host/cpu.c.o"
+  "CMakeFiles/sof.dir/src/arch/host/cpu.c.o.d"
+  "CMakeFiles/sof.dir/src/audio/buffer.c.o"
+  "CMakeFiles/sof.dir/src/audio/buffer.c.o.d"
+  "CMakeFiles/sof.dir/src/audio/component.c.o"
+  "CMakeFiles/sof.dir/src/audio/component.c.o.d"
+  "CMakeFiles/sof.dir/src/audio/pipeline.c.o"
+  "CMakeFiles/sof.dir/src/audio/pipeline.c.o.d"
+  "CMakeFiles/sof.dir/src/ipc/batch.c.o"
+  "CMakeFiles/sof.dir/src/ipc/batch.c.o.d"
+  "CMakeFiles/sof.dir/src/ipc/ipc.c.o"
+  "CMakeFiles/sof.dir/src/ipc/ipc.c.o.d"
+  "CMakeFiles/sof.dir/src/lib/edf_queue.c.o"
+  "CMakeFiles/sof.dir/src/lib/edf_queue.c.o.d"
+  "CMakeFiles/sof.dir/src/lib/lib.c.o"
+  "CMakeFiles/sof.dir/src/lib/lib.c.o.d"
+  "CMakeFiles/sof.dir/src/lib/ll_wheel.c.o"
+  "CMakeFiles/sof.dir/src/lib/ll_wheel.c.o.d"
+  "libsof.pdb"
+  "libsof.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sof.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sof_eq_iir.dir/eq_iir.c.o"
+  "CMakeFiles/sof_eq_iir.dir/eq_iir.c.o.d"
+  "CMakeFiles/sof_eq_iir.dir/iir.c.o"
+  "CMakeFiles/sof_eq_iir.dir/iir.c.o.d"
+  "CMakeFiles/sof_eq_iir.dir/iir_avx2.c.o"
+  "CMakeFiles/sof_eq_iir.dir/iir_avx2.c.o.d"
+  "CMakeFiles/sof_eq_iir.dir/iir_sse42.c.o"
+  "CMakeFiles/sof_eq_iir.dir/iir_sse42.c.o.d"
+  "libsof_eq_iir.pdb"
+  "libsof_eq_iir.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sof_eq_iir.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sof_mixer_fma.dir/mixer.c.o"
+  "CMakeFiles/sof_mixer_fma.dir/mixer.c.o.d"
+  "CMakeFiles/sof_mixer_fma.dir/mixer_avx2.c.o"
+  "CMakeFiles/sof_mixer_fma.dir/mixer_avx2.c.o.d"
+  "CMakeFiles/sof_mixer_fma.dir/mixer_generic.c.o"
+  "CMakeFiles/sof_mixer_fma.dir/mixer_generic.c.o.d"
+  "CMakeFiles/sof_mixer_fma.dir/mixer_sse42.c.o"
+  "CMakeFiles/sof_mixer_fma.dir/mixer_sse42.c.o.d"
+  "libsof_mixer_fma.pdb"
+  "libsof_mixer_fma.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sof_mixer_fma.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
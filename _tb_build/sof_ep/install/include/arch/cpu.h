@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: Rander Wang <rander.wang@linux.intel.com>
+ *
+ */
+
+#ifndef __INCLUDE_ARCH_CPU__
+#define __INCLUDE_ARCH_CPU__
+
+#include <stdint.h>
+
+/* virtual core of the calling thread and the mask of enabled virtual cores,
+ * library users running several threads assign one core to each of them
+ */
+extern __thread int host_cpu_id;
+extern uint32_t host_cpu_enabled;
+
+static inline void arch_cpu_enable_core(int id)
+{
+	__sync_fetch_and_or(&host_cpu_enabled, 1 << id);
+}
+
+static inline void arch_cpu_disable_core(int id)
+{
+	__sync_fetch_and_and(&host_cpu_enabled, ~(1 << id));
+}
+
+static inline int arch_cpu_is_core_enabled(int id)
+{
+	return !!(host_cpu_enabled & (1 << id));
+}
+
+static inline int arch_cpu_get_id(void)
+{
+	return host_cpu_id;
+}
+
+static inline void arch_cpu_set_id(int id)
+{
+	host_cpu_id = id;
+}
+
+static inline void cpu_write_threadptr(int threadptr)
+{
+}
+
+static inline int cpu_read_threadptr(void)
+{
+	return 0;
+}
+
+#endif
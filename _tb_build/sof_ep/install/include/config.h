@@ -0,0 +1,18 @@
+/* Generated by Kconfiglib (https://github.com/ulfalizer/Kconfiglib) */
+#define CONFIG_LIBRARY 1
+#define CONFIG_FIRMWARE_SHORT_NAME ""
+#define CONFIG_COMP_DAI 1
+#define CONFIG_COMP_VOLUME 1
+#define CONFIG_COMP_SRC 1
+#define CONFIG_COMP_FIR 1
+#define CONFIG_COMP_IIR 1
+#define CONFIG_COMP_TONE 1
+#define CONFIG_COMP_MIXER 1
+#define CONFIG_COMP_MUX 1
+#define CONFIG_COMP_SWITCH 1
+#define CONFIG_COMP_KPB 1
+#define CONFIG_COMP_SEL 1
+#define CONFIG_COMP_TEST_KEYPHRASE 1
+#define CONFIG_TRACE 1
+#define CONFIG_TRACEE 1
+#define CONFIG_COMP_PERF 1
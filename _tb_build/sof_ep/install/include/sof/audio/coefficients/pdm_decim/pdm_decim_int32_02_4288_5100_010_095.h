@@ -0,0 +1,98 @@
+const int32_t fir_int32_02_4288_5100_010_095[91] = {
+	-193886,
+	104552,
+	2140521,
+	5355562,
+	5945318,
+	1216991,
+	-4511367,
+	-3527243,
+	3415937,
+	5526880,
+	-1935806,
+	-7515849,
+	-386524,
+	9252379,
+	3862172,
+	-10093681,
+	-8251552,
+	9738620,
+	13536988,
+	-7464432,
+	-19100785,
+	2935187,
+	24375729,
+	4314479,
+	-28271418,
+	-14141458,
+	29999307,
+	26636531,
+	-28180625,
+	-41208987,
+	21649022,
+	57264356,
+	-8757879,
+	-73520802,
+	-12043366,
+	88868414,
+	43784598,
+	-101162825,
+	-91853580,
+	106519993,
+	169110273,
+	-94206010,
+	-317139630,
+	5894310,
+	739661049,
+	1132200744,
+	739661049,
+	5894310,
+	-317139630,
+	-94206010,
+	169110273,
+	106519993,
+	-91853580,
+	-101162825,
+	43784598,
+	88868414,
+	-12043366,
+	-73520802,
+	-8757879,
+	57264356,
+	21649022,
+	-41208987,
+	-28180625,
+	26636531,
+	29999307,
+	-14141458,
+	-28271418,
+	4314479,
+	24375729,
+	2935187,
+	-19100785,
+	-7464432,
+	13536988,
+	9738620,
+	-8251552,
+	-10093681,
+	3862172,
+	9252379,
+	-386524,
+	-7515849,
+	-1935806,
+	5526880,
+	3415937,
+	-3527243,
+	-4511367,
+	1216991,
+	5945318,
+	5355562,
+	2140521,
+	104552,
+	-193886
+
+};
+
+struct pdm_decim pdm_decim_int32_02_4288_5100_010_095 = {
+	2, 91, 0, 4288, 5100, 10, 95, fir_int32_02_4288_5100_010_095
+};
@@ -0,0 +1,254 @@
+const int32_t fir_int32_08_4156_5380_010_090[247] = {
+	-337052,
+	-90075,
+	37780,
+	310298,
+	762602,
+	1418014,
+	2279975,
+	3324413,
+	4495298,
+	5703536,
+	6831280,
+	7740936,
+	8289504,
+	8346168,
+	7812523,
+	6641741,
+	4854841,
+	2549644,
+	-98570,
+	-2847418,
+	-5407472,
+	-7472951,
+	-8758755,
+	-9040926,
+	-8192669,
+	-6213693,
+	-3246278,
+	424677,
+	4395972,
+	8180309,
+	11265189,
+	13176475,
+	13545386,
+	12170147,
+	9059463,
+	4454447,
+	-1180491,
+	-7196755,
+	-12830960,
+	-17296055,
+	-19885729,
+	-20077500,
+	-17621714,
+	-12601266,
+	-5452197,
+	3062539,
+	11925735,
+	19980775,
+	26075722,
+	29220338,
+	28734576,
+	24368837,
+	16375791,
+	5519930,
+	-6982346,
+	-19587960,
+	-30609997,
+	-38433685,
+	-41741838,
+	-39718804,
+	-32202058,
+	-19758650,
+	-3667506,
+	14195787,
+	31565234,
+	46060011,
+	55497992,
+	58207057,
+	53292128,
+	40817642,
+	21874421,
+	-1487369,
+	-26460171,
+	-49799428,
+	-68227825,
+	-78875217,
+	-79697543,
+	-69816864,
+	-49730377,
+	-21350328,
+	12143051,
+	46630130,
+	77532435,
+	100390923,
+	111473843,
+	108334402,
+	90240198,
+	58408793,
+	16001822,
+	-32138446,
+	-79996329,
+	-121085165,
+	-149268412,
+	-159601418,
+	-149086287,
+	-117235239,
+	-66355092,
+	-1494553,
+	69965597,
+	139055884,
+	196228005,
+	232526458,
+	240790250,
+	216740138,
+	159811182,
+	73611998,
+	-34070591,
+	-151754583,
+	-265210746,
+	-358796902,
+	-417052464,
+	-426388521,
+	-376691518,
+	-262659116,
+	-84707915,
+	150664267,
+	431125422,
+	739363099,
+	1054476937,
+	1353781691,
+	1614844650,
+	1817552687,
+	1945997296,
+	1989982406,
+	1945997296,
+	1817552687,
+	1614844650,
+	1353781691,
+	1054476937,
+	739363099,
+	431125422,
+	150664267,
+	-84707915,
+	-262659116,
+	-376691518,
+	-426388521,
+	-417052464,
+	-358796902,
+	-265210746,
+	-151754583,
+	-34070591,
+	73611998,
+	159811182,
+	216740138,
+	240790250,
+	232526458,
+	196228005,
+	139055884,
+	69965597,
+	-1494553,
+	-66355092,
+	-117235239,
+	-149086287,
+	-159601418,
+	-149268412,
+	-121085165,
+	-79996329,
+	-32138446,
+	16001822,
+	58408793,
+	90240198,
+	108334402,
+	111473843,
+	100390923,
+	77532435,
+	46630130,
+	12143051,
+	-21350328,
+	-49730377,
+	-69816864,
+	-79697543,
+	-78875217,
+	-68227825,
+	-49799428,
+	-26460171,
+	-1487369,
+	21874421,
+	40817642,
+	53292128,
+	58207057,
+	55497992,
+	46060011,
+	31565234,
+	14195787,
+	-3667506,
+	-19758650,
+	-32202058,
+	-39718804,
+	-41741838,
+	-38433685,
+	-30609997,
+	-19587960,
+	-6982346,
+	5519930,
+	16375791,
+	24368837,
+	28734576,
+	29220338,
+	26075722,
+	19980775,
+	11925735,
+	3062539,
+	-5452197,
+	-12601266,
+	-17621714,
+	-20077500,
+	-19885729,
+	-17296055,
+	-12830960,
+	-7196755,
+	-1180491,
+	4454447,
+	9059463,
+	12170147,
+	13545386,
+	13176475,
+	11265189,
+	8180309,
+	4395972,
+	424677,
+	-3246278,
+	-6213693,
+	-8192669,
+	-9040926,
+	-8758755,
+	-7472951,
+	-5407472,
+	-2847418,
+	-98570,
+	2549644,
+	4854841,
+	6641741,
+	7812523,
+	8346168,
+	8289504,
+	7740936,
+	6831280,
+	5703536,
+	4495298,
+	3324413,
+	2279975,
+	1418014,
+	762602,
+	310298,
+	37780,
+	-90075,
+	-337052
+
+};
+
+struct pdm_decim pdm_decim_int32_08_4156_5380_010_090 = {
+	8, 247, 3, 4156, 5380, 10, 90, fir_int32_08_4156_5380_010_090
+};
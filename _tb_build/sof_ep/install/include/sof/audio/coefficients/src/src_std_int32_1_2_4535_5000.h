@@ -0,0 +1,207 @@
+const int32_t src_int32_1_2_4535_5000_fir[200] = {
+	-84357,
+	50235,
+	139225,
+	-48832,
+	-208849,
+	31015,
+	292130,
+	9590,
+	-386259,
+	-79637,
+	486442,
+	185624,
+	-585693,
+	-333361,
+	674732,
+	527362,
+	-742023,
+	-770180,
+	773956,
+	1061730,
+	-755206,
+	-1398622,
+	669274,
+	1773556,
+	-499206,
+	-2174817,
+	228488,
+	2585926,
+	157912,
+	-2985478,
+	-672373,
+	3347216,
+	1323382,
+	-3640362,
+	-2114262,
+	3830245,
+	3041930,
+	-3879209,
+	-4095751,
+	3747828,
+	5256550,
+	-3396388,
+	-6495849,
+	2786607,
+	7775375,
+	-1883559,
+	-9046916,
+	657725,
+	10252525,
+	912889,
+	-11325125,
+	-2840649,
+	12189498,
+	5126279,
+	-12763649,
+	-7757029,
+	12960492,
+	10705076,
+	-12689800,
+	-13926242,
+	11860314,
+	17359034,
+	-10381891,
+	-20924044,
+	8167534,
+	24523651,
+	-5135106,
+	-28041936,
+	1208493,
+	31344654,
+	3682116,
+	-34278963,
+	-9601236,
+	36672451,
+	16611018,
+	-38330725,
+	-24777037,
+	39032330,
+	34178514,
+	-38518842,
+	-44925759,
+	36476272,
+	57190086,
+	-32500220,
+	-71256846,
+	26029055,
+	87624811,
+	-16209471,
+	-107207496,
+	1604602,
+	131785695,
+	20513896,
+	-165179166,
+	-56184685,
+	216966918,
+	122162882,
+	-318949380,
+	-288878358,
+	673275541,
+	1754385456,
+	1754385456,
+	673275541,
+	-288878358,
+	-318949380,
+	122162882,
+	216966918,
+	-56184685,
+	-165179166,
+	20513896,
+	131785695,
+	1604602,
+	-107207496,
+	-16209471,
+	87624811,
+	26029055,
+	-71256846,
+	-32500220,
+	57190086,
+	36476272,
+	-44925759,
+	-38518842,
+	34178514,
+	39032330,
+	-24777037,
+	-38330725,
+	16611018,
+	36672451,
+	-9601236,
+	-34278963,
+	3682116,
+	31344654,
+	1208493,
+	-28041936,
+	-5135106,
+	24523651,
+	8167534,
+	-20924044,
+	-10381891,
+	17359034,
+	11860314,
+	-13926242,
+	-12689800,
+	10705076,
+	12960492,
+	-7757029,
+	-12763649,
+	5126279,
+	12189498,
+	-2840649,
+	-11325125,
+	912889,
+	10252525,
+	657725,
+	-9046916,
+	-1883559,
+	7775375,
+	2786607,
+	-6495849,
+	-3396388,
+	5256550,
+	3747828,
+	-4095751,
+	-3879209,
+	3041930,
+	3830245,
+	-2114262,
+	-3640362,
+	1323382,
+	3347216,
+	-672373,
+	-2985478,
+	157912,
+	2585926,
+	228488,
+	-2174817,
+	-499206,
+	1773556,
+	669274,
+	-1398622,
+	-755206,
+	1061730,
+	773956,
+	-770180,
+	-742023,
+	527362,
+	674732,
+	-333361,
+	-585693,
+	185624,
+	486442,
+	-79637,
+	-386259,
+	9590,
+	292130,
+	31015,
+	-208849,
+	-48832,
+	139225,
+	50235,
+	-84357
+
+};
+
+struct src_stage src_int32_1_2_4535_5000 = {
+	1, 0, 1, 200, 200, 2, 1, 0, 1,
+	src_int32_1_2_4535_5000_fir};
@@ -0,0 +1,63 @@
+const int32_t src_int32_1_3_2268_5000_fir[56] = {
+	636662,
+	1367445,
+	1168433,
+	-1113091,
+	-5228555,
+	-8512773,
+	-6739201,
+	2764092,
+	17380905,
+	28046417,
+	23219492,
+	-2711393,
+	-41479156,
+	-70267160,
+	-62272596,
+	-5253484,
+	82664699,
+	152749385,
+	147216043,
+	35627282,
+	-153131824,
+	-325316190,
+	-354264540,
+	-140373711,
+	329128823,
+	953901216,
+	1547192859,
+	1908310509,
+	1908310509,
+	1547192859,
+	953901216,
+	329128823,
+	-140373711,
+	-354264540,
+	-325316190,
+	-153131824,
+	35627282,
+	147216043,
+	152749385,
+	82664699,
+	-5253484,
+	-62272596,
+	-70267160,
+	-41479156,
+	-2711393,
+	23219492,
+	28046417,
+	17380905,
+	2764092,
+	-6739201,
+	-8512773,
+	-5228555,
+	-1113091,
+	1168433,
+	1367445,
+	636662
+
+};
+
+struct src_stage src_int32_1_3_2268_5000 = {
+	1, 0, 1, 56, 56, 3, 1, 0, 2,
+	src_int32_1_3_2268_5000_fir};
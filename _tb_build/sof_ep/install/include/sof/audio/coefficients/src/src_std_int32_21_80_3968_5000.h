@@ -0,0 +1,3115 @@
+const int32_t src_int32_21_80_3968_5000_fir[3108] = {
+	-174020,
+	2072,
+	309190,
+	579170,
+	583165,
+	181370,
+	-533203,
+	-1205646,
+	-1366812,
+	-714209,
+	624451,
+	2030368,
+	2639131,
+	1821890,
+	-343787,
+	-2920099,
+	-4456245,
+	-3748695,
+	-643361,
+	3608207,
+	6765100,
+	6711176,
+	2748086,
+	-3674464,
+	-9351056,
+	-10836927,
+	-6417466,
+	2543519,
+	11792440,
+	16095193,
+	12074481,
+	494763,
+	-13429257,
+	-22227839,
+	-20045030,
+	-6245388,
+	13349231,
+	28688687,
+	30482787,
+	15558759,
+	-10386005,
+	-34594599,
+	-43305209,
+	-29292194,
+	3109533,
+	38680234,
+	58154570,
+	48319821,
+	10239727,
+	-39223396,
+	-74396147,
+	-73663155,
+	-31985716,
+	33847984,
+	91162794,
+	106909715,
+	65715182,
+	-18938394,
+	-107454682,
+	-151410356,
+	-118371595,
+	-12235355,
+	122320493,
+	216139710,
+	207609646,
+	76739873,
+	-135275589,
+	-332720960,
+	-398888877,
+	-244584332,
+	148471892,
+	709051931,
+	1293005303,
+	1730772532,
+	1888050617,
+	1715492023,
+	1267210683,
+	680494707,
+	125055954,
+	-257543957,
+	-400250100,
+	-325397517,
+	-124600270,
+	85382191,
+	210855178,
+	213617932,
+	116260374,
+	-18423772,
+	-121799914,
+	-150923731,
+	-103888170,
+	-14435239,
+	68886771,
+	107432444,
+	89156327,
+	30616396,
+	-34730899,
+	-74670859,
+	-73412085,
+	-36981839,
+	12496053,
+	49502428,
+	57833271,
+	37205792,
+	1343706,
+	-30459146,
+	-43388909,
+	-33698160,
+	-9072988,
+	16598459,
+	30784459,
+	28208054,
+	12426793,
+	-7102610,
+	-20432959,
+	-22027183,
+	-12822825,
+	1154639,
+	12462102,
+	16065838,
+	11425282,
+	2068633,
+	-6754607,
+	-10897239,
+	-9152160,
+	-3356154,
+	3012454,
+	6804759,
+	6674439,
+	3411169,
+	-832269,
+	-3840953,
+	-4427416,
+	-2809071,
+	-220985,
+	1895445,
+	2639632,
+	1974702,
+	552701,
+	-763883,
+	-1376540,
+	-1181651,
+	-496506,
+	209430,
+	591796,
+	570608,
+	293649,
+	-10109,
+	-169654,
+	14579,
+	324661,
+	587113,
+	573566,
+	152547,
+	-569829,
+	-1228449,
+	-1355152,
+	-662878,
+	696407,
+	2084183,
+	2635254,
+	1745102,
+	-467629,
+	-3028723,
+	-4479778,
+	-3650713,
+	-451648,
+	3802745,
+	6848197,
+	6608293,
+	2477779,
+	-3991142,
+	-9540108,
+	-10762602,
+	-6069434,
+	3019269,
+	12148018,
+	16104839,
+	11668811,
+	-170901,
+	-14023757,
+	-22402546,
+	-19629446,
+	-5374152,
+	14261890,
+	29137382,
+	30141408,
+	14492621,
+	-11695318,
+	-35454596,
+	-43167648,
+	-28081321,
+	4883400,
+	40116987,
+	58406535,
+	47069953,
+	7955765,
+	-41431778,
+	-75295470,
+	-72558185,
+	-29182498,
+	37060400,
+	93071488,
+	106252049,
+	62439724,
+	-23452184,
+	-110917021,
+	-151715112,
+	-114769268,
+	-5977446,
+	128286881,
+	218421172,
+	204074456,
+	67902542,
+	-145922238,
+	-339741405,
+	-397013681,
+	-231065496,
+	172282288,
+	737667305,
+	1318461497,
+	1745400155,
+	1887282138,
+	1699569792,
+	1241095777,
+	652014101,
+	102046838,
+	-269941809,
+	-401104289,
+	-317783643,
+	-113908907,
+	93821678,
+	213810297,
+	210861178,
+	110114600,
+	-24535907,
+	-125051560,
+	-150257274,
+	-100222584,
+	-9948078,
+	71951409,
+	107820560,
+	87055201,
+	27369692,
+	-37415101,
+	-75580725,
+	-72345046,
+	-34710059,
+	14722172,
+	50616776,
+	57443489,
+	35695713,
+	-411974,
+	-31581045,
+	-43419007,
+	-32766626,
+	-7757902,
+	17610627,
+	31046333,
+	27696300,
+	11495779,
+	-7944864,
+	-20792961,
+	-21801019,
+	-12205300,
+	1807957,
+	12831338,
+	16016970,
+	11047094,
+	1595192,
+	-7080533,
+	-10943585,
+	-8943753,
+	-3036621,
+	3270608,
+	6889015,
+	6576403,
+	3211903,
+	-1018163,
+	-3927433,
+	-4393383,
+	-2695808,
+	-99366,
+	1965711,
+	2636800,
+	1917279,
+	481247,
+	-811859,
+	-1384352,
+	-1156517,
+	-459790,
+	236701,
+	599466,
+	561450,
+	278062,
+	-21955,
+	-164884,
+	27398,
+	340037,
+	594411,
+	562996,
+	122987,
+	-606334,
+	-1250011,
+	-1341546,
+	-609934,
+	768476,
+	2136051,
+	2627964,
+	1665140,
+	-592363,
+	-3134776,
+	-4497923,
+	-3547071,
+	-257344,
+	3994510,
+	6923552,
+	6496149,
+	2201817,
+	-4305773,
+	-9718988,
+	-10674235,
+	-5710854,
+	3495296,
+	12491476,
+	16094605,
+	11245454,
+	-841570,
+	-14605495,
+	-22550891,
+	-19186517,
+	-4489878,
+	15163567,
+	29553356,
+	29760464,
+	13401177,
+	-12999285,
+	-36276842,
+	-42976028,
+	-26827725,
+	6663178,
+	41514032,
+	58588395,
+	45753913,
+	5646786,
+	-43604053,
+	-76108381,
+	-71356645,
+	-26324277,
+	40249583,
+	94879391,
+	105459282,
+	59063627,
+	-27971197,
+	-114270173,
+	-151836167,
+	-110995829,
+	343024,
+	134151501,
+	220457201,
+	200250705,
+	58878321,
+	-156527474,
+	-346446433,
+	-394617965,
+	-216990506,
+	196474373,
+	766322217,
+	1343561312,
+	1759364194,
+	1885745746,
+	1683017458,
+	1214678903,
+	623628423,
+	79456499,
+	-281775819,
+	-401458759,
+	-309892037,
+	-103213987,
+	102050826,
+	216474583,
+	207875010,
+	103891271,
+	-30565116,
+	-128124096,
+	-149413214,
+	-96463103,
+	-5482211,
+	74906162,
+	108074549,
+	84862627,
+	24111919,
+	-40035474,
+	-76392303,
+	-71196884,
+	-32411027,
+	16915569,
+	51661956,
+	56986155,
+	34152079,
+	-2155427,
+	-32656819,
+	-43395828,
+	-31801375,
+	-6442373,
+	18594212,
+	31268364,
+	27154273,
+	10557395,
+	-8771224,
+	-21124798,
+	-21549818,
+	-11577527,
+	2453962,
+	13181878,
+	15948805,
+	10658434,
+	1123771,
+	-7394934,
+	-10976029,
+	-8726180,
+	-2716276,
+	3522285,
+	6963927,
+	6471188,
+	3010682,
+	-1200841,
+	-4008088,
+	-4354248,
+	-2580478,
+	20928,
+	2032639,
+	2630681,
+	1858198,
+	410177,
+	-858100,
+	-1390267,
+	-1130293,
+	-423103,
+	263160,
+	606182,
+	551722,
+	262452,
+	-33454,
+	-159708,
+	40517,
+	355291,
+	601041,
+	551450,
+	92717,
+	-642666,
+	-1270284,
+	-1325984,
+	-555424,
+	840566,
+	2185878,
+	2617227,
+	1582068,
+	-717840,
+	-3238094,
+	-4510600,
+	-3437840,
+	-60668,
+	4183232,
+	6990992,
+	6374798,
+	1920494,
+	-4617944,
+	-9887382,
+	-10571811,
+	-5342082,
+	3971009,
+	12822287,
+	16064343,
+	10804797,
+	-1516449,
+	-15173649,
+	-22672490,
+	-18716589,
+	-3593567,
+	16053068,
+	29935860,
+	29340149,
+	12285599,
+	-14296258,
+	-37060062,
+	-42730219,
+	-25532661,
+	8446715,
+	42869384,
+	58699460,
+	44372877,
+	3315458,
+	-45737316,
+	-76833304,
+	-70059355,
+	-23414178,
+	43411473,
+	96583585,
+	104531413,
+	55590267,
+	-32489974,
+	-117509216,
+	-151771894,
+	-107054400,
+	6718989,
+	139906360,
+	222242918,
+	196139828,
+	49675632,
+	-167078441,
+	-352823780,
+	-391695573,
+	-202362910,
+	221034983,
+	794997929,
+	1368287005,
+	1772654426,
+	1883442578,
+	1665847086,
+	1187978540,
+	595355810,
+	57296468,
+	-293044405,
+	-401321193,
+	-301735517,
+	-92527857,
+	110062444,
+	218847948,
+	204665199,
+	97598507,
+	-36504910,
+	-131015317,
+	-148393977,
+	-92614979,
+	-1042875,
+	77748253,
+	108195053,
+	82581899,
+	20847109,
+	-42589264,
+	-77105264,
+	-69969537,
+	-30087724,
+	19073785,
+	52637149,
+	56462273,
+	32577001,
+	-3884603,
+	-33685460,
+	-43319760,
+	-30803822,
+	-5128019,
+	19548206,
+	31450561,
+	26582856,
+	9612848,
+	-9580789,
+	-21428270,
+	-21274078,
+	-10940359,
+	3091913,
+	13513437,
+	15861584,
+	10259869,
+	654937,
+	-7697519,
+	-10994654,
+	-8499794,
+	-2395525,
+	3767231,
+	7029492,
+	6358995,
+	2807778,
+	-1380108,
+	-4082878,
+	-4310117,
+	-2463251,
+	139761,
+	2096185,
+	2621323,
+	1797556,
+	339579,
+	-902568,
+	-1394305,
+	-1103032,
+	-386496,
+	288786,
+	611954,
+	541450,
+	246845,
+	-44597,
+	-154123,
+	53922,
+	370400,
+	606980,
+	538927,
+	61768,
+	-678772,
+	-1289220,
+	-1308457,
+	-499398,
+	912583,
+	2233574,
+	2603013,
+	1495955,
+	-843907,
+	-3338512,
+	-4517730,
+	-3323098,
+	138155,
+	4368641,
+	7050353,
+	6244302,
+	1634114,
+	-4927240,
+	-10044984,
+	-10455337,
+	-4963493,
+	4445809,
+	13139933,
+	16013928,
+	10347251,
+	-2194733,
+	-15727409,
+	-22766991,
+	-18220046,
+	-2686241,
+	16929202,
+	30284184,
+	28880703,
+	11147097,
+	-15584589,
+	-37803026,
+	-42430158,
+	-24197446,
+	10231840,
+	44181098,
+	58739120,
+	42928109,
+	964494,
+	-47828689,
+	-77468759,
+	-68667253,
+	-20455405,
+	46542015,
+	98181260,
+	103468604,
+	52023161,
+	-37003017,
+	-120629331,
+	-151520875,
+	-102948331,
+	13143258,
+	145543522,
+	223773686,
+	191743604,
+	40303193,
+	-177562183,
+	-358861358,
+	-388240757,
+	-187186748,
+	245950569,
+	823675590,
+	1392621054,
+	1785261111,
+	1880374334,
+	1648071177,
+	1161013308,
+	567214212,
+	35577851,
+	-303746476,
+	-400699636,
+	-293327010,
+	-81862706,
+	117849660,
+	220930639,
+	201237722,
+	91244435,
+	-42348960,
+	-133723252,
+	-147202177,
+	-88683530,
+	3364764,
+	80475057,
+	108182872,
+	80216398,
+	17579276,
+	-45073817,
+	-77719403,
+	-68665028,
+	-27743144,
+	21194421,
+	53541628,
+	55872924,
+	30972611,
+	-5597481,
+	-34666025,
+	-43191253,
+	-29775407,
+	-3816442,
+	20471644,
+	31592979,
+	25982958,
+	8663344,
+	-10372685,
+	-21703214,
+	-20974323,
+	-10294654,
+	3721086,
+	13825756,
+	15755568,
+	9851974,
+	189250,
+	-7988014,
+	-10999556,
+	-8264955,
+	-2074770,
+	4005205,
+	7085717,
+	6240034,
+	2603462,
+	-1555772,
+	-4151771,
+	-4261101,
+	-2344298,
+	256999,
+	2156309,
+	2608781,
+	1735452,
+	269537,
+	-945232,
+	-1396490,
+	-1074788,
+	-350017,
+	313557,
+	616791,
+	530660,
+	231263,
+	-55376,
+	-148128,
+	67601,
+	385335,
+	612205,
+	525425,
+	30170,
+	-714599,
+	-1306771,
+	-1288957,
+	-441908,
+	984430,
+	2279046,
+	2585296,
+	1406875,
+	-970410,
+	-3435869,
+	-4519243,
+	-3202933,
+	338894,
+	4550469,
+	7101481,
+	6104740,
+	1342989,
+	-5233246,
+	-10191500,
+	-10324835,
+	-4575476,
+	4919096,
+	13443909,
+	15943261,
+	9873252,
+	-2875603,
+	-16265978,
+	-22834073,
+	-17697304,
+	-1768944,
+	17790790,
+	30597652,
+	28382420,
+	9986919,
+	-16862627,
+	-38504540,
+	-42075845,
+	-22823454,
+	12016366,
+	45447269,
+	58706851,
+	41420960,
+	-1403348,
+	-49875325,
+	-78013364,
+	-67181404,
+	-17451248,
+	49637165,
+	99669713,
+	102271184,
+	48365967,
+	-41504793,
+	-123625800,
+	-151081901,
+	-98681193,
+	19608519,
+	151055117,
+	225045118,
+	187064156,
+	30770009,
+	-187965661,
+	-364547261,
+	-384248181,
+	-171466554,
+	271207207,
+	852336251,
+	1416546174,
+	1797175004,
+	1876543281,
+	1629702653,
+	1133801958,
+	539221377,
+	14311316,
+	-313881429,
+	-399602479,
+	-284679533,
+	-71230556,
+	125405926,
+	222723227,
+	197598748,
+	84837182,
+	-48091102,
+	-136246159,
+	-145840613,
+	-84674134,
+	7735617,
+	83084108,
+	108038959,
+	77769583,
+	14312411,
+	-47486579,
+	-78234634,
+	-67285461,
+	-25380287,
+	23275137,
+	54374756,
+	55219262,
+	29341067,
+	-7292076,
+	-35597637,
+	-43010818,
+	-28717602,
+	-2509233,
+	21363603,
+	31695722,
+	25355520,
+	7710087,
+	-11146066,
+	-21949502,
+	-20651102,
+	-9641274,
+	4340772,
+	14118601,
+	15631040,
+	9435331,
+	-272740,
+	-8266163,
+	-10990851,
+	-8022031,
+	-1754412,
+	4235974,
+	7132623,
+	6114521,
+	2398005,
+	-1727652,
+	-4214746,
+	-4207315,
+	-2223788,
+	372511,
+	2212975,
+	2593110,
+	1671985,
+	200134,
+	-986061,
+	-1396846,
+	-1045612,
+	-313711,
+	337456,
+	620703,
+	519377,
+	215729,
+	-65782,
+	-141722,
+	81537,
+	400073,
+	616694,
+	510946,
+	-2045,
+	-750093,
+	-1322893,
+	-1267483,
+	-383009,
+	1056012,
+	2322208,
+	2564054,
+	1314907,
+	-1097190,
+	-3530005,
+	-4515075,
+	-3077438,
+	541315,
+	4728448,
+	7144230,
+	5956198,
+	1047442,
+	-5535547,
+	-10326646,
+	-10180346,
+	-4178435,
+	5390266,
+	13733725,
+	15852265,
+	9383258,
+	-3558233,
+	-16788571,
+	-22873446,
+	-17148818,
+	-842739,
+	18636658,
+	30875628,
+	27845643,
+	8806345,
+	-18128725,
+	-39163457,
+	-41667351,
+	-21412117,
+	13798092,
+	46666035,
+	58602215,
+	39852867,
+	-3785277,
+	-51874415,
+	-78465843,
+	-65602993,
+	-14405070,
+	52692893,
+	101046357,
+	100939645,
+	44622477,
+	-45989741,
+	-126494020,
+	-150453982,
+	-94256779,
+	26107348,
+	156433346,
+	226053083,
+	182103950,
+	21085363,
+	-198275757,
+	-369869782,
+	-379712929,
+	-155207354,
+	296790608,
+	880960885,
+	1440045334,
+	1808387357,
+	1871952246,
+	1610754851,
+	1106363351,
+	511394836,
+	-6492911,
+	-323449144,
+	-398038453,
+	-275806185,
+	-60643254,
+	132725024,
+	224226607,
+	193754630,
+	78384864,
+	-53725345,
+	-138582533,
+	-144312264,
+	-80592219,
+	12064675,
+	85573100,
+	107764420,
+	75244989,
+	11050474,
+	-49825104,
+	-78650994,
+	-65833015,
+	-23002153,
+	25313659,
+	55135987,
+	54502511,
+	27684542,
+	-8966435,
+	-36479483,
+	-42779028,
+	-27631903,
+	-1207963,
+	22223209,
+	31758943,
+	24701508,
+	6754275,
+	-11900117,
+	-22167044,
+	-20304992,
+	-8981083,
+	4950280,
+	14391765,
+	15488303,
+	9010527,
+	-730491,
+	-8531725,
+	-10968667,
+	-7771397,
+	-1434846,
+	4459319,
+	7170240,
+	5982678,
+	2191676,
+	-1895570,
+	-4271785,
+	-4148881,
+	-2101894,
+	486170,
+	2266155,
+	2574371,
+	1607255,
+	131452,
+	-1025029,
+	-1395401,
+	-1015559,
+	-277626,
+	360465,
+	623704,
+	507628,
+	200265,
+	-75808,
+	-134905,
+	95714,
+	414585,
+	620425,
+	495490,
+	-34843,
+	-785201,
+	-1337541,
+	-1244032,
+	-322758,
+	1127230,
+	2362972,
+	2539271,
+	1220134,
+	-1224088,
+	-3620763,
+	-4505169,
+	-2946717,
+	745179,
+	4902315,
+	7178463,
+	5798779,
+	747803,
+	-5833730,
+	-10450151,
+	-10021928,
+	-3772790,
+	5858714,
+	14008901,
+	15740892,
+	8877754,
+	-4241788,
+	-17294414,
+	-22884852,
+	-16575077,
+	91290,
+	19465647,
+	31117517,
+	27270765,
+	7606694,
+	-19381236,
+	-39778673,
+	-41204812,
+	-19964922,
+	15574807,
+	47835580,
+	58424858,
+	38225349,
+	-6178460,
+	-53823189,
+	-78825021,
+	-63933323,
+	-11320314,
+	55705190,
+	102308723,
+	99474647,
+	40796614,
+	-50452279,
+	-129229505,
+	-149636343,
+	-89679101,
+	32632218,
+	161670499,
+	226793717,
+	176865800,
+	11258817,
+	-208479294,
+	-374817425,
+	-374630515,
+	-138414660,
+	322686129,
+	909530396,
+	1463101766,
+	1818889935,
+	1866604620,
+	1591241508,
+	1078716445,
+	483751890,
+	-26825053,
+	-332449982,
+	-396016617,
+	-266720130,
+	-50112458,
+	139801064,
+	225441996,
+	189711902,
+	71895577,
+	-59245875,
+	-140731099,
+	-142620283,
+	-76443262,
+	16347017,
+	87939886,
+	107360509,
+	72646217,
+	7797395,
+	-52087049,
+	-78968638,
+	-64309944,
+	-20611744,
+	27307780,
+	55824868,
+	53723965,
+	26005229,
+	-10618645,
+	-37310818,
+	-42496512,
+	-26519831,
+	85811,
+	23049632,
+	31782842,
+	24021914,
+	5797102,
+	-12634051,
+	-22355784,
+	-19936591,
+	-8314948,
+	5548938,
+	14645067,
+	15327681,
+	8578156,
+	-1183473,
+	-8784481,
+	-10933152,
+	-7513433,
+	-1116462,
+	4675030,
+	7198612,
+	5844733,
+	1984744,
+	-2059357,
+	-4322882,
+	-4085924,
+	-1978784,
+	597855,
+	2315822,
+	2552627,
+	1541363,
+	63570,
+	-1062113,
+	-1392184,
+	-984684,
+	-241807,
+	382569,
+	625807,
+	495440,
+	184892,
+	-85448,
+	-127677,
+	110117,
+	428846,
+	623378,
+	479063,
+	-68188,
+	-819868,
+	-1350672,
+	-1218607,
+	-261217,
+	1197987,
+	2401253,
+	2510935,
+	1122645,
+	-1350942,
+	-3707989,
+	-4489473,
+	-2810880,
+	950242,
+	5071808,
+	7204053,
+	5632596,
+	444411,
+	-6127383,
+	-10561757,
+	-9849657,
+	-3358975,
+	6323830,
+	14268974,
+	15609115,
+	8357246,
+	-4925426,
+	-17782754,
+	-22868066,
+	-15976606,
+	1032043,
+	20276609,
+	31322762,
+	26658227,
+	6389314,
+	-20618522,
+	-40349131,
+	-40688432,
+	-18483410,
+	17344289,
+	48954137,
+	58174514,
+	36540012,
+	-8580036,
+	-55718919,
+	-79089829,
+	-62173823,
+	-8200487,
+	58670072,
+	103454461,
+	97877014,
+	36892431,
+	-54886810,
+	-131827896,
+	-148628430,
+	-84952386,
+	39175504,
+	166758956,
+	227263424,
+	171352863,
+	1300194,
+	-218563045,
+	-379378914,
+	-368996886,
+	-121094475,
+	348878782,
+	938025643,
+	1485698989,
+	1828675015,
+	1860504348,
+	1571176750,
+	1050880279,
+	456309595,
+	-46675789,
+	-340884782,
+	-393546346,
+	-257434588,
+	-39649631,
+	146628492,
+	226370924,
+	185477262,
+	65377390,
+	-64647060,
+	-142690815,
+	-140767994,
+	-72232776,
+	20577812,
+	90182481,
+	106828630,
+	69976935,
+	4557066,
+	-54270181,
+	-79187841,
+	-62718575,
+	-18212054,
+	29255361,
+	56441037,
+	52884983,
+	24305330,
+	-12246834,
+	-38090963,
+	-42163961,
+	-25382927,
+	1370554,
+	23842087,
+	31767666,
+	23317757,
+	4839754,
+	-13347111,
+	-22515705,
+	-19546521,
+	-7643735,
+	6136090,
+	14878350,
+	15149518,
+	8138816,
+	-1631162,
+	-9024226,
+	-10884465,
+	-7248526,
+	-799648,
+	4882911,
+	7217792,
+	5700918,
+	1777473,
+	-2218850,
+	-4368035,
+	-4018574,
+	-1854630,
+	707446,
+	2361956,
+	2527944,
+	1474410,
+	-3434,
+	-1097289,
+	-1387225,
+	-953039,
+	-206296,
+	403753,
+	627025,
+	482839,
+	169632,
+	-94696,
+	-120040,
+	124729,
+	442829,
+	625533,
+	461668,
+	-102044,
+	-854040,
+	-1362245,
+	-1191211,
+	-198447,
+	1268183,
+	2436970,
+	2479036,
+	1022532,
+	-1477589,
+	-3791529,
+	-4467946,
+	-2670045,
+	1156256,
+	5236669,
+	7220884,
+	5457774,
+	137612,
+	-6416095,
+	-10661218,
+	-9663630,
+	-2937437,
+	6785007,
+	14513497,
+	15456933,
+	7822263,
+	-5608297,
+	-18252848,
+	-22822899,
+	-15353964,
+	1978405,
+	21068410,
+	31490850,
+	26008524,
+	5155586,
+	-21838950,
+	-40873822,
+	-40118483,
+	-16969176,
+	19104312,
+	50019991,
+	57851005,
+	34798540,
+	-10987112,
+	-57558925,
+	-79259309,
+	-60326037,
+	-5049167,
+	61583586,
+	104481349,
+	96147739,
+	32914106,
+	-59287729,
+	-134284961,
+	-147429913,
+	-80081074,
+	45729492,
+	171691201,
+	227458886,
+	165568643,
+	-8780418,
+	-228513744,
+	-383543211,
+	-362808432,
+	-103253287,
+	375353249,
+	966427447,
+	1507820813,
+	1837735398,
+	1853655929,
+	1550575079,
+	1022873952,
+	429084752,
+	-66036258,
+	-348754858,
+	-390637323,
+	-247962816,
+	-29266027,
+	153202093,
+	227015233,
+	181057569,
+	58838333,
+	-69923457,
+	-144460870,
+	-138758887,
+	-67966308,
+	24752327,
+	92299065,
+	106170328,
+	67240873,
+	1333335,
+	-56372377,
+	-79308995,
+	-61061300,
+	-15806071,
+	31154332,
+	56984221,
+	51986991,
+	22587062,
+	-13849170,
+	-38819306,
+	-41782119,
+	-24222757,
+	2644754,
+	24599838,
+	31713708,
+	22590076,
+	3883412,
+	-14038573,
+	-22646824,
+	-19135427,
+	-6968313,
+	6711101,
+	15091487,
+	14954176,
+	7693107,
+	-2073050,
+	-9250774,
+	-10822784,
+	-6977069,
+	-484782,
+	5082775,
+	7227844,
+	5551473,
+	1570128,
+	-2373893,
+	-4407252,
+	-3946966,
+	-1729600,
+	814829,
+	2404543,
+	2500392,
+	1406495,
+	-69486,
+	-1130541,
+	-1380559,
+	-920681,
+	-171138,
+	424004,
+	627374,
+	469852,
+	154505,
+	-103546,
+	-111995,
+	139531,
+	456506,
+	626871,
+	443313,
+	-136374,
+	-887663,
+	-1372220,
+	-1161853,
+	-134514,
+	1337719,
+	2470042,
+	2443572,
+	919893,
+	-1603864,
+	-3871237,
+	-4440548,
+	-2524339,
+	1362970,
+	5396641,
+	7228846,
+	5274450,
+	-172239,
+	-6699458,
+	-10748300,
+	-9463959,
+	-2508637,
+	7241636,
+	14742036,
+	15284374,
+	7273357,
+	-6289546,
+	-18703974,
+	-22749192,
+	-14707744,
+	2929243,
+	21839933,
+	31621308,
+	25322197,
+	3906920,
+	-23040899,
+	-41351788,
+	-39495305,
+	-15423865,
+	20852646,
+	51031478,
+	57454240,
+	33002698,
+	-13396771,
+	-59340577,
+	-79332610,
+	-58391628,
+	-1869994,
+	64441812,
+	105387292,
+	94287981,
+	28865933,
+	-63649429,
+	-136596608,
+	-146040686,
+	-75069813,
+	52286391,
+	176459833,
+	227377070,
+	159516988,
+	-18972685,
+	-238318102,
+	-387299524,
+	-356061992,
+	-84898066,
+	402093888,
+	994716615,
+	1529451361,
+	1846064414,
+	1846064414,
+	1529451361,
+	994716615,
+	402093888,
+	-84898066,
+	-356061992,
+	-387299524,
+	-238318102,
+	-18972685,
+	159516988,
+	227377070,
+	176459833,
+	52286391,
+	-75069813,
+	-146040686,
+	-136596608,
+	-63649429,
+	28865933,
+	94287981,
+	105387292,
+	64441812,
+	-1869994,
+	-58391628,
+	-79332610,
+	-59340577,
+	-13396771,
+	33002698,
+	57454240,
+	51031478,
+	20852646,
+	-15423865,
+	-39495305,
+	-41351788,
+	-23040899,
+	3906920,
+	25322197,
+	31621308,
+	21839933,
+	2929243,
+	-14707744,
+	-22749192,
+	-18703974,
+	-6289546,
+	7273357,
+	15284374,
+	14742036,
+	7241636,
+	-2508637,
+	-9463959,
+	-10748300,
+	-6699458,
+	-172239,
+	5274450,
+	7228846,
+	5396641,
+	1362970,
+	-2524339,
+	-4440548,
+	-3871237,
+	-1603864,
+	919893,
+	2443572,
+	2470042,
+	1337719,
+	-134514,
+	-1161853,
+	-1372220,
+	-887663,
+	-136374,
+	443313,
+	626871,
+	456506,
+	139531,
+	-111995,
+	-103546,
+	154505,
+	469852,
+	627374,
+	424004,
+	-171138,
+	-920681,
+	-1380559,
+	-1130541,
+	-69486,
+	1406495,
+	2500392,
+	2404543,
+	814829,
+	-1729600,
+	-3946966,
+	-4407252,
+	-2373893,
+	1570128,
+	5551473,
+	7227844,
+	5082775,
+	-484782,
+	-6977069,
+	-10822784,
+	-9250774,
+	-2073050,
+	7693107,
+	14954176,
+	15091487,
+	6711101,
+	-6968313,
+	-19135427,
+	-22646824,
+	-14038573,
+	3883412,
+	22590076,
+	31713708,
+	24599838,
+	2644754,
+	-24222757,
+	-41782119,
+	-38819306,
+	-13849170,
+	22587062,
+	51986991,
+	56984221,
+	31154332,
+	-15806071,
+	-61061300,
+	-79308995,
+	-56372377,
+	1333335,
+	67240873,
+	106170328,
+	92299065,
+	24752327,
+	-67966308,
+	-138758887,
+	-144460870,
+	-69923457,
+	58838333,
+	181057569,
+	227015233,
+	153202093,
+	-29266027,
+	-247962816,
+	-390637323,
+	-348754858,
+	-66036258,
+	429084752,
+	1022873952,
+	1550575079,
+	1853655929,
+	1837735398,
+	1507820813,
+	966427447,
+	375353249,
+	-103253287,
+	-362808432,
+	-383543211,
+	-228513744,
+	-8780418,
+	165568643,
+	227458886,
+	171691201,
+	45729492,
+	-80081074,
+	-147429913,
+	-134284961,
+	-59287729,
+	32914106,
+	96147739,
+	104481349,
+	61583586,
+	-5049167,
+	-60326037,
+	-79259309,
+	-57558925,
+	-10987112,
+	34798540,
+	57851005,
+	50019991,
+	19104312,
+	-16969176,
+	-40118483,
+	-40873822,
+	-21838950,
+	5155586,
+	26008524,
+	31490850,
+	21068410,
+	1978405,
+	-15353964,
+	-22822899,
+	-18252848,
+	-5608297,
+	7822263,
+	15456933,
+	14513497,
+	6785007,
+	-2937437,
+	-9663630,
+	-10661218,
+	-6416095,
+	137612,
+	5457774,
+	7220884,
+	5236669,
+	1156256,
+	-2670045,
+	-4467946,
+	-3791529,
+	-1477589,
+	1022532,
+	2479036,
+	2436970,
+	1268183,
+	-198447,
+	-1191211,
+	-1362245,
+	-854040,
+	-102044,
+	461668,
+	625533,
+	442829,
+	124729,
+	-120040,
+	-94696,
+	169632,
+	482839,
+	627025,
+	403753,
+	-206296,
+	-953039,
+	-1387225,
+	-1097289,
+	-3434,
+	1474410,
+	2527944,
+	2361956,
+	707446,
+	-1854630,
+	-4018574,
+	-4368035,
+	-2218850,
+	1777473,
+	5700918,
+	7217792,
+	4882911,
+	-799648,
+	-7248526,
+	-10884465,
+	-9024226,
+	-1631162,
+	8138816,
+	15149518,
+	14878350,
+	6136090,
+	-7643735,
+	-19546521,
+	-22515705,
+	-13347111,
+	4839754,
+	23317757,
+	31767666,
+	23842087,
+	1370554,
+	-25382927,
+	-42163961,
+	-38090963,
+	-12246834,
+	24305330,
+	52884983,
+	56441037,
+	29255361,
+	-18212054,
+	-62718575,
+	-79187841,
+	-54270181,
+	4557066,
+	69976935,
+	106828630,
+	90182481,
+	20577812,
+	-72232776,
+	-140767994,
+	-142690815,
+	-64647060,
+	65377390,
+	185477262,
+	226370924,
+	146628492,
+	-39649631,
+	-257434588,
+	-393546346,
+	-340884782,
+	-46675789,
+	456309595,
+	1050880279,
+	1571176750,
+	1860504348,
+	1828675015,
+	1485698989,
+	938025643,
+	348878782,
+	-121094475,
+	-368996886,
+	-379378914,
+	-218563045,
+	1300194,
+	171352863,
+	227263424,
+	166758956,
+	39175504,
+	-84952386,
+	-148628430,
+	-131827896,
+	-54886810,
+	36892431,
+	97877014,
+	103454461,
+	58670072,
+	-8200487,
+	-62173823,
+	-79089829,
+	-55718919,
+	-8580036,
+	36540012,
+	58174514,
+	48954137,
+	17344289,
+	-18483410,
+	-40688432,
+	-40349131,
+	-20618522,
+	6389314,
+	26658227,
+	31322762,
+	20276609,
+	1032043,
+	-15976606,
+	-22868066,
+	-17782754,
+	-4925426,
+	8357246,
+	15609115,
+	14268974,
+	6323830,
+	-3358975,
+	-9849657,
+	-10561757,
+	-6127383,
+	444411,
+	5632596,
+	7204053,
+	5071808,
+	950242,
+	-2810880,
+	-4489473,
+	-3707989,
+	-1350942,
+	1122645,
+	2510935,
+	2401253,
+	1197987,
+	-261217,
+	-1218607,
+	-1350672,
+	-819868,
+	-68188,
+	479063,
+	623378,
+	428846,
+	110117,
+	-127677,
+	-85448,
+	184892,
+	495440,
+	625807,
+	382569,
+	-241807,
+	-984684,
+	-1392184,
+	-1062113,
+	63570,
+	1541363,
+	2552627,
+	2315822,
+	597855,
+	-1978784,
+	-4085924,
+	-4322882,
+	-2059357,
+	1984744,
+	5844733,
+	7198612,
+	4675030,
+	-1116462,
+	-7513433,
+	-10933152,
+	-8784481,
+	-1183473,
+	8578156,
+	15327681,
+	14645067,
+	5548938,
+	-8314948,
+	-19936591,
+	-22355784,
+	-12634051,
+	5797102,
+	24021914,
+	31782842,
+	23049632,
+	85811,
+	-26519831,
+	-42496512,
+	-37310818,
+	-10618645,
+	26005229,
+	53723965,
+	55824868,
+	27307780,
+	-20611744,
+	-64309944,
+	-78968638,
+	-52087049,
+	7797395,
+	72646217,
+	107360509,
+	87939886,
+	16347017,
+	-76443262,
+	-142620283,
+	-140731099,
+	-59245875,
+	71895577,
+	189711902,
+	225441996,
+	139801064,
+	-50112458,
+	-266720130,
+	-396016617,
+	-332449982,
+	-26825053,
+	483751890,
+	1078716445,
+	1591241508,
+	1866604620,
+	1818889935,
+	1463101766,
+	909530396,
+	322686129,
+	-138414660,
+	-374630515,
+	-374817425,
+	-208479294,
+	11258817,
+	176865800,
+	226793717,
+	161670499,
+	32632218,
+	-89679101,
+	-149636343,
+	-129229505,
+	-50452279,
+	40796614,
+	99474647,
+	102308723,
+	55705190,
+	-11320314,
+	-63933323,
+	-78825021,
+	-53823189,
+	-6178460,
+	38225349,
+	58424858,
+	47835580,
+	15574807,
+	-19964922,
+	-41204812,
+	-39778673,
+	-19381236,
+	7606694,
+	27270765,
+	31117517,
+	19465647,
+	91290,
+	-16575077,
+	-22884852,
+	-17294414,
+	-4241788,
+	8877754,
+	15740892,
+	14008901,
+	5858714,
+	-3772790,
+	-10021928,
+	-10450151,
+	-5833730,
+	747803,
+	5798779,
+	7178463,
+	4902315,
+	745179,
+	-2946717,
+	-4505169,
+	-3620763,
+	-1224088,
+	1220134,
+	2539271,
+	2362972,
+	1127230,
+	-322758,
+	-1244032,
+	-1337541,
+	-785201,
+	-34843,
+	495490,
+	620425,
+	414585,
+	95714,
+	-134905,
+	-75808,
+	200265,
+	507628,
+	623704,
+	360465,
+	-277626,
+	-1015559,
+	-1395401,
+	-1025029,
+	131452,
+	1607255,
+	2574371,
+	2266155,
+	486170,
+	-2101894,
+	-4148881,
+	-4271785,
+	-1895570,
+	2191676,
+	5982678,
+	7170240,
+	4459319,
+	-1434846,
+	-7771397,
+	-10968667,
+	-8531725,
+	-730491,
+	9010527,
+	15488303,
+	14391765,
+	4950280,
+	-8981083,
+	-20304992,
+	-22167044,
+	-11900117,
+	6754275,
+	24701508,
+	31758943,
+	22223209,
+	-1207963,
+	-27631903,
+	-42779028,
+	-36479483,
+	-8966435,
+	27684542,
+	54502511,
+	55135987,
+	25313659,
+	-23002153,
+	-65833015,
+	-78650994,
+	-49825104,
+	11050474,
+	75244989,
+	107764420,
+	85573100,
+	12064675,
+	-80592219,
+	-144312264,
+	-138582533,
+	-53725345,
+	78384864,
+	193754630,
+	224226607,
+	132725024,
+	-60643254,
+	-275806185,
+	-398038453,
+	-323449144,
+	-6492911,
+	511394836,
+	1106363351,
+	1610754851,
+	1871952246,
+	1808387357,
+	1440045334,
+	880960885,
+	296790608,
+	-155207354,
+	-379712929,
+	-369869782,
+	-198275757,
+	21085363,
+	182103950,
+	226053083,
+	156433346,
+	26107348,
+	-94256779,
+	-150453982,
+	-126494020,
+	-45989741,
+	44622477,
+	100939645,
+	101046357,
+	52692893,
+	-14405070,
+	-65602993,
+	-78465843,
+	-51874415,
+	-3785277,
+	39852867,
+	58602215,
+	46666035,
+	13798092,
+	-21412117,
+	-41667351,
+	-39163457,
+	-18128725,
+	8806345,
+	27845643,
+	30875628,
+	18636658,
+	-842739,
+	-17148818,
+	-22873446,
+	-16788571,
+	-3558233,
+	9383258,
+	15852265,
+	13733725,
+	5390266,
+	-4178435,
+	-10180346,
+	-10326646,
+	-5535547,
+	1047442,
+	5956198,
+	7144230,
+	4728448,
+	541315,
+	-3077438,
+	-4515075,
+	-3530005,
+	-1097190,
+	1314907,
+	2564054,
+	2322208,
+	1056012,
+	-383009,
+	-1267483,
+	-1322893,
+	-750093,
+	-2045,
+	510946,
+	616694,
+	400073,
+	81537,
+	-141722,
+	-65782,
+	215729,
+	519377,
+	620703,
+	337456,
+	-313711,
+	-1045612,
+	-1396846,
+	-986061,
+	200134,
+	1671985,
+	2593110,
+	2212975,
+	372511,
+	-2223788,
+	-4207315,
+	-4214746,
+	-1727652,
+	2398005,
+	6114521,
+	7132623,
+	4235974,
+	-1754412,
+	-8022031,
+	-10990851,
+	-8266163,
+	-272740,
+	9435331,
+	15631040,
+	14118601,
+	4340772,
+	-9641274,
+	-20651102,
+	-21949502,
+	-11146066,
+	7710087,
+	25355520,
+	31695722,
+	21363603,
+	-2509233,
+	-28717602,
+	-43010818,
+	-35597637,
+	-7292076,
+	29341067,
+	55219262,
+	54374756,
+	23275137,
+	-25380287,
+	-67285461,
+	-78234634,
+	-47486579,
+	14312411,
+	77769583,
+	108038959,
+	83084108,
+	7735617,
+	-84674134,
+	-145840613,
+	-136246159,
+	-48091102,
+	84837182,
+	197598748,
+	222723227,
+	125405926,
+	-71230556,
+	-284679533,
+	-399602479,
+	-313881429,
+	14311316,
+	539221377,
+	1133801958,
+	1629702653,
+	1876543281,
+	1797175004,
+	1416546174,
+	852336251,
+	271207207,
+	-171466554,
+	-384248181,
+	-364547261,
+	-187965661,
+	30770009,
+	187064156,
+	225045118,
+	151055117,
+	19608519,
+	-98681193,
+	-151081901,
+	-123625800,
+	-41504793,
+	48365967,
+	102271184,
+	99669713,
+	49637165,
+	-17451248,
+	-67181404,
+	-78013364,
+	-49875325,
+	-1403348,
+	41420960,
+	58706851,
+	45447269,
+	12016366,
+	-22823454,
+	-42075845,
+	-38504540,
+	-16862627,
+	9986919,
+	28382420,
+	30597652,
+	17790790,
+	-1768944,
+	-17697304,
+	-22834073,
+	-16265978,
+	-2875603,
+	9873252,
+	15943261,
+	13443909,
+	4919096,
+	-4575476,
+	-10324835,
+	-10191500,
+	-5233246,
+	1342989,
+	6104740,
+	7101481,
+	4550469,
+	338894,
+	-3202933,
+	-4519243,
+	-3435869,
+	-970410,
+	1406875,
+	2585296,
+	2279046,
+	984430,
+	-441908,
+	-1288957,
+	-1306771,
+	-714599,
+	30170,
+	525425,
+	612205,
+	385335,
+	67601,
+	-148128,
+	-55376,
+	231263,
+	530660,
+	616791,
+	313557,
+	-350017,
+	-1074788,
+	-1396490,
+	-945232,
+	269537,
+	1735452,
+	2608781,
+	2156309,
+	256999,
+	-2344298,
+	-4261101,
+	-4151771,
+	-1555772,
+	2603462,
+	6240034,
+	7085717,
+	4005205,
+	-2074770,
+	-8264955,
+	-10999556,
+	-7988014,
+	189250,
+	9851974,
+	15755568,
+	13825756,
+	3721086,
+	-10294654,
+	-20974323,
+	-21703214,
+	-10372685,
+	8663344,
+	25982958,
+	31592979,
+	20471644,
+	-3816442,
+	-29775407,
+	-43191253,
+	-34666025,
+	-5597481,
+	30972611,
+	55872924,
+	53541628,
+	21194421,
+	-27743144,
+	-68665028,
+	-77719403,
+	-45073817,
+	17579276,
+	80216398,
+	108182872,
+	80475057,
+	3364764,
+	-88683530,
+	-147202177,
+	-133723252,
+	-42348960,
+	91244435,
+	201237722,
+	220930639,
+	117849660,
+	-81862706,
+	-293327010,
+	-400699636,
+	-303746476,
+	35577851,
+	567214212,
+	1161013308,
+	1648071177,
+	1880374334,
+	1785261111,
+	1392621054,
+	823675590,
+	245950569,
+	-187186748,
+	-388240757,
+	-358861358,
+	-177562183,
+	40303193,
+	191743604,
+	223773686,
+	145543522,
+	13143258,
+	-102948331,
+	-151520875,
+	-120629331,
+	-37003017,
+	52023161,
+	103468604,
+	98181260,
+	46542015,
+	-20455405,
+	-68667253,
+	-77468759,
+	-47828689,
+	964494,
+	42928109,
+	58739120,
+	44181098,
+	10231840,
+	-24197446,
+	-42430158,
+	-37803026,
+	-15584589,
+	11147097,
+	28880703,
+	30284184,
+	16929202,
+	-2686241,
+	-18220046,
+	-22766991,
+	-15727409,
+	-2194733,
+	10347251,
+	16013928,
+	13139933,
+	4445809,
+	-4963493,
+	-10455337,
+	-10044984,
+	-4927240,
+	1634114,
+	6244302,
+	7050353,
+	4368641,
+	138155,
+	-3323098,
+	-4517730,
+	-3338512,
+	-843907,
+	1495955,
+	2603013,
+	2233574,
+	912583,
+	-499398,
+	-1308457,
+	-1289220,
+	-678772,
+	61768,
+	538927,
+	606980,
+	370400,
+	53922,
+	-154123,
+	-44597,
+	246845,
+	541450,
+	611954,
+	288786,
+	-386496,
+	-1103032,
+	-1394305,
+	-902568,
+	339579,
+	1797556,
+	2621323,
+	2096185,
+	139761,
+	-2463251,
+	-4310117,
+	-4082878,
+	-1380108,
+	2807778,
+	6358995,
+	7029492,
+	3767231,
+	-2395525,
+	-8499794,
+	-10994654,
+	-7697519,
+	654937,
+	10259869,
+	15861584,
+	13513437,
+	3091913,
+	-10940359,
+	-21274078,
+	-21428270,
+	-9580789,
+	9612848,
+	26582856,
+	31450561,
+	19548206,
+	-5128019,
+	-30803822,
+	-43319760,
+	-33685460,
+	-3884603,
+	32577001,
+	56462273,
+	52637149,
+	19073785,
+	-30087724,
+	-69969537,
+	-77105264,
+	-42589264,
+	20847109,
+	82581899,
+	108195053,
+	77748253,
+	-1042875,
+	-92614979,
+	-148393977,
+	-131015317,
+	-36504910,
+	97598507,
+	204665199,
+	218847948,
+	110062444,
+	-92527857,
+	-301735517,
+	-401321193,
+	-293044405,
+	57296468,
+	595355810,
+	1187978540,
+	1665847086,
+	1883442578,
+	1772654426,
+	1368287005,
+	794997929,
+	221034983,
+	-202362910,
+	-391695573,
+	-352823780,
+	-167078441,
+	49675632,
+	196139828,
+	222242918,
+	139906360,
+	6718989,
+	-107054400,
+	-151771894,
+	-117509216,
+	-32489974,
+	55590267,
+	104531413,
+	96583585,
+	43411473,
+	-23414178,
+	-70059355,
+	-76833304,
+	-45737316,
+	3315458,
+	44372877,
+	58699460,
+	42869384,
+	8446715,
+	-25532661,
+	-42730219,
+	-37060062,
+	-14296258,
+	12285599,
+	29340149,
+	29935860,
+	16053068,
+	-3593567,
+	-18716589,
+	-22672490,
+	-15173649,
+	-1516449,
+	10804797,
+	16064343,
+	12822287,
+	3971009,
+	-5342082,
+	-10571811,
+	-9887382,
+	-4617944,
+	1920494,
+	6374798,
+	6990992,
+	4183232,
+	-60668,
+	-3437840,
+	-4510600,
+	-3238094,
+	-717840,
+	1582068,
+	2617227,
+	2185878,
+	840566,
+	-555424,
+	-1325984,
+	-1270284,
+	-642666,
+	92717,
+	551450,
+	601041,
+	355291,
+	40517,
+	-159708,
+	-33454,
+	262452,
+	551722,
+	606182,
+	263160,
+	-423103,
+	-1130293,
+	-1390267,
+	-858100,
+	410177,
+	1858198,
+	2630681,
+	2032639,
+	20928,
+	-2580478,
+	-4354248,
+	-4008088,
+	-1200841,
+	3010682,
+	6471188,
+	6963927,
+	3522285,
+	-2716276,
+	-8726180,
+	-10976029,
+	-7394934,
+	1123771,
+	10658434,
+	15948805,
+	13181878,
+	2453962,
+	-11577527,
+	-21549818,
+	-21124798,
+	-8771224,
+	10557395,
+	27154273,
+	31268364,
+	18594212,
+	-6442373,
+	-31801375,
+	-43395828,
+	-32656819,
+	-2155427,
+	34152079,
+	56986155,
+	51661956,
+	16915569,
+	-32411027,
+	-71196884,
+	-76392303,
+	-40035474,
+	24111919,
+	84862627,
+	108074549,
+	74906162,
+	-5482211,
+	-96463103,
+	-149413214,
+	-128124096,
+	-30565116,
+	103891271,
+	207875010,
+	216474583,
+	102050826,
+	-103213987,
+	-309892037,
+	-401458759,
+	-281775819,
+	79456499,
+	623628423,
+	1214678903,
+	1683017458,
+	1885745746,
+	1759364194,
+	1343561312,
+	766322217,
+	196474373,
+	-216990506,
+	-394617965,
+	-346446433,
+	-156527474,
+	58878321,
+	200250705,
+	220457201,
+	134151501,
+	343024,
+	-110995829,
+	-151836167,
+	-114270173,
+	-27971197,
+	59063627,
+	105459282,
+	94879391,
+	40249583,
+	-26324277,
+	-71356645,
+	-76108381,
+	-43604053,
+	5646786,
+	45753913,
+	58588395,
+	41514032,
+	6663178,
+	-26827725,
+	-42976028,
+	-36276842,
+	-12999285,
+	13401177,
+	29760464,
+	29553356,
+	15163567,
+	-4489878,
+	-19186517,
+	-22550891,
+	-14605495,
+	-841570,
+	11245454,
+	16094605,
+	12491476,
+	3495296,
+	-5710854,
+	-10674235,
+	-9718988,
+	-4305773,
+	2201817,
+	6496149,
+	6923552,
+	3994510,
+	-257344,
+	-3547071,
+	-4497923,
+	-3134776,
+	-592363,
+	1665140,
+	2627964,
+	2136051,
+	768476,
+	-609934,
+	-1341546,
+	-1250011,
+	-606334,
+	122987,
+	562996,
+	594411,
+	340037,
+	27398,
+	-164884,
+	-21955,
+	278062,
+	561450,
+	599466,
+	236701,
+	-459790,
+	-1156517,
+	-1384352,
+	-811859,
+	481247,
+	1917279,
+	2636800,
+	1965711,
+	-99366,
+	-2695808,
+	-4393383,
+	-3927433,
+	-1018163,
+	3211903,
+	6576403,
+	6889015,
+	3270608,
+	-3036621,
+	-8943753,
+	-10943585,
+	-7080533,
+	1595192,
+	11047094,
+	16016970,
+	12831338,
+	1807957,
+	-12205300,
+	-21801019,
+	-20792961,
+	-7944864,
+	11495779,
+	27696300,
+	31046333,
+	17610627,
+	-7757902,
+	-32766626,
+	-43419007,
+	-31581045,
+	-411974,
+	35695713,
+	57443489,
+	50616776,
+	14722172,
+	-34710059,
+	-72345046,
+	-75580725,
+	-37415101,
+	27369692,
+	87055201,
+	107820560,
+	71951409,
+	-9948078,
+	-100222584,
+	-150257274,
+	-125051560,
+	-24535907,
+	110114600,
+	210861178,
+	213810297,
+	93821678,
+	-113908907,
+	-317783643,
+	-401104289,
+	-269941809,
+	102046838,
+	652014101,
+	1241095777,
+	1699569792,
+	1887282138,
+	1745400155,
+	1318461497,
+	737667305,
+	172282288,
+	-231065496,
+	-397013681,
+	-339741405,
+	-145922238,
+	67902542,
+	204074456,
+	218421172,
+	128286881,
+	-5977446,
+	-114769268,
+	-151715112,
+	-110917021,
+	-23452184,
+	62439724,
+	106252049,
+	93071488,
+	37060400,
+	-29182498,
+	-72558185,
+	-75295470,
+	-41431778,
+	7955765,
+	47069953,
+	58406535,
+	40116987,
+	4883400,
+	-28081321,
+	-43167648,
+	-35454596,
+	-11695318,
+	14492621,
+	30141408,
+	29137382,
+	14261890,
+	-5374152,
+	-19629446,
+	-22402546,
+	-14023757,
+	-170901,
+	11668811,
+	16104839,
+	12148018,
+	3019269,
+	-6069434,
+	-10762602,
+	-9540108,
+	-3991142,
+	2477779,
+	6608293,
+	6848197,
+	3802745,
+	-451648,
+	-3650713,
+	-4479778,
+	-3028723,
+	-467629,
+	1745102,
+	2635254,
+	2084183,
+	696407,
+	-662878,
+	-1355152,
+	-1228449,
+	-569829,
+	152547,
+	573566,
+	587113,
+	324661,
+	14579,
+	-169654,
+	-10109,
+	293649,
+	570608,
+	591796,
+	209430,
+	-496506,
+	-1181651,
+	-1376540,
+	-763883,
+	552701,
+	1974702,
+	2639632,
+	1895445,
+	-220985,
+	-2809071,
+	-4427416,
+	-3840953,
+	-832269,
+	3411169,
+	6674439,
+	6804759,
+	3012454,
+	-3356154,
+	-9152160,
+	-10897239,
+	-6754607,
+	2068633,
+	11425282,
+	16065838,
+	12462102,
+	1154639,
+	-12822825,
+	-22027183,
+	-20432959,
+	-7102610,
+	12426793,
+	28208054,
+	30784459,
+	16598459,
+	-9072988,
+	-33698160,
+	-43388909,
+	-30459146,
+	1343706,
+	37205792,
+	57833271,
+	49502428,
+	12496053,
+	-36981839,
+	-73412085,
+	-74670859,
+	-34730899,
+	30616396,
+	89156327,
+	107432444,
+	68886771,
+	-14435239,
+	-103888170,
+	-150923731,
+	-121799914,
+	-18423772,
+	116260374,
+	213617932,
+	210855178,
+	85382191,
+	-124600270,
+	-325397517,
+	-400250100,
+	-257543957,
+	125055954,
+	680494707,
+	1267210683,
+	1715492023,
+	1888050617,
+	1730772532,
+	1293005303,
+	709051931,
+	148471892,
+	-244584332,
+	-398888877,
+	-332720960,
+	-135275589,
+	76739873,
+	207609646,
+	216139710,
+	122320493,
+	-12235355,
+	-118371595,
+	-151410356,
+	-107454682,
+	-18938394,
+	65715182,
+	106909715,
+	91162794,
+	33847984,
+	-31985716,
+	-73663155,
+	-74396147,
+	-39223396,
+	10239727,
+	48319821,
+	58154570,
+	38680234,
+	3109533,
+	-29292194,
+	-43305209,
+	-34594599,
+	-10386005,
+	15558759,
+	30482787,
+	28688687,
+	13349231,
+	-6245388,
+	-20045030,
+	-22227839,
+	-13429257,
+	494763,
+	12074481,
+	16095193,
+	11792440,
+	2543519,
+	-6417466,
+	-10836927,
+	-9351056,
+	-3674464,
+	2748086,
+	6711176,
+	6765100,
+	3608207,
+	-643361,
+	-3748695,
+	-4456245,
+	-2920099,
+	-343787,
+	1821890,
+	2639131,
+	2030368,
+	624451,
+	-714209,
+	-1366812,
+	-1205646,
+	-533203,
+	181370,
+	583165,
+	579170,
+	309190,
+	2072,
+	-174020
+
+};
+
+struct src_stage src_int32_21_80_3968_5000 = {
+	19, 5, 21, 148, 3108, 80, 21, 0, 2,
+	src_int32_21_80_3968_5000_fir};
@@ -0,0 +1,2823 @@
+const int32_t src_int32_32_21_4535_5000_fir[2816] = {
+	-70924,
+	93303,
+	-103450,
+	92376,
+	-49646,
+	-36134,
+	176622,
+	-382855,
+	664189,
+	-1027111,
+	1473976,
+	-2001738,
+	2600759,
+	-3253773,
+	3935110,
+	-4610244,
+	5235760,
+	-5759785,
+	6122930,
+	-6259756,
+	6100749,
+	-5574759,
+	4611830,
+	-3146313,
+	1120136,
+	1513922,
+	-4789113,
+	8721941,
+	-13309878,
+	18529746,
+	-24336911,
+	30665411,
+	-37429141,
+	44524189,
+	-51832458,
+	59226809,
+	-66578167,
+	73765738,
+	-80693054,
+	87317342,
+	-93715031,
+	100268107,
+	-108398354,
+	125748871,
+	1816884089,
+	66753465,
+	-80101364,
+	82697352,
+	-81841534,
+	79089392,
+	-75044484,
+	70048576,
+	-64351478,
+	58164302,
+	-51677594,
+	45066787,
+	-38492622,
+	32099605,
+	-26013885,
+	20341271,
+	-15165740,
+	10548664,
+	-6528804,
+	3123109,
+	-328238,
+	-1877279,
+	3530364,
+	-4680361,
+	5385803,
+	-5711135,
+	5723545,
+	-5490030,
+	5074819,
+	-4537223,
+	3929973,
+	-3298080,
+	2678185,
+	-2098408,
+	1578604,
+	-1130996,
+	761066,
+	-468655,
+	249162,
+	-94760,
+	-4416,
+	59207,
+	-80510,
+	78540,
+	-79199,
+	107624,
+	-125995,
+	125398,
+	-95264,
+	23792,
+	101403,
+	-292446,
+	560160,
+	-912875,
+	1355142,
+	-1886396,
+	2499680,
+	-3180489,
+	3905833,
+	-4643613,
+	5352387,
+	-5981591,
+	6472264,
+	-6758311,
+	6768283,
+	-6427655,
+	5661531,
+	-4397671,
+	2569729,
+	-120540,
+	-2994711,
+	6805620,
+	-11324186,
+	16543118,
+	-22435026,
+	28952699,
+	-36030691,
+	43588532,
+	-51536016,
+	59781420,
+	-68244338,
+	76876882,
+	-85702097,
+	94893100,
+	-104964314,
+	117340189,
+	-136654712,
+	187495932,
+	1811618493,
+	10728440,
+	-51993803,
+	64785996,
+	-69455029,
+	70288473,
+	-68812339,
+	65763665,
+	-61588752,
+	56607519,
+	-51076493,
+	45214744,
+	-39214494,
+	33244945,
+	-27453082,
+	21963277,
+	-16876638,
+	12270611,
+	-8199107,
+	4693260,
+	-1762842,
+	-601710,
+	2426760,
+	-3752551,
+	4630037,
+	-5117632,
+	5278010,
+	-5175097,
+	4871371,
+	-4425562,
+	3890810,
+	-3313324,
+	2731543,
+	-2175775,
+	1668287,
+	-1223756,
+	850042,
+	-549165,
+	318429,
+	-151595,
+	40036,
+	26186,
+	-57388,
+	63479,
+	-87023,
+	121360,
+	-147930,
+	157974,
+	-140870,
+	84508,
+	24130,
+	-198162,
+	449800,
+	-789165,
+	1222976,
+	-1753180,
+	2375579,
+	-3078568,
+	3842053,
+	-4636653,
+	5423265,
+	-6153073,
+	6768054,
+	-7202016,
+	7382176,
+	-7231258,
+	6670040,
+	-5620279,
+	4007885,
+	-1766186,
+	-1160866,
+	4815776,
+	-9225046,
+	14397435,
+	-20323156,
+	26974308,
+	-34306880,
+	42264837,
+	-50787087,
+	59818813,
+	-69330147,
+	79348600,
+	-90020536,
+	101741982,
+	-115481679,
+	133756337,
+	-164633686,
+	251756211,
+	1801114808,
+	-42128269,
+	-24297580,
+	46691640,
+	-56669247,
+	60997624,
+	-62056922,
+	60953755,
+	-58318858,
+	54574222,
+	-50038034,
+	44969899,
+	-39591125,
+	34093676,
+	-28643787,
+	23383096,
+	-18428799,
+	13873622,
+	-9786051,
+	6211049,
+	-3171341,
+	669283,
+	1310764,
+	-2799644,
+	3840342,
+	-4484774,
+	4790592,
+	-4818123,
+	4627577,
+	-4276604,
+	3818300,
+	-3299677,
+	2760629,
+	-2233388,
+	1742421,
+	-1304725,
+	930448,
+	-623757,
+	383870,
+	-206170,
+	83335,
+	-6399,
+	-34291,
+	48264,
+	-94306,
+	134368,
+	-169044,
+	189801,
+	-186057,
+	145486,
+	-54544,
+	-100781,
+	333998,
+	-656948,
+	1078483,
+	-1603058,
+	2229292,
+	-2948603,
+	3743983,
+	-4589035,
+	5447346,
+	-6272277,
+	7007242,
+	-7586520,
+	7936615,
+	-7978143,
+	7628217,
+	-6803232,
+	5421952,
+	-3408728,
+	696700,
+	2769239,
+	-7029950,
+	12110254,
+	-18018168,
+	24745491,
+	-32270228,
+	40561546,
+	-49588416,
+	59334084,
+	-69820602,
+	81152679,
+	-93602669,
+	107794548,
+	-125163880,
+	149361384,
+	-192093362,
+	318272771,
+	1785427880,
+	-91640451,
+	2774915,
+	28570167,
+	-43599461,
+	51302952,
+	-54842320,
+	55665667,
+	-54574757,
+	52086130,
+	-48574802,
+	44337473,
+	-39621895,
+	34640667,
+	-29577518,
+	24589904,
+	-19809931,
+	15344672,
+	-11276494,
+	7663707,
+	-4541717,
+	1924711,
+	192153,
+	-1830109,
+	3023848,
+	-3818384,
+	4265884,
+	-4422584,
+	4345925,
+	-4092000,
+	3713407,
+	-3257557,
+	2765455,
+	-2270970,
+	1800549,
+	-1373347,
+	1001699,
+	-691866,
+	444971,
+	-258047,
+	125122,
+	-38270,
+	-11424,
+	33035,
+	-100962,
+	146510,
+	-189127,
+	220580,
+	-230414,
+	206190,
+	-133944,
+	-1119,
+	213704,
+	-517283,
+	922785,
+	-1437155,
+	2061864,
+	-2791443,
+	3612139,
+	-4500785,
+	5423984,
+	-6337687,
+	7187240,
+	-7907960,
+	8426260,
+	-8661323,
+	8527289,
+	-7935886,
+	6799393,
+	-5033792,
+	2561941,
+	683464,
+	-4757354,
+	9700494,
+	-15538741,
+	22283803,
+	-29936079,
+	38490472,
+	-47946692,
+	58326824,
+	-69705743,
+	82266401,
+	-96408626,
+	112987257,
+	-133913070,
+	164003561,
+	-218788249,
+	386771521,
+	1764639549,
+	-137654401,
+	29022106,
+	10574531,
+	-30361506,
+	41292863,
+	-47235819,
+	49949852,
+	-50393188,
+	49168693,
+	-46702943,
+	43325995,
+	-39309182,
+	34883437,
+	-30248079,
+	25574801,
+	-21009311,
+	16671976,
+	-12658224,
+	9039123,
+	-5862377,
+	3153806,
+	-919352,
+	-852488,
+	2187858,
+	-3124527,
+	3708763,
+	-3992259,
+	4029214,
+	-3873695,
+	3577364,
+	-3187625,
+	2746243,
+	-2288423,
+	1842357,
+	-1429180,
+	1063296,
+	-752990,
+	501266,
+	-306815,
+	165057,
+	-69161,
+	11016,
+	17930,
+	-106908,
+	157650,
+	-207974,
+	250014,
+	-273531,
+	266075,
+	-213377,
+	99975,
+	89917,
+	-371305,
+	757118,
+	-1256751,
+	1874535,
+	-2608184,
+	3447339,
+	-4372283,
+	5352942,
+	-6348247,
+	7305957,
+	-8162988,
+	8846295,
+	-9274314,
+	9358935,
+	-9007955,
+	8127895,
+	-6627055,
+	4418623,
+	-1423629,
+	-2426530,
+	7188285,
+	-12905212,
+	19608959,
+	-27322488,
+	36066731,
+	-45872510,
+	56801169,
+	-68980770,
+	82672797,
+	-98404773,
+	117263093,
+	-141637711,
+	177535795,
+	-244470930,
+	456962686,
+	1738858143,
+	-180039550,
+	54254408,
+	-7146413,
+	-17070816,
+	31057291,
+	-39307292,
+	43859921,
+	-45814314,
+	45850845,
+	-44442001,
+	41947205,
+	-38658318,
+	34822156,
+	-30651600,
+	26330875,
+	-22017870,
+	17845079,
+	-13920063,
+	10325948,
+	-7122242,
+	4346113,
+	-2014164,
+	124674,
+	1339786,
+	-2409456,
+	3124347,
+	-3531195,
+	3680517,
+	-3623910,
+	3411665,
+	-3090781,
+	2703422,
+	-2285825,
+	1867676,
+	-1471901,
+	1114832,
+	-806696,
+	552336,
+	-352101,
+	202824,
+	-98820,
+	32838,
+	3081,
+	-112063,
+	167661,
+	-225385,
+	277811,
+	-315000,
+	324596,
+	-292141,
+	201629,
+	-36316,
+	-220222,
+	582820,
+	-1063266,
+	1668732,
+	-2400161,
+	3250699,
+	-4204269,
+	5234398,
+	-6303371,
+	7361821,
+	-8348812,
+	9192473,
+	-9811190,
+	10115353,
+	-10009603,
+	9395482,
+	-8174361,
+	6250470,
+	-3533797,
+	-57396,
+	4594797,
+	-10139416,
+	16742683,
+	-24450085,
+	33308628,
+	-43380325,
+	54765796,
+	-67646139,
+	82360852,
+	-99564080,
+	120572136,
+	-148253442,
+	189816985,
+	-268893736,
+	528542391,
+	1708217799,
+	-218688941,
+	78295317,
+	-24449027,
+	-3841463,
+	20686918,
+	-31128582,
+	37452156,
+	-40881347,
+	42164723,
+	-41814721,
+	40215922,
+	-37677517,
+	34459626,
+	-30786552,
+	26853247,
+	-22828259,
+	18854940,
+	-15051956,
+	11513684,
+	-8310847,
+	5491572,
+	-3082920,
+	1092904,
+	487087,
+	-1679553,
+	2517945,
+	-3043670,
+	3303160,
+	-3345117,
+	3218046,
+	-2968146,
+	2637620,
+	-2263427,
+	1876486,
+	-1501304,
+	1155995,
+	-852623,
+	597818,
+	-393566,
+	238132,
+	-127010,
+	53864,
+	-11386,
+	-116355,
+	176420,
+	-241172,
+	303689,
+	-354422,
+	381211,
+	-369527,
+	302951,
+	-163915,
+	-65299,
+	401322,
+	-858252,
+	1446064,
+	-2168944,
+	3023625,
+	-3997835,
+	5068952,
+	-6202956,
+	7353795,
+	-8463221,
+	9461158,
+	-10266647,
+	10789342,
+	-10931534,
+	10590616,
+	-9661852,
+	8041299,
+	-5628640,
+	2329648,
+	1942066,
+	-7264502,
+	13708533,
+	-21341916,
+	30237529,
+	-40488347,
+	52233895,
+	-65707604,
+	81325660,
+	-99866429,
+	122872087,
+	-153683904,
+	200713268,
+	-291810462,
+	601194340,
+	1672877637,
+	-253519543,
+	100982376,
+	-41195944,
+	9214764,
+	10272395,
+	-22772861,
+	30785004,
+	-35640148,
+	38145361,
+	-38846823,
+	38149900,
+	-36377786,
+	33801234,
+	-30653742,
+	27139098,
+	-23434900,
+	19694000,
+	-16045047,
+	12592770,
+	-9418425,
+	6580612,
+	-4116554,
+	2043876,
+	-362801,
+	-941279,
+	1895010,
+	-2534153,
+	2900684,
+	-3040017,
+	2998470,
+	-2821056,
+	2549662,
+	-2221651,
+	1868907,
+	-1517302,
+	1186564,
+	-890482,
+	637398,
+	-430911,
+	270715,
+	-153512,
+	73925,
+	-25350,
+	-119715,
+	183816,
+	-255155,
+	327379,
+	-391409,
+	435385,
+	-444829,
+	403042,
+	-291772,
+	92146,
+	214135,
+	-643379,
+	1208302,
+	-1916319,
+	2767804,
+	-3754422,
+	4857616,
+	-6047381,
+	7281395,
+	-8504610,
+	9649363,
+	-10636049,
+	11374362,
+	-11765079,
+	11702308,
+	-11076087,
+	9775168,
+	-7689754,
+	4713896,
+	-747192,
+	-4304744,
+	10531707,
+	-18023261,
+	26877698,
+	-37218421,
+	49223091,
+	-63176222,
+	79568536,
+	-99298864,
+	124128729,
+	-157861512,
+	210099243,
+	-312978094,
+	674591603,
+	1633020765,
+	-284472411,
+	122168027,
+	-57257058,
+	21989254,
+	-96413,
+	-14313996,
+	23918549,
+	-30138809,
+	33830368,
+	-35566761,
+	35769646,
+	-34772807,
+	32854890,
+	-30256290,
+	27187679,
+	-23834021,
+	20356237,
+	-16891751,
+	13554661,
+	-10435984,
+	7604220,
+	-5106377,
+	2969478,
+	-1202530,
+	-201109,
+	1261092,
+	-2007265,
+	2476818,
+	-2711513,
+	2755103,
+	-2651043,
+	2440553,
+	-2161082,
+	1845203,
+	-1519927,
+	1206417,
+	-920058,
+	670824,
+	-463878,
+	300337,
+	-178128,
+	92865,
+	-38700,
+	-122083,
+	189744,
+	-267168,
+	348626,
+	-425588,
+	486598,
+	-517349,
+	501000,
+	-418763,
+	250760,
+	22838,
+	-420425,
+	957371,
+	-1644281,
+	2485195,
+	-3475807,
+	4601818,
+	-5837516,
+	7144695,
+	-8472002,
+	9754781,
+	-10915477,
+	11864604,
+	-12502274,
+	12720214,
+	-12404167,
+	11436515,
+	-9698895,
+	7074515,
+	-3449775,
+	-1285338,
+	7238840,
+	-14521430,
+	23256111,
+	-33595867,
+	45755331,
+	-60068303,
+	77097064,
+	-97855795,
+	124316329,
+	-160728166,
+	217859157,
+	-332158544,
+	748398474,
+	1588853147,
+	-311512682,
+	141720346,
+	-72510435,
+	34377433,
+	-10331185,
+	-5825916,
+	16913988,
+	-24427220,
+	29259578,
+	-32005451,
+	33098220,
+	-32878800,
+	31630935,
+	-29599587,
+	27000302,
+	-24023676,
+	20837202,
+	-17585805,
+	14391891,
+	-11355381,
+	8554025,
+	-6044148,
+	3861885,
+	-2024898,
+	534518,
+	621789,
+	-1467736,
+	2035442,
+	-2362683,
+	2490298,
+	-2459825,
+	2311473,
+	-2082462,
+	1805775,
+	-1509326,
+	1215526,
+	-941214,
+	697898,
+	-492252,
+	326794,
+	-200680,
+	110544,
+	-51331,
+	-123404,
+	194113,
+	-277058,
+	367189,
+	-456604,
+	534346,
+	-586402,
+	595930,
+	-543756,
+	409158,
+	-170935,
+	-191258,
+	695332,
+	-1355017,
+	2178008,
+	-3164096,
+	4303387,
+	-5574711,
+	6944334,
+	-8365058,
+	9775811,
+	-11101767,
+	12255038,
+	-13135935,
+	13634732,
+	-13633849,
+	13010295,
+	-11638139,
+	9390723,
+	-6142194,
+	1767813,
+	3857780,
+	-10865543,
+	19402237,
+	-29649284,
+	41856733,
+	-56405321,
+	73925102,
+	-95539124,
+	123417979,
+	-162235894,
+	223888033,
+	-349120374,
+	822272401,
+	1540602332,
+	-334629415,
+	159523650,
+	-86843150,
+	46279572,
+	-20345865,
+	2618027,
+	9833093,
+	-18556625,
+	24474692,
+	-28195987,
+	30161023,
+	-30714360,
+	30142039,
+	-28691228,
+	26580313,
+	-24003750,
+	21134054,
+	-18122319,
+	15098129,
+	-12169386,
+	9422358,
+	-6922143,
+	4713624,
+	-2822914,
+	1259258,
+	-17305,
+	-920362,
+	1580549,
+	-1996754,
+	2206572,
+	-2249286,
+	2163764,
+	-1986682,
+	1751155,
+	-1485759,
+	1213956,
+	-953886,
+	718482,
+	-515862,
+	349911,
+	-221009,
+	126832,
+	-63151,
+	-123633,
+	196842,
+	-284689,
+	382851,
+	-484124,
+	578149,
+	-651325,
+	686949,
+	-665622,
+	565944,
+	-365508,
+	42179,
+	424366,
+	-1050886,
+	1848692,
+	-2821702,
+	3964542,
+	-5260795,
+	6681513,
+	-8184089,
+	9711577,
+	-11192544,
+	12541471,
+	-13659730,
+	14437090,
+	-14753658,
+	14482117,
+	-13490041,
+	11641975,
+	-8800875,
+	4828320,
+	417354,
+	-7086287,
+	15347809,
+	-25410337,
+	37557393,
+	-52213781,
+	70072726,
+	-92358328,
+	121425856,
+	-162347425,
+	228092742,
+	-363640504,
+	895865979,
+	1488516038,
+	-353835284,
+	175478973,
+	-100152033,
+	57601547,
+	-30057365,
+	10945667,
+	2737675,
+	-12579167,
+	19518898,
+	-24173337,
+	26985552,
+	-28300281,
+	28403070,
+	-27540931,
+	25933050,
+	-23775944,
+	21245568,
+	-18497804,
+	15668232,
+	-12871740,
+	10202316,
+	-7733217,
+	5517634,
+	-3589856,
+	1966916,
+	-650646,
+	-369965,
+	1116215,
+	-1617069,
+	1906578,
+	-2021458,
+	1998913,
+	-1874773,
+	1682004,
+	-1449599,
+	1201867,
+	-958086,
+	732499,
+	-534583,
+	369547,
+	-238985,
+	141618,
+	-74075,
+	-122736,
+	197866,
+	-289943,
+	395415,
+	-507842,
+	617555,
+	-711481,
+	773199,
+	-783246,
+	719717,
+	-559180,
+	277881,
+	146756,
+	-734403,
+	1499916,
+	-2451335,
+	3587880,
+	-4898060,
+	6357992,
+	-7930053,
+	9561942,
+	-11186252,
+	12720585,
+	-14068239,
+	15119431,
+	-15752992,
+	15838375,
+	-15237791,
+	13808143,
+	-11402366,
+	7869531,
+	-3052871,
+	-3215665,
+	11126562,
+	-20913502,
+	32891166,
+	-47525034,
+	65566123,
+	-88330459,
+	118341421,
+	-161036681,
+	230392999,
+	-375505889,
+	968828982,
+	1432860636,
+	-369166109,
+	189504416,
+	-112344328,
+	68255538,
+	-39386225,
+	19086634,
+	-4310942,
+	-6547433,
+	14436491,
+	-19974027,
+	23601149,
+	-25659361,
+	26430948,
+	-26160440,
+	25065780,
+	-23343747,
+	21172133,
+	-18710192,
+	16098270,
+	-13457198,
+	10887817,
+	-8470862,
+	6267326,
+	-4319327,
+	2651496,
+	-1272788,
+	178652,
+	646559,
+	-1227057,
+	1593087,
+	-1778502,
+	1818541,
+	-1747893,
+	1599099,
+	-1401321,
+	1179506,
+	-953901,
+	739927,
+	-548332,
+	385594,
+	-254495,
+	154806,
+	-84029,
+	-120685,
+	197131,
+	-292720,
+	404708,
+	-527480,
+	652141,
+	-766266,
+	853851,
+	-895533,
+	869084,
+	-750235,
+	513804,
+	-135132,
+	-408218,
+	1134545,
+	-2055971,
+	3176350,
+	-4489245,
+	5976078,
+	-7604561,
+	9327516,
+	-11082169,
+	12789975,
+	-14357006,
+	15674888,
+	-16622226,
+	17066372,
+	-16865361,
+	15869693,
+	-13923538,
+	10864764,
+	-6522849,
+	713274,
+	6773956,
+	-16195790,
+	27895400,
+	-42375053,
+	60437434,
+	-83480095,
+	114175530,
+	-158289186,
+	230722281,
+	-384515147,
+	1040810428,
+	1373919501,
+	-380680247,
+	201535371,
+	-123338257,
+	78160675,
+	-48257245,
+	26972928,
+	-11252443,
+	-514000,
+	9272478,
+	-15635811,
+	20038737,
+	-22816185,
+	24244489,
+	-24563404,
+	23987626,
+	-22712398,
+	20915740,
+	-18758847,
+	16385564,
+	-13921570,
+	11473645,
+	-9129260,
+	6956634,
+	-5005310,
+	3307256,
+	-1878431,
+	720742,
+	175708,
+	-830205,
+	1268957,
+	-1522687,
+	1624386,
+	-1607318,
+	1503327,
+	-1341501,
+	1147208,
+	-941489,
+	740804,
+	-557073,
+	397979,
+	-267456,
+	166318,
+	-92952,
+	-117465,
+	194599,
+	-292941,
+	410582,
+	-542789,
+	681524,
+	-815114,
+	928115,
+	-1001423,
+	1012676,
+	-936963,
+	747877,
+	-418868,
+	-75092,
+	755619,
+	-1638838,
+	2733236,
+	-4037520,
+	5538608,
+	-7209858,
+	9009654,
+	-10880425,
+	12748177,
+	-14522590,
+	16097650,
+	-17352796,
+	18154435,
+	-18357660,
+	17807859,
+	-16341796,
+	13787541,
+	-9962304,
+	4666716,
+	2326883,
+	-11296451,
+	22610645,
+	-36804168,
+	54724534,
+	-77839218,
+	108948483,
+	-154102382,
+	229028657,
+	-390480139,
+	1111460664,
+	1311991279,
+	-388457842,
+	211524605,
+	-133063488,
+	87243603,
+	-56600065,
+	34539475,
+	-18028030,
+	5469019,
+	4072190,
+	-11197339,
+	16330531,
+	-19796902,
+	21864223,
+	-22765250,
+	22709469,
+	-21888819,
+	20479952,
+	-18644556,
+	16528686,
+	-14261747,
+	11955490,
+	-9703324,
+	7580066,
+	-5642213,
+	3928751,
+	-2462463,
+	1251659,
+	-292239,
+	-430025,
+	937111,
+	-1256371,
+	1418289,
+	-1454429,
+	1395678,
+	-1270807,
+	1105390,
+	-921079,
+	735227,
+	-560817,
+	406661,
+	-277805,
+	176089,
+	-100790,
+	-113070,
+	190249,
+	-290548,
+	412920,
+	-553559,
+	705358,
+	-857504,
+	995244,
+	-1099900,
+	1149156,
+	-1117671,
+	978021,
+	-701982,
+	262122,
+	366325,
+	-1203383,
+	2262129,
+	-3546458,
+	5048930,
+	-6748818,
+	8610456,
+	-10582003,
+	12594688,
+	-14562599,
+	16383023,
+	-17937289,
+	19092031,
+	-19700665,
+	19604817,
+	-18635273,
+	16611814,
+	-13340996,
+	8610371,
+	-2176644,
+	-6256647,
+	17080332,
+	-30856759,
+	48470772,
+	-71447029,
+	102689978,
+	-148485863,
+	225275523,
+	-393227474,
+	1180433453,
+	1247388055,
+	-392599939,
+	219442228,
+	-141461502,
+	95438996,
+	-64349700,
+	41724652,
+	-24580910,
+	11350419,
+	-1119117,
+	-6697812,
+	12509762,
+	-16628988,
+	19312205,
+	-20783032,
+	21243843,
+	-20881551,
+	19869861,
+	-18369512,
+	16527476,
+	-14475722,
+	12329976,
+	-10188742,
+	8132748,
+	-6224917,
+	4510881,
+	-3020007,
+	1766898,
+	-753249,
+	-30025,
+	600509,
+	-981980,
+	1202171,
+	-1290696,
+	1277234,
+	-1189996,
+	1054547,
+	-892964,
+	723343,
+	-559613,
+	411632,
+	-285507,
+	184076,
+	-107506,
+	-107506,
+	184076,
+	-285507,
+	411632,
+	-559613,
+	723343,
+	-892964,
+	1054547,
+	-1189996,
+	1277234,
+	-1290696,
+	1202171,
+	-981980,
+	600509,
+	-30025,
+	-753249,
+	1766898,
+	-3020007,
+	4510881,
+	-6224917,
+	8132748,
+	-10188742,
+	12329976,
+	-14475722,
+	16527476,
+	-18369512,
+	19869861,
+	-20881551,
+	21243843,
+	-20783032,
+	19312205,
+	-16628988,
+	12509762,
+	-6697812,
+	-1119117,
+	11350419,
+	-24580910,
+	41724652,
+	-64349700,
+	95438996,
+	-141461502,
+	219442228,
+	-392599939,
+	1247388055,
+	1180433453,
+	-393227474,
+	225275523,
+	-148485863,
+	102689978,
+	-71447029,
+	48470772,
+	-30856759,
+	17080332,
+	-6256647,
+	-2176644,
+	8610371,
+	-13340996,
+	16611814,
+	-18635273,
+	19604817,
+	-19700665,
+	19092031,
+	-17937289,
+	16383023,
+	-14562599,
+	12594688,
+	-10582003,
+	8610456,
+	-6748818,
+	5048930,
+	-3546458,
+	2262129,
+	-1203383,
+	366325,
+	262122,
+	-701982,
+	978021,
+	-1117671,
+	1149156,
+	-1099900,
+	995244,
+	-857504,
+	705358,
+	-553559,
+	412920,
+	-290548,
+	190249,
+	-113070,
+	-100790,
+	176089,
+	-277805,
+	406661,
+	-560817,
+	735227,
+	-921079,
+	1105390,
+	-1270807,
+	1395678,
+	-1454429,
+	1418289,
+	-1256371,
+	937111,
+	-430025,
+	-292239,
+	1251659,
+	-2462463,
+	3928751,
+	-5642213,
+	7580066,
+	-9703324,
+	11955490,
+	-14261747,
+	16528686,
+	-18644556,
+	20479952,
+	-21888819,
+	22709469,
+	-22765250,
+	21864223,
+	-19796902,
+	16330531,
+	-11197339,
+	4072190,
+	5469019,
+	-18028030,
+	34539475,
+	-56600065,
+	87243603,
+	-133063488,
+	211524605,
+	-388457842,
+	1311991279,
+	1111460664,
+	-390480139,
+	229028657,
+	-154102382,
+	108948483,
+	-77839218,
+	54724534,
+	-36804168,
+	22610645,
+	-11296451,
+	2326883,
+	4666716,
+	-9962304,
+	13787541,
+	-16341796,
+	17807859,
+	-18357660,
+	18154435,
+	-17352796,
+	16097650,
+	-14522590,
+	12748177,
+	-10880425,
+	9009654,
+	-7209858,
+	5538608,
+	-4037520,
+	2733236,
+	-1638838,
+	755619,
+	-75092,
+	-418868,
+	747877,
+	-936963,
+	1012676,
+	-1001423,
+	928115,
+	-815114,
+	681524,
+	-542789,
+	410582,
+	-292941,
+	194599,
+	-117465,
+	-92952,
+	166318,
+	-267456,
+	397979,
+	-557073,
+	740804,
+	-941489,
+	1147208,
+	-1341501,
+	1503327,
+	-1607318,
+	1624386,
+	-1522687,
+	1268957,
+	-830205,
+	175708,
+	720742,
+	-1878431,
+	3307256,
+	-5005310,
+	6956634,
+	-9129260,
+	11473645,
+	-13921570,
+	16385564,
+	-18758847,
+	20915740,
+	-22712398,
+	23987626,
+	-24563404,
+	24244489,
+	-22816185,
+	20038737,
+	-15635811,
+	9272478,
+	-514000,
+	-11252443,
+	26972928,
+	-48257245,
+	78160675,
+	-123338257,
+	201535371,
+	-380680247,
+	1373919501,
+	1040810428,
+	-384515147,
+	230722281,
+	-158289186,
+	114175530,
+	-83480095,
+	60437434,
+	-42375053,
+	27895400,
+	-16195790,
+	6773956,
+	713274,
+	-6522849,
+	10864764,
+	-13923538,
+	15869693,
+	-16865361,
+	17066372,
+	-16622226,
+	15674888,
+	-14357006,
+	12789975,
+	-11082169,
+	9327516,
+	-7604561,
+	5976078,
+	-4489245,
+	3176350,
+	-2055971,
+	1134545,
+	-408218,
+	-135132,
+	513804,
+	-750235,
+	869084,
+	-895533,
+	853851,
+	-766266,
+	652141,
+	-527480,
+	404708,
+	-292720,
+	197131,
+	-120685,
+	-84029,
+	154806,
+	-254495,
+	385594,
+	-548332,
+	739927,
+	-953901,
+	1179506,
+	-1401321,
+	1599099,
+	-1747893,
+	1818541,
+	-1778502,
+	1593087,
+	-1227057,
+	646559,
+	178652,
+	-1272788,
+	2651496,
+	-4319327,
+	6267326,
+	-8470862,
+	10887817,
+	-13457198,
+	16098270,
+	-18710192,
+	21172133,
+	-23343747,
+	25065780,
+	-26160440,
+	26430948,
+	-25659361,
+	23601149,
+	-19974027,
+	14436491,
+	-6547433,
+	-4310942,
+	19086634,
+	-39386225,
+	68255538,
+	-112344328,
+	189504416,
+	-369166109,
+	1432860636,
+	968828982,
+	-375505889,
+	230392999,
+	-161036681,
+	118341421,
+	-88330459,
+	65566123,
+	-47525034,
+	32891166,
+	-20913502,
+	11126562,
+	-3215665,
+	-3052871,
+	7869531,
+	-11402366,
+	13808143,
+	-15237791,
+	15838375,
+	-15752992,
+	15119431,
+	-14068239,
+	12720585,
+	-11186252,
+	9561942,
+	-7930053,
+	6357992,
+	-4898060,
+	3587880,
+	-2451335,
+	1499916,
+	-734403,
+	146756,
+	277881,
+	-559180,
+	719717,
+	-783246,
+	773199,
+	-711481,
+	617555,
+	-507842,
+	395415,
+	-289943,
+	197866,
+	-122736,
+	-74075,
+	141618,
+	-238985,
+	369547,
+	-534583,
+	732499,
+	-958086,
+	1201867,
+	-1449599,
+	1682004,
+	-1874773,
+	1998913,
+	-2021458,
+	1906578,
+	-1617069,
+	1116215,
+	-369965,
+	-650646,
+	1966916,
+	-3589856,
+	5517634,
+	-7733217,
+	10202316,
+	-12871740,
+	15668232,
+	-18497804,
+	21245568,
+	-23775944,
+	25933050,
+	-27540931,
+	28403070,
+	-28300281,
+	26985552,
+	-24173337,
+	19518898,
+	-12579167,
+	2737675,
+	10945667,
+	-30057365,
+	57601547,
+	-100152033,
+	175478973,
+	-353835284,
+	1488516038,
+	895865979,
+	-363640504,
+	228092742,
+	-162347425,
+	121425856,
+	-92358328,
+	70072726,
+	-52213781,
+	37557393,
+	-25410337,
+	15347809,
+	-7086287,
+	417354,
+	4828320,
+	-8800875,
+	11641975,
+	-13490041,
+	14482117,
+	-14753658,
+	14437090,
+	-13659730,
+	12541471,
+	-11192544,
+	9711577,
+	-8184089,
+	6681513,
+	-5260795,
+	3964542,
+	-2821702,
+	1848692,
+	-1050886,
+	424366,
+	42179,
+	-365508,
+	565944,
+	-665622,
+	686949,
+	-651325,
+	578149,
+	-484124,
+	382851,
+	-284689,
+	196842,
+	-123633,
+	-63151,
+	126832,
+	-221009,
+	349911,
+	-515862,
+	718482,
+	-953886,
+	1213956,
+	-1485759,
+	1751155,
+	-1986682,
+	2163764,
+	-2249286,
+	2206572,
+	-1996754,
+	1580549,
+	-920362,
+	-17305,
+	1259258,
+	-2822914,
+	4713624,
+	-6922143,
+	9422358,
+	-12169386,
+	15098129,
+	-18122319,
+	21134054,
+	-24003750,
+	26580313,
+	-28691228,
+	30142039,
+	-30714360,
+	30161023,
+	-28195987,
+	24474692,
+	-18556625,
+	9833093,
+	2618027,
+	-20345865,
+	46279572,
+	-86843150,
+	159523650,
+	-334629415,
+	1540602332,
+	822272401,
+	-349120374,
+	223888033,
+	-162235894,
+	123417979,
+	-95539124,
+	73925102,
+	-56405321,
+	41856733,
+	-29649284,
+	19402237,
+	-10865543,
+	3857780,
+	1767813,
+	-6142194,
+	9390723,
+	-11638139,
+	13010295,
+	-13633849,
+	13634732,
+	-13135935,
+	12255038,
+	-11101767,
+	9775811,
+	-8365058,
+	6944334,
+	-5574711,
+	4303387,
+	-3164096,
+	2178008,
+	-1355017,
+	695332,
+	-191258,
+	-170935,
+	409158,
+	-543756,
+	595930,
+	-586402,
+	534346,
+	-456604,
+	367189,
+	-277058,
+	194113,
+	-123404,
+	-51331,
+	110544,
+	-200680,
+	326794,
+	-492252,
+	697898,
+	-941214,
+	1215526,
+	-1509326,
+	1805775,
+	-2082462,
+	2311473,
+	-2459825,
+	2490298,
+	-2362683,
+	2035442,
+	-1467736,
+	621789,
+	534518,
+	-2024898,
+	3861885,
+	-6044148,
+	8554025,
+	-11355381,
+	14391891,
+	-17585805,
+	20837202,
+	-24023676,
+	27000302,
+	-29599587,
+	31630935,
+	-32878800,
+	33098220,
+	-32005451,
+	29259578,
+	-24427220,
+	16913988,
+	-5825916,
+	-10331185,
+	34377433,
+	-72510435,
+	141720346,
+	-311512682,
+	1588853147,
+	748398474,
+	-332158544,
+	217859157,
+	-160728166,
+	124316329,
+	-97855795,
+	77097064,
+	-60068303,
+	45755331,
+	-33595867,
+	23256111,
+	-14521430,
+	7238840,
+	-1285338,
+	-3449775,
+	7074515,
+	-9698895,
+	11436515,
+	-12404167,
+	12720214,
+	-12502274,
+	11864604,
+	-10915477,
+	9754781,
+	-8472002,
+	7144695,
+	-5837516,
+	4601818,
+	-3475807,
+	2485195,
+	-1644281,
+	957371,
+	-420425,
+	22838,
+	250760,
+	-418763,
+	501000,
+	-517349,
+	486598,
+	-425588,
+	348626,
+	-267168,
+	189744,
+	-122083,
+	-38700,
+	92865,
+	-178128,
+	300337,
+	-463878,
+	670824,
+	-920058,
+	1206417,
+	-1519927,
+	1845203,
+	-2161082,
+	2440553,
+	-2651043,
+	2755103,
+	-2711513,
+	2476818,
+	-2007265,
+	1261092,
+	-201109,
+	-1202530,
+	2969478,
+	-5106377,
+	7604220,
+	-10435984,
+	13554661,
+	-16891751,
+	20356237,
+	-23834021,
+	27187679,
+	-30256290,
+	32854890,
+	-34772807,
+	35769646,
+	-35566761,
+	33830368,
+	-30138809,
+	23918549,
+	-14313996,
+	-96413,
+	21989254,
+	-57257058,
+	122168027,
+	-284472411,
+	1633020765,
+	674591603,
+	-312978094,
+	210099243,
+	-157861512,
+	124128729,
+	-99298864,
+	79568536,
+	-63176222,
+	49223091,
+	-37218421,
+	26877698,
+	-18023261,
+	10531707,
+	-4304744,
+	-747192,
+	4713896,
+	-7689754,
+	9775168,
+	-11076087,
+	11702308,
+	-11765079,
+	11374362,
+	-10636049,
+	9649363,
+	-8504610,
+	7281395,
+	-6047381,
+	4857616,
+	-3754422,
+	2767804,
+	-1916319,
+	1208302,
+	-643379,
+	214135,
+	92146,
+	-291772,
+	403042,
+	-444829,
+	435385,
+	-391409,
+	327379,
+	-255155,
+	183816,
+	-119715,
+	-25350,
+	73925,
+	-153512,
+	270715,
+	-430911,
+	637398,
+	-890482,
+	1186564,
+	-1517302,
+	1868907,
+	-2221651,
+	2549662,
+	-2821056,
+	2998470,
+	-3040017,
+	2900684,
+	-2534153,
+	1895010,
+	-941279,
+	-362801,
+	2043876,
+	-4116554,
+	6580612,
+	-9418425,
+	12592770,
+	-16045047,
+	19694000,
+	-23434900,
+	27139098,
+	-30653742,
+	33801234,
+	-36377786,
+	38149900,
+	-38846823,
+	38145361,
+	-35640148,
+	30785004,
+	-22772861,
+	10272395,
+	9214764,
+	-41195944,
+	100982376,
+	-253519543,
+	1672877637,
+	601194340,
+	-291810462,
+	200713268,
+	-153683904,
+	122872087,
+	-99866429,
+	81325660,
+	-65707604,
+	52233895,
+	-40488347,
+	30237529,
+	-21341916,
+	13708533,
+	-7264502,
+	1942066,
+	2329648,
+	-5628640,
+	8041299,
+	-9661852,
+	10590616,
+	-10931534,
+	10789342,
+	-10266647,
+	9461158,
+	-8463221,
+	7353795,
+	-6202956,
+	5068952,
+	-3997835,
+	3023625,
+	-2168944,
+	1446064,
+	-858252,
+	401322,
+	-65299,
+	-163915,
+	302951,
+	-369527,
+	381211,
+	-354422,
+	303689,
+	-241172,
+	176420,
+	-116355,
+	-11386,
+	53864,
+	-127010,
+	238132,
+	-393566,
+	597818,
+	-852623,
+	1155995,
+	-1501304,
+	1876486,
+	-2263427,
+	2637620,
+	-2968146,
+	3218046,
+	-3345117,
+	3303160,
+	-3043670,
+	2517945,
+	-1679553,
+	487087,
+	1092904,
+	-3082920,
+	5491572,
+	-8310847,
+	11513684,
+	-15051956,
+	18854940,
+	-22828259,
+	26853247,
+	-30786552,
+	34459626,
+	-37677517,
+	40215922,
+	-41814721,
+	42164723,
+	-40881347,
+	37452156,
+	-31128582,
+	20686918,
+	-3841463,
+	-24449027,
+	78295317,
+	-218688941,
+	1708217799,
+	528542391,
+	-268893736,
+	189816985,
+	-148253442,
+	120572136,
+	-99564080,
+	82360852,
+	-67646139,
+	54765796,
+	-43380325,
+	33308628,
+	-24450085,
+	16742683,
+	-10139416,
+	4594797,
+	-57396,
+	-3533797,
+	6250470,
+	-8174361,
+	9395482,
+	-10009603,
+	10115353,
+	-9811190,
+	9192473,
+	-8348812,
+	7361821,
+	-6303371,
+	5234398,
+	-4204269,
+	3250699,
+	-2400161,
+	1668732,
+	-1063266,
+	582820,
+	-220222,
+	-36316,
+	201629,
+	-292141,
+	324596,
+	-315000,
+	277811,
+	-225385,
+	167661,
+	-112063,
+	3081,
+	32838,
+	-98820,
+	202824,
+	-352101,
+	552336,
+	-806696,
+	1114832,
+	-1471901,
+	1867676,
+	-2285825,
+	2703422,
+	-3090781,
+	3411665,
+	-3623910,
+	3680517,
+	-3531195,
+	3124347,
+	-2409456,
+	1339786,
+	124674,
+	-2014164,
+	4346113,
+	-7122242,
+	10325948,
+	-13920063,
+	17845079,
+	-22017870,
+	26330875,
+	-30651600,
+	34822156,
+	-38658318,
+	41947205,
+	-44442001,
+	45850845,
+	-45814314,
+	43859921,
+	-39307292,
+	31057291,
+	-17070816,
+	-7146413,
+	54254408,
+	-180039550,
+	1738858143,
+	456962686,
+	-244470930,
+	177535795,
+	-141637711,
+	117263093,
+	-98404773,
+	82672797,
+	-68980770,
+	56801169,
+	-45872510,
+	36066731,
+	-27322488,
+	19608959,
+	-12905212,
+	7188285,
+	-2426530,
+	-1423629,
+	4418623,
+	-6627055,
+	8127895,
+	-9007955,
+	9358935,
+	-9274314,
+	8846295,
+	-8162988,
+	7305957,
+	-6348247,
+	5352942,
+	-4372283,
+	3447339,
+	-2608184,
+	1874535,
+	-1256751,
+	757118,
+	-371305,
+	89917,
+	99975,
+	-213377,
+	266075,
+	-273531,
+	250014,
+	-207974,
+	157650,
+	-106908,
+	17930,
+	11016,
+	-69161,
+	165057,
+	-306815,
+	501266,
+	-752990,
+	1063296,
+	-1429180,
+	1842357,
+	-2288423,
+	2746243,
+	-3187625,
+	3577364,
+	-3873695,
+	4029214,
+	-3992259,
+	3708763,
+	-3124527,
+	2187858,
+	-852488,
+	-919352,
+	3153806,
+	-5862377,
+	9039123,
+	-12658224,
+	16671976,
+	-21009311,
+	25574801,
+	-30248079,
+	34883437,
+	-39309182,
+	43325995,
+	-46702943,
+	49168693,
+	-50393188,
+	49949852,
+	-47235819,
+	41292863,
+	-30361506,
+	10574531,
+	29022106,
+	-137654401,
+	1764639549,
+	386771521,
+	-218788249,
+	164003561,
+	-133913070,
+	112987257,
+	-96408626,
+	82266401,
+	-69705743,
+	58326824,
+	-47946692,
+	38490472,
+	-29936079,
+	22283803,
+	-15538741,
+	9700494,
+	-4757354,
+	683464,
+	2561941,
+	-5033792,
+	6799393,
+	-7935886,
+	8527289,
+	-8661323,
+	8426260,
+	-7907960,
+	7187240,
+	-6337687,
+	5423984,
+	-4500785,
+	3612139,
+	-2791443,
+	2061864,
+	-1437155,
+	922785,
+	-517283,
+	213704,
+	-1119,
+	-133944,
+	206190,
+	-230414,
+	220580,
+	-189127,
+	146510,
+	-100962,
+	33035,
+	-11424,
+	-38270,
+	125122,
+	-258047,
+	444971,
+	-691866,
+	1001699,
+	-1373347,
+	1800549,
+	-2270970,
+	2765455,
+	-3257557,
+	3713407,
+	-4092000,
+	4345925,
+	-4422584,
+	4265884,
+	-3818384,
+	3023848,
+	-1830109,
+	192153,
+	1924711,
+	-4541717,
+	7663707,
+	-11276494,
+	15344672,
+	-19809931,
+	24589904,
+	-29577518,
+	34640667,
+	-39621895,
+	44337473,
+	-48574802,
+	52086130,
+	-54574757,
+	55665667,
+	-54842320,
+	51302952,
+	-43599461,
+	28570167,
+	2774915,
+	-91640451,
+	1785427880,
+	318272771,
+	-192093362,
+	149361384,
+	-125163880,
+	107794548,
+	-93602669,
+	81152679,
+	-69820602,
+	59334084,
+	-49588416,
+	40561546,
+	-32270228,
+	24745491,
+	-18018168,
+	12110254,
+	-7029950,
+	2769239,
+	696700,
+	-3408728,
+	5421952,
+	-6803232,
+	7628217,
+	-7978143,
+	7936615,
+	-7586520,
+	7007242,
+	-6272277,
+	5447346,
+	-4589035,
+	3743983,
+	-2948603,
+	2229292,
+	-1603058,
+	1078483,
+	-656948,
+	333998,
+	-100781,
+	-54544,
+	145486,
+	-186057,
+	189801,
+	-169044,
+	134368,
+	-94306,
+	48264,
+	-34291,
+	-6399,
+	83335,
+	-206170,
+	383870,
+	-623757,
+	930448,
+	-1304725,
+	1742421,
+	-2233388,
+	2760629,
+	-3299677,
+	3818300,
+	-4276604,
+	4627577,
+	-4818123,
+	4790592,
+	-4484774,
+	3840342,
+	-2799644,
+	1310764,
+	669283,
+	-3171341,
+	6211049,
+	-9786051,
+	13873622,
+	-18428799,
+	23383096,
+	-28643787,
+	34093676,
+	-39591125,
+	44969899,
+	-50038034,
+	54574222,
+	-58318858,
+	60953755,
+	-62056922,
+	60997624,
+	-56669247,
+	46691640,
+	-24297580,
+	-42128269,
+	1801114808,
+	251756211,
+	-164633686,
+	133756337,
+	-115481679,
+	101741982,
+	-90020536,
+	79348600,
+	-69330147,
+	59818813,
+	-50787087,
+	42264837,
+	-34306880,
+	26974308,
+	-20323156,
+	14397435,
+	-9225046,
+	4815776,
+	-1160866,
+	-1766186,
+	4007885,
+	-5620279,
+	6670040,
+	-7231258,
+	7382176,
+	-7202016,
+	6768054,
+	-6153073,
+	5423265,
+	-4636653,
+	3842053,
+	-3078568,
+	2375579,
+	-1753180,
+	1222976,
+	-789165,
+	449800,
+	-198162,
+	24130,
+	84508,
+	-140870,
+	157974,
+	-147930,
+	121360,
+	-87023,
+	63479,
+	-57388,
+	26186,
+	40036,
+	-151595,
+	318429,
+	-549165,
+	850042,
+	-1223756,
+	1668287,
+	-2175775,
+	2731543,
+	-3313324,
+	3890810,
+	-4425562,
+	4871371,
+	-5175097,
+	5278010,
+	-5117632,
+	4630037,
+	-3752551,
+	2426760,
+	-601710,
+	-1762842,
+	4693260,
+	-8199107,
+	12270611,
+	-16876638,
+	21963277,
+	-27453082,
+	33244945,
+	-39214494,
+	45214744,
+	-51076493,
+	56607519,
+	-61588752,
+	65763665,
+	-68812339,
+	70288473,
+	-69455029,
+	64785996,
+	-51993803,
+	10728440,
+	1811618493,
+	187495932,
+	-136654712,
+	117340189,
+	-104964314,
+	94893100,
+	-85702097,
+	76876882,
+	-68244338,
+	59781420,
+	-51536016,
+	43588532,
+	-36030691,
+	28952699,
+	-22435026,
+	16543118,
+	-11324186,
+	6805620,
+	-2994711,
+	-120540,
+	2569729,
+	-4397671,
+	5661531,
+	-6427655,
+	6768283,
+	-6758311,
+	6472264,
+	-5981591,
+	5352387,
+	-4643613,
+	3905833,
+	-3180489,
+	2499680,
+	-1886396,
+	1355142,
+	-912875,
+	560160,
+	-292446,
+	101403,
+	23792,
+	-95264,
+	125398,
+	-125995,
+	107624,
+	-79199,
+	78540,
+	-80510,
+	59207,
+	-4416,
+	-94760,
+	249162,
+	-468655,
+	761066,
+	-1130996,
+	1578604,
+	-2098408,
+	2678185,
+	-3298080,
+	3929973,
+	-4537223,
+	5074819,
+	-5490030,
+	5723545,
+	-5711135,
+	5385803,
+	-4680361,
+	3530364,
+	-1877279,
+	-328238,
+	3123109,
+	-6528804,
+	10548664,
+	-15165740,
+	20341271,
+	-26013885,
+	32099605,
+	-38492622,
+	45066787,
+	-51677594,
+	58164302,
+	-64351478,
+	70048576,
+	-75044484,
+	79089392,
+	-81841534,
+	82697352,
+	-80101364,
+	66753465,
+	1816884089,
+	125748871,
+	-108398354,
+	100268107,
+	-93715031,
+	87317342,
+	-80693054,
+	73765738,
+	-66578167,
+	59226809,
+	-51832458,
+	44524189,
+	-37429141,
+	30665411,
+	-24336911,
+	18529746,
+	-13309878,
+	8721941,
+	-4789113,
+	1513922,
+	1120136,
+	-3146313,
+	4611830,
+	-5574759,
+	6100749,
+	-6259756,
+	6122930,
+	-5759785,
+	5235760,
+	-4610244,
+	3935110,
+	-3253773,
+	2600759,
+	-2001738,
+	1473976,
+	-1027111,
+	664189,
+	-382855,
+	176622,
+	-36134,
+	-49646,
+	92376,
+	-103450,
+	93303,
+	-70924
+
+};
+
+struct src_stage src_int32_32_21_4535_5000 = {
+	19, 29, 32, 88, 2816, 21, 32, 0, 0,
+	src_int32_32_21_4535_5000_fir};
@@ -0,0 +1,587 @@
+const int32_t src_int32_5_7_4535_5000_fir[580] = {
+	-38462,
+	102037,
+	-72148,
+	-86806,
+	244982,
+	-186919,
+	-141915,
+	473280,
+	-397340,
+	-187336,
+	808089,
+	-747573,
+	-195266,
+	1267400,
+	-1290620,
+	-124131,
+	1862996,
+	-2087472,
+	83625,
+	2597229,
+	-3206005,
+	503640,
+	3459880,
+	-4720116,
+	1232004,
+	4425273,
+	-6709929,
+	2388757,
+	5449689,
+	-9264427,
+	4124263,
+	6468882,
+	-12488886,
+	6631873,
+	7394907,
+	-16521547,
+	10173924,
+	8110372,
+	-21568831,
+	15136712,
+	8455490,
+	-27981085,
+	22153148,
+	8196015,
+	-36428239,
+	32402994,
+	6936436,
+	-48365082,
+	48465985,
+	3847703,
+	-67552099,
+	77407167,
+	-3451383,
+	-107149959,
+	148106542,
+	-26985239,
+	-263979820,
+	675163560,
+	1360559814,
+	422296181,
+	-296356995,
+	61390476,
+	101494530,
+	-121738169,
+	38984670,
+	50604492,
+	-74494343,
+	30312615,
+	29446445,
+	-51461564,
+	24997411,
+	17865433,
+	-37340107,
+	20967875,
+	10720364,
+	-27608459,
+	17578651,
+	6078478,
+	-20466630,
+	14594914,
+	3027658,
+	-15056157,
+	11931733,
+	1060616,
+	-10907820,
+	9563958,
+	-143345,
+	-7732141,
+	7488456,
+	-807434,
+	-5329184,
+	5706376,
+	-1097151,
+	-3546771,
+	4214587,
+	-1139145,
+	-2260592,
+	3002025,
+	-1030708,
+	-1364959,
+	2048968,
+	-845072,
+	-768849,
+	1328114,
+	-634978,
+	-394476,
+	806726,
+	-435664,
+	-176872,
+	449257,
+	-267796,
+	-63643,
+	220020,
+	-140471,
+	-14441,
+	85560,
+	-11926,
+	100674,
+	-123276,
+	-10151,
+	225704,
+	-286630,
+	22119,
+	410302,
+	-560863,
+	114669,
+	659024,
+	-985865,
+	309379,
+	968355,
+	-1605453,
+	661596,
+	1323524,
+	-2465302,
+	1241157,
+	1695315,
+	-3610681,
+	2133312,
+	2036935,
+	-5084462,
+	3440094,
+	2280814,
+	-6926036,
+	5283235,
+	2334806,
+	-9172086,
+	7810654,
+	2076577,
+	-11860702,
+	11210356,
+	1343485,
+	-15041462,
+	15739546,
+	-87924,
+	-18796883,
+	21786254,
+	-2546527,
+	-23287973,
+	30006609,
+	-6571081,
+	-28858693,
+	41661572,
+	-13182949,
+	-36312147,
+	59582467,
+	-24733276,
+	-47823497,
+	91731585,
+	-48439346,
+	-71330548,
+	172077963,
+	-123518492,
+	-171356279,
+	918199510,
+	1279817231,
+	183792909,
+	-274922585,
+	128609793,
+	42151697,
+	-114355243,
+	71830791,
+	16672584,
+	-68155633,
+	50194321,
+	6190082,
+	-45458996,
+	37944159,
+	794633,
+	-31695235,
+	29590890,
+	-2161196,
+	-22421077,
+	23295741,
+	-3717043,
+	-15822210,
+	18292171,
+	-4391361,
+	-11008277,
+	14214653,
+	-4491361,
+	-7476392,
+	10868583,
+	-4222698,
+	-4906485,
+	8136568,
+	-3733666,
+	-3073197,
+	5936006,
+	-3134595,
+	-1805125,
+	4198990,
+	-2507111,
+	-965303,
+	2863077,
+	-1909228,
+	-441782,
+	1867756,
+	-1378874,
+	-143034,
+	1153981,
+	-937008,
+	4471,
+	665236,
+	-590769,
+	57895,
+	349200,
+	-336729,
+	59603,
+	159402,
+	-164148,
+	38952,
+	56486,
+	21662,
+	79151,
+	-156875,
+	77178,
+	161316,
+	-341465,
+	196549,
+	264959,
+	-632202,
+	417755,
+	376704,
+	-1057176,
+	789380,
+	471589,
+	-1642672,
+	1370679,
+	510337,
+	-2410247,
+	2231231,
+	436749,
+	-3373708,
+	3450527,
+	175110,
+	-4536317,
+	5118135,
+	-372860,
+	-5888540,
+	7335568,
+	-1332510,
+	-7406670,
+	10221801,
+	-2864363,
+	-9052534,
+	13926055,
+	-5180071,
+	-10774474,
+	18654989,
+	-8575441,
+	-12509594,
+	24730287,
+	-13501925,
+	-14187193,
+	32716655,
+	-20732902,
+	-15733139,
+	43736502,
+	-31797613,
+	-17074829,
+	60380772,
+	-50342566,
+	-18146337,
+	90137084,
+	-87957601,
+	-18893253,
+	166430704,
+	-211958158,
+	-19276798,
+	1126971574,
+	1126971574,
+	-19276798,
+	-211958158,
+	166430704,
+	-18893253,
+	-87957601,
+	90137084,
+	-18146337,
+	-50342566,
+	60380772,
+	-17074829,
+	-31797613,
+	43736502,
+	-15733139,
+	-20732902,
+	32716655,
+	-14187193,
+	-13501925,
+	24730287,
+	-12509594,
+	-8575441,
+	18654989,
+	-10774474,
+	-5180071,
+	13926055,
+	-9052534,
+	-2864363,
+	10221801,
+	-7406670,
+	-1332510,
+	7335568,
+	-5888540,
+	-372860,
+	5118135,
+	-4536317,
+	175110,
+	3450527,
+	-3373708,
+	436749,
+	2231231,
+	-2410247,
+	510337,
+	1370679,
+	-1642672,
+	471589,
+	789380,
+	-1057176,
+	376704,
+	417755,
+	-632202,
+	264959,
+	196549,
+	-341465,
+	161316,
+	77178,
+	-156875,
+	79151,
+	21662,
+	56486,
+	38952,
+	-164148,
+	159402,
+	59603,
+	-336729,
+	349200,
+	57895,
+	-590769,
+	665236,
+	4471,
+	-937008,
+	1153981,
+	-143034,
+	-1378874,
+	1867756,
+	-441782,
+	-1909228,
+	2863077,
+	-965303,
+	-2507111,
+	4198990,
+	-1805125,
+	-3134595,
+	5936006,
+	-3073197,
+	-3733666,
+	8136568,
+	-4906485,
+	-4222698,
+	10868583,
+	-7476392,
+	-4491361,
+	14214653,
+	-11008277,
+	-4391361,
+	18292171,
+	-15822210,
+	-3717043,
+	23295741,
+	-22421077,
+	-2161196,
+	29590890,
+	-31695235,
+	794633,
+	37944159,
+	-45458996,
+	6190082,
+	50194321,
+	-68155633,
+	16672584,
+	71830791,
+	-114355243,
+	42151697,
+	128609793,
+	-274922585,
+	183792909,
+	1279817231,
+	918199510,
+	-171356279,
+	-123518492,
+	172077963,
+	-71330548,
+	-48439346,
+	91731585,
+	-47823497,
+	-24733276,
+	59582467,
+	-36312147,
+	-13182949,
+	41661572,
+	-28858693,
+	-6571081,
+	30006609,
+	-23287973,
+	-2546527,
+	21786254,
+	-18796883,
+	-87924,
+	15739546,
+	-15041462,
+	1343485,
+	11210356,
+	-11860702,
+	2076577,
+	7810654,
+	-9172086,
+	2334806,
+	5283235,
+	-6926036,
+	2280814,
+	3440094,
+	-5084462,
+	2036935,
+	2133312,
+	-3610681,
+	1695315,
+	1241157,
+	-2465302,
+	1323524,
+	661596,
+	-1605453,
+	968355,
+	309379,
+	-985865,
+	659024,
+	114669,
+	-560863,
+	410302,
+	22119,
+	-286630,
+	225704,
+	-10151,
+	-123276,
+	100674,
+	-11926,
+	85560,
+	-14441,
+	-140471,
+	220020,
+	-63643,
+	-267796,
+	449257,
+	-176872,
+	-435664,
+	806726,
+	-394476,
+	-634978,
+	1328114,
+	-768849,
+	-845072,
+	2048968,
+	-1364959,
+	-1030708,
+	3002025,
+	-2260592,
+	-1139145,
+	4214587,
+	-3546771,
+	-1097151,
+	5706376,
+	-5329184,
+	-807434,
+	7488456,
+	-7732141,
+	-143345,
+	9563958,
+	-10907820,
+	1060616,
+	11931733,
+	-15056157,
+	3027658,
+	14594914,
+	-20466630,
+	6078478,
+	17578651,
+	-27608459,
+	10720364,
+	20967875,
+	-37340107,
+	17865433,
+	24997411,
+	-51461564,
+	29446445,
+	30312615,
+	-74494343,
+	50604492,
+	38984670,
+	-121738169,
+	101494530,
+	61390476,
+	-296356995,
+	422296181,
+	1360559814,
+	675163560,
+	-263979820,
+	-26985239,
+	148106542,
+	-107149959,
+	-3451383,
+	77407167,
+	-67552099,
+	3847703,
+	48465985,
+	-48365082,
+	6936436,
+	32402994,
+	-36428239,
+	8196015,
+	22153148,
+	-27981085,
+	8455490,
+	15136712,
+	-21568831,
+	8110372,
+	10173924,
+	-16521547,
+	7394907,
+	6631873,
+	-12488886,
+	6468882,
+	4124263,
+	-9264427,
+	5449689,
+	2388757,
+	-6709929,
+	4425273,
+	1232004,
+	-4720116,
+	3459880,
+	503640,
+	-3206005,
+	2597229,
+	83625,
+	-2087472,
+	1862996,
+	-124131,
+	-1290620,
+	1267400,
+	-195266,
+	-747573,
+	808089,
+	-187336,
+	-397340,
+	473280,
+	-141915,
+	-186919,
+	244982,
+	-86806,
+	-72148,
+	102037,
+	-38462
+
+};
+
+struct src_stage src_int32_5_7_4535_5000 = {
+	4, 3, 5, 116, 580, 7, 5, 0, 0,
+	src_int32_5_7_4535_5000_fir};
@@ -0,0 +1,391 @@
+const int32_t src_int32_6_5_4354_5000_fir[384] = {
+	-122729,
+	196634,
+	-249782,
+	247228,
+	-144395,
+	-109525,
+	565887,
+	-1268757,
+	2245363,
+	-3495634,
+	4981904,
+	-6620079,
+	8273620,
+	-9751632,
+	10812091,
+	-11170770,
+	10515920,
+	-8528033,
+	4903361,
+	620828,
+	-8241850,
+	18071114,
+	-30121039,
+	44303371,
+	-60444150,
+	78323752,
+	-97759589,
+	118776503,
+	-142002792,
+	169812384,
+	-210916831,
+	314734689,
+	1865916563,
+	-13004206,
+	-60572172,
+	83031930,
+	-89887398,
+	89039047,
+	-83556033,
+	75128491,
+	-64926564,
+	53865148,
+	-42689976,
+	32002640,
+	-22265509,
+	13802955,
+	-6805786,
+	1341418,
+	2629977,
+	-5234475,
+	6660371,
+	-7133253,
+	6892271,
+	-6169392,
+	5172972,
+	-4076403,
+	3012002,
+	-2069806,
+	1300460,
+	-721154,
+	323399,
+	-81465,
+	-39539,
+	76746,
+	-162323,
+	288382,
+	-430169,
+	559717,
+	-634563,
+	598435,
+	-384367,
+	-79457,
+	861136,
+	-2014137,
+	3564771,
+	-5499170,
+	7751141,
+	-10192388,
+	12626599,
+	-14788626,
+	16349570,
+	-16927941,
+	16106305,
+	-13451864,
+	8538426,
+	-965962,
+	-9627644,
+	23570709,
+	-41191016,
+	62903738,
+	-89411161,
+	122164212,
+	-164553432,
+	225657595,
+	-336741254,
+	699423821,
+	1721178547,
+	-250187728,
+	79972277,
+	-12626314,
+	-22250260,
+	41522712,
+	-51468862,
+	55163663,
+	-54468639,
+	50705446,
+	-44911645,
+	37940474,
+	-30497334,
+	23150979,
+	-16336703,
+	10359773,
+	-5402812,
+	1538281,
+	1254322,
+	-3067852,
+	4045259,
+	-4357570,
+	4183830,
+	-3694379,
+	3038345,
+	-2335736,
+	1673994,
+	-1108468,
+	665942,
+	-350220,
+	148707,
+	-39046,
+	-166351,
+	321375,
+	-528470,
+	773480,
+	-1025826,
+	1236191,
+	-1336245,
+	1241100,
+	-854928,
+	79902,
+	1171778,
+	-2963460,
+	5318269,
+	-8203425,
+	11516243,
+	-15073474,
+	18605395,
+	-21755646,
+	24087065,
+	-25092821,
+	24210826,
+	-20837670,
+	14335759,
+	-4022932,
+	-10874888,
+	31347458,
+	-58891845,
+	96217809,
+	-149156391,
+	233001432,
+	-402830430,
+	1095427867,
+	1451967844,
+	-379784762,
+	183278830,
+	-95584911,
+	44691924,
+	-11898744,
+	-9852006,
+	23927867,
+	-32276875,
+	36232633,
+	-36834829,
+	34960944,
+	-31376441,
+	26748533,
+	-21644850,
+	16528002,
+	-11751861,
+	7562409,
+	-4104130,
+	1431660,
+	474425,
+	-1689268,
+	2324598,
+	-2510495,
+	2379451,
+	-2053729,
+	1636582,
+	-1207376,
+	820305,
+	-506047,
+	275522,
+	-124854,
+	-124854,
+	275522,
+	-506047,
+	820305,
+	-1207376,
+	1636582,
+	-2053729,
+	2379451,
+	-2510495,
+	2324598,
+	-1689268,
+	474425,
+	1431660,
+	-4104130,
+	7562409,
+	-11751861,
+	16528002,
+	-21644850,
+	26748533,
+	-31376441,
+	34960944,
+	-36834829,
+	36232633,
+	-32276875,
+	23927867,
+	-9852006,
+	-11898744,
+	44691924,
+	-95584911,
+	183278830,
+	-379784762,
+	1451967844,
+	1095427867,
+	-402830430,
+	233001432,
+	-149156391,
+	96217809,
+	-58891845,
+	31347458,
+	-10874888,
+	-4022932,
+	14335759,
+	-20837670,
+	24210826,
+	-25092821,
+	24087065,
+	-21755646,
+	18605395,
+	-15073474,
+	11516243,
+	-8203425,
+	5318269,
+	-2963460,
+	1171778,
+	79902,
+	-854928,
+	1241100,
+	-1336245,
+	1236191,
+	-1025826,
+	773480,
+	-528470,
+	321375,
+	-166351,
+	-39046,
+	148707,
+	-350220,
+	665942,
+	-1108468,
+	1673994,
+	-2335736,
+	3038345,
+	-3694379,
+	4183830,
+	-4357570,
+	4045259,
+	-3067852,
+	1254322,
+	1538281,
+	-5402812,
+	10359773,
+	-16336703,
+	23150979,
+	-30497334,
+	37940474,
+	-44911645,
+	50705446,
+	-54468639,
+	55163663,
+	-51468862,
+	41522712,
+	-22250260,
+	-12626314,
+	79972277,
+	-250187728,
+	1721178547,
+	699423821,
+	-336741254,
+	225657595,
+	-164553432,
+	122164212,
+	-89411161,
+	62903738,
+	-41191016,
+	23570709,
+	-9627644,
+	-965962,
+	8538426,
+	-13451864,
+	16106305,
+	-16927941,
+	16349570,
+	-14788626,
+	12626599,
+	-10192388,
+	7751141,
+	-5499170,
+	3564771,
+	-2014137,
+	861136,
+	-79457,
+	-384367,
+	598435,
+	-634563,
+	559717,
+	-430169,
+	288382,
+	-162323,
+	76746,
+	-39539,
+	-81465,
+	323399,
+	-721154,
+	1300460,
+	-2069806,
+	3012002,
+	-4076403,
+	5172972,
+	-6169392,
+	6892271,
+	-7133253,
+	6660371,
+	-5234475,
+	2629977,
+	1341418,
+	-6805786,
+	13802955,
+	-22265509,
+	32002640,
+	-42689976,
+	53865148,
+	-64926564,
+	75128491,
+	-83556033,
+	89039047,
+	-89887398,
+	83031930,
+	-60572172,
+	-13004206,
+	1865916563,
+	314734689,
+	-210916831,
+	169812384,
+	-142002792,
+	118776503,
+	-97759589,
+	78323752,
+	-60444150,
+	44303371,
+	-30121039,
+	18071114,
+	-8241850,
+	620828,
+	4903361,
+	-8528033,
+	10515920,
+	-11170770,
+	10812091,
+	-9751632,
+	8273620,
+	-6620079,
+	4981904,
+	-3495634,
+	2245363,
+	-1268757,
+	565887,
+	-109525,
+	-144395,
+	247228,
+	-249782,
+	196634,
+	-122729
+
+};
+
+struct src_stage src_int32_6_5_4354_5000 = {
+	4, 5, 6, 64, 384, 5, 6, 0, 0,
+	src_int32_6_5_4354_5000_fir};
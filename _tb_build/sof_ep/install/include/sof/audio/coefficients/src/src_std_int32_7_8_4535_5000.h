@@ -0,0 +1,651 @@
+const int32_t src_int32_7_8_4535_5000_fir[644] = {
+	-1007,
+	-96094,
+	242640,
+	-381988,
+	424738,
+	-280782,
+	-93512,
+	650578,
+	-1232177,
+	1594041,
+	-1479668,
+	727727,
+	622321,
+	-2272348,
+	3695256,
+	-4267611,
+	3482895,
+	-1184302,
+	-2268506,
+	5981440,
+	-8703830,
+	9186789,
+	-6635500,
+	1113458,
+	6258943,
+	-13430918,
+	17903445,
+	-17479559,
+	11084235,
+	609059,
+	-14995467,
+	27951399,
+	-34829269,
+	31832387,
+	-17414295,
+	-6718221,
+	35362958,
+	-60530092,
+	73033814,
+	-64633956,
+	30188470,
+	30811190,
+	-113932062,
+	211410274,
+	-317877633,
+	461686142,
+	1668052163,
+	209738924,
+	-242218976,
+	205545620,
+	-141891825,
+	71019482,
+	-7602771,
+	-38214594,
+	61616268,
+	-63199427,
+	48005297,
+	-23712768,
+	-1521836,
+	21028332,
+	-30937164,
+	30605674,
+	-22173610,
+	9489454,
+	3218003,
+	-12533544,
+	16619057,
+	-15412986,
+	10308030,
+	-3487402,
+	-2834248,
+	7034088,
+	-8416490,
+	7218636,
+	-4347977,
+	980404,
+	1835272,
+	-3451050,
+	3715641,
+	-2901752,
+	1523539,
+	-124452,
+	-892483,
+	1349154,
+	-1285582,
+	886509,
+	-381800,
+	-40076,
+	280288,
+	-333735,
+	259847,
+	-139778,
+	-47510,
+	-32575,
+	187993,
+	-379272,
+	520014,
+	-499461,
+	228113,
+	307119,
+	-1001281,
+	1628033,
+	-1890280,
+	1521405,
+	-410322,
+	-1295157,
+	3156998,
+	-4523127,
+	4713001,
+	-3271039,
+	208228,
+	3864443,
+	-7790464,
+	10138976,
+	-9647531,
+	5717425,
+	1204229,
+	-9518385,
+	16744747,
+	-20159998,
+	17665599,
+	-8640951,
+	-5505824,
+	21332740,
+	-34015860,
+	38580205,
+	-31437366,
+	11820142,
+	17324920,
+	-49324227,
+	74761113,
+	-83287701,
+	65805814,
+	-16310156,
+	-67599344,
+	187515183,
+	-358876654,
+	730996555,
+	1592150862,
+	-8011351,
+	-145526975,
+	173436395,
+	-149186864,
+	99457121,
+	-42465930,
+	-7889760,
+	42430804,
+	-57303990,
+	53756119,
+	-36940236,
+	14046507,
+	7749565,
+	-23011835,
+	29063396,
+	-26147585,
+	16817970,
+	-4835454,
+	-6058053,
+	13141672,
+	-15260034,
+	12839891,
+	-7466769,
+	1218560,
+	4011786,
+	-7009738,
+	7441987,
+	-5765883,
+	2929457,
+	7983,
+	-2206283,
+	3237738,
+	-3114585,
+	2178707,
+	-918114,
+	-216419,
+	937554,
+	-1164499,
+	989881,
+	-600348,
+	188897,
+	109772,
+	-245295,
+	240863,
+	-159883,
+	-93748,
+	43522,
+	100159,
+	-321356,
+	548300,
+	-663024,
+	539377,
+	-101861,
+	-614984,
+	1434364,
+	-2056897,
+	2141837,
+	-1435660,
+	-91075,
+	2153099,
+	-4157667,
+	5336292,
+	-4985281,
+	2752143,
+	1129530,
+	-5759525,
+	9715137,
+	-11423736,
+	9684497,
+	-4187480,
+	-4154992,
+	13224059,
+	-20129512,
+	22007494,
+	-16989113,
+	5053360,
+	11539062,
+	-28454845,
+	40199395,
+	-41580905,
+	29385503,
+	-3809322,
+	-30793319,
+	66133852,
+	-91205216,
+	94171436,
+	-64227720,
+	-7873114,
+	133963932,
+	-353785685,
+	998244056,
+	1446575195,
+	-178771684,
+	-42062699,
+	121497390,
+	-136315458,
+	113076178,
+	-69940265,
+	22138004,
+	18352023,
+	-43957431,
+	52093682,
+	-44757780,
+	27213478,
+	-6141629,
+	-12245613,
+	23663331,
+	-26483087,
+	21657700,
+	-11987520,
+	1028195,
+	8008442,
+	-13061279,
+	13563713,
+	-10310403,
+	4969657,
+	556273,
+	-4712515,
+	6658675,
+	-6356815,
+	4409621,
+	-1746520,
+	-718168,
+	2347226,
+	-2901103,
+	2511608,
+	-1549828,
+	453401,
+	423418,
+	-895194,
+	954999,
+	-724500,
+	376326,
+	-61948,
+	-131992,
+	191763,
+	-156345,
+	-132395,
+	122157,
+	-11210,
+	-211769,
+	500108,
+	-743914,
+	795093,
+	-522325,
+	-118804,
+	1027618,
+	-1943007,
+	2492897,
+	-2309262,
+	1181498,
+	803466,
+	-3195751,
+	5240567,
+	-6072791,
+	5010976,
+	-1865338,
+	-2852992,
+	7925181,
+	-11673970,
+	12441411,
+	-9178272,
+	1962208,
+	7753186,
+	-17304733,
+	23435447,
+	-23248298,
+	15251838,
+	-174443,
+	-18760839,
+	36292247,
+	-46302635,
+	43505079,
+	-25224170,
+	-7212191,
+	47891729,
+	-86756328,
+	110928362,
+	-106317740,
+	58041280,
+	54810193,
+	-294785465,
+	1243169872,
+	1243169872,
+	-294785465,
+	54810193,
+	58041280,
+	-106317740,
+	110928362,
+	-86756328,
+	47891729,
+	-7212191,
+	-25224170,
+	43505079,
+	-46302635,
+	36292247,
+	-18760839,
+	-174443,
+	15251838,
+	-23248298,
+	23435447,
+	-17304733,
+	7753186,
+	1962208,
+	-9178272,
+	12441411,
+	-11673970,
+	7925181,
+	-2852992,
+	-1865338,
+	5010976,
+	-6072791,
+	5240567,
+	-3195751,
+	803466,
+	1181498,
+	-2309262,
+	2492897,
+	-1943007,
+	1027618,
+	-118804,
+	-522325,
+	795093,
+	-743914,
+	500108,
+	-211769,
+	-11210,
+	122157,
+	-132395,
+	-156345,
+	191763,
+	-131992,
+	-61948,
+	376326,
+	-724500,
+	954999,
+	-895194,
+	423418,
+	453401,
+	-1549828,
+	2511608,
+	-2901103,
+	2347226,
+	-718168,
+	-1746520,
+	4409621,
+	-6356815,
+	6658675,
+	-4712515,
+	556273,
+	4969657,
+	-10310403,
+	13563713,
+	-13061279,
+	8008442,
+	1028195,
+	-11987520,
+	21657700,
+	-26483087,
+	23663331,
+	-12245613,
+	-6141629,
+	27213478,
+	-44757780,
+	52093682,
+	-43957431,
+	18352023,
+	22138004,
+	-69940265,
+	113076178,
+	-136315458,
+	121497390,
+	-42062699,
+	-178771684,
+	1446575195,
+	998244056,
+	-353785685,
+	133963932,
+	-7873114,
+	-64227720,
+	94171436,
+	-91205216,
+	66133852,
+	-30793319,
+	-3809322,
+	29385503,
+	-41580905,
+	40199395,
+	-28454845,
+	11539062,
+	5053360,
+	-16989113,
+	22007494,
+	-20129512,
+	13224059,
+	-4154992,
+	-4187480,
+	9684497,
+	-11423736,
+	9715137,
+	-5759525,
+	1129530,
+	2752143,
+	-4985281,
+	5336292,
+	-4157667,
+	2153099,
+	-91075,
+	-1435660,
+	2141837,
+	-2056897,
+	1434364,
+	-614984,
+	-101861,
+	539377,
+	-663024,
+	548300,
+	-321356,
+	100159,
+	43522,
+	-93748,
+	-159883,
+	240863,
+	-245295,
+	109772,
+	188897,
+	-600348,
+	989881,
+	-1164499,
+	937554,
+	-216419,
+	-918114,
+	2178707,
+	-3114585,
+	3237738,
+	-2206283,
+	7983,
+	2929457,
+	-5765883,
+	7441987,
+	-7009738,
+	4011786,
+	1218560,
+	-7466769,
+	12839891,
+	-15260034,
+	13141672,
+	-6058053,
+	-4835454,
+	16817970,
+	-26147585,
+	29063396,
+	-23011835,
+	7749565,
+	14046507,
+	-36940236,
+	53756119,
+	-57303990,
+	42430804,
+	-7889760,
+	-42465930,
+	99457121,
+	-149186864,
+	173436395,
+	-145526975,
+	-8011351,
+	1592150862,
+	730996555,
+	-358876654,
+	187515183,
+	-67599344,
+	-16310156,
+	65805814,
+	-83287701,
+	74761113,
+	-49324227,
+	17324920,
+	11820142,
+	-31437366,
+	38580205,
+	-34015860,
+	21332740,
+	-5505824,
+	-8640951,
+	17665599,
+	-20159998,
+	16744747,
+	-9518385,
+	1204229,
+	5717425,
+	-9647531,
+	10138976,
+	-7790464,
+	3864443,
+	208228,
+	-3271039,
+	4713001,
+	-4523127,
+	3156998,
+	-1295157,
+	-410322,
+	1521405,
+	-1890280,
+	1628033,
+	-1001281,
+	307119,
+	228113,
+	-499461,
+	520014,
+	-379272,
+	187993,
+	-32575,
+	-47510,
+	-139778,
+	259847,
+	-333735,
+	280288,
+	-40076,
+	-381800,
+	886509,
+	-1285582,
+	1349154,
+	-892483,
+	-124452,
+	1523539,
+	-2901752,
+	3715641,
+	-3451050,
+	1835272,
+	980404,
+	-4347977,
+	7218636,
+	-8416490,
+	7034088,
+	-2834248,
+	-3487402,
+	10308030,
+	-15412986,
+	16619057,
+	-12533544,
+	3218003,
+	9489454,
+	-22173610,
+	30605674,
+	-30937164,
+	21028332,
+	-1521836,
+	-23712768,
+	48005297,
+	-63199427,
+	61616268,
+	-38214594,
+	-7602771,
+	71019482,
+	-141891825,
+	205545620,
+	-242218976,
+	209738924,
+	1668052163,
+	461686142,
+	-317877633,
+	211410274,
+	-113932062,
+	30811190,
+	30188470,
+	-64633956,
+	73033814,
+	-60530092,
+	35362958,
+	-6718221,
+	-17414295,
+	31832387,
+	-34829269,
+	27951399,
+	-14995467,
+	609059,
+	11084235,
+	-17479559,
+	17903445,
+	-13430918,
+	6258943,
+	1113458,
+	-6635500,
+	9186789,
+	-8703830,
+	5981440,
+	-2268506,
+	-1184302,
+	3482895,
+	-4267611,
+	3695256,
+	-2272348,
+	622321,
+	727727,
+	-1479668,
+	1594041,
+	-1232177,
+	650578,
+	-93512,
+	-280782,
+	424738,
+	-381988,
+	242640,
+	-96094,
+	-1007
+
+};
+
+struct src_stage src_int32_7_8_4535_5000 = {
+	1, 1, 7, 92, 644, 8, 7, 0, 0,
+	src_int32_7_8_4535_5000_fir};
@@ -0,0 +1,487 @@
+const int32_t src_int32_8_21_3239_5000_fir[480] = {
+	-149226,
+	295321,
+	1071448,
+	1138422,
+	-528828,
+	-3225632,
+	-4049899,
+	-310478,
+	6610126,
+	10275415,
+	4168095,
+	-10301522,
+	-21063319,
+	-13977156,
+	11892756,
+	36950332,
+	33586760,
+	-6995570,
+	-57316330,
+	-68136346,
+	-11773742,
+	80400887,
+	126946515,
+	59284423,
+	-104342845,
+	-239861449,
+	-186516191,
+	132922525,
+	629542365,
+	1076186058,
+	1240069506,
+	1031911724,
+	564808985,
+	79785089,
+	-207589635,
+	-230252369,
+	-82083007,
+	74474519,
+	126552414,
+	69492235,
+	-22059907,
+	-70366989,
+	-52177836,
+	-483802,
+	36189265,
+	34870231,
+	8130976,
+	-16072056,
+	-20469254,
+	-8370280,
+	5529287,
+	10263546,
+	5758331,
+	-1035658,
+	-4165896,
+	-2917837,
+	-225353,
+	1213730,
+	985491,
+	209441,
+	-125242,
+	387782,
+	1146499,
+	1033582,
+	-851794,
+	-3504250,
+	-3856853,
+	472093,
+	7411867,
+	10123475,
+	2660308,
+	-12178967,
+	-21360175,
+	-11558511,
+	15655163,
+	38560661,
+	30349957,
+	-13693333,
+	-61809257,
+	-64771346,
+	-853017,
+	90582781,
+	125434492,
+	42441972,
+	-126220886,
+	-246405629,
+	-161050786,
+	189026078,
+	693505507,
+	1115840947,
+	1233971170,
+	983412235,
+	499834323,
+	29947857,
+	-224300515,
+	-217881629,
+	-59767649,
+	87876352,
+	124342567,
+	58044839,
+	-31589397,
+	-71478433,
+	-46496253,
+	5754146,
+	38146729,
+	32372328,
+	4425920,
+	-17827357,
+	-19601843,
+	-6417408,
+	6731118,
+	10097584,
+	4872903,
+	-1695708,
+	-4208409,
+	-2588200,
+	55043,
+	1260863,
+	891418,
+	131239,
+	-92452,
+	485451,
+	1207812,
+	898324,
+	-1189989,
+	-3746324,
+	-3584312,
+	1302794,
+	8146945,
+	9800167,
+	1021838,
+	-13969585,
+	-21339515,
+	-8837921,
+	19359411,
+	39654211,
+	26499944,
+	-20482535,
+	-65559571,
+	-60273374,
+	10565347,
+	99852390,
+	121949620,
+	24113017,
+	-147379419,
+	-249603676,
+	-131209647,
+	247723041,
+	756167262,
+	1150521271,
+	1221830041,
+	931116717,
+	435139661,
+	-16296482,
+	-236722314,
+	-203070278,
+	-37708079,
+	99384497,
+	120428804,
+	46246471,
+	-40256053,
+	-71501493,
+	-40377760,
+	11638211,
+	39458483,
+	29512557,
+	830263,
+	-19233125,
+	-18487964,
+	-4473748,
+	7764001,
+	9789133,
+	3969814,
+	-2284446,
+	-4181986,
+	-2243896,
+	309469,
+	1281591,
+	791922,
+	61532,
+	-50476,
+	586678,
+	1252570,
+	732295,
+	-1538503,
+	-3944587,
+	-3231068,
+	2170906,
+	8798834,
+	9300349,
+	-728353,
+	-15639985,
+	-20985100,
+	-5843078,
+	22944839,
+	40189905,
+	22068278,
+	-27263058,
+	-68477368,
+	-54661027,
+	22331038,
+	108029490,
+	116450780,
+	4492404,
+	-167473081,
+	-249200418,
+	-97055662,
+	308605343,
+	816999850,
+	1179914989,
+	1203756592,
+	875484447,
+	371233281,
+	-58698883,
+	-244970574,
+	-186152865,
+	-16197399,
+	108924134,
+	114941998,
+	34282027,
+	-47970555,
+	-70481563,
+	-33930531,
+	17096957,
+	40133511,
+	26349794,
+	-2607392,
+	-20285222,
+	-17156944,
+	-2568400,
+	8621517,
+	9351387,
+	3064350,
+	-2797256,
+	-4092017,
+	-1891823,
+	535725,
+	1278029,
+	689552,
+	865,
+	865,
+	689552,
+	1278029,
+	535725,
+	-1891823,
+	-4092017,
+	-2797256,
+	3064350,
+	9351387,
+	8621517,
+	-2568400,
+	-17156944,
+	-20285222,
+	-2607392,
+	26349794,
+	40133511,
+	17096957,
+	-33930531,
+	-70481563,
+	-47970555,
+	34282027,
+	114941998,
+	108924134,
+	-16197399,
+	-186152865,
+	-244970574,
+	-58698883,
+	371233281,
+	875484447,
+	1203756592,
+	1179914989,
+	816999850,
+	308605343,
+	-97055662,
+	-249200418,
+	-167473081,
+	4492404,
+	116450780,
+	108029490,
+	22331038,
+	-54661027,
+	-68477368,
+	-27263058,
+	22068278,
+	40189905,
+	22944839,
+	-5843078,
+	-20985100,
+	-15639985,
+	-728353,
+	9300349,
+	8798834,
+	2170906,
+	-3231068,
+	-3944587,
+	-1538503,
+	732295,
+	1252570,
+	586678,
+	-50476,
+	61532,
+	791922,
+	1281591,
+	309469,
+	-2243896,
+	-4181986,
+	-2284446,
+	3969814,
+	9789133,
+	7764001,
+	-4473748,
+	-18487964,
+	-19233125,
+	830263,
+	29512557,
+	39458483,
+	11638211,
+	-40377760,
+	-71501493,
+	-40256053,
+	46246471,
+	120428804,
+	99384497,
+	-37708079,
+	-203070278,
+	-236722314,
+	-16296482,
+	435139661,
+	931116717,
+	1221830041,
+	1150521271,
+	756167262,
+	247723041,
+	-131209647,
+	-249603676,
+	-147379419,
+	24113017,
+	121949620,
+	99852390,
+	10565347,
+	-60273374,
+	-65559571,
+	-20482535,
+	26499944,
+	39654211,
+	19359411,
+	-8837921,
+	-21339515,
+	-13969585,
+	1021838,
+	9800167,
+	8146945,
+	1302794,
+	-3584312,
+	-3746324,
+	-1189989,
+	898324,
+	1207812,
+	485451,
+	-92452,
+	131239,
+	891418,
+	1260863,
+	55043,
+	-2588200,
+	-4208409,
+	-1695708,
+	4872903,
+	10097584,
+	6731118,
+	-6417408,
+	-19601843,
+	-17827357,
+	4425920,
+	32372328,
+	38146729,
+	5754146,
+	-46496253,
+	-71478433,
+	-31589397,
+	58044839,
+	124342567,
+	87876352,
+	-59767649,
+	-217881629,
+	-224300515,
+	29947857,
+	499834323,
+	983412235,
+	1233971170,
+	1115840947,
+	693505507,
+	189026078,
+	-161050786,
+	-246405629,
+	-126220886,
+	42441972,
+	125434492,
+	90582781,
+	-853017,
+	-64771346,
+	-61809257,
+	-13693333,
+	30349957,
+	38560661,
+	15655163,
+	-11558511,
+	-21360175,
+	-12178967,
+	2660308,
+	10123475,
+	7411867,
+	472093,
+	-3856853,
+	-3504250,
+	-851794,
+	1033582,
+	1146499,
+	387782,
+	-125242,
+	209441,
+	985491,
+	1213730,
+	-225353,
+	-2917837,
+	-4165896,
+	-1035658,
+	5758331,
+	10263546,
+	5529287,
+	-8370280,
+	-20469254,
+	-16072056,
+	8130976,
+	34870231,
+	36189265,
+	-483802,
+	-52177836,
+	-70366989,
+	-22059907,
+	69492235,
+	126552414,
+	74474519,
+	-82083007,
+	-230252369,
+	-207589635,
+	79785089,
+	564808985,
+	1031911724,
+	1240069506,
+	1076186058,
+	629542365,
+	132922525,
+	-186516191,
+	-239861449,
+	-104342845,
+	59284423,
+	126946515,
+	80400887,
+	-11773742,
+	-68136346,
+	-57316330,
+	-6995570,
+	33586760,
+	36950332,
+	11892756,
+	-13977156,
+	-21063319,
+	-10301522,
+	4168095,
+	10275415,
+	6610126,
+	-310478,
+	-4049899,
+	-3225632,
+	-528828,
+	1138422,
+	1071448,
+	295321,
+	-149226
+
+};
+
+struct src_stage src_int32_8_21_3239_5000 = {
+	13, 5, 8, 60, 480, 21, 8, 0, 1,
+	src_int32_8_21_3239_5000_fir};
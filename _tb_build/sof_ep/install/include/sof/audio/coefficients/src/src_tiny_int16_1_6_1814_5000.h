@@ -0,0 +1,99 @@
+const int16_t src_int16_1_6_1814_5000_fir[92] = {
+	-4,
+	0,
+	10,
+	26,
+	47,
+	70,
+	90,
+	100,
+	91,
+	58,
+	-3,
+	-92,
+	-202,
+	-319,
+	-423,
+	-488,
+	-491,
+	-409,
+	-230,
+	45,
+	397,
+	788,
+	1165,
+	1461,
+	1606,
+	1536,
+	1208,
+	606,
+	-245,
+	-1275,
+	-2374,
+	-3391,
+	-4154,
+	-4486,
+	-4223,
+	-3243,
+	-1481,
+	1055,
+	4275,
+	8009,
+	12021,
+	16024,
+	19713,
+	22791,
+	25001,
+	26156,
+	26156,
+	25001,
+	22791,
+	19713,
+	16024,
+	12021,
+	8009,
+	4275,
+	1055,
+	-1481,
+	-3243,
+	-4223,
+	-4486,
+	-4154,
+	-3391,
+	-2374,
+	-1275,
+	-245,
+	606,
+	1208,
+	1536,
+	1606,
+	1461,
+	1165,
+	788,
+	397,
+	45,
+	-230,
+	-409,
+	-491,
+	-488,
+	-423,
+	-319,
+	-202,
+	-92,
+	-3,
+	58,
+	91,
+	100,
+	90,
+	70,
+	47,
+	26,
+	10,
+	0,
+	-4
+
+};
+
+struct src_stage src_int16_1_6_1814_5000 = {
+	1, 0, 1, 92, 92, 6, 1, 0, 3,
+	src_int16_1_6_1814_5000_fir};
@@ -0,0 +1,327 @@
+const int16_t src_int16_20_21_1667_5000_fir[320] = {
+	3,
+	49,
+	-174,
+	-95,
+	1057,
+	-1065,
+	-2563,
+	9160,
+	19031,
+	8358,
+	-2759,
+	-857,
+	1033,
+	-137,
+	-154,
+	49,
+	4,
+	48,
+	-192,
+	-49,
+	1072,
+	-1276,
+	-2325,
+	9961,
+	18967,
+	7557,
+	-2917,
+	-654,
+	1000,
+	-174,
+	-135,
+	48,
+	5,
+	47,
+	-211,
+	2,
+	1075,
+	-1487,
+	-2044,
+	10754,
+	18840,
+	6762,
+	-3034,
+	-457,
+	958,
+	-206,
+	-116,
+	46,
+	7,
+	44,
+	-230,
+	57,
+	1067,
+	-1696,
+	-1720,
+	11535,
+	18649,
+	5978,
+	-3113,
+	-268,
+	910,
+	-233,
+	-98,
+	44,
+	9,
+	41,
+	-245,
+	116,
+	1046,
+	-1901,
+	-1353,
+	12299,
+	18398,
+	5209,
+	-3157,
+	-88,
+	855,
+	-255,
+	-80,
+	42,
+	12,
+	36,
+	-260,
+	178,
+	1012,
+	-2100,
+	-944,
+	13043,
+	18086,
+	4459,
+	-3166,
+	82,
+	795,
+	-273,
+	-63,
+	39,
+	14,
+	30,
+	-273,
+	244,
+	965,
+	-2291,
+	-492,
+	13761,
+	17717,
+	3730,
+	-3143,
+	239,
+	731,
+	-286,
+	-48,
+	36,
+	17,
+	24,
+	-284,
+	311,
+	904,
+	-2468,
+	1,
+	14447,
+	17293,
+	3028,
+	-3090,
+	385,
+	663,
+	-295,
+	-33,
+	33,
+	20,
+	14,
+	-293,
+	381,
+	828,
+	-2631,
+	533,
+	15102,
+	16816,
+	2354,
+	-3010,
+	517,
+	594,
+	-300,
+	-19,
+	30,
+	23,
+	4,
+	-298,
+	452,
+	739,
+	-2778,
+	1104,
+	15717,
+	16289,
+	1712,
+	-2905,
+	635,
+	523,
+	-301,
+	-6,
+	26,
+	26,
+	-6,
+	-301,
+	523,
+	635,
+	-2905,
+	1712,
+	16289,
+	15717,
+	1104,
+	-2778,
+	739,
+	452,
+	-298,
+	4,
+	23,
+	30,
+	-19,
+	-300,
+	594,
+	517,
+	-3010,
+	2354,
+	16816,
+	15102,
+	533,
+	-2631,
+	828,
+	381,
+	-293,
+	14,
+	20,
+	33,
+	-33,
+	-295,
+	663,
+	385,
+	-3090,
+	3028,
+	17293,
+	14447,
+	1,
+	-2468,
+	904,
+	311,
+	-284,
+	24,
+	17,
+	36,
+	-48,
+	-286,
+	731,
+	239,
+	-3143,
+	3730,
+	17717,
+	13761,
+	-492,
+	-2291,
+	965,
+	244,
+	-273,
+	30,
+	14,
+	39,
+	-63,
+	-273,
+	795,
+	82,
+	-3166,
+	4459,
+	18086,
+	13043,
+	-944,
+	-2100,
+	1012,
+	178,
+	-260,
+	36,
+	12,
+	42,
+	-80,
+	-255,
+	855,
+	-88,
+	-3157,
+	5209,
+	18398,
+	12299,
+	-1353,
+	-1901,
+	1046,
+	116,
+	-245,
+	41,
+	9,
+	44,
+	-98,
+	-233,
+	910,
+	-268,
+	-3113,
+	5978,
+	18649,
+	11535,
+	-1720,
+	-1696,
+	1067,
+	57,
+	-230,
+	44,
+	7,
+	46,
+	-116,
+	-206,
+	958,
+	-457,
+	-3034,
+	6762,
+	18840,
+	10754,
+	-2044,
+	-1487,
+	1075,
+	2,
+	-211,
+	47,
+	5,
+	48,
+	-135,
+	-174,
+	1000,
+	-654,
+	-2917,
+	7557,
+	18967,
+	9961,
+	-2325,
+	-1276,
+	1072,
+	-49,
+	-192,
+	48,
+	4,
+	49,
+	-154,
+	-137,
+	1033,
+	-857,
+	-2759,
+	8358,
+	19031,
+	9160,
+	-2563,
+	-1065,
+	1057,
+	-95,
+	-174,
+	49,
+	3
+
+};
+
+struct src_stage src_int16_20_21_1667_5000 = {
+	1, 1, 20, 16, 320, 21, 20, 0, 0,
+	src_int16_20_21_1667_5000_fir};
@@ -0,0 +1,487 @@
+const int16_t src_int16_24_25_1814_5000_fir[480] = {
+	5,
+	-32,
+	-12,
+	226,
+	-303,
+	-355,
+	1406,
+	-874,
+	-2925,
+	8597,
+	18418,
+	7934,
+	-3078,
+	-676,
+	1367,
+	-406,
+	-266,
+	224,
+	-20,
+	-29,
+	6,
+	-36,
+	-3,
+	226,
+	-339,
+	-299,
+	1435,
+	-1076,
+	-2743,
+	9258,
+	18375,
+	7272,
+	-3201,
+	-481,
+	1321,
+	-452,
+	-229,
+	221,
+	-27,
+	-26,
+	6,
+	-39,
+	6,
+	225,
+	-375,
+	-238,
+	1455,
+	-1278,
+	-2530,
+	9915,
+	18287,
+	6614,
+	-3296,
+	-290,
+	1267,
+	-492,
+	-193,
+	216,
+	-33,
+	-23,
+	7,
+	-42,
+	16,
+	221,
+	-410,
+	-172,
+	1465,
+	-1480,
+	-2288,
+	10564,
+	18157,
+	5961,
+	-3363,
+	-107,
+	1206,
+	-527,
+	-156,
+	210,
+	-39,
+	-20,
+	6,
+	-45,
+	27,
+	215,
+	-443,
+	-102,
+	1465,
+	-1680,
+	-2014,
+	11203,
+	17983,
+	5317,
+	-3403,
+	71,
+	1139,
+	-557,
+	-120,
+	202,
+	-44,
+	-17,
+	6,
+	-48,
+	38,
+	208,
+	-474,
+	-28,
+	1453,
+	-1876,
+	-1710,
+	11832,
+	17769,
+	4684,
+	-3417,
+	239,
+	1067,
+	-581,
+	-86,
+	193,
+	-48,
+	-14,
+	5,
+	-51,
+	49,
+	198,
+	-504,
+	49,
+	1431,
+	-2071,
+	-1377,
+	12445,
+	17513,
+	4064,
+	-3407,
+	400,
+	992,
+	-599,
+	-52,
+	183,
+	-52,
+	-11,
+	5,
+	-53,
+	61,
+	185,
+	-532,
+	130,
+	1396,
+	-2256,
+	-1013,
+	13040,
+	17217,
+	3458,
+	-3373,
+	550,
+	910,
+	-613,
+	-20,
+	173,
+	-54,
+	-9,
+	4,
+	-55,
+	74,
+	171,
+	-555,
+	214,
+	1350,
+	-2434,
+	-620,
+	13615,
+	16883,
+	2870,
+	-3318,
+	690,
+	826,
+	-621,
+	11,
+	162,
+	-56,
+	-8,
+	3,
+	-56,
+	87,
+	155,
+	-576,
+	299,
+	1292,
+	-2602,
+	-198,
+	14167,
+	16512,
+	2301,
+	-3241,
+	820,
+	740,
+	-625,
+	40,
+	150,
+	-58,
+	-5,
+	2,
+	-57,
+	99,
+	136,
+	-594,
+	387,
+	1222,
+	-2759,
+	251,
+	14695,
+	16106,
+	1754,
+	-3146,
+	938,
+	653,
+	-625,
+	67,
+	138,
+	-59,
+	-2,
+	1,
+	-58,
+	112,
+	115,
+	-608,
+	475,
+	1139,
+	-2903,
+	727,
+	15195,
+	15667,
+	1228,
+	-3032,
+	1044,
+	564,
+	-618,
+	92,
+	125,
+	-59,
+	-1,
+	-1,
+	-59,
+	125,
+	92,
+	-618,
+	564,
+	1045,
+	-3031,
+	1228,
+	15667,
+	15195,
+	727,
+	-2903,
+	1139,
+	475,
+	-608,
+	115,
+	112,
+	-58,
+	1,
+	-2,
+	-59,
+	138,
+	67,
+	-625,
+	653,
+	938,
+	-3146,
+	1754,
+	16106,
+	14695,
+	251,
+	-2759,
+	1222,
+	387,
+	-594,
+	136,
+	99,
+	-57,
+	2,
+	-5,
+	-58,
+	150,
+	40,
+	-625,
+	740,
+	820,
+	-3241,
+	2301,
+	16512,
+	14167,
+	-198,
+	-2602,
+	1292,
+	299,
+	-576,
+	155,
+	87,
+	-56,
+	3,
+	-8,
+	-56,
+	162,
+	11,
+	-621,
+	826,
+	690,
+	-3318,
+	2870,
+	16883,
+	13615,
+	-620,
+	-2434,
+	1350,
+	214,
+	-555,
+	171,
+	74,
+	-55,
+	4,
+	-9,
+	-54,
+	173,
+	-20,
+	-613,
+	910,
+	550,
+	-3373,
+	3458,
+	17217,
+	13040,
+	-1013,
+	-2256,
+	1396,
+	130,
+	-532,
+	185,
+	61,
+	-53,
+	5,
+	-11,
+	-52,
+	183,
+	-52,
+	-599,
+	992,
+	400,
+	-3407,
+	4064,
+	17513,
+	12445,
+	-1377,
+	-2070,
+	1431,
+	49,
+	-504,
+	198,
+	49,
+	-50,
+	5,
+	-14,
+	-48,
+	193,
+	-86,
+	-581,
+	1067,
+	239,
+	-3417,
+	4684,
+	17769,
+	11832,
+	-1710,
+	-1876,
+	1453,
+	-28,
+	-474,
+	208,
+	38,
+	-48,
+	6,
+	-17,
+	-44,
+	202,
+	-120,
+	-557,
+	1139,
+	71,
+	-3403,
+	5317,
+	17983,
+	11204,
+	-2014,
+	-1680,
+	1465,
+	-102,
+	-443,
+	215,
+	27,
+	-45,
+	6,
+	-20,
+	-39,
+	210,
+	-156,
+	-527,
+	1206,
+	-107,
+	-3363,
+	5961,
+	18157,
+	10564,
+	-2288,
+	-1480,
+	1465,
+	-172,
+	-410,
+	221,
+	16,
+	-42,
+	7,
+	-23,
+	-33,
+	216,
+	-193,
+	-492,
+	1267,
+	-290,
+	-3296,
+	6614,
+	18287,
+	9915,
+	-2530,
+	-1278,
+	1455,
+	-238,
+	-375,
+	225,
+	6,
+	-39,
+	6,
+	-26,
+	-27,
+	221,
+	-229,
+	-452,
+	1321,
+	-481,
+	-3201,
+	7272,
+	18375,
+	9258,
+	-2743,
+	-1076,
+	1435,
+	-299,
+	-339,
+	226,
+	-3,
+	-36,
+	6,
+	-29,
+	-20,
+	224,
+	-266,
+	-406,
+	1367,
+	-676,
+	-3078,
+	7934,
+	18418,
+	8597,
+	-2925,
+	-874,
+	1406,
+	-355,
+	-303,
+	226,
+	-12,
+	-32,
+	5
+
+};
+
+struct src_stage src_int16_24_25_1814_5000 = {
+	1, 1, 24, 20, 480, 25, 24, 0, 0,
+	src_int16_24_25_1814_5000_fir};
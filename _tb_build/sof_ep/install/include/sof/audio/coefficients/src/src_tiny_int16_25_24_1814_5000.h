@@ -0,0 +1,407 @@
+const int16_t src_int16_25_24_1814_5000_fir[400] = {
+	-6,
+	60,
+	-44,
+	-371,
+	964,
+	-263,
+	-3138,
+	8142,
+	19177,
+	7454,
+	-3223,
+	-96,
+	905,
+	-384,
+	-26,
+	55,
+	-7,
+	64,
+	-62,
+	-355,
+	1019,
+	-436,
+	-3025,
+	8833,
+	19131,
+	6770,
+	-3280,
+	63,
+	843,
+	-393,
+	-10,
+	50,
+	-6,
+	69,
+	-82,
+	-334,
+	1068,
+	-616,
+	-2882,
+	9523,
+	19038,
+	6095,
+	-3310,
+	214,
+	778,
+	-398,
+	5,
+	45,
+	-7,
+	73,
+	-102,
+	-309,
+	1112,
+	-800,
+	-2709,
+	10209,
+	18899,
+	5429,
+	-3316,
+	355,
+	710,
+	-400,
+	19,
+	40,
+	-5,
+	77,
+	-123,
+	-280,
+	1150,
+	-988,
+	-2505,
+	10889,
+	18715,
+	4775,
+	-3297,
+	487,
+	640,
+	-398,
+	32,
+	36,
+	-5,
+	80,
+	-144,
+	-247,
+	1181,
+	-1178,
+	-2269,
+	11560,
+	18487,
+	4137,
+	-3255,
+	609,
+	570,
+	-394,
+	43,
+	31,
+	-4,
+	84,
+	-166,
+	-210,
+	1204,
+	-1369,
+	-2002,
+	12218,
+	18216,
+	3515,
+	-3192,
+	720,
+	499,
+	-386,
+	53,
+	27,
+	-4,
+	86,
+	-189,
+	-168,
+	1219,
+	-1561,
+	-1704,
+	12862,
+	17902,
+	2913,
+	-3109,
+	820,
+	429,
+	-376,
+	63,
+	24,
+	-2,
+	88,
+	-211,
+	-123,
+	1225,
+	-1750,
+	-1374,
+	13489,
+	17548,
+	2332,
+	-3009,
+	909,
+	359,
+	-364,
+	69,
+	19,
+	-1,
+	89,
+	-233,
+	-73,
+	1222,
+	-1936,
+	-1013,
+	14094,
+	17155,
+	1774,
+	-2891,
+	986,
+	290,
+	-349,
+	75,
+	15,
+	1,
+	89,
+	-255,
+	-20,
+	1209,
+	-2116,
+	-621,
+	14677,
+	16725,
+	1240,
+	-2759,
+	1053,
+	223,
+	-333,
+	80,
+	12,
+	3,
+	88,
+	-276,
+	36,
+	1186,
+	-2291,
+	-199,
+	15234,
+	16260,
+	733,
+	-2614,
+	1108,
+	158,
+	-315,
+	84,
+	10,
+	6,
+	85,
+	-296,
+	96,
+	1152,
+	-2457,
+	253,
+	15762,
+	15762,
+	253,
+	-2457,
+	1152,
+	96,
+	-296,
+	85,
+	6,
+	10,
+	84,
+	-315,
+	158,
+	1108,
+	-2614,
+	733,
+	16260,
+	15234,
+	-199,
+	-2291,
+	1186,
+	36,
+	-276,
+	88,
+	3,
+	12,
+	80,
+	-333,
+	223,
+	1053,
+	-2759,
+	1240,
+	16725,
+	14677,
+	-621,
+	-2116,
+	1209,
+	-20,
+	-255,
+	89,
+	1,
+	15,
+	75,
+	-349,
+	290,
+	986,
+	-2891,
+	1774,
+	17155,
+	14094,
+	-1013,
+	-1936,
+	1222,
+	-73,
+	-233,
+	89,
+	-1,
+	19,
+	69,
+	-364,
+	359,
+	909,
+	-3009,
+	2332,
+	17548,
+	13489,
+	-1374,
+	-1750,
+	1225,
+	-123,
+	-211,
+	88,
+	-2,
+	24,
+	63,
+	-376,
+	429,
+	820,
+	-3109,
+	2913,
+	17902,
+	12862,
+	-1704,
+	-1561,
+	1219,
+	-168,
+	-189,
+	86,
+	-4,
+	27,
+	53,
+	-386,
+	499,
+	720,
+	-3192,
+	3515,
+	18216,
+	12218,
+	-2002,
+	-1369,
+	1204,
+	-210,
+	-166,
+	84,
+	-4,
+	31,
+	43,
+	-394,
+	570,
+	609,
+	-3255,
+	4137,
+	18487,
+	11560,
+	-2269,
+	-1178,
+	1181,
+	-247,
+	-144,
+	80,
+	-5,
+	36,
+	32,
+	-398,
+	640,
+	487,
+	-3297,
+	4775,
+	18715,
+	10889,
+	-2505,
+	-988,
+	1150,
+	-280,
+	-123,
+	77,
+	-5,
+	40,
+	19,
+	-400,
+	710,
+	355,
+	-3316,
+	5429,
+	18899,
+	10209,
+	-2709,
+	-800,
+	1112,
+	-309,
+	-102,
+	73,
+	-7,
+	45,
+	5,
+	-398,
+	778,
+	214,
+	-3310,
+	6095,
+	19038,
+	9523,
+	-2882,
+	-616,
+	1068,
+	-334,
+	-82,
+	69,
+	-6,
+	50,
+	-10,
+	-393,
+	843,
+	63,
+	-3280,
+	6770,
+	19131,
+	8833,
+	-3025,
+	-436,
+	1019,
+	-355,
+	-62,
+	64,
+	-7,
+	55,
+	-26,
+	-384,
+	905,
+	-96,
+	-3223,
+	7454,
+	19177,
+	8142,
+	-3138,
+	-263,
+	964,
+	-371,
+	-44,
+	60,
+	-6
+
+};
+
+struct src_stage src_int16_25_24_1814_5000 = {
+	23, 24, 25, 16, 400, 24, 25, 0, 0,
+	src_int16_25_24_1814_5000_fir};
@@ -0,0 +1,147 @@
+const int16_t src_int16_7_8_1814_5000_fir[140] = {
+	-3,
+	-28,
+	94,
+	64,
+	-488,
+	259,
+	1261,
+	-1931,
+	-1887,
+	10203,
+	18176,
+	8115,
+	-2649,
+	-1325,
+	1329,
+	28,
+	-432,
+	112,
+	66,
+	-28,
+	-7,
+	-24,
+	120,
+	-1,
+	-512,
+	508,
+	1079,
+	-2481,
+	-817,
+	12206,
+	17732,
+	6027,
+	-3108,
+	-712,
+	1294,
+	-171,
+	-354,
+	142,
+	40,
+	-26,
+	-11,
+	-15,
+	141,
+	-80,
+	-497,
+	758,
+	780,
+	-2925,
+	547,
+	14036,
+	16864,
+	4023,
+	-3284,
+	-136,
+	1174,
+	-327,
+	-264,
+	155,
+	17,
+	-21,
+	-16,
+	-2,
+	154,
+	-170,
+	-436,
+	988,
+	370,
+	-3209,
+	2176,
+	15612,
+	15612,
+	2176,
+	-3209,
+	370,
+	988,
+	-436,
+	-170,
+	154,
+	-2,
+	-16,
+	-21,
+	17,
+	155,
+	-264,
+	-327,
+	1174,
+	-136,
+	-3284,
+	4023,
+	16864,
+	14036,
+	547,
+	-2925,
+	780,
+	758,
+	-497,
+	-80,
+	141,
+	-15,
+	-11,
+	-26,
+	40,
+	142,
+	-354,
+	-171,
+	1294,
+	-712,
+	-3108,
+	6027,
+	17732,
+	12206,
+	-817,
+	-2481,
+	1079,
+	508,
+	-512,
+	-1,
+	120,
+	-24,
+	-7,
+	-28,
+	66,
+	112,
+	-432,
+	28,
+	1329,
+	-1325,
+	-2649,
+	8115,
+	18176,
+	10203,
+	-1887,
+	-1931,
+	1261,
+	259,
+	-488,
+	64,
+	94,
+	-28,
+	-3
+
+};
+
+struct src_stage src_int16_7_8_1814_5000 = {
+	1, 1, 7, 20, 140, 8, 7, 0, 0,
+	src_int16_7_8_1814_5000_fir};
@@ -0,0 +1,135 @@
+const int16_t src_int16_8_7_1814_5000_fir[128] = {
+	-7,
+	55,
+	-1,
+	-445,
+	979,
+	-144,
+	-3442,
+	9206,
+	20768,
+	6823,
+	-3621,
+	389,
+	744,
+	-452,
+	48,
+	37,
+	-10,
+	74,
+	-63,
+	-397,
+	1175,
+	-760,
+	-2944,
+	11596,
+	20255,
+	4544,
+	-3521,
+	815,
+	493,
+	-423,
+	82,
+	21,
+	-9,
+	90,
+	-137,
+	-302,
+	1307,
+	-1423,
+	-2106,
+	13893,
+	19254,
+	2451,
+	-3194,
+	1118,
+	249,
+	-368,
+	101,
+	8,
+	-7,
+	102,
+	-217,
+	-160,
+	1355,
+	-2085,
+	-916,
+	15997,
+	17811,
+	614,
+	-2696,
+	1297,
+	26,
+	-297,
+	106,
+	0,
+	0,
+	106,
+	-297,
+	26,
+	1297,
+	-2695,
+	614,
+	17811,
+	15997,
+	-915,
+	-2085,
+	1355,
+	-160,
+	-217,
+	102,
+	-7,
+	9,
+	101,
+	-368,
+	248,
+	1118,
+	-3194,
+	2450,
+	19254,
+	13893,
+	-2105,
+	-1423,
+	1308,
+	-302,
+	-137,
+	90,
+	-9,
+	21,
+	82,
+	-423,
+	493,
+	815,
+	-3521,
+	4544,
+	20255,
+	11596,
+	-2945,
+	-760,
+	1175,
+	-397,
+	-63,
+	74,
+	-10,
+	37,
+	47,
+	-452,
+	744,
+	389,
+	-3621,
+	6823,
+	20768,
+	9206,
+	-3442,
+	-144,
+	979,
+	-445,
+	0,
+	55,
+	-7
+
+};
+
+struct src_stage src_int16_8_7_1814_5000 = {
+	6, 7, 8, 16, 128, 7, 8, 0, 0,
+	src_int16_8_7_1814_5000_fir};
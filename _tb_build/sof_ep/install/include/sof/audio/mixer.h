@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: Janusz Jankowski <janusz.jankowski@linux.intel.com>
+ */
+
+#ifndef __INCLUDE_AUDIO_MIXER_H__
+#define __INCLUDE_AUDIO_MIXER_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sof/audio/component.h>
+#include <sof/audio/format.h>
+#include <platform/platform.h>
+
+#define MIXER_GENERIC
+
+#if defined(__SSE4_2__) || defined(__AVX2__)
+#undef MIXER_GENERIC
+#endif
+
+/* number of samples mixed per accumulator block */
+#define MIXER_BLOCK_SAMPLES	64
+
+/* per source gain is Q8.16 like the volume component gain */
+#define MIXER_GAIN_QXY_Y	16
+#define MIXER_GAIN_UNITY	(1 << MIXER_GAIN_QXY_Y)
+#define MIXER_GAIN_MAX		((1 << (8 + MIXER_GAIN_QXY_Y - 1)) - 1)
+
+/* mixer component private data */
+struct mixer_data {
+	/* block processing functions for the stream frame format */
+	void (*acc_func)(void *acc, const void *src, int32_t gain,
+			 uint32_t samples, int first);
+	void (*sat_func)(void *dest, const void *acc, uint32_t samples);
+
+	/* source gains, indexed by position in the source buffer list */
+	int32_t gain[PLATFORM_MAX_STREAMS];
+
+	/* block accumulator, int32_t for S16_LE and int64_t otherwise */
+	union {
+		int32_t s32[MIXER_BLOCK_SAMPLES];
+		int64_t s64[MIXER_BLOCK_SAMPLES];
+	} acc;
+};
+
+/* mixer block processing functions for a frame format
+ *
+ * acc_func() adds samples of one source scaled by gain to the accumulator,
+ * or initialises the accumulator with them when first is set. sat_func()
+ * saturates the accumulator to the sink sample size.
+ */
+struct mixer_func_map {
+	uint16_t frame_fmt;
+	void (*acc_func)(void *acc, const void *src, int32_t gain,
+			 uint32_t samples, int first);
+	void (*sat_func)(void *dest, const void *acc, uint32_t samples);
+};
+
+extern const struct mixer_func_map mixer_func_map[];
+extern const size_t mixer_func_count;
+
+/* scale a source sample by a Q8.16 gain, rounded like the volume component */
+static inline int64_t mixer_gain_sample(int32_t x, int32_t gain)
+{
+	return q_multsr_32x32(x, gain, MIXER_GAIN_QXY_Y);
+}
+
+#ifdef UNIT_TEST
+void sys_comp_mixer_init(void);
+#endif
+
+#endif
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: Liam Girdwood <liam.r.girdwood@linux.intel.com>
+ */
+
+#ifndef __INCLUDE_CLOCK__
+#define __INCLUDE_CLOCK__
+
+#include <stdint.h>
+
+#define CLOCK_NOTIFY_PRE	0
+#define CLOCK_NOTIFY_POST	1
+
+#define CLOCK_SSP_XTAL_OSCILLATOR		0x0
+#define CLOCK_SSP_AUDIO_CARDINAL		0x1
+#define CLOCK_SSP_PLL_FIXED			0x2
+
+struct clock_notify_data {
+	uint32_t old_freq;
+	uint32_t old_ticks_per_msec;
+	uint32_t freq;
+	uint32_t ticks_per_msec;
+};
+
+struct freq_table {
+	uint32_t freq;
+	uint32_t ticks_per_msec;
+	uint32_t enc;
+};
+
+uint32_t clock_get_freq(int clock);
+
+void clock_set_freq(int clock, uint32_t hz);
+
+uint64_t clock_ms_to_ticks(int clock, uint64_t ms);
+
+void clock_init(void);
+
+#endif
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: Yan Wang <yan.wang@linux.intel.com>
+ */
+
+#ifndef __INCLUDE_DMA_TRACE__
+#define __INCLUDE_DMA_TRACE__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <sof/sof.h>
+#include <sof/list.h>
+#include <sof/mailbox.h>
+#include <sof/debug.h>
+#include <sof/timer.h>
+#include <sof/dma.h>
+#include <sof/schedule.h>
+#include <platform/platform.h>
+#include <platform/timer.h>
+
+struct dma_trace_buf {
+	void *w_ptr;		/* buffer write pointer */
+	void *r_ptr;		/* buffer read position */
+	void *addr;		/* buffer base address */
+	void *end_addr;		/* buffer end address */
+	uint32_t size;		/* size of buffer in bytes */
+	uint32_t avail;		/* avail bytes in buffer */
+};
+
+/* per core event ring size in bytes, must be a power of 2 */
+#define DMA_TRACE_RING_SIZE	(DMA_TRACE_LOCAL_SIZE / 2)
+
+/*
+ * Per core event ring. Each core is the only producer of its own ring and
+ * trace_work() on the master core is the only consumer, so no lock is
+ * shared between cores. Positions are free running byte counts and every
+ * event is stored as its length in bytes followed by the event itself.
+ */
+struct dma_trace_ring {
+	uint32_t *addr;		/* uncached ring base address */
+	uint32_t reserve;	/* end of space handed out to producers */
+	uint32_t commit;	/* end of events visible to the consumer */
+	uint32_t nest;		/* producers between reserve and commit */
+	uint32_t read;		/* consumer position */
+	uint32_t dropped;	/* events dropped because the ring was full */
+	uint32_t dropped_logged; /* dropped events already reported */
+};
+
+/* largest compact event body, the index, both ids and all params */
+#define DTRACE_COMPACT_BODY_MAX		32
+
+/* body size in the compact event flags */
+#define DTRACE_COMPACT_SIZE_SHIFT	8
+
+/*
+ * Compact event as queued in the core rings, with the timestamp where
+ * log_entry_header has it. trace_work() turns the timestamp and flags
+ * into the record head when sending it to the host.
+ */
+struct dtrace_compact_event {
+	uint32_t flags;		/* TRACE_COMPACT_* flags, core and body size */
+	uint32_t timestamp_lo;
+	uint32_t timestamp_hi;
+	uint8_t body[DTRACE_COMPACT_BODY_MAX];
+};
+
+struct dma_trace_data {
+	struct dma_sg_config config;
+	struct dma_trace_buf dmatb;
+	struct dma_trace_ring ring[PLATFORM_CORE_COUNT];
+	struct dma_copy dc;
+	uint32_t old_host_offset;
+	uint32_t host_offset;
+	uint32_t overflow;
+	uint32_t messages;
+	uint32_t host_size;
+	struct task dmat_work;
+	uint32_t enabled;
+	uint32_t copy_in_progress;
+	uint32_t stream_tag;
+#if CONFIG_TRACE_COMPACT
+	uint64_t compact_timestamp; /* timestamp of the last record sent */
+	uint32_t compact_sync; /* next record carries an absolute timestamp */
+#endif
+};
+
+int dma_trace_init_early(struct sof *sof);
+int dma_trace_init_complete(struct dma_trace_data *d);
+int dma_trace_host_buffer(struct dma_trace_data *d,
+			  struct dma_sg_elem_array *elem_array,
+			  uint32_t host_size);
+int dma_trace_enable(struct dma_trace_data *d);
+void dma_trace_flush(void *t);
+
+void dtrace_event(const char *e, uint32_t size);
+void dtrace_event_atomic(const char *e, uint32_t length);
+
+/* store value as unsigned LEB128, returns the number of bytes used */
+static inline uint32_t dtrace_varint_put(uint8_t *dst, uint32_t value)
+{
+	uint32_t i = 0;
+
+	while (value >= 0x80) {
+		dst[i++] = value | 0x80;
+		value >>= 7;
+	}
+	dst[i++] = value;
+
+	return i;
+}
+
+static inline uint32_t dtrace_varint_put64(uint8_t *dst, uint64_t value)
+{
+	uint32_t i = 0;
+
+	while (value >= 0x80) {
+		dst[i++] = value | 0x80;
+		value >>= 7;
+	}
+	dst[i++] = value;
+
+	return i;
+}
+
+#endif
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * Ready queue of the EDF scheduler. Queued tasks are kept in a binary
+ * min-heap ordered by priority and then by deadline.
+ */
+
+#ifndef __INCLUDE_SOF_EDF_QUEUE_H__
+#define __INCLUDE_SOF_EDF_QUEUE_H__
+
+#include <stdint.h>
+#include <sof/schedule.h>
+#include <sof/edf_schedule.h>
+
+/* initial number of heap slots, the heap doubles when it is full */
+#define EDF_QUEUE_INIT_SIZE	16
+
+struct edf_queue {
+	struct task **tasks;	/* heap array, tasks[0] runs next */
+	uint32_t count;		/* number of queued tasks */
+	uint32_t size;		/* number of allocated slots */
+};
+
+int edf_queue_init(struct edf_queue *queue);
+void edf_queue_free(struct edf_queue *queue);
+int edf_queue_insert(struct edf_queue *queue, struct task *task);
+void edf_queue_remove(struct edf_queue *queue, struct task *task);
+void edf_queue_update(struct edf_queue *queue, struct task *task);
+
+/* task that runs next or NULL if the queue is empty */
+static inline struct task *edf_queue_peek(struct edf_queue *queue)
+{
+	return queue->count ? queue->tasks[0] : NULL;
+}
+
+static inline int edf_queue_is_empty(struct edf_queue *queue)
+{
+	return !queue->count;
+}
+
+static inline int edf_queue_contains(struct edf_queue *queue,
+				     struct task *task)
+{
+	struct edf_task_pdata *edf_pdata = edf_sch_get_pdata(task);
+
+	return edf_pdata->queue_idx < queue->count &&
+		queue->tasks[edf_pdata->queue_idx] == task;
+}
+
+#endif /* __INCLUDE_SOF_EDF_QUEUE_H__ */
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: Liam Girdwood <liam.r.girdwood@linux.intel.com>
+ */
+
+#ifndef __INCLUDE_INTERRUPT__
+#define __INCLUDE_INTERRUPT__
+
+#include <stdint.h>
+#include <arch/interrupt.h>
+#include <platform/interrupt.h>
+#include <sof/drivers/interrupt.h>
+#include <sof/trace.h>
+#include <sof/debug.h>
+#include <sof/lock.h>
+#include <sof/list.h>
+
+#define trace_irq(__e)	trace_event(TRACE_CLASS_IRQ, __e)
+#define trace_irq_error(__e, ...) \
+	trace_error(TRACE_CLASS_IRQ,  __e, ##__VA_ARGS__)
+
+#define IRQ_MANUAL_UNMASK	0
+#define IRQ_AUTO_UNMASK		1
+
+struct irq_desc {
+	/* irq must be first for constructor */
+	int irq;        /* logical IRQ number */
+
+	/* handler is optional for constructor */
+	void (*handler)(void *arg);
+	void *handler_arg;
+
+	/* whether irq should be automatically unmasked */
+	int unmask;
+
+	/* to identify interrupt with the same IRQ */
+	int id;
+	spinlock_t lock;
+	uint32_t enabled_count;
+
+	/* to link to other irq_desc */
+	struct list_item irq_list;
+
+	uint32_t num_children;
+	struct list_item child[PLATFORM_IRQ_CHILDREN];
+};
+
+int interrupt_register(uint32_t irq, int unmask, void(*handler)(void *arg),
+		       void *arg);
+void interrupt_unregister(uint32_t irq);
+uint32_t interrupt_enable(uint32_t irq);
+uint32_t interrupt_disable(uint32_t irq);
+
+static inline void interrupt_set(int irq)
+{
+	arch_interrupt_set(SOF_IRQ_NUMBER(irq));
+}
+
+static inline void interrupt_clear(int irq)
+{
+	arch_interrupt_clear(SOF_IRQ_NUMBER(irq));
+}
+
+static inline uint32_t interrupt_global_disable(void)
+{
+	return arch_interrupt_global_disable();
+}
+
+static inline void interrupt_global_enable(uint32_t flags)
+{
+	arch_interrupt_global_enable(flags);
+}
+
+#endif
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: Liam Girdwood <liam.r.girdwood@linux.intel.com>
+ */
+
+#ifndef __INCLUDE_IO__
+#define __INCLUDE_IO__
+
+#include <stdint.h>
+#include <config.h>
+#include <sof/bit.h>
+
+#if CONFIG_LIBRARY
+
+static inline uint32_t io_reg_read(uint32_t reg) {return 0;}
+static inline void io_reg_write(uint32_t reg, uint32_t val) {}
+static inline void io_reg_update_bits(uint32_t reg, uint32_t mask,
+				      uint32_t value) {}
+static inline uint16_t io_reg_read16(uint32_t reg) {return 0;}
+static inline void io_reg_write16(uint32_t reg, uint16_t val) {}
+
+#else
+
+static inline uint32_t io_reg_read(uint32_t reg)
+{
+	return *((volatile uint32_t*)reg);
+}
+
+static inline void io_reg_write(uint32_t reg, uint32_t val)
+{
+	*((volatile uint32_t*)reg) = val;
+}
+
+static inline void io_reg_update_bits(uint32_t reg, uint32_t mask, uint32_t value)
+{
+	io_reg_write(reg, (io_reg_read(reg) & (~mask)) | (value & mask));
+}
+
+static inline uint16_t io_reg_read16(uint32_t reg)
+{
+	return *((volatile uint16_t*)reg);
+}
+
+static inline void io_reg_write16(uint32_t reg, uint16_t val)
+{
+	*((volatile uint16_t*)reg) = val;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Statistical sampling profiler. A timer interrupt on each core records the
+ * interrupted PC, and the samples are sent as PROFILER class traces that
+ * sof-logger -P turns into a flat profile of the firmware ELF.
+ */
+
+#ifndef __INCLUDE_SOF_PROFILER_H__
+#define __INCLUDE_SOF_PROFILER_H__
+
+#include <stdint.h>
+#include <config.h>
+
+struct sof;
+
+#if CONFIG_PROFILER
+
+#include <sof/schedule.h>
+#include <sof/timer.h>
+#include <platform/platform.h>
+
+/* samples kept per core between two drains, must be a power of 2 */
+#define PROFILER_SAMPLES	64
+
+/* samples sent in one trace record */
+#define PROFILER_RECORD_SAMPLES	4
+
+/*
+ * Per core sample ring. The timer interrupt of the core is its only producer
+ * and the drain task of the same core its only consumer, so masking local
+ * interrupts in the drain task is all the locking needed.
+ */
+struct profiler_core {
+	uint32_t pc[PROFILER_SAMPLES];
+	uint32_t head;		/* samples taken */
+	uint32_t tail;		/* samples sent */
+	uint32_t dropped;	/* samples lost because the ring was full */
+	uint64_t period;	/* sampling period in timer ticks */
+	struct timer timer;	/* sampling timer of this core */
+	struct task drain;	/* sends the samples by trace */
+};
+
+struct profiler {
+	struct profiler_core core[PLATFORM_CORE_COUNT];
+};
+
+void profiler_init(struct sof *sof);
+
+#else
+
+static inline void profiler_init(struct sof *sof) { }
+
+#endif /* CONFIG_PROFILER */
+
+#endif /* __INCLUDE_SOF_PROFILER_H__ */
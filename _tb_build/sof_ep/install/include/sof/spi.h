@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2017, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: Guennadi Liakhovetski <guennadi.liakhovetski@linux.intel.com>
+ */
+
+#ifndef __INCLUDE_SPI_H__
+#define __INCLUDE_SPI_H__
+
+#include <stdint.h>
+
+enum spi_type {
+	SOF_SPI_INTEL_SLAVE,
+	SOF_SPI_INTEL_MASTER,
+};
+
+enum spi_xfer_direction {
+	SPI_DIR_RX,
+	SPI_DIR_TX,
+};
+
+struct spi_plat_fifo_data {
+	uint32_t handshake;
+};
+
+struct spi_platform_data {
+	uint32_t base;
+	uint32_t irq;
+	struct spi_plat_fifo_data fifo[2];
+	enum spi_type type;
+};
+
+struct spi;
+
+int spi_push(struct spi *spi, const void *data, size_t size);
+int spi_probe(struct spi *spi);
+struct spi *spi_get(enum spi_type type);
+int spi_install(const struct spi_platform_data *plat, size_t n);
+void spi_init(void);
+
+#endif
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2016, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: Liam Girdwood <liam.r.girdwood@linux.intel.com>
+ */
+
+#ifndef __INCLUDE_TIMER__
+#define __INCLUDE_TIMER__
+
+#include <arch/timer.h>
+#include <stdint.h>
+
+struct timesource_data {
+	struct timer timer;
+	int clk;
+	int notifier;
+	int (*timer_set)(struct timer *t, uint64_t ticks);
+	void (*timer_clear)(struct timer *t);
+	uint64_t (*timer_get)(struct timer *t);
+};
+
+int timer_register(struct timer *timer,
+	void(*handler)(void *arg), void *arg);
+void timer_unregister(struct timer *timer);
+void timer_enable(struct timer *timer);
+void timer_disable(struct timer *timer);
+
+static inline int timer_set(struct timer *timer, uint64_t ticks)
+{
+	return arch_timer_set(timer, ticks);
+}
+
+void timer_set_ms(struct timer *timer, unsigned int ms);
+
+static inline void timer_clear(struct timer *timer)
+{
+	arch_timer_clear(timer);
+}
+
+unsigned int timer_get_count(struct timer *timer);
+
+unsigned int timer_get_count_delta(struct timer *timer);
+
+static inline uint64_t timer_get_system(struct timer *timer)
+{
+	return arch_timer_get_system(timer);
+}
+
+#endif
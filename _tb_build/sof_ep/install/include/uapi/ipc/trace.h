@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: Liam Girdwood <liam.r.girdwood@linux.intel.com>
+ *         Keyon Jie <yang.jie@linux.intel.com>
+ */
+
+/**
+ * \file include/uapi/ipc/trace.h
+ * \brief IPC definitions
+ * \author Liam Girdwood <liam.r.girdwood@linux.intel.com>
+ * \author Keyon Jie <yang.jie@linux.intel.com>
+ */
+
+#ifndef __INCLUDE_UAPI_IPC_TRACE_H__
+#define __INCLUDE_UAPI_IPC_TRACE_H__
+
+#include <uapi/ipc/header.h>
+#include <uapi/ipc/stream.h>
+
+/*
+ * DMA for Trace
+ */
+
+#define SOF_TRACE_FILENAME_SIZE		32
+
+/* DMA for Trace params info - SOF_IPC_DEBUG_DMA_PARAMS */
+/* Deprecated - use sof_ipc_dma_trace_params_ext */
+struct sof_ipc_dma_trace_params {
+	struct sof_ipc_cmd_hdr hdr;
+	struct sof_ipc_host_buffer buffer;
+	uint32_t stream_tag;
+} __attribute__((packed));
+
+/* DMA for Trace params info - SOF_IPC_DEBUG_DMA_PARAMS_EXT */
+struct sof_ipc_dma_trace_params_ext {
+	struct sof_ipc_cmd_hdr hdr;
+	struct sof_ipc_host_buffer buffer;
+	uint32_t stream_tag;
+	uint64_t timestamp;
+	uint32_t reserved[8];
+} __attribute__((packed));
+
+/* DMA for Trace params info - SOF_IPC_DEBUG_DMA_PARAMS */
+struct sof_ipc_dma_trace_posn {
+	struct sof_ipc_reply rhdr;
+	uint32_t host_offset;	/* Offset of DMA host buffer */
+	uint32_t overflow;	/* overflow bytes if any */
+	uint32_t messages;	/* total trace messages */
+} __attribute__((packed));
+
+/* clear the counters after reading them */
+#define SOF_IPC_COMP_PERF_RESET		(1 << 0)
+
+/* component performance counters request - SOF_IPC_TRACE_COMP_PERF */
+struct sof_ipc_comp_perf_params {
+	struct sof_ipc_cmd_hdr hdr;
+	uint32_t comp_id;
+	uint32_t flags;		/* SOF_IPC_COMP_PERF_ flags */
+} __attribute__((packed));
+
+/* component performance counters, execution times are in timer ticks */
+struct sof_ipc_comp_perf {
+	struct sof_ipc_reply rhdr;
+	uint32_t comp_id;
+	uint32_t pipeline_id;
+	uint32_t copies;	/* number of measured copies */
+	uint32_t copy_min;	/* shortest copy */
+	uint32_t copy_avg;	/* average copy */
+	uint32_t copy_max;	/* longest copy */
+	uint64_t bytes;		/* bytes produced to sinks */
+	uint32_t periods;	/* number of measured pipeline periods */
+	uint32_t period_avg;	/* average pipeline period */
+	uint32_t period_max;	/* longest pipeline period */
+	uint32_t period_budget;	/* pipeline period length */
+	uint32_t overruns;	/* pipeline periods longer than budget */
+	uint32_t reserved[4];
+} __attribute__((packed));
+
+/* heap types for SOF_IPC_TRACE_HEAP_STATS */
+#define SOF_IPC_HEAP_SYS_RUNTIME	0
+#define SOF_IPC_HEAP_RUNTIME		1
+#define SOF_IPC_HEAP_BUFFER		2
+
+/* clear peak, failure and size counters after reading them */
+#define SOF_IPC_HEAP_STATS_RESET	(1 << 0)
+
+#define SOF_IPC_HEAP_STATS_MAPS		8	/* block maps reported */
+#define SOF_IPC_HEAP_STATS_SIZES	8	/* size histogram buckets */
+
+/* heap statistics request - SOF_IPC_TRACE_HEAP_STATS */
+struct sof_ipc_heap_stats_params {
+	struct sof_ipc_cmd_hdr hdr;
+	uint32_t heap;		/* SOF_IPC_HEAP_ type */
+	uint32_t index;		/* heap of this type, -EINVAL past the last */
+	uint32_t flags;		/* SOF_IPC_HEAP_STATS_ flags */
+} __attribute__((packed));
+
+/* statistics of one block map of a heap, sizes are in blocks */
+struct sof_ipc_heap_map_stats {
+	uint32_t block_size;	/* block size in bytes */
+	uint32_t count;		/* number of blocks */
+	uint32_t free;		/* free blocks */
+	uint32_t peak_used;	/* most blocks used at once */
+	uint32_t largest_free;	/* longest run of free blocks */
+	uint32_t failures;	/* requests that found the map full */
+} __attribute__((packed));
+
+/* heap statistics, sizes are in bytes */
+struct sof_ipc_heap_stats {
+	struct sof_ipc_reply rhdr;
+	uint32_t heap;
+	uint32_t index;
+	uint32_t caps;		/* SOF_MEM_CAPS_ */
+	uint32_t size;
+	uint32_t used;
+	uint32_t free;
+	uint32_t peak_used;	/* most bytes used at once */
+	uint32_t largest_free;	/* largest free continuous space */
+	uint32_t failures;	/* failed allocations */
+	/* requested sizes, bucket n counts sizes up to 32 << n bytes and
+	 * the last bucket counts all larger sizes
+	 */
+	uint32_t sizes[SOF_IPC_HEAP_STATS_SIZES];
+	uint32_t reserved[4];
+	uint32_t num_maps;
+	struct sof_ipc_heap_map_stats map[SOF_IPC_HEAP_STATS_MAPS];
+} __attribute__((packed));
+
+/* trace filter element keys for SOF_IPC_TRACE_FILTER_UPDATE */
+#define SOF_IPC_TRACE_FILTER_ELEM_SET_LEVEL	0x01	/* LOG_LEVEL_ value */
+#define SOF_IPC_TRACE_FILTER_ELEM_BY_CLASS	0x02	/* TRACE_CLASS_ >> 24 */
+#define SOF_IPC_TRACE_FILTER_ELEM_BY_PIPE	0x03	/* pipeline id, id_0 */
+#define SOF_IPC_TRACE_FILTER_ELEM_BY_COMP	0x04	/* component id, id_1 */
+#define SOF_IPC_TRACE_FILTER_ELEM_TYPE_MASK	0x7f
+#define SOF_IPC_TRACE_FILTER_ELEM_FIN		0x80	/* last of a group */
+
+struct sof_ipc_trace_filter_elem {
+	uint32_t key;		/* SOF_IPC_TRACE_FILTER_ELEM_ */
+	uint32_t value;
+} __attribute__((packed));
+
+/*
+ * Runtime trace levels - SOF_IPC_TRACE_FILTER_UPDATE
+ *
+ * The elements are groups of optional BY_CLASS, BY_PIPE and BY_COMP
+ * selectors, each group closed by a SET_LEVEL | FIN element. A group
+ * without selectors sets the level of all traces and drops the pipeline
+ * and component levels. A group with only BY_CLASS sets the level of
+ * the class. Groups with BY_PIPE or BY_COMP set the level of the traces
+ * with these ids, in the class if BY_CLASS is given or in all classes.
+ * Error traces are always sent.
+ */
+struct sof_ipc_trace_filter {
+	struct sof_ipc_cmd_hdr hdr;
+	uint32_t elem_cnt;
+	uint32_t reserved[8];
+	struct sof_ipc_trace_filter_elem elems[];
+} __attribute__((packed));
+
+/*
+ * Commom debug
+ */
+
+/*
+ * SOF panic codes
+ */
+#define SOF_IPC_PANIC_MAGIC			0x0dead000
+#define SOF_IPC_PANIC_MAGIC_MASK		0x0ffff000
+#define SOF_IPC_PANIC_CODE_MASK			0x00000fff
+#define SOF_IPC_PANIC_MEM			(SOF_IPC_PANIC_MAGIC | 0x0)
+#define SOF_IPC_PANIC_WORK			(SOF_IPC_PANIC_MAGIC | 0x1)
+#define SOF_IPC_PANIC_IPC			(SOF_IPC_PANIC_MAGIC | 0x2)
+#define SOF_IPC_PANIC_ARCH			(SOF_IPC_PANIC_MAGIC | 0x3)
+#define SOF_IPC_PANIC_PLATFORM			(SOF_IPC_PANIC_MAGIC | 0x4)
+#define SOF_IPC_PANIC_TASK			(SOF_IPC_PANIC_MAGIC | 0x5)
+#define SOF_IPC_PANIC_EXCEPTION			(SOF_IPC_PANIC_MAGIC | 0x6)
+#define SOF_IPC_PANIC_DEADLOCK			(SOF_IPC_PANIC_MAGIC | 0x7)
+#define SOF_IPC_PANIC_STACK			(SOF_IPC_PANIC_MAGIC | 0x8)
+#define SOF_IPC_PANIC_IDLE			(SOF_IPC_PANIC_MAGIC | 0x9)
+#define SOF_IPC_PANIC_WFI			(SOF_IPC_PANIC_MAGIC | 0xa)
+#define SOF_IPC_PANIC_ASSERT			(SOF_IPC_PANIC_MAGIC | 0xb)
+
+/* panic info include filename and line number
+ * filename array will not include null terminator if fully filled
+ */
+struct sof_ipc_panic_info {
+	struct sof_ipc_hdr hdr;
+	uint32_t code;			/* SOF_IPC_PANIC_ */
+	char filename[SOF_TRACE_FILENAME_SIZE];
+	uint32_t linenum;
+} __attribute__((packed));
+
+#endif
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Author: Slawomir Blauciak <slawomir.blauciak@linux.intel.com>
+ */
+
+#ifndef __INCLUDE_UAPI_USER_DETECT_TEST_H__
+#define __INCLUDE_UAPI_USER_DETECT_TEST_H__
+
+/** IPC blob types */
+#define SOF_DETECT_TEST_CONFIG	0
+#define SOF_DETECT_TEST_MODEL	1
+
+struct sof_detect_test_config {
+	uint32_t size;
+
+	/** synthetic system load settings */
+	uint32_t load_mips;
+	uint32_t load_memory_size;
+
+	/** length of the keyphrase in milliseconds */
+	uint32_t keyphrase_length;
+
+	/** activation right shift, determines the speed of activation */
+	uint16_t activation_shift;
+
+	/** activation threshold */
+	int16_t activation_threshold;
+
+	/** reserved for future use */
+	uint32_t reserved[3];
+} __attribute__((packed));
+
+/** used for binary blob size sanity checks */
+#define SOF_DETECT_TEST_MAX_CFG_SIZE sizeof(struct sof_detect_test_config)
+
+#endif
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/tools/testbench/../.."
+  "/root/repo/_tb_build/sof_ep/build"
+  "/root/repo/_tb_build/sof_ep"
+  "/root/repo/_tb_build/sof_ep/tmp"
+  "/root/repo/_tb_build/sof_ep/src/sof_ep-stamp"
+  "/root/repo/_tb_build/sof_ep/src"
+  "/root/repo/_tb_build/sof_ep/src/sof_ep-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_tb_build/sof_ep/src/sof_ep-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_tb_build/sof_ep/src/sof_ep-stamp${cfgdir}") # cfgdir has leading slash
+endif()
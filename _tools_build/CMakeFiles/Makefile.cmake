@@ -0,0 +1,99 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/tools/CMakeLists.txt"
+  "/root/repo/tools/eqctl/CMakeLists.txt"
+  "/root/repo/tools/logger/CMakeLists.txt"
+  "/root/repo/tools/test/CMakeLists.txt"
+  "/root/repo/tools/test/topology/CMakeLists.txt"
+  "/root/repo/tools/topology/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "logger/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "eqctl/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "topology/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/topology/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "logger/CMakeFiles/sof-logger.dir/DependInfo.cmake"
+  "eqctl/CMakeFiles/sof-eqctl.dir/DependInfo.cmake"
+  "topology/CMakeFiles/abi.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topologies.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-cht-nocodec.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-byt-nocodec.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-cht-max98090.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-cht-rt5682.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-hda-generic-2ch.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-hda-generic-4ch.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-hda-generic-idisp-2ch.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-hda-generic-idisp-4ch.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-apl-nocodec.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-apl-keyword-detect.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-bdw-rt286.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-bdw-rt5640.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-byt-rt5640.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-byt-rt5645.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-byt-rt5651.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-byt-rt5682.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-byt-da7213.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-cnl-rt274.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-hsw-rt5640.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-apl-tdf8532.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-apl-pcm512x.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-apl-pcm512x-nohdmi.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-apl-rt298.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-apl-wm8804.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-apl-da7219.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-glk-da7219-kwd.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-glk-da7219.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-glk-rt5682.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-icl-nocodec.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-apl-eq-pcm512x.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-apl-eq-dmic.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-apl-dmic-4ch.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-apl-dmic-2ch.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-icl-dmic-4ch.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-apl-src-pcm512x.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-cml-rt5682.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-whl-rt5682.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-icl-rt5682.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-cml-src-rt5682.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-cnl-nocodec.dir/DependInfo.cmake"
+  "topology/CMakeFiles/topology_sof-cml-rt5682-max98357a.dir/DependInfo.cmake"
+  "test/topology/CMakeFiles/tests.dir/DependInfo.cmake"
+  "test/topology/CMakeFiles/tests-clean.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sof-eqctl.dir/eqctl.c.o"
+  "CMakeFiles/sof-eqctl.dir/eqctl.c.o.d"
+  "sof-eqctl"
+  "sof-eqctl.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sof-eqctl.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
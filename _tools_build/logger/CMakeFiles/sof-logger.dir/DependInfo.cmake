@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tools/logger/convert.c" "logger/CMakeFiles/sof-logger.dir/convert.c.o" "gcc" "logger/CMakeFiles/sof-logger.dir/convert.c.o.d"
+  "/root/repo/tools/logger/logger.c" "logger/CMakeFiles/sof-logger.dir/logger.c.o" "gcc" "logger/CMakeFiles/sof-logger.dir/logger.c.o.d"
+  "/root/repo/tools/logger/profile.c" "logger/CMakeFiles/sof-logger.dir/profile.c.o" "gcc" "logger/CMakeFiles/sof-logger.dir/profile.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sof-logger.dir/convert.c.o"
+  "CMakeFiles/sof-logger.dir/convert.c.o.d"
+  "CMakeFiles/sof-logger.dir/logger.c.o"
+  "CMakeFiles/sof-logger.dir/logger.c.o.d"
+  "CMakeFiles/sof-logger.dir/profile.c.o"
+  "CMakeFiles/sof-logger.dir/profile.c.o.d"
+  "sof-logger"
+  "sof-logger.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/sof-logger.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/abi"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/abi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-apl-da7219"
+  "sof-apl-da7219.conf"
+  "sof-apl-da7219.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-apl-da7219.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-apl-dmic-4ch"
+  "sof-apl-dmic-4ch.conf"
+  "sof-apl-dmic-4ch.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-apl-dmic-4ch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
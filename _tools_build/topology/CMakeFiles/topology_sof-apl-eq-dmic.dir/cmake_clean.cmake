@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-apl-eq-dmic"
+  "sof-apl-eq-dmic.conf"
+  "sof-apl-eq-dmic.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-apl-eq-dmic.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
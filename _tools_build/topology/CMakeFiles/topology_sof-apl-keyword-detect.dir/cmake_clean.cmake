@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-apl-keyword-detect"
+  "sof-apl-keyword-detect.conf"
+  "sof-apl-keyword-detect.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-apl-keyword-detect.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-apl-nocodec"
+  "sof-apl-nocodec.conf"
+  "sof-apl-nocodec.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-apl-nocodec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-apl-pcm512x-nohdmi"
+  "sof-apl-pcm512x-nohdmi.conf"
+  "sof-apl-pcm512x-nohdmi.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-apl-pcm512x-nohdmi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-apl-rt298"
+  "sof-apl-rt298.conf"
+  "sof-apl-rt298.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-apl-rt298.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-apl-src-pcm512x"
+  "sof-apl-src-pcm512x.conf"
+  "sof-apl-src-pcm512x.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-apl-src-pcm512x.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
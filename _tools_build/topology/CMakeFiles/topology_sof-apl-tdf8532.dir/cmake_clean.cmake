@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-apl-tdf8532"
+  "sof-apl-tdf8532.conf"
+  "sof-apl-tdf8532.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-apl-tdf8532.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-apl-wm8804"
+  "sof-apl-wm8804.conf"
+  "sof-apl-wm8804.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-apl-wm8804.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-bdw-rt286"
+  "sof-bdw-rt286.conf"
+  "sof-bdw-rt286.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-bdw-rt286.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
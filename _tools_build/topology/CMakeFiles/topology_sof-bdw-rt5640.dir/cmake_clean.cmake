@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-bdw-rt5640"
+  "sof-bdw-rt5640.conf"
+  "sof-bdw-rt5640.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-bdw-rt5640.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
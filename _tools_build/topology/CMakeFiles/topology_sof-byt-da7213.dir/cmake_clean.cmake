@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-byt-da7213"
+  "sof-byt-da7213.conf"
+  "sof-byt-da7213.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-byt-da7213.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
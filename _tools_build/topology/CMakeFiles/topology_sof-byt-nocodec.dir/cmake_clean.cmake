@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-byt-nocodec"
+  "sof-byt-nocodec.conf"
+  "sof-byt-nocodec.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-byt-nocodec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-byt-rt5645"
+  "sof-byt-rt5645.conf"
+  "sof-byt-rt5645.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-byt-rt5645.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-cht-max98090"
+  "sof-cht-max98090.conf"
+  "sof-cht-max98090.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-cht-max98090.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-cht-nocodec"
+  "sof-cht-nocodec.conf"
+  "sof-cht-nocodec.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-cht-nocodec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
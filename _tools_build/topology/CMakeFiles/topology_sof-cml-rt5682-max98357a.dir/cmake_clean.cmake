@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-cml-rt5682-max98357a"
+  "sof-cml-rt5682-max98357a.conf"
+  "sof-cml-rt5682-max98357a.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-cml-rt5682-max98357a.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
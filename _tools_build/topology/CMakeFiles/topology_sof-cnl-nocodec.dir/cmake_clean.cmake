@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-cnl-nocodec"
+  "sof-cnl-nocodec.conf"
+  "sof-cnl-nocodec.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-cnl-nocodec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
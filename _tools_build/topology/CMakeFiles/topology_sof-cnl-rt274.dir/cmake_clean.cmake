@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-cnl-rt274"
+  "sof-cnl-rt274.conf"
+  "sof-cnl-rt274.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-cnl-rt274.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-glk-da7219-kwd"
+  "sof-glk-da7219-kwd.conf"
+  "sof-glk-da7219-kwd.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-glk-da7219-kwd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
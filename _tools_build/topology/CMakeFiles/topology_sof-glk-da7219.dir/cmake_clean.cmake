@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-glk-da7219"
+  "sof-glk-da7219.conf"
+  "sof-glk-da7219.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-glk-da7219.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
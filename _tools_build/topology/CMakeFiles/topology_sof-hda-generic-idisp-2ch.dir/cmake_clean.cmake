@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-hda-generic-idisp-2ch"
+  "sof-hda-generic-idisp-2ch.conf"
+  "sof-hda-generic-idisp-2ch.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-hda-generic-idisp-2ch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
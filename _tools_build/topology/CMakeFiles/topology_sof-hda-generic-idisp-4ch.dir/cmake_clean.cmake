@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-hda-generic-idisp-4ch"
+  "sof-hda-generic-idisp-4ch.conf"
+  "sof-hda-generic-idisp-4ch.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-hda-generic-idisp-4ch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-icl-dmic-4ch"
+  "sof-icl-dmic-4ch.conf"
+  "sof-icl-dmic-4ch.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-icl-dmic-4ch.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
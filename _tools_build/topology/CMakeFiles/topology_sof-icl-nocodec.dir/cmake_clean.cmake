@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-icl-nocodec"
+  "sof-icl-nocodec.conf"
+  "sof-icl-nocodec.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-icl-nocodec.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
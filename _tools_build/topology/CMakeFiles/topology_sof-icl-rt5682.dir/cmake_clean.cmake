@@ -0,0 +1,10 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/topology_sof-icl-rt5682"
+  "sof-icl-rt5682.conf"
+  "sof-icl-rt5682.tplg"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/topology_sof-icl-rt5682.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,3 @@
+define(`SOF_ABI_MAJOR', `0x03')
+define(`SOF_ABI_MINOR', `0x0e')
+define(`SOF_ABI_PATCH', `0x00')
@@ -32,22 +32,37 @@
 #ifndef __INCLUDE_ARCH_CPU__
 #define __INCLUDE_ARCH_CPU__
 
+#include <stdint.h>
+
+/* virtual core of the calling thread and the mask of enabled virtual cores,
+ * library users running several threads assign one core to each of them
+ */
+extern __thread int host_cpu_id;
+extern uint32_t host_cpu_enabled;
+
 static inline void arch_cpu_enable_core(int id)
 {
+	__sync_fetch_and_or(&host_cpu_enabled, 1 << id);
 }
 
 static inline void arch_cpu_disable_core(int id)
 {
+	__sync_fetch_and_and(&host_cpu_enabled, ~(1 << id));
 }
 
 static inline int arch_cpu_is_core_enabled(int id)
 {
-	return 0;
+	return !!(host_cpu_enabled & (1 << id));
 }
 
 static inline int arch_cpu_get_id(void)
 {
-	return 0;
+	return host_cpu_id;
+}
+
+static inline void arch_cpu_set_id(int id)
+{
+	host_cpu_id = id;
 }
 
 static inline void cpu_write_threadptr(int threadptr)
@@ -35,11 +35,48 @@
 #include <stdint.h>
 #include <errno.h>
 
+/* host spinlocks are real test-and-set locks so that library users running
+ * the firmware on several threads get the same exclusion as SMP DSPs
+ */
 typedef struct {
+	uint32_t lock;
+	uint32_t contended; /* times a taker found the lock held */
+#if DEBUG_LOCKS
+	uint32_t user;
+#endif
 } spinlock_t;
 
-static inline void arch_spinlock_init(spinlock_t *lock) {}
-static inline void arch_spin_lock(spinlock_t *lock) {}
-static inline void arch_spin_unlock(spinlock_t *lock) {}
+static inline void arch_spinlock_init(spinlock_t *lock)
+{
+	lock->lock = 0;
+	lock->contended = 0;
+}
+
+static inline void arch_spin_lock(spinlock_t *lock)
+{
+	int contended = 0;
+
+	while (__sync_lock_test_and_set(&lock->lock, 1)) {
+		contended = 1;
+		while (__atomic_load_n(&lock->lock, __ATOMIC_RELAXED))
+			;
+	}
+
+	/* counted with the lock held */
+	if (contended)
+		lock->contended++;
+}
+
+static inline int arch_try_lock(spinlock_t *lock)
+{
+	if (__sync_lock_test_and_set(&lock->lock, 1))
+		return 0; /* lock failed */
+	return 1; /* lock acquired */
+}
+
+static inline void arch_spin_unlock(spinlock_t *lock)
+{
+	__sync_lock_release(&lock->lock);
+}
 
 #endif
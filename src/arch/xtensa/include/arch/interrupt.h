@@ -95,6 +95,48 @@ static inline uint32_t arch_interrupt_get_status(void)
 	return xthal_get_interrupt();
 }
 
+#define _arch_interrupt_level(irq)	XCHAL_INT ## irq ## _LEVEL
+
+/* level of an interrupt whose number is known at build time */
+#define arch_interrupt_level(irq)	_arch_interrupt_level(irq)
+
+/* PC interrupted by the interrupt of this level, read from its handler */
+static inline uint32_t arch_interrupt_get_epc(int level)
+{
+	uint32_t epc;
+
+	switch (level) {
+	case 1:
+		asm volatile("rsr.epc1 %0" : "=a" (epc));
+		break;
+#if XCHAL_NUM_INTLEVELS > 1
+	case 2:
+		asm volatile("rsr.epc2 %0" : "=a" (epc));
+		break;
+#endif
+#if XCHAL_NUM_INTLEVELS > 2
+	case 3:
+		asm volatile("rsr.epc3 %0" : "=a" (epc));
+		break;
+#endif
+#if XCHAL_NUM_INTLEVELS > 3
+	case 4:
+		asm volatile("rsr.epc4 %0" : "=a" (epc));
+		break;
+#endif
+#if XCHAL_NUM_INTLEVELS > 4
+	case 5:
+		asm volatile("rsr.epc5 %0" : "=a" (epc));
+		break;
+#endif
+	default:
+		epc = 0;
+		break;
+	}
+
+	return epc;
+}
+
 static inline uint32_t arch_interrupt_global_disable(void)
 {
 	uint32_t flags;
@@ -45,6 +45,7 @@
 #include <sof/lock.h>
 #include <sof/notifier.h>
 #include <sof/panic.h>
+#include <sof/profiler.h>
 #include <sof/schedule.h>
 #include <sof/task.h>
 #include <platform/idc.h>
@@ -132,6 +133,8 @@ int slave_core_init(struct sof *sof)
 
 	trace_point(TRACE_BOOT_PLATFORM);
 
+	profiler_init(sof);
+
 	/* should not return */
 	err = do_task_slave_core(sof);
 
@@ -90,6 +90,10 @@ struct comp_buffer *buffer_new(struct sof_ipc_buffer *desc)
 
 	buffer_zero(buffer);
 
+	/* buffers that never get connected can still be freed */
+	list_init(&buffer->source_list);
+	list_init(&buffer->sink_list);
+
 	spinlock_init(&buffer->lock);
 
 	return buffer;
@@ -165,6 +169,10 @@ void comp_update_buffer_produce(struct comp_buffer *buffer, uint32_t bytes)
 	/* calculate free bytes */
 	buffer->free = buffer->size - buffer->avail;
 
+#if CONFIG_COMP_PERF
+	buffer->source->perf_bytes += bytes;
+#endif
+
 	if (buffer->cb && buffer->cb_type & BUFF_CB_TYPE_PRODUCE)
 		buffer->cb(buffer->cb_data, bytes);
 
@@ -36,6 +36,7 @@
 #include <sof/ipc.h>
 #include <uapi/user/eq.h>
 #include "fir_config.h"
+#include "fir_fft.h"
 
 #if FIR_GENERIC
 #include "fir.h"
@@ -74,6 +75,12 @@ struct comp_data {
 			    struct comp_buffer *source,
 			    struct comp_buffer *sink,
 			    int frames, int nch);
+	struct fir_fft fft;		  /**< FFT convolution state */
+	bool fft_mode;			  /**< FFT convolution is used */
+	void (*eq_fir_fft_func)(struct fir_fft *fft,
+				struct comp_buffer *source,
+				struct comp_buffer *sink,
+				int frames, int nch);
 };
 
 /* The optimized FIR functions variants need to be updated into function
@@ -139,10 +146,37 @@ static inline void set_s32_fir(struct comp_data *cd)
 }
 #endif
 
+static inline int set_fir_fft_func(struct comp_dev *dev)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+
+	switch (dev->params.frame_fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+		trace_eq("set_fir_fft_func(), SOF_IPC_FRAME_S16_LE");
+		cd->eq_fir_fft_func = eq_fir_fft_s16;
+		break;
+	case SOF_IPC_FRAME_S24_4LE:
+		trace_eq("set_fir_fft_func(), SOF_IPC_FRAME_S24_4LE");
+		cd->eq_fir_fft_func = eq_fir_fft_s24;
+		break;
+	case SOF_IPC_FRAME_S32_LE:
+		trace_eq("set_fir_fft_func(), SOF_IPC_FRAME_S32_LE");
+		cd->eq_fir_fft_func = eq_fir_fft_s32;
+		break;
+	default:
+		trace_eq_error("set_fir_fft_func(), invalid frame_fmt");
+		return -EINVAL;
+	}
+	return 0;
+}
+
 static inline int set_fir_func(struct comp_dev *dev)
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
 
+	if (cd->fft_mode)
+		return set_fir_fft_func(dev);
+
 	switch (dev->params.frame_fmt) {
 	case SOF_IPC_FRAME_S16_LE:
 		trace_eq("set_fir_func(), SOF_IPC_FRAME_S16_LE");
@@ -246,12 +280,115 @@ static void eq_fir_free_delaylines(struct comp_data *cd)
 	 * each FIR channel delay line to NULL.
 	 */
 	rfree(cd->fir_delay);
+	cd->fir_delay = NULL;
 	cd->fir_delay_size = 0;
 	for (i = 0; i < PLATFORM_MAX_CHANNELS; i++)
 		fir[i].delay = NULL;
+
+	fir_fft_free(&cd->fft);
+	cd->fft_mode = false;
+}
+
+/* Get the FFT convolution partition size for a period, it is the largest
+ * power of two that is not longer than the period.
+ */
+static int eq_fir_fft_partition(int frames)
+{
+	int psize = FIR_FFT_PARTITION_MIN;
+
+	while (psize < FIR_FFT_PARTITION_MAX && 2 * psize <= frames)
+		psize <<= 1;
+
+	return psize;
+}
+
+/* Check if the blob requests FFT convolution for any of the used
+ * responses.
+ */
+static bool eq_fir_use_fft(struct sof_eq_fir_config *config,
+			   struct sof_eq_fir_coef_data *lookup[],
+			   int16_t *assign_response, int nch)
+{
+	int resp;
+	int i;
+
+	if (!config->fft_threshold)
+		return false;
+
+	for (i = 0; i < nch; i++) {
+		if (i < config->channels_in_config)
+			resp = assign_response[i];
+		else
+			resp = assign_response[0];
+
+		if (resp >= 0 && resp < config->number_of_responses &&
+		    lookup[resp]->length >= config->fft_threshold)
+			return true;
+	}
+
+	return false;
+}
+
+/* Setup all channels for partitioned FFT convolution */
+static int eq_fir_fft_setup(struct comp_data *cd,
+			    struct sof_eq_fir_coef_data *lookup[],
+			    int16_t *assign_response, int nch, int frames)
+{
+	struct sof_eq_fir_config *config = cd->config;
+	struct fir_fft_state *state = cd->fft.state;
+	int32_t *fir_delay;
+	size_t size_sum = 0;
+	int resp;
+	int ret;
+	int s;
+	int i;
+
+	ret = fir_fft_init(&cd->fft, eq_fir_fft_partition(frames));
+	if (ret < 0) {
+		trace_eq_error("eq_fir_fft_setup() error: "
+			       "fir_fft_init() failed");
+		return ret;
+	}
+
+	cd->fft_mode = true;
+	trace_eq("eq_fir_fft_setup(), partition size = %d", cd->fft.psize);
+
+	for (i = 0; i < nch; i++) {
+		if (i < config->channels_in_config)
+			resp = assign_response[i];
+		else
+			resp = assign_response[0];
+
+		if (resp >= config->number_of_responses)
+			return -EINVAL;
+
+		/* Bypass channels are delayed the same as the filtered */
+		s = fir_fft_init_coef(&cd->fft, &state[i],
+				      resp < 0 ? NULL : lookup[resp]);
+		if (s < 0)
+			return -EINVAL;
+
+		size_sum += s;
+		trace_eq("eq_fir_fft_setup(), "
+			 "ch = %d initialized to response = %d", i, resp);
+	}
+
+	cd->fir_delay = rballoc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, size_sum);
+	if (!cd->fir_delay) {
+		trace_eq_error("eq_fir_fft_setup() error: alloc failed, "
+			       "size = %u", size_sum);
+		return -ENOMEM;
+	}
+
+	cd->fir_delay_size = size_sum;
+	fir_delay = cd->fir_delay;
+	for (i = 0; i < nch; i++)
+		fir_fft_init_data(&cd->fft, &state[i], &fir_delay);
+
+	return 0;
 }
 
-static int eq_fir_setup(struct comp_data *cd, int nch)
+static int eq_fir_setup(struct comp_data *cd, int nch, int frames)
 {
 	struct fir_state_32x16 *fir = cd->fir;
 	struct sof_eq_fir_config *config = cd->config;
@@ -260,6 +397,7 @@ static int eq_fir_setup(struct comp_data *cd, int nch)
 	int32_t *fir_delay;
 	int16_t *coef_data;
 	int16_t *assign_response;
+	void *data;
 	int resp;
 	int i;
 	int j;
@@ -286,8 +424,10 @@ static int eq_fir_setup(struct comp_data *cd, int nch)
 
 	/* Collect index of respose start positions in all_coefficients[]  */
 	j = 0;
-	assign_response = &config->data[0];
-	coef_data = &config->data[config->channels_in_config];
+	/* config is packed, don't take the member address directly */
+	data = config->data;
+	assign_response = data;
+	coef_data = assign_response + config->channels_in_config;
 	for (i = 0; i < SOF_EQ_FIR_MAX_RESPONSES; i++) {
 		if (i < config->number_of_responses) {
 			trace_eq("eq_fir_setup(), "
@@ -300,6 +440,11 @@ static int eq_fir_setup(struct comp_data *cd, int nch)
 		}
 	}
 
+	/* Long responses are computed with partitioned FFT convolution */
+	if (eq_fir_use_fft(config, lookup, assign_response, nch))
+		return eq_fir_fft_setup(cd, lookup, assign_response, nch,
+					frames);
+
 	/* Initialize 1st phase */
 	for (i = 0; i < nch; i++) {
 		/* Check for not reading past blob response to channel assign
@@ -681,6 +826,17 @@ static int eq_fir_copy(struct comp_dev *dev)
 		return ret;
 	}
 
+	/* The FFT convolution buffers the input internally and can
+	 * process any number of frames.
+	 */
+	if (cd->fft_mode) {
+		cd->eq_fir_fft_func(&cd->fft, cl.source, cl.sink, cl.frames,
+				    nch);
+		comp_update_buffer_consume(cl.source, cl.source_bytes);
+		comp_update_buffer_produce(cl.sink, cl.sink_bytes);
+		return 0;
+	}
+
 	/* Check if number of frames to process if it is odd. The
 	 * optimized FIR function to process even number of frames
 	 * is lower load than generic version. In that case process
@@ -760,7 +916,7 @@ static int eq_fir_prepare(struct comp_dev *dev)
 
 	/* Initialize EQ */
 	if (cd->config) {
-		ret = eq_fir_setup(cd, dev->params.channels);
+		ret = eq_fir_setup(cd, dev->params.channels, dev->frames);
 		if (ret < 0) {
 			trace_eq_error("eq_fir_prepare() error: "
 				       "eq_fir_setup failed.");
@@ -41,6 +41,7 @@
 #include <sof/ipc.h>
 #include <sof/audio/component.h>
 #include <sof/audio/format.h>
+#include <sof/math/numbers.h>
 #include <uapi/user/eq.h>
 #include "eq_iir.h"
 #include "iir.h"
@@ -54,9 +55,15 @@
 #define trace_eq_error(__e, ...) \
 	trace_error(TRACE_CLASS_EQ_IIR, __e, ##__VA_ARGS__)
 
+/* Number of multichannel DF2T groups needed for all channels */
+#define EQ_IIR_LANE_GROUPS \
+	((PLATFORM_MAX_CHANNELS + IIR_DF2T_LANES - 1) / IIR_DF2T_LANES)
+
 /* IIR component private data */
 struct comp_data {
 	struct iir_state_df2t iir[PLATFORM_MAX_CHANNELS]; /**< filters state */
+	struct iir_lanes_df2t lanes[EQ_IIR_LANE_GROUPS]; /**< multichannel */
+	int lane_groups;		    /**< used lanes, 0 if per channel */
 	struct sof_eq_iir_config *config;   /**< pointer to setup blob */
 	enum sof_ipc_frame source_format;   /**< source frame format */
 	enum sof_ipc_frame sink_format;     /**< sink frame format */
@@ -215,6 +222,145 @@ static void eq_iir_s32_24_default(struct comp_dev *dev,
 	}
 }
 
+static inline int32_t eq_iir_load(void *x, const int fmt)
+{
+	switch (fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+		return *(int16_t *)x << 16;
+	case SOF_IPC_FRAME_S24_4LE:
+		return *(int32_t *)x << 8;
+	default:
+		return *(int32_t *)x;
+	}
+}
+
+static inline void eq_iir_store(void *y, int32_t z, const int fmt)
+{
+	switch (fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+		*(int16_t *)y = sat_int16(Q_SHIFT_RND(z, 31, 15));
+		break;
+	case SOF_IPC_FRAME_S24_4LE:
+		*(int32_t *)y = sat_int24(Q_SHIFT_RND(z, 31, 23));
+		break;
+	default:
+		*(int32_t *)y = z;
+		break;
+	}
+}
+
+/* Filter the channels in groups of IIR_DF2T_LANES with the multichannel
+ * DF2T. The frames of a group are gathered to a block in lane order, then
+ * filtered and scattered back to sink.
+ */
+static inline void eq_iir_lanes(struct comp_dev *dev,
+				struct comp_buffer *source,
+				struct comp_buffer *sink, uint32_t frames,
+				const int source_fmt, const int sink_fmt)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+	struct iir_lanes_df2t *lanes;
+	int32_t x[IIR_BLOCK_FRAMES * IIR_DF2T_LANES] = { 0 };
+	int32_t y[IIR_BLOCK_FRAMES * IIR_DF2T_LANES];
+	size_t in_bytes = source_fmt == SOF_IPC_FRAME_S16_LE ?
+		sizeof(int16_t) : sizeof(int32_t);
+	size_t out_bytes = sink_fmt == SOF_IPC_FRAME_S16_LE ?
+		sizeof(int16_t) : sizeof(int32_t);
+	size_t in_frame_bytes = dev->params.channels * in_bytes;
+	size_t out_frame_bytes = dev->params.channels * out_bytes;
+	void *src;
+	void *dst;
+	int remaining;
+	int n;
+	int g;
+	int i;
+	int l;
+
+	for (g = 0; g < cd->lane_groups; g++) {
+		lanes = &cd->lanes[g];
+		src = buffer_read_frag(source, g * IIR_DF2T_LANES, in_bytes);
+		dst = buffer_write_frag(sink, g * IIR_DF2T_LANES, out_bytes);
+		remaining = frames;
+		while (remaining) {
+			/* process up to the nearest source or sink wrap */
+			n = MIN(buffer_steps_without_wrap(source, src,
+							  in_frame_bytes),
+				buffer_steps_without_wrap(sink, dst,
+							  out_frame_bytes));
+			n = MIN(n, remaining);
+			n = MIN(n, IIR_BLOCK_FRAMES);
+
+			for (i = 0; i < n * IIR_DF2T_LANES;
+			     i += IIR_DF2T_LANES) {
+				for (l = 0; l < lanes->channels; l++)
+					x[i + l] = eq_iir_load(src +
+							       l * in_bytes,
+							       source_fmt);
+				src += in_frame_bytes;
+			}
+
+			iir_df2t_lanes(lanes, x, y, n);
+
+			for (i = 0; i < n * IIR_DF2T_LANES;
+			     i += IIR_DF2T_LANES) {
+				for (l = 0; l < lanes->channels; l++)
+					eq_iir_store(dst + l * out_bytes,
+						     y[i + l], sink_fmt);
+				dst += out_frame_bytes;
+			}
+
+			remaining -= n;
+			src = buffer_wrap(source, src);
+			dst = buffer_wrap(sink, dst);
+		}
+	}
+}
+
+static void eq_iir_s16_lanes(struct comp_dev *dev,
+			     struct comp_buffer *source,
+			     struct comp_buffer *sink,
+			     uint32_t frames)
+{
+	eq_iir_lanes(dev, source, sink, frames, SOF_IPC_FRAME_S16_LE,
+		     SOF_IPC_FRAME_S16_LE);
+}
+
+static void eq_iir_s24_lanes(struct comp_dev *dev,
+			     struct comp_buffer *source,
+			     struct comp_buffer *sink,
+			     uint32_t frames)
+{
+	eq_iir_lanes(dev, source, sink, frames, SOF_IPC_FRAME_S24_4LE,
+		     SOF_IPC_FRAME_S24_4LE);
+}
+
+static void eq_iir_s32_lanes(struct comp_dev *dev,
+			     struct comp_buffer *source,
+			     struct comp_buffer *sink,
+			     uint32_t frames)
+{
+	eq_iir_lanes(dev, source, sink, frames, SOF_IPC_FRAME_S32_LE,
+		     SOF_IPC_FRAME_S32_LE);
+}
+
+static void eq_iir_s32_16_lanes(struct comp_dev *dev,
+				struct comp_buffer *source,
+				struct comp_buffer *sink,
+				uint32_t frames)
+{
+	eq_iir_lanes(dev, source, sink, frames, SOF_IPC_FRAME_S32_LE,
+		     SOF_IPC_FRAME_S16_LE);
+}
+
+static void eq_iir_s32_24_lanes(struct comp_dev *dev,
+				struct comp_buffer *source,
+				struct comp_buffer *sink,
+				uint32_t frames)
+{
+	eq_iir_lanes(dev, source, sink, frames, SOF_IPC_FRAME_S32_LE,
+		     SOF_IPC_FRAME_S24_4LE);
+}
+
 static void eq_iir_s16_pass(struct comp_dev *dev,
 			    struct comp_buffer *source,
 			    struct comp_buffer *sink,
@@ -295,6 +441,18 @@ const struct eq_iir_func_map fm_configured[] = {
 	{SOF_IPC_FRAME_S32_LE,  SOF_IPC_FRAME_S32_LE,  eq_iir_s32_default},
 };
 
+const struct eq_iir_func_map fm_lanes[] = {
+	{SOF_IPC_FRAME_S16_LE,  SOF_IPC_FRAME_S16_LE,  eq_iir_s16_lanes},
+	{SOF_IPC_FRAME_S16_LE,  SOF_IPC_FRAME_S24_4LE, NULL},
+	{SOF_IPC_FRAME_S16_LE,  SOF_IPC_FRAME_S32_LE,  NULL},
+	{SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S16_LE,  NULL},
+	{SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S24_4LE, eq_iir_s24_lanes},
+	{SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S32_LE,  NULL},
+	{SOF_IPC_FRAME_S32_LE,  SOF_IPC_FRAME_S16_LE,  eq_iir_s32_16_lanes},
+	{SOF_IPC_FRAME_S32_LE,  SOF_IPC_FRAME_S24_4LE, eq_iir_s32_24_lanes},
+	{SOF_IPC_FRAME_S32_LE,  SOF_IPC_FRAME_S32_LE,  eq_iir_s32_lanes},
+};
+
 const struct eq_iir_func_map fm_passthrough[] = {
 	{SOF_IPC_FRAME_S16_LE,  SOF_IPC_FRAME_S16_LE,  eq_iir_s16_pass},
 	{SOF_IPC_FRAME_S16_LE,  SOF_IPC_FRAME_S24_4LE, NULL},
@@ -344,6 +502,37 @@ static void eq_iir_free_delaylines(struct comp_data *cd)
 	cd->iir_delay_size = 0;
 	for (i = 0; i < PLATFORM_MAX_CHANNELS; i++)
 		iir[i].delay = NULL;
+
+	cd->lane_groups = 0;
+	for (i = 0; i < EQ_IIR_LANE_GROUPS; i++) {
+		cd->lanes[i].coef = NULL;
+		cd->lanes[i].delay = NULL;
+	}
+}
+
+/* Prepare the multichannel DF2T for all channels. Returns the needed size
+ * for delay lines and coefficients or zero if some channel can't be run
+ * with it.
+ */
+static size_t eq_iir_lanes_init(struct comp_data *cd, int nch)
+{
+	size_t size_sum = 0;
+	int groups = ceil_divide(nch, IIR_DF2T_LANES);
+	int ret;
+	int ch;
+	int g;
+
+	for (g = 0; g < groups; g++) {
+		ch = g * IIR_DF2T_LANES;
+		ret = iir_init_coef_lanes_df2t(&cd->lanes[g], &cd->iir[ch],
+					       MIN(nch - ch, IIR_DF2T_LANES));
+		if (ret < 0)
+			return 0;
+
+		size_sum += ret;
+	}
+
+	return size_sum;
 }
 
 static int eq_iir_setup(struct comp_data *cd, int nch)
@@ -354,6 +543,7 @@ static int eq_iir_setup(struct comp_data *cd, int nch)
 	struct sof_eq_iir_header_df2t *eq;
 	int64_t *iir_delay;
 	int32_t *coef_data, *assign_response;
+	void *data;
 	size_t s;
 	size_t size_sum = 0;
 	int i;
@@ -383,8 +573,10 @@ static int eq_iir_setup(struct comp_data *cd, int nch)
 
 	/* Collect index of response start positions in all_coefficients[]  */
 	j = 0;
-	assign_response = &config->data[0];
-	coef_data = &config->data[config->channels_in_config];
+	/* config is packed, don't take the member address directly */
+	data = config->data;
+	assign_response = data;
+	coef_data = assign_response + config->channels_in_config;
 	for (i = 0; i < SOF_EQ_IIR_MAX_RESPONSES; i++) {
 		if (i < config->number_of_responses) {
 			trace_eq("eq_iir_setup(), "
@@ -441,6 +633,19 @@ static int eq_iir_setup(struct comp_data *cd, int nch)
 	cd->iir_delay_size = size_sum;
 	if (!size_sum)
 		return 0;
+
+	/* Use the multichannel DF2T when all channels can be run with it,
+	 * it needs memory also for the transposed coefficients.
+	 */
+	s = eq_iir_lanes_init(cd, nch);
+	if (s) {
+		cd->lane_groups = ceil_divide(nch, IIR_DF2T_LANES);
+		cd->iir_delay_size = s;
+		size_sum = s;
+		trace_eq("eq_iir_setup(), multichannel groups = %d",
+			 cd->lane_groups);
+	}
+
 	/* Allocate all IIR channels data in a big chunk and clear it */
 	cd->iir_delay = rzalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, size_sum);
 	if (!cd->iir_delay)
@@ -450,6 +655,14 @@ static int eq_iir_setup(struct comp_data *cd, int nch)
 
 	/* Initialize 2nd phase to set EQ delay lines pointers */
 	iir_delay = cd->iir_delay;
+	if (cd->lane_groups) {
+		for (i = 0; i < cd->lane_groups; i++)
+			iir_init_delay_lanes_df2t(&cd->lanes[i],
+						  &iir[i * IIR_DF2T_LANES],
+						  &iir_delay);
+		return 0;
+	}
+
 	for (i = 0; i < nch; i++) {
 		resp = assign_response[i];
 		if (resp >= 0)
@@ -817,8 +1030,10 @@ static int eq_iir_prepare(struct comp_dev *dev)
 				       "eq_iir_setup failed.");
 			goto err;
 		}
-		cd->eq_iir_func = eq_iir_find_func(cd, fm_configured,
-						   ARRAY_SIZE(fm_configured));
+		cd->eq_iir_func = cd->lane_groups ?
+			eq_iir_find_func(cd, fm_lanes, ARRAY_SIZE(fm_lanes)) :
+			eq_iir_find_func(cd, fm_configured,
+					 ARRAY_SIZE(fm_configured));
 		if (!cd->eq_iir_func) {
 			trace_eq_error("eq_iir_prepare() error: "
 					"No processing function available, "
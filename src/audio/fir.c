@@ -60,10 +60,13 @@ void fir_reset(struct fir_state_32x16 *fir)
 size_t fir_init_coef(struct fir_state_32x16 *fir,
 		     struct sof_eq_fir_coef_data *config)
 {
+	/* config is packed, don't take the member address directly */
+	void *coef = config->coef;
+
 	fir->rwi = 0;
 	fir->length = (int)config->length;
 	fir->out_shift = (int)config->out_shift;
-	fir->coef = &config->coef[0];
+	fir->coef = coef;
 	fir->delay = NULL;
 
 	/* Check for sane FIR length. The length is constrained to be a
@@ -72,83 +75,174 @@ size_t fir_init_coef(struct fir_state_32x16 *fir,
 	if (fir->length > SOF_EQ_FIR_MAX_LENGTH || fir->length < 1)
 		return -EINVAL;
 
-	return fir->length * sizeof(int32_t);
+	return FIR_DELAY_LENGTH(fir->length) * sizeof(int32_t);
 }
 
 void fir_init_delay(struct fir_state_32x16 *fir, int32_t **data)
 {
 	fir->delay = *data;
-	*data += fir->length; /* Point to next delay line start */
+	*data += FIR_DELAY_LENGTH(fir->length); /* Point to next delay line */
+
+	/* Start with zero history right after the first write position */
+	bzero(fir->delay, FIR_DELAY_LENGTH(fir->length) * sizeof(int32_t));
+	fir->rwi = FIR_DELAY_LENGTH(fir->length) - fir->length + 1;
 }
 
-void eq_fir_s16(struct fir_state_32x16 fir[], struct comp_buffer *source,
-		struct comp_buffer *sink, int frames, int nch)
+#if !FIR_SSE42 && !FIR_AVX2
+
+void fir_32x16_block(struct fir_state_32x16 *fir, int32_t y[], int n)
 {
-	struct fir_state_32x16 *filter;
-	int16_t *x;
-	int16_t *y;
-	int32_t z;
-	int idx;
-	int ch;
+	const int16_t *c = fir->coef;
+	const int length = fir->length;
+	int32_t *d = &fir->delay[fir->rwi + n - 1];
+	int64_t acc0;
+	int64_t acc1;
 	int i;
+	int j;
 
-	for (ch = 0; ch < nch; ch++) {
-		filter = &fir[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = buffer_read_frag_s16(source, idx);
-			y = buffer_write_frag_s16(sink, idx);
-			z = fir_32x16(filter, *x << 16);
-			*y = sat_int16(Q_SHIFT_RND(z, 31, 15));
-			idx += nch;
+	/* Oldest of the n new samples is the first output. Two outputs are
+	 * computed per iteration to reuse the coefficient loads, the newer
+	 * output uses delay line data one sample earlier.
+	 */
+	for (i = 0; i + 1 < n; i += 2) {
+		acc0 = 0;
+		acc1 = 0;
+
+		/* Data is Q8.24, coef is Q1.15, product is Q9.39 */
+		for (j = 0; j < length; j++) {
+			acc0 += (int64_t)c[j] * d[j];
+			acc1 += (int64_t)c[j] * d[j - 1];
 		}
+
+		y[i] = fir_32x16_out(fir, acc0);
+		y[i + 1] = fir_32x16_out(fir, acc1);
+		d -= 2;
+	}
+
+	if (i < n) {
+		acc0 = 0;
+		for (j = 0; j < length; j++)
+			acc0 += (int64_t)c[j] * d[j];
+
+		y[i] = fir_32x16_out(fir, acc0);
 	}
 }
 
-void eq_fir_s24(struct fir_state_32x16 fir[], struct comp_buffer *source,
-		struct comp_buffer *sink, int frames, int nch)
+#endif
+
+/* Get input sample as Q1.31 or Q8.24 for s32 */
+static inline int32_t eq_fir_load(const void *x, const int fmt)
 {
-	struct fir_state_32x16 *filter;
-	int32_t *x;
-	int32_t *y;
-	int32_t z;
-	int idx;
-	int ch;
+	switch (fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+		return (int32_t)*(int16_t *)x << 16;
+	case SOF_IPC_FRAME_S24_4LE:
+		return *(int32_t *)x << 8;
+	default:
+		return *(int32_t *)x;
+	}
+}
+
+static inline void eq_fir_store(void *y, int32_t z, const int fmt)
+{
+	switch (fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+		*(int16_t *)y = sat_int16(Q_SHIFT_RND(z, 31, 15));
+		break;
+	case SOF_IPC_FRAME_S24_4LE:
+		*(int32_t *)y = sat_int24(Q_SHIFT_RND(z, 31, 23));
+		break;
+	default:
+		*(int32_t *)y = z;
+		break;
+	}
+}
+
+/* Filter frames of one channel in blocks. The input samples of a block are
+ * first written to delay line, then all outputs of the block are computed
+ * with the linear delay line and stored to sink.
+ */
+static inline void eq_fir_block(struct fir_state_32x16 *filter,
+				struct comp_buffer *source,
+				struct comp_buffer *sink, int ch, int frames,
+				int nch, const int fmt)
+{
+	int32_t z[FIR_BLOCK_SAMPLES];
+	size_t sample_bytes = fmt == SOF_IPC_FRAME_S16_LE ?
+		sizeof(int16_t) : sizeof(int32_t);
+	size_t frame_bytes = nch * sample_bytes;
+	void *x = buffer_read_frag(source, ch, sample_bytes);
+	void *y = buffer_write_frag(sink, ch, sample_bytes);
+	int remaining = frames;
+	int n;
 	int i;
 
-	for (ch = 0; ch < nch; ch++) {
-		filter = &fir[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = buffer_read_frag_s32(source, idx);
-			y = buffer_write_frag_s32(sink, idx);
-			z = fir_32x16(filter, *x << 8);
-			*y = sat_int24(Q_SHIFT_RND(z, 31, 23));
-			idx += nch;
+	while (remaining) {
+		/* process up to the nearest source or sink wrap */
+		n = MIN(buffer_steps_without_wrap(source, x, frame_bytes),
+			buffer_steps_without_wrap(sink, y, frame_bytes));
+		n = MIN(n, remaining);
+		n = MIN(n, FIR_BLOCK_SAMPLES);
+
+		if (filter->length) {
+			/* limit to free space in delay line */
+			n = MIN(n, fir_delay_free(filter));
+
+			for (i = 1; i <= n; i++) {
+				filter->delay[filter->rwi - i] =
+					eq_fir_load(x, fmt);
+				x += frame_bytes;
+			}
+
+			filter->rwi -= n;
+			fir_32x16_block(filter, z, n);
+		} else {
+			/* Bypass is set with length set to zero. */
+			for (i = 0; i < n; i++) {
+				z[i] = eq_fir_load(x, fmt);
+				x += frame_bytes;
+			}
+		}
+
+		for (i = 0; i < n; i++) {
+			eq_fir_store(y, z[i], fmt);
+			y += frame_bytes;
 		}
+
+		remaining -= n;
+		x = buffer_wrap(source, x);
+		y = buffer_wrap(sink, y);
 	}
 }
 
+void eq_fir_s16(struct fir_state_32x16 fir[], struct comp_buffer *source,
+		struct comp_buffer *sink, int frames, int nch)
+{
+	int ch;
+
+	for (ch = 0; ch < nch; ch++)
+		eq_fir_block(&fir[ch], source, sink, ch, frames, nch,
+			     SOF_IPC_FRAME_S16_LE);
+}
+
+void eq_fir_s24(struct fir_state_32x16 fir[], struct comp_buffer *source,
+		struct comp_buffer *sink, int frames, int nch)
+{
+	int ch;
+
+	for (ch = 0; ch < nch; ch++)
+		eq_fir_block(&fir[ch], source, sink, ch, frames, nch,
+			     SOF_IPC_FRAME_S24_4LE);
+}
+
 void eq_fir_s32(struct fir_state_32x16 fir[], struct comp_buffer *source,
 		struct comp_buffer *sink, int frames, int nch)
 {
-	struct fir_state_32x16 *filter;
-	int32_t *x;
-	int32_t *y;
-	int idx;
 	int ch;
-	int i;
 
-	for (ch = 0; ch < nch; ch++) {
-		filter = &fir[ch];
-		idx = ch;
-		for (i = 0; i < frames; i++) {
-			x = buffer_read_frag_s32(source, idx);
-			y = buffer_write_frag_s32(sink, idx);
-			*y = fir_32x16(filter, *x);
-			idx += nch;
-		}
-	}
+	for (ch = 0; ch < nch; ch++)
+		eq_fir_block(&fir[ch], source, sink, ch, frames, nch,
+			     SOF_IPC_FRAME_S32_LE);
 }
 
 #endif
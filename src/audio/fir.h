@@ -37,10 +37,22 @@
 
 #if FIR_GENERIC
 
+#include <sof/string.h>
 #include <sof/audio/format.h>
 
+/* The delay line is linear and twice the filter length. New samples are
+ * written towards lower addresses so that the newest sample and the
+ * length - 1 samples before it are always contiguous, in the same order as
+ * the coefficients. When the write index reaches the start the history is
+ * moved back to the end of the delay line.
+ */
+#define FIR_DELAY_LENGTH(length)	(2 * (length))
+
+/* Maximum number of samples processed per FIR block call */
+#define FIR_BLOCK_SAMPLES		64
+
 struct fir_state_32x16 {
-	int rwi; /* Circular read and write index */
+	int rwi; /* Index of the newest sample in delay line */
 	int length; /* Number of FIR taps */
 	int out_shift; /* Amount of right shifts at output */
 	int16_t *coef; /* Pointer to FIR coefficients */
@@ -63,64 +75,36 @@ void eq_fir_s24(struct fir_state_32x16 *fir, struct comp_buffer *source,
 void eq_fir_s32(struct fir_state_32x16 *fir, struct comp_buffer *source,
 		struct comp_buffer *sink, int frames, int nch);
 
+/* Compute n output samples for the n newest samples in delay line. The
+ * output y[0] is for the oldest of them. Data is Q8.24, coef is Q1.15 and
+ * output is Q8.24. This is the multiply-accumulate kernel that has an
+ * optimized version for each supported instruction set.
+ */
+void fir_32x16_block(struct fir_state_32x16 *fir, int32_t y[], int n);
+
 /* The next functions are inlined to optmize execution speed */
 
-static inline void fir_part_32x16(int64_t *y, int taps, const int16_t c[],
-				  int *ic, int32_t d[], int *id)
+/* Get number of samples that can be written to delay line without
+ * moving the history to delay line end.
+ */
+static inline int fir_delay_free(struct fir_state_32x16 *fir)
 {
-	int n;
+	int history = fir->length - 1;
 
-	/* Data is Q8.24, coef is Q1.15, product is Q9.39 */
-	for (n = 0; n < taps; n++) {
-		*y += (int64_t)c[*ic] * d[*id];
-		(*ic)++;
-		(*id)--;
+	if (!fir->rwi) {
+		memcpy(fir->delay + FIR_DELAY_LENGTH(fir->length) - history,
+		       fir->delay, history * sizeof(int32_t));
+		fir->rwi = FIR_DELAY_LENGTH(fir->length) - history;
 	}
+
+	return fir->rwi;
 }
 
-static inline int32_t fir_32x16(struct fir_state_32x16 *fir, int32_t x)
+/* Round and saturate 64 bit Q9.39 accumulator to Q8.24 output */
+static inline int32_t fir_32x16_out(struct fir_state_32x16 *fir, int64_t y)
 {
-	int64_t y = 0;
-	int n1;
-	int n2;
-	int i = 0; /* Start from 1st tap */
-	int tmp_ri;
-
-	/* Bypass is set with length set to zero. */
-	if (!fir->length)
-		return x;
-
-	/* Write sample to delay */
-	fir->delay[fir->rwi] = x;
-
-	/* Start FIR calculation. Calculate first number of taps possible to
-	 * calculate before circular wrap need.
-	 */
-	n1 = fir->rwi + 1;
-	/* Point to newest sample and advance read index */
-	tmp_ri = (fir->rwi)++;
-	if (fir->rwi == fir->length)
-		fir->rwi = 0;
-
-	if (n1 > fir->length) {
-		/* No need to un-wrap fir read index, make sure ri
-		 * is >= 0 after FIR computation.
-		 */
-		fir_part_32x16(&y, fir->length, fir->coef, &i, fir->delay,
-			       &tmp_ri);
-	} else {
-		n2 = fir->length - n1;
-		/* Part 1, loop n1 times, fir_ri becomes -1 */
-		fir_part_32x16(&y, n1, fir->coef, &i, fir->delay, &tmp_ri);
-
-		/* Part 2, unwrap fir_ri, continue rest of filter */
-		tmp_ri = fir->length - 1;
-		fir_part_32x16(&y, n2, fir->coef, &i, fir->delay, &tmp_ri);
-	}
 	/* Q9.39 -> Q9.24, saturate to Q8.24 */
-	y = sat_int32(y >> (15 + fir->out_shift));
-
-	return (int32_t)y;
+	return sat_int32(y >> (15 + fir->out_shift));
 }
 
 #endif
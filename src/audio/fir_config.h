@@ -48,6 +48,8 @@
 #define FIR_GENERIC	0
 #define FIR_HIFIEP	0
 #define FIR_HIFI3	1
+#define FIR_SSE42	0
+#define FIR_AVX2	0
 #endif
 
 /* Select optimized code variant when xt-xcc compiler is used */
@@ -72,6 +74,20 @@
 #endif
 #endif
 
+/* The generic block FIR uses x86 SIMD multiply-accumulate kernels when
+ * built for the optimized host library modules.
+ */
+#if FIR_GENERIC && defined(__AVX2__)
+#define FIR_SSE42	0
+#define FIR_AVX2	1
+#elif FIR_GENERIC && defined(__SSE4_2__)
+#define FIR_SSE42	1
+#define FIR_AVX2	0
+#elif FIR_AUTOARCH == 1
+#define FIR_SSE42	0
+#define FIR_AVX2	0
+#endif
+
 #define FIR_CONFIG_H
 
 #endif
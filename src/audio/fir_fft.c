@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <sof/alloc.h>
+#include <sof/audio/component.h>
+#include <sof/audio/format.h>
+#include <sof/math/fft.h>
+#include <sof/math/numbers.h>
+#include <uapi/user/eq.h>
+#include "fir_fft.h"
+
+/*
+ * EQ FIR uniformly partitioned overlap-save convolution
+ *
+ * Input blocks of psize samples are transformed together with the previous
+ * block with a FFT of size 2 * psize. The input spectra of the latest
+ * blocks are kept in a frequency domain delay line and multiplied with the
+ * spectra of the corresponding filter partitions. The inverse FFT of the
+ * sum gives in its second half psize samples of the linear convolution.
+ * The output is delayed by psize samples.
+ */
+
+int fir_fft_init(struct fir_fft *fft, int psize)
+{
+	int i;
+
+	if (psize < FIR_FFT_PARTITION_MIN || psize > FIR_FFT_PARTITION_MAX)
+		return -EINVAL;
+
+	fft->psize = psize;
+	fft->plan = fft_plan_new(2 * psize);
+	fft->buf = rballoc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM,
+			   (psize + 1) * sizeof(struct icomplex32));
+	fft->acc = rballoc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM,
+			   2 * (psize + 1) * sizeof(int64_t));
+	if (!fft->plan || !fft->buf || !fft->acc) {
+		fir_fft_free(fft);
+		return -ENOMEM;
+	}
+
+	for (i = 0; i < PLATFORM_MAX_CHANNELS; i++)
+		fir_fft_reset(&fft->state[i]);
+
+	return 0;
+}
+
+void fir_fft_free(struct fir_fft *fft)
+{
+	fft_plan_free(fft->plan);
+	rfree(fft->buf);
+	rfree(fft->acc);
+	fft->plan = NULL;
+	fft->buf = NULL;
+	fft->acc = NULL;
+	fft->psize = 0;
+}
+
+void fir_fft_reset(struct fir_fft_state *state)
+{
+	state->length = 0;
+	state->partitions = 0;
+	state->out_shift = 0;
+	state->shift = 0;
+	state->coef_data = NULL;
+	state->coef = NULL;
+	state->fdl = NULL;
+	state->fdl_idx = 0;
+	state->in = NULL;
+	state->out = NULL;
+	state->pos = 0;
+}
+
+/* Setup channel for a filter response or for a bypass with the same delay
+ * as the filtered channels if config is NULL. Returns the size of needed
+ * data in bytes or a negative error code.
+ */
+int fir_fft_init_coef(struct fir_fft *fft, struct fir_fft_state *state,
+		      struct sof_eq_fir_coef_data *config)
+{
+	int psize = fft->psize;
+	int spectrum_bytes = (psize + 1) * sizeof(struct icomplex32);
+	void *coef;
+
+	fir_fft_reset(state);
+	if (config) {
+		state->length = config->length;
+		state->out_shift = config->out_shift;
+		/* config is packed, don't take the member address directly */
+		coef = config->coef;
+		state->coef_data = coef;
+		state->partitions = ceil_divide(state->length, psize);
+
+		/* Spectra of input and coefficients are scaled by 1/fft_size
+		 * each, one of the scalings is compensated here. The output
+		 * shift and inverse FFT headroom are applied here too.
+		 */
+		state->shift = 15 - fft->plan->len + state->out_shift +
+			FIR_FFT_HEADROOM;
+
+		if (state->length < 1 ||
+		    state->length > SOF_EQ_FIR_FFT_MAX_LENGTH ||
+		    state->shift < 1)
+			return -EINVAL;
+	}
+
+	/* Coefficients and input spectra, previous and current input block,
+	 * and output block.
+	 */
+	return 2 * state->partitions * spectrum_bytes +
+		3 * psize * sizeof(int32_t);
+}
+
+void fir_fft_init_data(struct fir_fft *fft, struct fir_fft_state *state,
+		       int32_t **data)
+{
+	struct icomplex32 *buf = fft->buf;
+	int32_t *x = (int32_t *)fft->buf;
+	int psize = fft->psize;
+	int nbins = psize + 1;
+	int i;
+	int j;
+	int k;
+
+	state->coef = (struct icomplex32 *)*data;
+	state->fdl = state->coef + state->partitions * nbins;
+	state->in = (int32_t *)(state->fdl + state->partitions * nbins);
+	state->out = state->in + 2 * psize;
+	*data = state->out + psize; /* Point to next channel data start */
+
+	bzero(state->fdl, state->partitions * nbins * sizeof(*state->fdl));
+	bzero(state->in, 3 * psize * sizeof(int32_t));
+
+	/* Compute spectrum of every zero padded filter partition */
+	for (k = 0; k < state->partitions; k++) {
+		bzero(buf, nbins * sizeof(*buf));
+		for (i = 0; i < psize; i++) {
+			j = k * psize + i;
+			if (j >= state->length)
+				break;
+
+			/* Q1.15 to Q1.31 */
+			x[i] = (int32_t)state->coef_data[j] << 16;
+		}
+
+		fft_real_execute_32(fft->plan, buf, 0, 1);
+		memcpy(&state->coef[k * nbins], buf, nbins * sizeof(*buf));
+	}
+}
+
+/* Filter the input block of a channel and update the output block */
+static void fir_fft_block(struct fir_fft *fft, struct fir_fft_state *state)
+{
+	struct icomplex32 *buf = fft->buf;
+	struct icomplex32 *x;
+	struct icomplex32 *h;
+	int64_t *acc = fft->acc;
+	int64_t re;
+	int64_t im;
+	int32_t *y;
+	int psize = fft->psize;
+	int nbins = psize + 1;
+	int fdl_idx;
+	int i;
+	int k;
+
+	/* Delay only bypass */
+	if (!state->partitions) {
+		memcpy(state->out, &state->in[psize], psize * sizeof(int32_t));
+		return;
+	}
+
+	/* Spectrum of previous and current input block */
+	memcpy(buf, state->in, 2 * psize * sizeof(int32_t));
+	fft_real_execute_32(fft->plan, buf, 0, 1);
+
+	/* Insert as newest to frequency domain delay line */
+	state->fdl_idx = state->fdl_idx ? state->fdl_idx - 1 :
+		state->partitions - 1;
+	memcpy(&state->fdl[state->fdl_idx * nbins], buf,
+	       nbins * sizeof(*buf));
+
+	/* Sum the products of input spectra and partition spectra, the
+	 * Q2.62 products are accumulated as Q18.46.
+	 */
+	bzero(acc, 2 * nbins * sizeof(int64_t));
+	fdl_idx = state->fdl_idx;
+	for (k = 0; k < state->partitions; k++) {
+		x = &state->fdl[fdl_idx * nbins];
+		h = &state->coef[k * nbins];
+		for (i = 0; i < nbins; i++) {
+			re = (int64_t)x[i].real * h[i].real -
+				(int64_t)x[i].imag * h[i].imag;
+			im = (int64_t)x[i].real * h[i].imag +
+				(int64_t)x[i].imag * h[i].real;
+			acc[2 * i] += re >> 16;
+			acc[2 * i + 1] += im >> 16;
+		}
+
+		if (++fdl_idx == state->partitions)
+			fdl_idx = 0;
+	}
+
+	/* Output spectrum */
+	for (i = 0; i < nbins; i++) {
+		buf[i].real = sat_int32(Q_SHIFT_RND(acc[2 * i],
+						    state->shift, 0));
+		buf[i].imag = sat_int32(Q_SHIFT_RND(acc[2 * i + 1],
+						    state->shift, 0));
+	}
+
+	fft_real_execute_32(fft->plan, buf, 1, 0);
+
+	/* The second half is the valid part of circular convolution */
+	y = (int32_t *)buf + psize;
+	for (i = 0; i < psize; i++)
+		state->out[i] = sat_int32((int64_t)y[i] << FIR_FFT_HEADROOM);
+
+	/* Current input block becomes the previous */
+	memcpy(state->in, &state->in[psize], psize * sizeof(int32_t));
+}
+
+/* Get input sample as Q1.31 */
+static inline int32_t fir_fft_load(const void *x, const int fmt)
+{
+	switch (fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+		return (int32_t)*(int16_t *)x << 16;
+	case SOF_IPC_FRAME_S24_4LE:
+		return *(int32_t *)x << 8;
+	default:
+		return *(int32_t *)x;
+	}
+}
+
+static inline void fir_fft_store(void *y, int32_t z, const int fmt)
+{
+	switch (fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+		*(int16_t *)y = sat_int16(Q_SHIFT_RND(z, 31, 15));
+		break;
+	case SOF_IPC_FRAME_S24_4LE:
+		*(int32_t *)y = sat_int24(Q_SHIFT_RND(z, 31, 23));
+		break;
+	default:
+		*(int32_t *)y = z;
+		break;
+	}
+}
+
+static inline void eq_fir_fft_channel(struct fir_fft *fft,
+				      struct fir_fft_state *state,
+				      struct comp_buffer *source,
+				      struct comp_buffer *sink, int ch,
+				      int frames, int nch, const int fmt)
+{
+	size_t sample_bytes = fmt == SOF_IPC_FRAME_S16_LE ?
+		sizeof(int16_t) : sizeof(int32_t);
+	size_t frame_bytes = nch * sample_bytes;
+	void *x = buffer_read_frag(source, ch, sample_bytes);
+	void *y = buffer_write_frag(sink, ch, sample_bytes);
+	int32_t *in;
+	int32_t *out;
+	int remaining = frames;
+	int n;
+	int i;
+
+	while (remaining) {
+		/* process up to the nearest source or sink wrap or to
+		 * the end of the current block
+		 */
+		n = MIN(buffer_steps_without_wrap(source, x, frame_bytes),
+			buffer_steps_without_wrap(sink, y, frame_bytes));
+		n = MIN(n, remaining);
+		n = MIN(n, fft->psize - state->pos);
+
+		in = &state->in[fft->psize + state->pos];
+		out = &state->out[state->pos];
+		for (i = 0; i < n; i++) {
+			in[i] = fir_fft_load(x, fmt);
+			fir_fft_store(y, out[i], fmt);
+			x += frame_bytes;
+			y += frame_bytes;
+		}
+
+		state->pos += n;
+		if (state->pos == fft->psize) {
+			fir_fft_block(fft, state);
+			state->pos = 0;
+		}
+
+		remaining -= n;
+		x = buffer_wrap(source, x);
+		y = buffer_wrap(sink, y);
+	}
+}
+
+void eq_fir_fft_s16(struct fir_fft *fft, struct comp_buffer *source,
+		    struct comp_buffer *sink, int frames, int nch)
+{
+	int ch;
+
+	for (ch = 0; ch < nch; ch++)
+		eq_fir_fft_channel(fft, &fft->state[ch], source, sink, ch,
+				   frames, nch, SOF_IPC_FRAME_S16_LE);
+}
+
+void eq_fir_fft_s24(struct fir_fft *fft, struct comp_buffer *source,
+		    struct comp_buffer *sink, int frames, int nch)
+{
+	int ch;
+
+	for (ch = 0; ch < nch; ch++)
+		eq_fir_fft_channel(fft, &fft->state[ch], source, sink, ch,
+				   frames, nch, SOF_IPC_FRAME_S24_4LE);
+}
+
+void eq_fir_fft_s32(struct fir_fft *fft, struct comp_buffer *source,
+		    struct comp_buffer *sink, int frames, int nch)
+{
+	int ch;
+
+	for (ch = 0; ch < nch; ch++)
+		eq_fir_fft_channel(fft, &fft->state[ch], source, sink, ch,
+				   frames, nch, SOF_IPC_FRAME_S32_LE);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FIR_FFT_H
+#define FIR_FFT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sof/audio/component.h>
+#include <sof/math/fft.h>
+#include <uapi/user/eq.h>
+
+/* Partition size limits in samples, FFT size is twice the partition */
+#define FIR_FFT_PARTITION_MIN	16
+#define FIR_FFT_PARTITION_MAX	(FFT_SIZE_MAX / 2)
+
+/* Bits of headroom in the unscaled inverse FFT, output samples can exceed
+ * full scale by this many bits before the inverse transform saturates.
+ */
+#define FIR_FFT_HEADROOM	2
+
+/* Uniformly partitioned overlap-save convolution state of a channel.
+ * The filter is split to partitions of psize taps. Spectra have psize + 1
+ * bins since the rest of the spectrum of real signals is the conjugate.
+ */
+struct fir_fft_state {
+	int length; /* Number of FIR taps, zero for delay only bypass */
+	int partitions; /* Number of filter partitions */
+	int out_shift; /* Amount of right shifts at output */
+	int shift; /* Right shifts of accumulated spectrum products */
+	int16_t *coef_data; /* Pointer to FIR coefficients in blob */
+	struct icomplex32 *coef; /* Partitions spectra */
+	struct icomplex32 *fdl; /* Frequency domain delay line of input */
+	int fdl_idx; /* Index of newest input spectrum in fdl */
+	int32_t *in; /* Previous and current input block */
+	int32_t *out; /* Output block */
+	int pos; /* Sample index in current block */
+};
+
+struct fir_fft {
+	struct fft_plan *plan; /* FFT of twice the partition size */
+	struct icomplex32 *buf; /* FFT work buffer */
+	int64_t *acc; /* Spectrum accumulator, real and imaginary pairs */
+	int psize; /* Partition size and latency in samples */
+	struct fir_fft_state state[PLATFORM_MAX_CHANNELS];
+};
+
+int fir_fft_init(struct fir_fft *fft, int psize);
+
+void fir_fft_free(struct fir_fft *fft);
+
+void fir_fft_reset(struct fir_fft_state *state);
+
+int fir_fft_init_coef(struct fir_fft *fft, struct fir_fft_state *state,
+		      struct sof_eq_fir_coef_data *config);
+
+void fir_fft_init_data(struct fir_fft *fft, struct fir_fft_state *state,
+		       int32_t **data);
+
+void eq_fir_fft_s16(struct fir_fft *fft, struct comp_buffer *source,
+		    struct comp_buffer *sink, int frames, int nch);
+
+void eq_fir_fft_s24(struct fir_fft *fft, struct comp_buffer *source,
+		    struct comp_buffer *sink, int frames, int nch);
+
+void eq_fir_fft_s32(struct fir_fft *fft, struct comp_buffer *source,
+		    struct comp_buffer *sink, int frames, int nch);
+
+#endif
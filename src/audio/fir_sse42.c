@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sof/audio/component.h>
+#include <sof/audio/format.h>
+#include <uapi/user/eq.h>
+#include "fir_config.h"
+
+#if FIR_SSE42
+
+#include <immintrin.h>
+#include "fir.h"
+
+/* Multiply-accumulate four taps. The coefficients are sign extended to
+ * 32 bits and c_odd holds the odd taps in the even lanes that the
+ * 32x32 -> 64 bit multiply uses. Products are Q9.39 as in generic code.
+ */
+static inline __m128i fir_sse42_mac(__m128i acc, const int32_t *d,
+				    __m128i c, __m128i c_odd)
+{
+	__m128i x = _mm_loadu_si128((__m128i *)d);
+
+	acc = _mm_add_epi64(acc, _mm_mul_epi32(x, c));
+	x = _mm_srli_epi64(x, 32);
+	return _mm_add_epi64(acc, _mm_mul_epi32(x, c_odd));
+}
+
+static inline int64_t fir_sse42_hsum(__m128i acc)
+{
+	return _mm_cvtsi128_si64(_mm_add_epi64(acc,
+					       _mm_unpackhi_epi64(acc, acc)));
+}
+
+/* Compute output for the delay line data that starts from d */
+static inline int64_t fir_sse42_dot(const int16_t *coef, const int32_t *d,
+				    int length)
+{
+	__m128i acc = _mm_setzero_si128();
+	__m128i c;
+	int64_t y;
+	int j;
+
+	for (j = 0; j + 4 <= length; j += 4) {
+		c = _mm_cvtepi16_epi32(_mm_loadl_epi64((__m128i *)
+						       &coef[j]));
+		acc = fir_sse42_mac(acc, &d[j], c, _mm_srli_epi64(c, 32));
+	}
+
+	y = fir_sse42_hsum(acc);
+	for (; j < length; j++)
+		y += (int64_t)coef[j] * d[j];
+
+	return y;
+}
+
+void fir_32x16_block(struct fir_state_32x16 *fir, int32_t y[], int n)
+{
+	const int16_t *coef = fir->coef;
+	const int length = fir->length;
+	int32_t *d0;
+	int32_t *d1;
+	__m128i acc0;
+	__m128i acc1;
+	__m128i c;
+	__m128i c_odd;
+	int64_t y0;
+	int64_t y1;
+	int i;
+	int j;
+
+	/* Compute two outputs per iteration to share the coefficient
+	 * loads, the newer output uses delay line data one sample earlier.
+	 */
+	for (i = 0; i + 1 < n; i += 2) {
+		d0 = &fir->delay[fir->rwi + n - 1 - i];
+		d1 = d0 - 1;
+		acc0 = _mm_setzero_si128();
+		acc1 = _mm_setzero_si128();
+
+		for (j = 0; j + 4 <= length; j += 4) {
+			c = _mm_cvtepi16_epi32(_mm_loadl_epi64((__m128i *)
+							       &coef[j]));
+			c_odd = _mm_srli_epi64(c, 32);
+			acc0 = fir_sse42_mac(acc0, &d0[j], c, c_odd);
+			acc1 = fir_sse42_mac(acc1, &d1[j], c, c_odd);
+		}
+
+		y0 = fir_sse42_hsum(acc0);
+		y1 = fir_sse42_hsum(acc1);
+		for (; j < length; j++) {
+			y0 += (int64_t)coef[j] * d0[j];
+			y1 += (int64_t)coef[j] * d1[j];
+		}
+
+		y[i] = fir_32x16_out(fir, y0);
+		y[i + 1] = fir_32x16_out(fir, y1);
+	}
+
+	/* The newest sample of an odd length block */
+	if (i < n)
+		y[i] = fir_32x16_out(fir, fir_sse42_dot(coef,
+							fir->delay + fir->rwi,
+							length));
+}
+
+#endif
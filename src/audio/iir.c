@@ -39,6 +39,7 @@
 #endif
 
 #include <sof/audio/format.h>
+#include <sof/math/numbers.h>
 #include <uapi/user/eq.h>
 #include "iir.h"
 
@@ -131,12 +132,86 @@ int32_t iir_df2t(struct iir_state_df2t *iir, int32_t x)
 	return out;
 }
 
+#if !IIR_SSE42 && !IIR_AVX2
+
+/* Run one biquad of a lane for n samples with stride of IIR_DF2T_LANES. The
+ * arithmetic is the same as in iir_df2t().
+ */
+static void iir_df2t_lane(int32_t *coef, int64_t *delay, int32_t x[], int n)
+{
+	int32_t a2 = coef[0];
+	int32_t a1 = coef[IIR_DF2T_LANES];
+	int32_t b2 = coef[2 * IIR_DF2T_LANES];
+	int32_t b1 = coef[3 * IIR_DF2T_LANES];
+	int32_t b0 = coef[4 * IIR_DF2T_LANES];
+	int32_t shift = coef[5 * IIR_DF2T_LANES];
+	int32_t gain = coef[6 * IIR_DF2T_LANES];
+	int64_t d0 = delay[0];
+	int64_t d1 = delay[IIR_DF2T_LANES];
+	int64_t acc;
+	int32_t tmp;
+	int32_t in;
+	int i;
+
+	for (i = 0; i < n; i += IIR_DF2T_LANES) {
+		in = x[i];
+		acc = (int64_t)b0 * in + d0;
+		tmp = (int32_t)Q_SHIFT_RND(acc, 61, 31);
+		d0 = d1 + (int64_t)b1 * in + (int64_t)a1 * tmp;
+		d1 = (int64_t)b2 * in + (int64_t)a2 * tmp;
+		acc = (int64_t)gain * tmp;
+		acc = Q_SHIFT_RND(acc, 45 + shift, 31);
+		x[i] = sat_int32(acc);
+	}
+
+	delay[0] = d0;
+	delay[IIR_DF2T_LANES] = d1;
+}
+
+/* Multichannel DF2T, the biquads are run one by one for the whole block of
+ * frames and only for the used lanes.
+ */
+void iir_df2t_lanes(struct iir_lanes_df2t *iir, int32_t x[], int32_t y[],
+		    int frames)
+{
+	int32_t *coef = iir->coef;
+	int64_t *delay = iir->delay;
+	int n = frames * IIR_DF2T_LANES;
+	int s;
+	int b;
+	int l;
+	int i;
+
+	for (s = 0; s < iir->sections; s++) {
+		for (b = 0; b < iir->biquads_in_series; b++) {
+			for (l = 0; l < iir->channels; l++)
+				iir_df2t_lane(coef + l, delay + l, x + l,
+					      n - l);
+
+			coef += SOF_EQ_IIR_NBIQUAD_DF2T * IIR_DF2T_LANES;
+			delay += IIR_DF2T_NUM_DELAYS * IIR_DF2T_LANES;
+		}
+
+		/* Sum the section outputs */
+		for (l = 0; l < iir->channels; l++) {
+			for (i = l; i < n; i += IIR_DF2T_LANES)
+				y[i] = s ? sat_int32((int64_t)y[i] + x[i]) :
+					x[i];
+		}
+	}
+}
+
+#endif
+
 size_t iir_init_coef_df2t(struct iir_state_df2t *iir,
 			  struct sof_eq_iir_header_df2t *config)
 {
+	/* config is packed, don't take the member address directly */
+	void *biquads = config->biquads;
+
 	iir->biquads = config->num_sections;
 	iir->biquads_in_series = config->num_sections_in_series;
-	iir->coef = config->biquads;
+	iir->coef = biquads;
 	iir->delay = NULL;
 
 	if (iir->biquads > SOF_EQ_IIR_DF2T_BIQUADS_MAX ||
@@ -159,6 +234,124 @@ void iir_init_delay_df2t(struct iir_state_df2t *iir, int64_t **delay)
 	*delay += 2 * iir->biquads;
 }
 
+/* Coefficients {a2, a1, b2, b1, b0, shift, gain} of a biquad that passes
+ * the input through unchanged and of a biquad that outputs zero.
+ */
+static const int32_t iir_df2t_pass[SOF_EQ_IIR_NBIQUAD_DF2T] = {
+	0, 0, 0, 0, 1 << 30, 0, 1 << 14
+};
+
+static const int32_t iir_df2t_zero[SOF_EQ_IIR_NBIQUAD_DF2T] = {
+	0, 0, 0, 0, 0, 0, 0
+};
+
+int iir_init_coef_lanes_df2t(struct iir_lanes_df2t *lanes,
+			     struct iir_state_df2t iir[], int nch)
+{
+	unsigned int sections = 1;
+	unsigned int in_series = 1;
+	int32_t shift;
+	int biquads;
+	int ch;
+	int i;
+
+	if (nch > IIR_DF2T_LANES)
+		return -EINVAL;
+
+	/* Find the common structure for the channels and check that the
+	 * shifts can be done by the multichannel DF2T.
+	 */
+	for (ch = 0; ch < nch; ch++) {
+		if (!iir[ch].biquads)
+			continue;
+
+		if (!iir[ch].biquads_in_series ||
+		    iir[ch].biquads % iir[ch].biquads_in_series)
+			return -EINVAL;
+
+		sections = MAX(sections,
+			       iir[ch].biquads / iir[ch].biquads_in_series);
+		in_series = MAX(in_series, iir[ch].biquads_in_series);
+		for (i = 0; i < iir[ch].biquads; i++) {
+			shift = iir[ch].coef[i * SOF_EQ_IIR_NBIQUAD_DF2T + 5];
+			if (shift < IIR_DF2T_LANES_SHIFT_MIN ||
+			    shift > IIR_DF2T_LANES_SHIFT_MAX)
+				return -EINVAL;
+		}
+	}
+
+	lanes->channels = nch;
+	lanes->sections = sections;
+	lanes->biquads_in_series = in_series;
+	lanes->coef = NULL;
+	lanes->delay = NULL;
+
+	/* Needed size for delay lines and transposed coefficients */
+	biquads = sections * in_series * IIR_DF2T_LANES;
+	return biquads * (IIR_DF2T_NUM_DELAYS * sizeof(int64_t) +
+			  SOF_EQ_IIR_NBIQUAD_DF2T * sizeof(int32_t));
+}
+
+/* Get coefficients of a biquad in a section of a channel, a bypassed
+ * channel passes the input through the first section.
+ */
+static const int32_t *iir_lanes_biquad(struct iir_state_df2t *iir,
+				       unsigned int section, unsigned int i)
+{
+	unsigned int sections;
+
+	if (!iir->biquads)
+		return section ? iir_df2t_zero : iir_df2t_pass;
+
+	sections = iir->biquads / iir->biquads_in_series;
+	if (section >= sections)
+		return iir_df2t_zero;
+
+	if (i >= iir->biquads_in_series)
+		return iir_df2t_pass;
+
+	return iir->coef + (section * iir->biquads_in_series + i) *
+		SOF_EQ_IIR_NBIQUAD_DF2T;
+}
+
+void iir_init_delay_lanes_df2t(struct iir_lanes_df2t *lanes,
+			       struct iir_state_df2t iir[], int64_t **delay)
+{
+	const int32_t *src;
+	int32_t *dst;
+	int biquads = lanes->sections * lanes->biquads_in_series;
+	int s;
+	int b;
+	int l;
+	int k;
+
+	/* Delay lines are followed by the coefficients */
+	lanes->delay = *delay;
+	lanes->coef = (int32_t *)(lanes->delay +
+				  biquads * IIR_DF2T_NUM_DELAYS *
+				  IIR_DF2T_LANES);
+	*delay = (int64_t *)(lanes->coef +
+			     biquads * SOF_EQ_IIR_NBIQUAD_DF2T *
+			     IIR_DF2T_LANES);
+
+	dst = lanes->coef;
+	for (s = 0; s < lanes->sections; s++) {
+		for (b = 0; b < lanes->biquads_in_series; b++) {
+			for (l = 0; l < IIR_DF2T_LANES; l++) {
+				if (l < lanes->channels)
+					src = iir_lanes_biquad(&iir[l], s, b);
+				else
+					src = iir_df2t_zero;
+
+				for (k = 0; k < SOF_EQ_IIR_NBIQUAD_DF2T; k++)
+					dst[k * IIR_DF2T_LANES + l] = src[k];
+			}
+
+			dst += SOF_EQ_IIR_NBIQUAD_DF2T * IIR_DF2T_LANES;
+		}
+	}
+}
+
 void iir_reset_df2t(struct iir_state_df2t *iir)
 {
 	iir->biquads = 0;
@@ -34,9 +34,22 @@
 #define IIR_H
 
 #include <uapi/user/eq.h>
+#include "iir_config.h"
 
 #define IIR_DF2T_NUM_DELAYS 2
 
+/* Number of channels processed in parallel by the multichannel DF2T */
+#define IIR_DF2T_LANES 4
+
+/* Maximum number of frames processed per multichannel DF2T call */
+#define IIR_BLOCK_FRAMES 16
+
+/* The multichannel DF2T applies the biquad output shift as one rounding
+ * right shift of 14 + shift, which needs to stay within 1..63.
+ */
+#define IIR_DF2T_LANES_SHIFT_MIN -13
+#define IIR_DF2T_LANES_SHIFT_MAX 49
+
 struct iir_state_df2t {
 	unsigned int biquads; /* Number of IIR 2nd order sections total */
 	unsigned int biquads_in_series; /* Number of IIR 2nd order sections
@@ -46,8 +59,38 @@ struct iir_state_df2t {
 	int64_t *delay; /* Pointer to IIR delay line */
 };
 
+/* Multichannel DF2T for up to IIR_DF2T_LANES channels. All channels are
+ * run with a common structure of sections and biquads in series. Channels
+ * with a shorter cascade are padded with pass-through biquads within a
+ * section and with zero output sections, which keeps the output identical
+ * to iir_df2t(). The coefficients are transposed so that every coefficient
+ * of a biquad is stored for all lanes next to each other, in the same
+ * order as in the configuration blob.
+ */
+struct iir_lanes_df2t {
+	unsigned int channels; /* Number of used lanes */
+	unsigned int sections; /* Number of sections */
+	unsigned int biquads_in_series; /* Number of biquads in a section */
+	int32_t *coef; /* [biquad][coefficient][lane] */
+	int64_t *delay; /* [biquad][delay][lane] */
+};
+
 int32_t iir_df2t(struct iir_state_df2t *iir, int32_t x);
 
+/* Filter a block of frames with the multichannel DF2T. The input x and the
+ * output y are frames of IIR_DF2T_LANES samples, the input is overwritten.
+ * This is the kernel that has an optimized version for each supported
+ * instruction set.
+ */
+void iir_df2t_lanes(struct iir_lanes_df2t *iir, int32_t x[], int32_t y[],
+		    int frames);
+
+int iir_init_coef_lanes_df2t(struct iir_lanes_df2t *lanes,
+			     struct iir_state_df2t iir[], int nch);
+
+void iir_init_delay_lanes_df2t(struct iir_lanes_df2t *lanes,
+			       struct iir_state_df2t iir[], int64_t **delay);
+
 size_t iir_init_coef_df2t(struct iir_state_df2t *iir,
 			  struct sof_eq_iir_header_df2t *config);
 
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sof/audio/format.h>
+#include <uapi/user/eq.h>
+#include "iir_config.h"
+
+#if IIR_AVX2
+
+#include <immintrin.h>
+#include "iir.h"
+
+/* The four lanes are sign extended to 64 bits so that the 32x32 -> 64 bit
+ * multiply can be used for the 32 bit data and coefficients.
+ */
+static inline __m256i iir_avx2_load(const int32_t *x)
+{
+	return _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)x));
+}
+
+static inline void iir_avx2_store(int32_t *x, __m256i v)
+{
+	const __m256i idx = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+	v = _mm256_permutevar8x32_epi32(v, idx);
+	_mm_storeu_si128((__m128i *)x, _mm256_castsi256_si128(v));
+}
+
+/* Arithmetic right shift by a lane specific amount, done as a logical
+ * shift of the ones' complement for negative values.
+ */
+static inline __m256i iir_avx2_srav(__m256i x, __m256i shift)
+{
+	__m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+
+	x = _mm256_srlv_epi64(_mm256_xor_si256(x, sign), shift);
+	return _mm256_xor_si256(x, sign);
+}
+
+static inline __m256i iir_avx2_sat(__m256i x)
+{
+	const __m256i max = _mm256_set1_epi64x(INT32_MAX);
+	const __m256i min = _mm256_set1_epi64x(INT32_MIN);
+
+	x = _mm256_blendv_epi8(x, max, _mm256_cmpgt_epi64(x, max));
+	return _mm256_blendv_epi8(x, min, _mm256_cmpgt_epi64(min, x));
+}
+
+/* Run one biquad for all lanes as iir_df2t() */
+static inline void iir_avx2_biquad(int32_t *coef, int64_t *delay,
+				   int32_t x[], int frames)
+{
+	const __m256i one = _mm256_set1_epi64x(1);
+	const __m256i rnd = _mm256_set1_epi64x(1LL << 29);
+	__m256i a2 = iir_avx2_load(coef);
+	__m256i a1 = iir_avx2_load(coef + IIR_DF2T_LANES);
+	__m256i b2 = iir_avx2_load(coef + 2 * IIR_DF2T_LANES);
+	__m256i b1 = iir_avx2_load(coef + 3 * IIR_DF2T_LANES);
+	__m256i b0 = iir_avx2_load(coef + 4 * IIR_DF2T_LANES);
+	__m256i shift = iir_avx2_load(coef + 5 * IIR_DF2T_LANES);
+	__m256i gain = iir_avx2_load(coef + 6 * IIR_DF2T_LANES);
+	__m256i d0 = _mm256_loadu_si256((__m256i *)delay);
+	__m256i d1 = _mm256_loadu_si256((__m256i *)(delay + IIR_DF2T_LANES));
+	__m256i grnd;
+	__m256i acc;
+	__m256i tmp;
+	__m256i in;
+	int i;
+
+	/* Output shift Q3.45 to Q3.31 with rounding is a right shift of
+	 * 14 + shift with rounding constant of half of its step.
+	 */
+	shift = _mm256_add_epi64(shift, _mm256_set1_epi64x(14));
+	grnd = _mm256_srli_epi64(_mm256_sllv_epi64(one, shift), 1);
+
+	for (i = 0; i < frames; i++) {
+		in = iir_avx2_load(x);
+
+		/* Shift Q3.61 to Q3.31 with rounding, only the low 32 bits
+		 * are used as in the cast to int32_t.
+		 */
+		acc = _mm256_add_epi64(_mm256_mul_epi32(b0, in), d0);
+		tmp = _mm256_srli_epi64(_mm256_add_epi64(acc, rnd), 30);
+
+		d0 = _mm256_add_epi64(d1, _mm256_mul_epi32(b1, in));
+		d0 = _mm256_add_epi64(d0, _mm256_mul_epi32(a1, tmp));
+		d1 = _mm256_add_epi64(_mm256_mul_epi32(b2, in),
+				      _mm256_mul_epi32(a2, tmp));
+
+		acc = _mm256_add_epi64(_mm256_mul_epi32(gain, tmp), grnd);
+		iir_avx2_store(x, iir_avx2_sat(iir_avx2_srav(acc, shift)));
+		x += IIR_DF2T_LANES;
+	}
+
+	_mm256_storeu_si256((__m256i *)delay, d0);
+	_mm256_storeu_si256((__m256i *)(delay + IIR_DF2T_LANES), d1);
+}
+
+void iir_df2t_lanes(struct iir_lanes_df2t *iir, int32_t x[], int32_t y[],
+		    int frames)
+{
+	int32_t *coef = iir->coef;
+	int64_t *delay = iir->delay;
+	__m256i sum;
+	int n = frames * IIR_DF2T_LANES;
+	int s;
+	int b;
+	int i;
+
+	for (s = 0; s < iir->sections; s++) {
+		for (b = 0; b < iir->biquads_in_series; b++) {
+			iir_avx2_biquad(coef, delay, x, frames);
+			coef += SOF_EQ_IIR_NBIQUAD_DF2T * IIR_DF2T_LANES;
+			delay += IIR_DF2T_NUM_DELAYS * IIR_DF2T_LANES;
+		}
+
+		/* Sum the section outputs */
+		for (i = 0; i < n; i += IIR_DF2T_LANES) {
+			sum = iir_avx2_load(&x[i]);
+			if (s)
+				sum = iir_avx2_sat(_mm256_add_epi64(sum,
+						iir_avx2_load(&y[i])));
+
+			iir_avx2_store(&y[i], sum);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <sof/audio/format.h>
+#include <uapi/user/eq.h>
+#include "iir_config.h"
+
+#if IIR_SSE42
+
+#include <immintrin.h>
+#include "iir.h"
+
+/* Two lanes are processed per vector. The lanes are sign extended to 64
+ * bits so that the 32x32 -> 64 bit multiply can be used for the 32 bit data
+ * and coefficients.
+ */
+static inline __m128i iir_sse42_load(const int32_t *x)
+{
+	return _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i *)x));
+}
+
+static inline void iir_sse42_store(int32_t *x, __m128i v)
+{
+	_mm_storel_epi64((__m128i *)x, _mm_shuffle_epi32(v, 0x08));
+}
+
+/* Arithmetic right shift by a lane specific amount, done as a logical
+ * shift of the ones' complement for negative values.
+ */
+static inline __m128i iir_sse42_srav(__m128i x, __m128i shift0,
+				     __m128i shift1)
+{
+	__m128i sign = _mm_cmpgt_epi64(_mm_setzero_si128(), x);
+
+	x = _mm_xor_si128(x, sign);
+	x = _mm_blend_epi16(_mm_srl_epi64(x, shift0), _mm_srl_epi64(x, shift1),
+			    0xf0);
+	return _mm_xor_si128(x, sign);
+}
+
+static inline __m128i iir_sse42_sat(__m128i x)
+{
+	const __m128i max = _mm_set1_epi64x(INT32_MAX);
+	const __m128i min = _mm_set1_epi64x(INT32_MIN);
+
+	x = _mm_blendv_epi8(x, max, _mm_cmpgt_epi64(x, max));
+	return _mm_blendv_epi8(x, min, _mm_cmpgt_epi64(min, x));
+}
+
+/* Run one biquad for two lanes as iir_df2t() */
+static inline void iir_sse42_biquad(int32_t *coef, int64_t *delay,
+				    int32_t x[], int frames)
+{
+	const __m128i rnd = _mm_set1_epi64x(1LL << 29);
+	__m128i a2 = iir_sse42_load(coef);
+	__m128i a1 = iir_sse42_load(coef + IIR_DF2T_LANES);
+	__m128i b2 = iir_sse42_load(coef + 2 * IIR_DF2T_LANES);
+	__m128i b1 = iir_sse42_load(coef + 3 * IIR_DF2T_LANES);
+	__m128i b0 = iir_sse42_load(coef + 4 * IIR_DF2T_LANES);
+	__m128i gain = iir_sse42_load(coef + 6 * IIR_DF2T_LANES);
+	__m128i d0 = _mm_loadu_si128((__m128i *)delay);
+	__m128i d1 = _mm_loadu_si128((__m128i *)(delay + IIR_DF2T_LANES));
+	__m128i shift0;
+	__m128i shift1;
+	__m128i grnd;
+	__m128i acc;
+	__m128i tmp;
+	__m128i in;
+	int s0 = 14 + coef[5 * IIR_DF2T_LANES];
+	int s1 = 14 + coef[5 * IIR_DF2T_LANES + 1];
+	int i;
+
+	/* Output shift Q3.45 to Q3.31 with rounding is a right shift of
+	 * 14 + shift with rounding constant of half of its step.
+	 */
+	shift0 = _mm_cvtsi32_si128(s0);
+	shift1 = _mm_cvtsi32_si128(s1);
+	grnd = _mm_set_epi64x(1LL << (s1 - 1), 1LL << (s0 - 1));
+
+	for (i = 0; i < frames; i++) {
+		in = iir_sse42_load(x);
+
+		/* Shift Q3.61 to Q3.31 with rounding, only the low 32 bits
+		 * are used as in the cast to int32_t.
+		 */
+		acc = _mm_add_epi64(_mm_mul_epi32(b0, in), d0);
+		tmp = _mm_srli_epi64(_mm_add_epi64(acc, rnd), 30);
+
+		d0 = _mm_add_epi64(d1, _mm_mul_epi32(b1, in));
+		d0 = _mm_add_epi64(d0, _mm_mul_epi32(a1, tmp));
+		d1 = _mm_add_epi64(_mm_mul_epi32(b2, in),
+				   _mm_mul_epi32(a2, tmp));
+
+		acc = _mm_add_epi64(_mm_mul_epi32(gain, tmp), grnd);
+		acc = iir_sse42_srav(acc, shift0, shift1);
+		iir_sse42_store(x, iir_sse42_sat(acc));
+		x += IIR_DF2T_LANES;
+	}
+
+	_mm_storeu_si128((__m128i *)delay, d0);
+	_mm_storeu_si128((__m128i *)(delay + IIR_DF2T_LANES), d1);
+}
+
+void iir_df2t_lanes(struct iir_lanes_df2t *iir, int32_t x[], int32_t y[],
+		    int frames)
+{
+	int32_t *coef = iir->coef;
+	int64_t *delay = iir->delay;
+	__m128i sum;
+	__m128i out;
+	int n = frames * IIR_DF2T_LANES;
+	int s;
+	int b;
+	int l;
+	int i;
+
+	for (s = 0; s < iir->sections; s++) {
+		for (b = 0; b < iir->biquads_in_series; b++) {
+			/* Lane pairs without used channels are skipped */
+			for (l = 0; l < iir->channels; l += 2)
+				iir_sse42_biquad(coef + l, delay + l, x + l,
+						 frames);
+
+			coef += SOF_EQ_IIR_NBIQUAD_DF2T * IIR_DF2T_LANES;
+			delay += IIR_DF2T_NUM_DELAYS * IIR_DF2T_LANES;
+		}
+
+		/* Sum the section outputs */
+		for (i = 0; i < n; i += IIR_DF2T_LANES) {
+			for (l = 0; l < iir->channels; l += 2) {
+				sum = iir_sse42_load(&x[i + l]);
+				if (s) {
+					out = iir_sse42_load(&y[i + l]);
+					sum = _mm_add_epi64(sum, out);
+					sum = iir_sse42_sat(sum);
+				}
+
+				iir_sse42_store(&y[i + l], sum);
+			}
+		}
+	}
+}
+
+#endif
@@ -48,73 +48,43 @@
 #define trace_mixer_error(__e, ...) \
 	trace_error(TRACE_CLASS_MIXER, __e, ##__VA_ARGS__)
 
-/* mixer component private data */
-struct mixer_data {
-	void (*mix_func)(struct comp_dev *dev, struct comp_buffer *sink,
-		struct comp_buffer **sources, uint32_t count, uint32_t frames);
-};
-
-/* Mix n 16 bit PCM source streams to one sink stream */
-static void mix_n_s16(struct comp_dev *dev, struct comp_buffer *sink,
-		      struct comp_buffer **sources, uint32_t num_sources,
-		      uint32_t frames)
+/* Mix n PCM source streams to one sink stream. Sources are accumulated one
+ * by one over blocks of samples into a wide accumulator that is saturated
+ * to the sink sample size once per block.
+ */
+static void mix_n(struct comp_dev *dev, struct comp_buffer *sink,
+		  struct comp_buffer **sources, int32_t *gains,
+		  uint32_t num_sources, uint32_t frames)
 {
-	int16_t *src;
-	int16_t *dest;
-	int32_t val;
-	int i;
-	int j;
-	int channel;
-	uint32_t frag = 0;
-
-	for (i = 0; i < frames; i++) {
-		for (channel = 0; channel < dev->params.channels; channel++) {
-			val = 0;
-
-			for (j = 0; j < num_sources; j++) {
-				src = buffer_read_frag_s16(sources[j], frag);
-				val += *src;
-			}
-
-			dest = buffer_write_frag_s16(sink, frag);
-
-			/* Saturate to 16 bits */
-			*dest = sat_int16(val);
-
-			frag++;
+	struct mixer_data *md = comp_get_drvdata(dev);
+	void *src[PLATFORM_MAX_STREAMS];
+	void *dest = sink->w_ptr;
+	uint32_t sample_bytes = comp_sample_bytes(dev);
+	uint32_t samples = frames * dev->params.channels;
+	uint32_t n;
+	uint32_t j;
+
+	for (j = 0; j < num_sources; j++)
+		src[j] = sources[j]->r_ptr;
+
+	while (samples) {
+		/* process a block up to the nearest source or sink wrap */
+		n = MIN(samples, MIXER_BLOCK_SAMPLES);
+		n = MIN(n, buffer_steps_without_wrap(sink, dest, sample_bytes));
+		for (j = 0; j < num_sources; j++)
+			n = MIN(n, buffer_steps_without_wrap(sources[j], src[j],
+							     sample_bytes));
+
+		for (j = 0; j < num_sources; j++) {
+			md->acc_func(&md->acc, src[j], gains[j], n, j == 0);
+			src[j] = buffer_wrap(sources[j],
+					     src[j] + n * sample_bytes);
 		}
-	}
-}
-
-/* Mix n 32 bit PCM source streams to one sink stream */
-static void mix_n_s32(struct comp_dev *dev, struct comp_buffer *sink,
-		      struct comp_buffer **sources, uint32_t num_sources,
-		      uint32_t frames)
-{
-	int32_t *src;
-	int32_t *dest;
-	int64_t val;
-	int i;
-	int j;
-	int channel;
-	uint32_t frag = 0;
-
-	for (i = 0; i < frames; i++) {
-		for (channel = 0; channel < dev->params.channels; channel++) {
-			val = 0;
 
-			for (j = 0; j < num_sources; j++) {
-				src = buffer_read_frag_s32(sources[j], frag);
-				val += *src;
-			}
-
-			dest = buffer_write_frag_s32(sink, frag);
-
-			/* Saturate to 32 bits */
-			*dest = sat_int32(val);
+		md->sat_func(dest, &md->acc, n);
 
-			frag++;
-		}
+		samples -= n;
+		dest = buffer_wrap(sink, dest + n * sample_bytes);
 	}
 }
 
@@ -125,6 +95,7 @@ static struct comp_dev *mixer_new(struct sof_ipc_comp *comp)
 	struct sof_ipc_comp_mixer *ipc_mixer =
 		(struct sof_ipc_comp_mixer *)comp;
 	struct mixer_data *md;
+	int i;
 
 	trace_mixer("mixer_new()");
 
@@ -149,6 +120,9 @@ static struct comp_dev *mixer_new(struct sof_ipc_comp *comp)
 		return NULL;
 	}
 
+	for (i = 0; i < PLATFORM_MAX_STREAMS; i++)
+		md->gain[i] = MIXER_GAIN_UNITY;
+
 	comp_set_drvdata(dev, md);
 	dev->state = COMP_STATE_READY;
 	return dev;
@@ -226,6 +200,96 @@ static inline int mixer_sink_status(struct comp_dev *mixer)
 	return sink->sink->state;
 }
 
+static int mixer_ctrl_set_cmd(struct comp_dev *dev,
+			      struct sof_ipc_ctrl_data *cdata)
+{
+	struct mixer_data *md = comp_get_drvdata(dev);
+	uint32_t source;
+	int32_t gain;
+	int j;
+
+	if (cdata->cmd != SOF_CTRL_CMD_VOLUME) {
+		trace_mixer_error("mixer_ctrl_set_cmd() error: "
+				  "invalid cdata->cmd = %u", cdata->cmd);
+		return -EINVAL;
+	}
+
+	if (cdata->num_elems == 0 || cdata->num_elems > PLATFORM_MAX_STREAMS) {
+		trace_mixer_error("mixer_ctrl_set_cmd() error: "
+				  "invalid cdata->num_elems");
+		return -EINVAL;
+	}
+
+	/* each element sets the gain of one source, channel is the source
+	 * index in the order the sources were connected
+	 */
+	for (j = 0; j < cdata->num_elems; j++) {
+		source = cdata->chanv[j].channel;
+		gain = cdata->chanv[j].value;
+
+		trace_mixer("mixer_ctrl_set_cmd(), source = %u, gain = %d",
+			    source, gain);
+
+		if (source >= PLATFORM_MAX_STREAMS || gain < 0 ||
+		    gain > MIXER_GAIN_MAX) {
+			trace_mixer_error("mixer_ctrl_set_cmd() error: "
+					  "invalid source = %u, gain = %d",
+					  source, gain);
+			return -EINVAL;
+		}
+
+		md->gain[source] = gain;
+	}
+
+	return 0;
+}
+
+static int mixer_ctrl_get_cmd(struct comp_dev *dev,
+			      struct sof_ipc_ctrl_data *cdata, int size)
+{
+	struct mixer_data *md = comp_get_drvdata(dev);
+	int j;
+
+	if (cdata->cmd != SOF_CTRL_CMD_VOLUME) {
+		trace_mixer_error("mixer_ctrl_get_cmd() error: "
+				  "invalid cdata->cmd = %u", cdata->cmd);
+		return -EINVAL;
+	}
+
+	if (cdata->num_elems == 0 || cdata->num_elems > PLATFORM_MAX_STREAMS ||
+	    sizeof(*cdata) + cdata->num_elems * sizeof(cdata->chanv[0]) >
+	    size) {
+		trace_mixer_error("mixer_ctrl_get_cmd() error: "
+				  "invalid cdata->num_elems");
+		return -EINVAL;
+	}
+
+	for (j = 0; j < cdata->num_elems; j++) {
+		cdata->chanv[j].channel = j;
+		cdata->chanv[j].value = md->gain[j];
+	}
+
+	return 0;
+}
+
+/* used to pass standard and bespoke commands (with data) to component */
+static int mixer_cmd(struct comp_dev *dev, int cmd, void *data,
+		     int max_data_size)
+{
+	struct sof_ipc_ctrl_data *cdata = data;
+
+	trace_mixer("mixer_cmd()");
+
+	switch (cmd) {
+	case COMP_CMD_SET_VALUE:
+		return mixer_ctrl_set_cmd(dev, cdata);
+	case COMP_CMD_GET_VALUE:
+		return mixer_ctrl_get_cmd(dev, cdata, max_data_size);
+	default:
+		return -EINVAL;
+	}
+}
+
 /* used to pass standard and bespoke commands (with data) to component */
 static int mixer_trigger(struct comp_dev *dev, int cmd)
 {
@@ -268,9 +332,11 @@ static int mixer_copy(struct comp_dev *dev)
 	struct mixer_data *md = comp_get_drvdata(dev);
 	struct comp_buffer *sink;
 	struct comp_buffer *sources[PLATFORM_MAX_STREAMS];
+	int32_t gains[PLATFORM_MAX_STREAMS];
 	struct comp_buffer *source;
 	struct list_item *blist;
 	int32_t i = 0;
+	int32_t source_idx = 0;
 	int32_t num_mix_sources = 0;
 	uint32_t frames = INT32_MAX;
 	uint32_t source_bytes;
@@ -288,8 +354,14 @@ static int mixer_copy(struct comp_dev *dev)
 		source = container_of(blist, struct comp_buffer, sink_list);
 
 		/* only mix the sources with the same state with mixer */
-		if (source->source->state == dev->state)
+		if (source->source->state == dev->state) {
+			gains[num_mix_sources] =
+				source_idx < PLATFORM_MAX_STREAMS ?
+				md->gain[source_idx] : MIXER_GAIN_UNITY;
 			sources[num_mix_sources++] = source;
+		}
+
+		source_idx++;
 
 		/* too many sources ? */
 		if (num_mix_sources == PLATFORM_MAX_STREAMS - 1)
@@ -331,7 +403,7 @@ static int mixer_copy(struct comp_dev *dev)
 		     source_bytes, sink_bytes);
 
 	/* mix streams */
-	md->mix_func(dev, sink, sources, i, frames);
+	mix_n(dev, sink, sources, gains, i, frames);
 
 	/* update source buffer pointers */
 	for (i = --num_mix_sources; i >= 0; i--)
@@ -376,14 +448,28 @@ static int mixer_prepare(struct comp_dev *dev)
 	struct comp_buffer *source;
 	int downstream = 0;
 	int ret;
+	int i;
 
 	trace_mixer("mixer_prepare()");
 
 	/* does mixer already have active source streams ? */
 	if (dev->state != COMP_STATE_ACTIVE) {
 		/* currently inactive so setup mixer */
-		md->mix_func = dev->params.frame_fmt == SOF_IPC_FRAME_S16_LE ?
-			mix_n_s16 : mix_n_s32;
+		for (i = 0; i < mixer_func_count; i++) {
+			if (dev->params.frame_fmt ==
+			    mixer_func_map[i].frame_fmt) {
+				md->acc_func = mixer_func_map[i].acc_func;
+				md->sat_func = mixer_func_map[i].sat_func;
+				break;
+			}
+		}
+
+		if (i == mixer_func_count) {
+			trace_mixer_error("mixer_prepare() error: unsupported "
+					  "frame format %u",
+					  dev->params.frame_fmt);
+			return -EINVAL;
+		}
 
 		ret = comp_set_state(dev, COMP_TRIGGER_PREPARE);
 		if (ret < 0)
@@ -441,6 +527,7 @@ struct comp_driver comp_mixer = {
 		.params		= mixer_params,
 		.prepare	= mixer_prepare,
 		.trigger	= mixer_trigger,
+		.cmd		= mixer_cmd,
 		.copy		= mixer_copy,
 		.reset		= mixer_reset,
 		.cache		= mixer_cache,
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <sof/audio/mixer.h>
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+#define MIX_SIMD_LANES	8
+#define mix_simd_t	__m256i
+
+static inline __m256i mix_simd_set1(int32_t gain)
+{
+	return _mm256_set1_epi32(gain);
+}
+
+static inline __m256i mix_simd_load(const void *src)
+{
+	return _mm256_loadu_si256((const __m256i *)src);
+}
+
+static inline void mix_simd_store(void *dest, __m256i x)
+{
+	_mm256_storeu_si256((__m256i *)dest, x);
+}
+
+static inline __m256i mix_simd_load_s16(const int16_t *src)
+{
+	return _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)src));
+}
+
+static inline __m256i mix_simd_add32(__m256i a, __m256i b)
+{
+	return _mm256_add_epi32(a, b);
+}
+
+static inline __m256i mix_simd_add64(__m256i a, __m256i b)
+{
+	return _mm256_add_epi64(a, b);
+}
+
+/* multiply the low 32 bits of each 64 bit lane by gain, round and
+ * arithmetically shift the products by the gain fraction bits
+ */
+static inline __m256i mix_simd_gain_s64(__m256i x, __m256i gain)
+{
+	const __m256i rnd = _mm256_set1_epi64x(1LL << (MIXER_GAIN_QXY_Y - 1));
+	const __m256i sign = _mm256_set1_epi64x(1LL <<
+						(63 - MIXER_GAIN_QXY_Y));
+	__m256i p = _mm256_add_epi64(_mm256_mul_epi32(x, gain), rnd);
+
+	/* there is no 64 bit arithmetic shift, so shift logically and
+	 * sign extend from bit 47, the shifted value always fits in 48 bits
+	 */
+	p = _mm256_srli_epi64(p, MIXER_GAIN_QXY_Y);
+	return _mm256_sub_epi64(_mm256_xor_si256(p, sign), sign);
+}
+
+static inline __m256i mix_simd_gain_s32(__m256i x, __m256i gain)
+{
+	const __m256i rnd = _mm256_set1_epi64x(1LL << (MIXER_GAIN_QXY_Y - 1));
+	__m256i even = _mm256_add_epi64(_mm256_mul_epi32(x, gain), rnd);
+	__m256i odd = _mm256_add_epi64(_mm256_mul_epi32(
+					_mm256_srli_epi64(x, 32), gain), rnd);
+
+	/* bits 16..47 of the products are the rounded results */
+	even = _mm256_srli_epi64(even, MIXER_GAIN_QXY_Y);
+	odd = _mm256_slli_epi64(_mm256_srli_epi64(odd, MIXER_GAIN_QXY_Y), 32);
+
+	return _mm256_blend_epi32(even, odd, 0xaa);
+}
+
+static inline __m256i mix_simd_widen_lo(__m256i x)
+{
+	return _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x));
+}
+
+static inline __m256i mix_simd_widen_hi(__m256i x)
+{
+	return _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1));
+}
+
+static inline __m256i mix_simd_sat_s32(__m256i x)
+{
+	const __m256i max = _mm256_set1_epi64x(INT32_MAX);
+	const __m256i min = _mm256_set1_epi64x(INT32_MIN);
+
+	x = _mm256_blendv_epi8(x, max, _mm256_cmpgt_epi64(x, max));
+	return _mm256_blendv_epi8(x, min, _mm256_cmpgt_epi64(min, x));
+}
+
+/* pack works within 128 bit lanes, restore the sample order */
+static inline __m256i mix_simd_pack_s16(__m256i a, __m256i b)
+{
+	return _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b),
+					_MM_SHUFFLE(3, 1, 2, 0));
+}
+
+/* gather the low 32 bits of each lane into the low half of each
+ * register, then join the halves
+ */
+static inline __m256i mix_simd_narrow_s32(__m256i lo, __m256i hi)
+{
+	const __m256i idx = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+
+	lo = _mm256_permutevar8x32_epi32(lo, idx);
+	hi = _mm256_permutevar8x32_epi32(hi, idx);
+	return _mm256_permute2x128_si256(lo, hi, 0x20);
+}
+
+#include "mixer_simd.h"
+
+#endif
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <sof/audio/mixer.h>
+
+#ifdef MIXER_GENERIC
+
+static void mix_acc_s16(void *acc, const void *src, int32_t gain,
+			uint32_t samples, int first)
+{
+	const int16_t *x = src;
+	int32_t *y = acc;
+	uint32_t i;
+
+	if (gain == MIXER_GAIN_UNITY) {
+		if (first) {
+			for (i = 0; i < samples; i++)
+				y[i] = x[i];
+		} else {
+			for (i = 0; i < samples; i++)
+				y[i] += x[i];
+		}
+	} else {
+		if (first) {
+			for (i = 0; i < samples; i++)
+				y[i] = mixer_gain_sample(x[i], gain);
+		} else {
+			for (i = 0; i < samples; i++)
+				y[i] += mixer_gain_sample(x[i], gain);
+		}
+	}
+}
+
+static void mix_sat_s16(void *dest, const void *acc, uint32_t samples)
+{
+	const int32_t *x = acc;
+	int16_t *y = dest;
+	uint32_t i;
+
+	for (i = 0; i < samples; i++)
+		y[i] = sat_int16(x[i]);
+}
+
+static void mix_acc_s32(void *acc, const void *src, int32_t gain,
+			uint32_t samples, int first)
+{
+	const int32_t *x = src;
+	int64_t *y = acc;
+	uint32_t i;
+
+	if (gain == MIXER_GAIN_UNITY) {
+		if (first) {
+			for (i = 0; i < samples; i++)
+				y[i] = x[i];
+		} else {
+			for (i = 0; i < samples; i++)
+				y[i] += x[i];
+		}
+	} else {
+		if (first) {
+			for (i = 0; i < samples; i++)
+				y[i] = mixer_gain_sample(x[i], gain);
+		} else {
+			for (i = 0; i < samples; i++)
+				y[i] += mixer_gain_sample(x[i], gain);
+		}
+	}
+}
+
+static void mix_sat_s32(void *dest, const void *acc, uint32_t samples)
+{
+	const int64_t *x = acc;
+	int32_t *y = dest;
+	uint32_t i;
+
+	for (i = 0; i < samples; i++)
+		y[i] = sat_int32(x[i]);
+}
+
+const struct mixer_func_map mixer_func_map[] = {
+	{SOF_IPC_FRAME_S16_LE, mix_acc_s16, mix_sat_s16},
+	{SOF_IPC_FRAME_S24_4LE, mix_acc_s32, mix_sat_s32},
+	{SOF_IPC_FRAME_S32_LE, mix_acc_s32, mix_sat_s32},
+};
+
+const size_t mixer_func_count = ARRAY_SIZE(mixer_func_map);
+
+#endif
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Mixing shared by the x86 SIMD implementations. Each of them defines
+ * MIX_SIMD_LANES 32 bit lanes in its mix_simd_t register type and these
+ * helpers before including this file once:
+ *
+ * mix_simd_set1()	gain in every 32 bit lane
+ * mix_simd_load()	load a register, mix_simd_store() stores it
+ * mix_simd_load_s16()	load MIX_SIMD_LANES s16 samples as 32 bits
+ * mix_simd_add32()	add 32 bit lanes, mix_simd_add64() 64 bit lanes
+ * mix_simd_gain_s32()	scale 32 bit lanes, the results must fit in 32 bits
+ * mix_simd_gain_s64()	scale the low 32 bits of 64 bit lanes
+ * mix_simd_widen_lo()	sign extend the low half of the 32 bit lanes to 64
+ *			bits, mix_simd_widen_hi() the high half
+ * mix_simd_sat_s32()	saturate 64 bit lanes to 32 bits
+ * mix_simd_pack_s16()	saturate two registers of 32 bit lanes to s16
+ *			samples in order
+ * mix_simd_narrow_s32()	low 32 bits of the 64 bit lanes of two registers
+ *			in order
+ */
+
+#ifndef MIXER_SIMD_H
+#define MIXER_SIMD_H
+
+#include <stdint.h>
+#include <sof/audio/mixer.h>
+
+/* 64 bit lanes in a register */
+#define MIX_SIMD_LANES64	(MIX_SIMD_LANES / 2)
+
+static inline void mix_simd_acc_s16(int32_t *acc, const int16_t *src,
+				    int32_t gain, uint32_t samples,
+				    const int first)
+{
+	const mix_simd_t g = mix_simd_set1(gain);
+	mix_simd_t x;
+	uint32_t i;
+
+	for (i = 0; i + MIX_SIMD_LANES <= samples; i += MIX_SIMD_LANES) {
+		x = mix_simd_load_s16(src + i);
+		if (gain != MIXER_GAIN_UNITY)
+			x = mix_simd_gain_s32(x, g);
+		if (!first)
+			x = mix_simd_add32(x, mix_simd_load(acc + i));
+		mix_simd_store(acc + i, x);
+	}
+
+	for (; i < samples; i++) {
+		if (first)
+			acc[i] = mixer_gain_sample(src[i], gain);
+		else
+			acc[i] += mixer_gain_sample(src[i], gain);
+	}
+}
+
+static void mix_acc_s16(void *acc, const void *src, int32_t gain,
+			uint32_t samples, int first)
+{
+	if (first)
+		mix_simd_acc_s16(acc, src, gain, samples, 1);
+	else
+		mix_simd_acc_s16(acc, src, gain, samples, 0);
+}
+
+static void mix_sat_s16(void *dest, const void *acc, uint32_t samples)
+{
+	const int32_t *x = acc;
+	int16_t *y = dest;
+	mix_simd_t lo;
+	mix_simd_t hi;
+	uint32_t i;
+
+	for (i = 0; i + 2 * MIX_SIMD_LANES <= samples;
+	     i += 2 * MIX_SIMD_LANES) {
+		lo = mix_simd_load(x + i);
+		hi = mix_simd_load(x + i + MIX_SIMD_LANES);
+		mix_simd_store(y + i, mix_simd_pack_s16(lo, hi));
+	}
+
+	for (; i < samples; i++)
+		y[i] = sat_int16(x[i]);
+}
+
+static inline void mix_simd_acc_s32(int64_t *acc, const int32_t *src,
+				    int32_t gain, uint32_t samples,
+				    const int first)
+{
+	const mix_simd_t g = mix_simd_set1(gain);
+	mix_simd_t x;
+	mix_simd_t lo;
+	mix_simd_t hi;
+	uint32_t i;
+
+	for (i = 0; i + MIX_SIMD_LANES <= samples; i += MIX_SIMD_LANES) {
+		x = mix_simd_load(src + i);
+		lo = mix_simd_widen_lo(x);
+		hi = mix_simd_widen_hi(x);
+		if (gain != MIXER_GAIN_UNITY) {
+			lo = mix_simd_gain_s64(lo, g);
+			hi = mix_simd_gain_s64(hi, g);
+		}
+		if (!first) {
+			lo = mix_simd_add64(lo, mix_simd_load(acc + i));
+			x = mix_simd_load(acc + i + MIX_SIMD_LANES64);
+			hi = mix_simd_add64(hi, x);
+		}
+		mix_simd_store(acc + i, lo);
+		mix_simd_store(acc + i + MIX_SIMD_LANES64, hi);
+	}
+
+	for (; i < samples; i++) {
+		if (first)
+			acc[i] = mixer_gain_sample(src[i], gain);
+		else
+			acc[i] += mixer_gain_sample(src[i], gain);
+	}
+}
+
+static void mix_acc_s32(void *acc, const void *src, int32_t gain,
+			uint32_t samples, int first)
+{
+	if (first)
+		mix_simd_acc_s32(acc, src, gain, samples, 1);
+	else
+		mix_simd_acc_s32(acc, src, gain, samples, 0);
+}
+
+static void mix_sat_s32(void *dest, const void *acc, uint32_t samples)
+{
+	const int64_t *x = acc;
+	int32_t *y = dest;
+	mix_simd_t lo;
+	mix_simd_t hi;
+	uint32_t i;
+
+	for (i = 0; i + MIX_SIMD_LANES <= samples; i += MIX_SIMD_LANES) {
+		lo = mix_simd_sat_s32(mix_simd_load(x + i));
+		hi = mix_simd_sat_s32(mix_simd_load(x + i + MIX_SIMD_LANES64));
+		mix_simd_store(y + i, mix_simd_narrow_s32(lo, hi));
+	}
+
+	for (; i < samples; i++)
+		y[i] = sat_int32(x[i]);
+}
+
+const struct mixer_func_map mixer_func_map[] = {
+	{SOF_IPC_FRAME_S16_LE, mix_acc_s16, mix_sat_s16},
+	{SOF_IPC_FRAME_S24_4LE, mix_acc_s32, mix_sat_s32},
+	{SOF_IPC_FRAME_S32_LE, mix_acc_s32, mix_sat_s32},
+};
+
+const size_t mixer_func_count = ARRAY_SIZE(mixer_func_map);
+
+#endif /* MIXER_SIMD_H */
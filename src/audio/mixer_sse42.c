@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <sof/audio/mixer.h>
+
+#if defined(__SSE4_2__) && !defined(__AVX2__)
+
+#include <immintrin.h>
+
+#define MIX_SIMD_LANES	4
+#define mix_simd_t	__m128i
+
+static inline __m128i mix_simd_set1(int32_t gain)
+{
+	return _mm_set1_epi32(gain);
+}
+
+static inline __m128i mix_simd_load(const void *src)
+{
+	return _mm_loadu_si128((const __m128i *)src);
+}
+
+static inline void mix_simd_store(void *dest, __m128i x)
+{
+	_mm_storeu_si128((__m128i *)dest, x);
+}
+
+static inline __m128i mix_simd_load_s16(const int16_t *src)
+{
+	return _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)src));
+}
+
+static inline __m128i mix_simd_add32(__m128i a, __m128i b)
+{
+	return _mm_add_epi32(a, b);
+}
+
+static inline __m128i mix_simd_add64(__m128i a, __m128i b)
+{
+	return _mm_add_epi64(a, b);
+}
+
+/* multiply the low 32 bits of each 64 bit lane by gain, round and
+ * arithmetically shift the products by the gain fraction bits
+ */
+static inline __m128i mix_simd_gain_s64(__m128i x, __m128i gain)
+{
+	const __m128i rnd = _mm_set1_epi64x(1LL << (MIXER_GAIN_QXY_Y - 1));
+	const __m128i sign = _mm_set1_epi64x(1LL << (63 - MIXER_GAIN_QXY_Y));
+	__m128i p = _mm_add_epi64(_mm_mul_epi32(x, gain), rnd);
+
+	/* there is no 64 bit arithmetic shift, so shift logically and
+	 * sign extend from bit 47, the shifted value always fits in 48 bits
+	 */
+	p = _mm_srli_epi64(p, MIXER_GAIN_QXY_Y);
+	return _mm_sub_epi64(_mm_xor_si128(p, sign), sign);
+}
+
+static inline __m128i mix_simd_gain_s32(__m128i x, __m128i gain)
+{
+	const __m128i rnd = _mm_set1_epi64x(1LL << (MIXER_GAIN_QXY_Y - 1));
+	__m128i even = _mm_add_epi64(_mm_mul_epi32(x, gain), rnd);
+	__m128i odd = _mm_add_epi64(_mm_mul_epi32(_mm_srli_epi64(x, 32),
+						  gain), rnd);
+
+	/* bits 16..47 of the products are the rounded results */
+	even = _mm_srli_epi64(even, MIXER_GAIN_QXY_Y);
+	odd = _mm_slli_epi64(_mm_srli_epi64(odd, MIXER_GAIN_QXY_Y), 32);
+
+	return _mm_blend_epi16(even, odd, 0xcc);
+}
+
+static inline __m128i mix_simd_widen_lo(__m128i x)
+{
+	return _mm_cvtepi32_epi64(x);
+}
+
+static inline __m128i mix_simd_widen_hi(__m128i x)
+{
+	return _mm_cvtepi32_epi64(_mm_srli_si128(x, 8));
+}
+
+static inline __m128i mix_simd_sat_s32(__m128i x)
+{
+	const __m128i max = _mm_set1_epi64x(INT32_MAX);
+	const __m128i min = _mm_set1_epi64x(INT32_MIN);
+
+	x = _mm_blendv_epi8(x, max, _mm_cmpgt_epi64(x, max));
+	return _mm_blendv_epi8(x, min, _mm_cmpgt_epi64(min, x));
+}
+
+static inline __m128i mix_simd_pack_s16(__m128i a, __m128i b)
+{
+	return _mm_packs_epi32(a, b);
+}
+
+static inline __m128i mix_simd_narrow_s32(__m128i lo, __m128i hi)
+{
+	return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(lo),
+					       _mm_castsi128_ps(hi),
+					       _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+#include "mixer_simd.h"
+
+#endif
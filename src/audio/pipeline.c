@@ -56,10 +56,13 @@ struct pipeline_data {
 	struct sof_ipc_pcm_params *params;
 	struct sof_ipc_stream_posn *posn;
 	struct pipeline *p;
+	struct pipeline_copy_list *list;
 	int cmd;
 };
 
 static uint64_t pipeline_task(void *arg);
+static void pipeline_graph_changed(struct pipeline *p);
+static void pipeline_graph_update(struct pipeline *p);
 
 /* create new pipeline - returns pipeline id or negative error */
 struct pipeline *pipeline_new(struct sof_ipc_pipe_new *pipe_desc,
@@ -80,6 +83,7 @@ struct pipeline *pipeline_new(struct sof_ipc_pipe_new *pipe_desc,
 	/* init pipeline */
 	p->sched_comp = cd;
 	p->status = COMP_STATE_INIT;
+	atomic_init(&p->graph_gen, 1);
 
 	spinlock_init(&p->lock);
 	assert(!memcpy_s(&p->ipc_pipe, sizeof(p->ipc_pipe),
@@ -106,6 +110,11 @@ int pipeline_connect(struct comp_dev *comp, struct comp_buffer *buffer,
 	buffer_set_comp(buffer, comp, dir);
 	spin_unlock(&comp->lock);
 
+	/* comps get their pipeline on complete, so only connections to
+	 * completed pipelines change a copy walk
+	 */
+	pipeline_graph_update(comp->pipeline);
+
 	return 0;
 }
 
@@ -199,6 +208,7 @@ int pipeline_complete(struct pipeline *p, struct comp_dev *source,
 	p->source_comp = source;
 	p->sink_comp = sink;
 	p->status = COMP_STATE_READY;
+	pipeline_graph_update(p);
 
 	/* show heap status */
 	heap_trace_all(0);
@@ -216,6 +226,9 @@ static int pipeline_comp_free(struct comp_dev *current, void *data, int dir)
 	if (!comp_is_single_pipeline(current, ppl_data->start)) {
 		tracev_pipe("pipeline_comp_free(), "
 			    "current is from another pipeline");
+
+		/* the neighbour loses its connection to the freed comps */
+		pipeline_graph_changed(current->pipeline);
 		return 0;
 	}
 
@@ -241,7 +254,7 @@ int pipeline_free(struct pipeline *p)
 	trace_pipe_with_ids(p, "pipeline_free()");
 
 	/* make sure we are not in use */
-	if (p->source_comp->state > COMP_STATE_READY) {
+	if (p->source_comp && p->source_comp->state > COMP_STATE_READY) {
 		trace_pipe_error_with_ids(p, "pipeline_free() error: Pipeline"
 					  " in use, %u, %u",
 					  p->source_comp->comp.id,
@@ -252,12 +265,16 @@ int pipeline_free(struct pipeline *p)
 	/* remove from any scheduling */
 	schedule_task_free(&p->pipe_task);
 
-	data.start = p->source_comp;
+	/* disconnect components, unless the pipeline was never completed */
+	if (p->source_comp) {
+		pipeline_graph_changed(p);
 
-	/* disconnect components */
-	pipeline_comp_free(p->source_comp, &data, PPL_DIR_DOWNSTREAM);
+		data.start = p->source_comp;
+		pipeline_comp_free(p->source_comp, &data, PPL_DIR_DOWNSTREAM);
+	}
 
 	/* now free the pipeline */
+	rfree(p->copy_list.entry);
 	rfree(p);
 
 	/* show heap status */
@@ -325,6 +342,9 @@ int pipeline_params(struct pipeline *p, struct comp_dev *host,
 
 	spin_unlock_irq(&p->lock, flags);
 
+	/* the copy walk direction is known now */
+	pipeline_copy_list_update(p);
+
 	return ret;
 }
 
@@ -436,6 +456,9 @@ static void pipeline_comp_trigger_sched_comp(struct pipeline *p,
 	case COMP_TRIGGER_RELEASE:
 	case COMP_TRIGGER_START:
 		p->xrun_bytes = 0;
+#if CONFIG_COMP_PERF
+		p->perf_budget = perf_cnt_us_to_ticks(p->ipc_pipe.period);
+#endif
 
 		/* playback pipelines need to be scheduled now,
 		 * capture pipelines are scheduled only for
@@ -645,6 +668,20 @@ int pipeline_reset(struct pipeline *p, struct comp_dev *host)
 	return ret;
 }
 
+/* copy a component and account its execution time */
+static inline int pipeline_comp_copy_timed(struct comp_dev *current)
+{
+#if CONFIG_COMP_PERF
+	uint64_t start = perf_cnt_get_ticks();
+	int err = comp_copy(current);
+
+	perf_cnt_add(&current->perf_copy, perf_cnt_get_ticks() - start);
+	return err;
+#else
+	return comp_copy(current);
+#endif
+}
+
 static int pipeline_comp_copy(struct comp_dev *current, void *data, int dir)
 {
 	struct pipeline_data *ppl_data = data;
@@ -669,7 +706,7 @@ static int pipeline_comp_copy(struct comp_dev *current, void *data, int dir)
 
 	/* copy to downstream immediately */
 	if (dir == PPL_DIR_DOWNSTREAM) {
-		err = comp_copy(current);
+		err = pipeline_comp_copy_timed(current);
 		if (err < 0 || err == PPL_STATUS_PATH_STOP)
 			return err;
 	}
@@ -680,17 +717,250 @@ static int pipeline_comp_copy(struct comp_dev *current, void *data, int dir)
 		return err;
 
 	if (dir == PPL_DIR_UPSTREAM)
-		err = comp_copy(current);
+		err = pipeline_comp_copy_timed(current);
 
 	return err;
 }
 
+/* get the component the copy walk starts from, for playback without
+ * preload the sink component is copied separately before the walk
+ */
+static struct comp_dev *pipeline_copy_start(struct pipeline *p, bool preload,
+					    uint32_t *dir)
+{
+	if (p->source_comp->params.direction == SOF_IPC_STREAM_PLAYBACK) {
+		*dir = PPL_DIR_UPSTREAM;
+		if (preload)
+			return p->sink_comp;
+
+		return comp_get_previous(p->sink_comp, *dir);
+	}
+
+	*dir = PPL_DIR_DOWNSTREAM;
+	return p->source_comp;
+}
+
+/* Invalidates the copy lists walking the graph of p, which are its own and
+ * the one of the pipeline owning its scheduling comp.
+ */
+static void pipeline_graph_changed(struct pipeline *p)
+{
+	struct pipeline *sched_p;
+
+	if (!p)
+		return;
+
+	atomic_add(&p->graph_gen, 1);
+
+	sched_p = p->sched_comp->pipeline;
+	if (sched_p && sched_p != p)
+		atomic_add(&sched_p->graph_gen, 1);
+}
+
+/* invalidates and rebuilds the copy lists walking the graph of p */
+static void pipeline_graph_update(struct pipeline *p)
+{
+	struct pipeline *sched_p;
+
+	if (!p)
+		return;
+
+	pipeline_graph_changed(p);
+	pipeline_copy_list_update(p);
+
+	sched_p = p->sched_comp->pipeline;
+	if (sched_p && sched_p != p)
+		pipeline_copy_list_update(sched_p);
+}
+
+/* Adds the components visited by pipeline_comp_copy() to the copy list.
+ * Entries are only stored while they fit, the count is always updated.
+ */
+static int pipeline_comp_copy_list(struct comp_dev *current, void *data,
+				   int dir)
+{
+	struct pipeline_data *ppl_data = data;
+	struct pipeline_copy_list *list = ppl_data->list;
+	uint32_t first = list->count;
+	uint32_t idx = first;
+	int err;
+
+	/* comps of a freed pipeline wait for their own free */
+	if (!comp_is_single_pipeline(current, ppl_data->start) &&
+	    (!current->pipeline ||
+	     !pipeline_is_same_sched_comp(current->pipeline, ppl_data->p)))
+		return 0;
+
+	/* downstream comps are copied before and upstream after the walk */
+	if (dir == PPL_DIR_DOWNSTREAM)
+		list->count++;
+
+	err = pipeline_for_each_comp(current, &pipeline_comp_copy_list,
+				     data, NULL, dir);
+	if (err < 0)
+		return err;
+
+	if (dir == PPL_DIR_UPSTREAM)
+		idx = list->count++;
+
+	if (idx < list->size) {
+		list->entry[idx].comp = current;
+		list->entry[idx].span = list->count - first;
+	}
+
+	return 0;
+}
+
+/* Flatten the steady state copy walk of the pipeline. The checks that
+ * depend only on the graph are done here, component state is still checked
+ * every period. The list is built aside and swapped in with interrupts off,
+ * so a running pipeline task sees either the old or the new list.
+ */
+static void pipeline_copy_list_build(struct pipeline *p)
+{
+	struct pipeline_copy_list list = { .entry = NULL };
+	struct pipeline_data data;
+	struct pipeline_copy_entry *old;
+	uint32_t flags;
+
+	/* read before the walk, a change during it leaves the list stale */
+	list.graph_gen = atomic_read(&p->graph_gen);
+
+	data.start = pipeline_copy_start(p, false, &list.dir);
+	data.p = p;
+	data.list = &list;
+
+	/* count the comps, then allocate and store them */
+	if (data.start) {
+		pipeline_comp_copy_list(data.start, &data, list.dir);
+		list.entry = rzalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM,
+				     list.count * sizeof(*list.entry));
+		if (!list.entry)
+			trace_pipe_error_with_ids(p, "pipeline_copy_list_build"
+						  "() error: Out of Memory");
+	}
+
+	list.size = list.entry ? list.count : 0;
+	list.count = 0;
+	if (list.entry) {
+		list.start = data.start;
+		pipeline_comp_copy_list(data.start, &data, list.dir);
+	}
+
+	spin_lock_irq(&p->lock, flags);
+	old = p->copy_list.entry;
+	p->copy_list = list;
+	spin_unlock_irq(&p->lock, flags);
+
+	rfree(old);
+}
+
+/* Rebuilds the copy list if the graph or the walk direction changed. Not
+ * for the pipeline task, it allocates, the task walks the graph instead
+ * until the list is rebuilt.
+ */
+void pipeline_copy_list_update(struct pipeline *p)
+{
+	struct pipeline_copy_list *list = &p->copy_list;
+	struct comp_dev *start;
+	uint32_t dir;
+
+	/* the walk needs the endpoints set on complete */
+	if (!p->source_comp)
+		return;
+
+	start = pipeline_copy_start(p, false, &dir);
+	if (list->graph_gen == atomic_read(&p->graph_gen) &&
+	    list->start == start && list->dir == dir)
+		return;
+
+	pipeline_copy_list_build(p);
+}
+
+/* checks if the copy list is current and matches the walk from start */
+static inline bool pipeline_copy_list_valid(struct pipeline *p,
+					    struct comp_dev *start,
+					    uint32_t dir)
+{
+	struct pipeline_copy_list *list = &p->copy_list;
+
+	return list->graph_gen == atomic_read(&p->graph_gen) &&
+	       list->start == start && list->dir == dir;
+}
+
+/* copy the pre-ordered list, the comps fed by an inactive comp or by a comp
+ * that stopped the path are skipped
+ */
+static int pipeline_copy_list_downstream(struct pipeline_copy_list *list)
+{
+	struct pipeline_copy_entry *e;
+	uint32_t i = 0;
+	int err;
+
+	while (i < list->count) {
+		e = &list->entry[i];
+
+		if (!comp_is_active(e->comp)) {
+			i += e->span;
+			continue;
+		}
+
+		err = pipeline_comp_copy_timed(e->comp);
+		if (err < 0)
+			return err;
+
+		i += err == PPL_STATUS_PATH_STOP ? e->span : 1;
+	}
+
+	return 0;
+}
+
+/* copy the post-ordered list, the comps feeding an inactive comp are
+ * skipped so these are marked first walking back from the start comp
+ */
+static int pipeline_copy_list_upstream(struct pipeline_copy_list *list)
+{
+	struct pipeline_copy_entry *e;
+	uint32_t first;
+	uint32_t i = list->count;
+	int err;
+
+	while (i > 0) {
+		e = &list->entry[i - 1];
+
+		if (comp_is_active(e->comp)) {
+			e->run = true;
+			i--;
+			continue;
+		}
+
+		first = i - e->span;
+		while (i > first)
+			list->entry[--i].run = false;
+	}
+
+	for (i = 0; i < list->count; i++) {
+		e = &list->entry[i];
+		if (!e->run)
+			continue;
+
+		err = pipeline_comp_copy_timed(e->comp);
+		if (err < 0)
+			return err;
+	}
+
+	return 0;
+}
+
 /* Copy data across all pipeline components.
  * For capture pipelines it always starts from source component
  * and continues downstream. For playback pipelines there are two
  * possibilities: for preload it starts from sink component and
  * continues upstream and if not preload, then it first copies
  * sink component itself and then goes upstream.
+ * The flattened copy list is rebuilt in IPC context when the graph
+ * changes and is used when it is current and matches the walk, otherwise
+ * the graph is walked.
  */
 static int pipeline_copy(struct pipeline *p)
 {
@@ -699,33 +969,34 @@ static int pipeline_copy(struct pipeline *p)
 	uint32_t dir;
 	int ret = 0;
 
-	if (p->source_comp->params.direction == SOF_IPC_STREAM_PLAYBACK) {
-		dir = PPL_DIR_UPSTREAM;
-		start = p->sink_comp;
-
-		/* if not pipeline preload then copy sink comp first */
-		if (!p->preload) {
-			ret = comp_copy(start);
-			if (ret < 0) {
-				trace_pipe_error("pipeline_copy() error: "
-						 "ret = %d", ret);
-				return ret;
-			}
-
-			start = comp_get_previous(start, dir);
-			if (!start)
-				/* nothing else to do */
-				return ret;
+	/* if not pipeline preload then copy sink comp first */
+	if (p->source_comp->params.direction == SOF_IPC_STREAM_PLAYBACK &&
+	    !p->preload) {
+		ret = pipeline_comp_copy_timed(p->sink_comp);
+		if (ret < 0) {
+			trace_pipe_error("pipeline_copy() error: "
+					 "ret = %d", ret);
+			return ret;
 		}
-	} else {
-		dir = PPL_DIR_DOWNSTREAM;
-		start = p->source_comp;
 	}
 
-	data.start = start;
-	data.p = p;
+	start = pipeline_copy_start(p, p->preload, &dir);
+	if (!start)
+		/* nothing else to do */
+		return ret;
+
+	if (pipeline_copy_list_valid(p, start, dir)) {
+		if (dir == PPL_DIR_DOWNSTREAM)
+			ret = pipeline_copy_list_downstream(&p->copy_list);
+		else
+			ret = pipeline_copy_list_upstream(&p->copy_list);
+	} else {
+		data.start = start;
+		data.p = p;
+
+		ret = pipeline_comp_copy(start, &data, dir);
+	}
 
-	ret = pipeline_comp_copy(start, &data, dir);
 	if (ret < 0)
 		trace_pipe_error("pipeline_copy() error: ret = %d, start"
 				 "->comp.id = %u, dir = %u", ret,
@@ -736,6 +1007,25 @@ static int pipeline_copy(struct pipeline *p)
 	return ret;
 }
 
+/* copy the pipeline and account the period execution time */
+static int pipeline_copy_timed(struct pipeline *p)
+{
+#if CONFIG_COMP_PERF
+	uint64_t start = perf_cnt_get_ticks();
+	uint64_t ticks;
+	int ret = pipeline_copy(p);
+
+	ticks = perf_cnt_get_ticks() - start;
+	perf_cnt_add(&p->perf_period, ticks);
+	if (p->perf_budget && ticks > p->perf_budget)
+		p->perf_overruns++;
+
+	return ret;
+#else
+	return pipeline_copy(p);
+#endif
+}
+
 /* Walk the graph to active components in any pipeline to find
  * the first active DAI and return it's timestamp.
  */
@@ -911,7 +1201,7 @@ static uint64_t pipeline_task(void *arg)
 			return 0;/* skip copy if still in xrun */
 	}
 
-	err = pipeline_copy(p);
+	err = pipeline_copy_timed(p);
 	if (err < 0) {
 		/* try to recover */
 		err = pipeline_xrun_recover(p);
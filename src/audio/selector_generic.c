@@ -36,6 +36,39 @@
 
 #include "selector.h"
 
+/**
+ * \brief Copies bytes between circular buffers one linear chunk at a time.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] bytes Number of bytes to copy.
+ */
+static void sel_copy(struct comp_buffer *sink, struct comp_buffer *source,
+		     uint32_t bytes)
+{
+	struct buffer_segments seg;
+	void *dest = sink->w_ptr;
+	void *src;
+	uint32_t size;
+	uint32_t n;
+	int i;
+
+	buffer_read_segments(source, bytes, &seg);
+
+	for (i = 0; i < 2; i++) {
+		src = seg.ptr[i];
+		size = seg.bytes[i];
+
+		while (size) {
+			n = MIN(size, buffer_bytes_without_wrap(sink, dest));
+			memcpy(dest, src, n);
+
+			size -= n;
+			src += n;
+			dest = buffer_wrap(sink, dest + n);
+		}
+	}
+}
+
 /** 
  * \brief Channel selection for 16 bit, 1 channel data format.
  * \param[in,out] dev Selector base component device.
@@ -47,16 +80,25 @@ static void sel_s16le_1ch(struct comp_dev *dev, struct comp_buffer *sink,
 			  struct comp_buffer *source, uint32_t frames)
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
-	int16_t *src;
-	int16_t *dest;
-	uint32_t i;
-	uint32_t j = 0;
+	int16_t *src = buffer_read_frag_s16(source, cd->config.sel_channel);
+	int16_t *dest = sink->w_ptr;
 	uint32_t nch = cd->config.in_channels_count;
+	uint32_t n;
+	uint32_t i;
+
+	while (frames) {
+		/* process up to the nearest source or sink wrap */
+		n = MIN(buffer_steps_without_wrap(source, src,
+						  nch * sizeof(*src)),
+			buffer_steps_without_wrap(sink, dest, sizeof(*dest)));
+		n = MIN(n, frames);
 
-	for (i = cd->config.sel_channel; i < frames * nch; i += nch) {
-		src = buffer_read_frag_s16(source, i);
-		dest = buffer_write_frag_s16(sink, j++);
-		*dest = *src;
+		for (i = 0; i < n; i++)
+			dest[i] = src[i * nch];
+
+		frames -= n;
+		src = buffer_wrap(source, src + n * nch);
+		dest = buffer_wrap(sink, dest + n);
 	}
 }
 
@@ -71,16 +113,25 @@ static void sel_s32le_1ch(struct comp_dev *dev, struct comp_buffer *sink,
 			  struct comp_buffer *source, uint32_t frames)
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
-	int32_t *src;
-	int32_t *dest;
-	uint32_t i;
-	uint32_t j = 0;
+	int32_t *src = buffer_read_frag_s32(source, cd->config.sel_channel);
+	int32_t *dest = sink->w_ptr;
 	uint32_t nch = cd->config.in_channels_count;
+	uint32_t n;
+	uint32_t i;
+
+	while (frames) {
+		/* process up to the nearest source or sink wrap */
+		n = MIN(buffer_steps_without_wrap(source, src,
+						  nch * sizeof(*src)),
+			buffer_steps_without_wrap(sink, dest, sizeof(*dest)));
+		n = MIN(n, frames);
 
-	for (i = cd->config.sel_channel; i < frames * nch; i += nch) {
-		src = buffer_read_frag_s32(source, i);
-		dest = buffer_write_frag_s32(sink, j++);
-		*dest = *src;
+		for (i = 0; i < n; i++)
+			dest[i] = src[i * nch];
+
+		frames -= n;
+		src = buffer_wrap(source, src + n * nch);
+		dest = buffer_wrap(sink, dest + n);
 	}
 }
 
@@ -95,20 +146,9 @@ static void sel_s16le_nch(struct comp_dev *dev, struct comp_buffer *sink,
 			  struct comp_buffer *source, uint32_t frames)
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
-	int16_t *src;
-	int16_t *dest;
-	uint32_t i;
-	uint32_t j = 0;
-	uint32_t channel;
-
-	for (i = 0; i < frames; i++) {
-		for (channel = 0; channel < cd->config.in_channels_count; channel++) {
-			src = buffer_read_frag_s16(source, j);
-			dest = buffer_write_frag_s16(sink, j);
-			*dest = *src;
-			j++;
-		}
-	}
+
+	sel_copy(sink, source,
+		 frames * cd->config.in_channels_count * sizeof(int16_t));
 }
 
 /** 
@@ -122,20 +162,9 @@ static void sel_s32le_nch(struct comp_dev *dev, struct comp_buffer *sink,
 			  struct comp_buffer *source, uint32_t frames)
 {
 	struct comp_data *cd = comp_get_drvdata(dev);
-	int32_t *src;
-	int32_t *dest;
-	uint32_t i;
-	uint32_t j = 0;
-	uint32_t channel;
-
-	for (i = 0; i < frames; i++) {
-		for (channel = 0; channel < cd->config.in_channels_count; channel++) {
-			src = buffer_read_frag_s32(source, j);
-			dest = buffer_write_frag_s32(sink, j);
-			*dest = *src;
-			j++;
-		}
-	}
+
+	sel_copy(sink, source,
+		 frames * cd->config.in_channels_count * sizeof(int32_t));
 }
 
 const struct comp_func_map func_table[] = {
@@ -130,6 +130,15 @@ void src_polyphase_stage_cir(struct src_stage_prm *s);
 
 void src_polyphase_stage_cir_s16(struct src_stage_prm *s);
 
+/* Compute one sub-filter output for all channels. The generic polyphase
+ * stage calls this x86 SIMD kernel from src_sse42.c or src_avx2.c when
+ * built with SRC_SSE42 or SRC_AVX2.
+ */
+void src_fir_filter_simd(int32_t *rp, const void *cp, int32_t *wp,
+			 int32_t *fir_start, int32_t *fir_end,
+			 int fir_delay_length, int taps_x_nch, int shift,
+			 int nch);
+
 int src_buffer_lengths(struct src_param *p, int fs_in, int fs_out, int nch,
 		       int source_frames);
 
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ */
+
+/* AVX2 sub-filter kernel for the generic SRC */
+
+#include <stdint.h>
+#include <sof/alloc.h>
+#include <sof/audio/format.h>
+#include <sof/math/numbers.h>
+#include <platform/platform.h>
+
+#include "src_config.h"
+#include "src.h"
+
+#if SRC_AVX2
+
+#include <immintrin.h>
+
+/* The products are computed with the 32x32 -> 64 bit multiply from data
+ * and coefficients sign extended to 64 bit lanes. The sums are the same as
+ * in the generic C version since only the order of additions differs.
+ */
+
+#if SRC_SHORT /* 16 bit coefficients version */
+
+typedef int16_t src_coef_t;
+
+/* Q1.15 x Q1.31 -> Q2.46, shift by 15 for Qx.46 to Qx.31 */
+#define SRC_AVX2_QSHIFT	15
+
+static inline int32_t src_avx2_coef(const src_coef_t *c)
+{
+	return *c;
+}
+
+/* Coefficients of four taps */
+static inline __m256i src_avx2_coef4(const src_coef_t *c)
+{
+	return _mm256_cvtepi16_epi64(_mm_loadl_epi64((const __m128i *)c));
+}
+
+#else /* 32bit coefficients version */
+
+typedef int32_t src_coef_t;
+
+/* Q1.23 x Q1.31 -> Q2.54, shift by 23 for Qx.54 to Qx.31 */
+#define SRC_AVX2_QSHIFT	23
+
+static inline int32_t src_avx2_coef(const src_coef_t *c)
+{
+	return *c >> 8;
+}
+
+/* Coefficients of four taps */
+static inline __m256i src_avx2_coef4(const src_coef_t *c)
+{
+	__m128i v = _mm_loadu_si128((const __m128i *)c);
+
+	return _mm256_cvtepi32_epi64(_mm_srai_epi32(v, 8));
+}
+
+#endif /* 32bit coefficients version */
+
+/* Coefficients of two taps, each for two channels */
+static inline __m256i src_avx2_coef2x2(const src_coef_t *c)
+{
+	return _mm256_setr_epi64x(src_avx2_coef(c), src_avx2_coef(c),
+				  src_avx2_coef(c + 1), src_avx2_coef(c + 1));
+}
+
+static inline __m256i src_avx2_mac(__m256i acc, const int32_t *d, __m256i c)
+{
+	__m256i x = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)d));
+
+	return _mm256_add_epi64(acc, _mm256_mul_epi32(x, c));
+}
+
+/* Multiply-accumulate taps of a linear part of the delay line. The frame
+ * of each tap is multiplied by the coefficient of the tap and the products
+ * are summed to sum[] by position in the frame.
+ */
+static inline void src_avx2_fir_part(const int32_t *data,
+				     const src_coef_t *coef, int taps,
+				     int nch, int64_t sum[])
+{
+	int64_t lanes[4];
+	__m256i acc = _mm256_setzero_si256();
+	int64_t c;
+	int t = 0;
+	int i;
+	int k;
+
+	switch (nch) {
+	case 1:
+		/* Four taps per vector */
+		for (; t + 4 <= taps; t += 4)
+			acc = src_avx2_mac(acc, data + t,
+					   src_avx2_coef4(coef + t));
+
+		_mm256_storeu_si256((__m256i *)lanes, acc);
+		sum[0] += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+		break;
+	case 2:
+		/* Two taps of two channels per vector */
+		for (; t + 2 <= taps; t += 2)
+			acc = src_avx2_mac(acc, data + 2 * t,
+					   src_avx2_coef2x2(coef + t));
+
+		_mm256_storeu_si256((__m256i *)lanes, acc);
+		sum[0] += lanes[0] + lanes[2];
+		sum[1] += lanes[1] + lanes[3];
+		break;
+	default:
+		/* Four channels of a tap per vector */
+		for (k = 0; k + 4 <= nch; k += 4) {
+			acc = _mm256_setzero_si256();
+			for (i = 0; i < taps; i++) {
+				c = src_avx2_coef(coef + i);
+				acc = src_avx2_mac(acc, data + i * nch + k,
+						   _mm256_set1_epi64x(c));
+			}
+
+			_mm256_storeu_si256((__m256i *)lanes, acc);
+			for (i = 0; i < 4; i++)
+				sum[k + i] += lanes[i];
+		}
+
+		/* Remaining channels */
+		for (; k < nch; k++) {
+			for (i = 0; i < taps; i++)
+				sum[k] += (int64_t)src_avx2_coef(coef + i) *
+					data[i * nch + k];
+		}
+
+		return;
+	}
+
+	/* Remaining taps of mono and stereo */
+	for (; t < taps; t++) {
+		c = src_avx2_coef(coef + t);
+		for (k = 0; k < nch; k++)
+			sum[k] += c * data[t * nch + k];
+	}
+}
+
+void src_fir_filter_simd(int32_t *rp, const void *cp, int32_t *wp,
+			 int32_t *fir_start, int32_t *fir_end,
+			 int fir_delay_length, int taps_x_nch, int shift,
+			 int nch)
+{
+	int64_t sum[PLATFORM_MAX_CHANNELS];
+	const src_coef_t *coef = cp;
+	const int qshift = SRC_AVX2_QSHIFT + shift;
+	const int32_t rnd = 1 << (qshift - 1); /* Half LSB */
+	int32_t *data = rp - nch + 1; /* Start of frame */
+	int taps = taps_x_nch / nch;
+	int taps1 = MIN(taps_x_nch, fir_end - data) / nch;
+	int j;
+
+	/* Initialize to half LSB for rounding. The channels are in reverse
+	 * order in the delay line frames.
+	 */
+	for (j = 0; j < nch; j++)
+		sum[j] = rnd;
+
+	src_avx2_fir_part(data, coef, taps1, nch, sum);
+	if (taps1 < taps)
+		src_avx2_fir_part(fir_start, coef + taps1, taps - taps1, nch,
+				  sum);
+
+	for (j = 0; j < nch; j++)
+		wp[j] = sat_int32(sum[nch - 1 - j] >> qshift);
+}
+
+#endif
@@ -47,6 +47,8 @@
 #define SRC_GENERIC	1
 #define SRC_HIFIEP	0
 #define SRC_HIFI3	0
+#define SRC_SSE42	0
+#define SRC_AVX2	0
 #endif
 
 /* Select optimized code variant when xt-xcc compiler is used */
@@ -77,4 +79,18 @@
 #endif
 #endif
 
+/* The generic SRC uses x86 SIMD sub-filter kernels when built for the
+ * optimized host library modules.
+ */
+#if SRC_GENERIC && defined(__AVX2__)
+#define SRC_SSE42	0
+#define SRC_AVX2	1
+#elif SRC_GENERIC && defined(__SSE4_2__)
+#define SRC_SSE42	1
+#define SRC_AVX2	0
+#elif SRC_AUTOARCH == 1
+#define SRC_SSE42	0
+#define SRC_AVX2	0
+#endif
+
 #endif
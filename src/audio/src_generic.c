@@ -43,7 +43,22 @@
 
 #if SRC_GENERIC
 
-#if SRC_SHORT /* 16 bit coefficients version */
+#if SRC_SSE42 || SRC_AVX2
+
+/* The sub-filters are computed by the SIMD kernel, it is bit exact with
+ * the C versions below.
+ */
+static inline void fir_filter_generic(int32_t *rp, const void *cp, int32_t *wp0,
+				      int32_t *fir_start, int32_t *fir_end,
+				      const int fir_delay_length,
+				      const int taps_x_nch,
+				      const int shift, const int nch)
+{
+	src_fir_filter_simd(rp, cp, wp0, fir_start, fir_end, fir_delay_length,
+			    taps_x_nch, shift, nch);
+}
+
+#elif SRC_SHORT /* 16 bit coefficients version */
 
 static inline void fir_filter_generic(int32_t *rp, const void *cp, int32_t *wp0,
 				      int32_t *fir_start, int32_t *fir_end,
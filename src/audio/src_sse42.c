@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ */
+
+/* SSE4.2 sub-filter kernel for the generic SRC */
+
+#include <stdint.h>
+#include <sof/alloc.h>
+#include <sof/audio/format.h>
+#include <sof/math/numbers.h>
+#include <platform/platform.h>
+
+#include "src_config.h"
+#include "src.h"
+
+#if SRC_SSE42
+
+#include <immintrin.h>
+
+/* The products are computed with the 32x32 -> 64 bit multiply from data
+ * and coefficients sign extended to 64 bit lanes. The sums are the same as
+ * in the generic C version since only the order of additions differs.
+ */
+
+#if SRC_SHORT /* 16 bit coefficients version */
+
+typedef int16_t src_coef_t;
+
+/* Q1.15 x Q1.31 -> Q2.46, shift by 15 for Qx.46 to Qx.31 */
+#define SRC_SSE42_QSHIFT	15
+
+static inline int32_t src_sse42_coef(const src_coef_t *c)
+{
+	return *c;
+}
+
+/* Coefficients of two taps */
+static inline __m128i src_sse42_coef2(const src_coef_t *c)
+{
+	return _mm_set_epi64x(c[1], c[0]);
+}
+
+#else /* 32bit coefficients version */
+
+typedef int32_t src_coef_t;
+
+/* Q1.23 x Q1.31 -> Q2.54, shift by 23 for Qx.54 to Qx.31 */
+#define SRC_SSE42_QSHIFT	23
+
+static inline int32_t src_sse42_coef(const src_coef_t *c)
+{
+	return *c >> 8;
+}
+
+/* Coefficients of two taps */
+static inline __m128i src_sse42_coef2(const src_coef_t *c)
+{
+	__m128i v = _mm_loadl_epi64((const __m128i *)c);
+
+	return _mm_cvtepi32_epi64(_mm_srai_epi32(v, 8));
+}
+
+#endif /* 32bit coefficients version */
+
+static inline __m128i src_sse42_mac(__m128i acc, const int32_t *d, __m128i c)
+{
+	__m128i x = _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i *)d));
+
+	return _mm_add_epi64(acc, _mm_mul_epi32(x, c));
+}
+
+/* Multiply-accumulate taps of a linear part of the delay line. The frame
+ * of each tap is multiplied by the coefficient of the tap and the products
+ * are summed to sum[] by position in the frame.
+ */
+static inline void src_sse42_fir_part(const int32_t *data,
+				      const src_coef_t *coef, int taps,
+				      int nch, int64_t sum[])
+{
+	int64_t lanes[2];
+	__m128i acc0;
+	__m128i acc1;
+	__m128i c;
+	int i;
+	int k;
+
+	if (nch == 1) {
+		/* Two taps per vector */
+		acc0 = _mm_setzero_si128();
+		for (i = 0; i + 2 <= taps; i += 2)
+			acc0 = src_sse42_mac(acc0, data + i,
+					     src_sse42_coef2(coef + i));
+
+		_mm_storeu_si128((__m128i *)lanes, acc0);
+		sum[0] += lanes[0] + lanes[1];
+		for (; i < taps; i++)
+			sum[0] += (int64_t)src_sse42_coef(coef + i) * data[i];
+
+		return;
+	}
+
+	/* Two channels of a tap per vector, two taps per iteration */
+	for (k = 0; k + 2 <= nch; k += 2) {
+		acc0 = _mm_setzero_si128();
+		acc1 = _mm_setzero_si128();
+		for (i = 0; i + 2 <= taps; i += 2) {
+			c = _mm_set1_epi64x(src_sse42_coef(coef + i));
+			acc0 = src_sse42_mac(acc0, data + i * nch + k, c);
+			c = _mm_set1_epi64x(src_sse42_coef(coef + i + 1));
+			acc1 = src_sse42_mac(acc1, data + (i + 1) * nch + k,
+					     c);
+		}
+
+		if (i < taps) {
+			c = _mm_set1_epi64x(src_sse42_coef(coef + i));
+			acc0 = src_sse42_mac(acc0, data + i * nch + k, c);
+		}
+
+		_mm_storeu_si128((__m128i *)lanes, _mm_add_epi64(acc0, acc1));
+		sum[k] += lanes[0];
+		sum[k + 1] += lanes[1];
+	}
+
+	/* Remaining channel */
+	if (k < nch) {
+		for (i = 0; i < taps; i++)
+			sum[k] += (int64_t)src_sse42_coef(coef + i) *
+				data[i * nch + k];
+	}
+}
+
+void src_fir_filter_simd(int32_t *rp, const void *cp, int32_t *wp,
+			 int32_t *fir_start, int32_t *fir_end,
+			 int fir_delay_length, int taps_x_nch, int shift,
+			 int nch)
+{
+	int64_t sum[PLATFORM_MAX_CHANNELS];
+	const src_coef_t *coef = cp;
+	const int qshift = SRC_SSE42_QSHIFT + shift;
+	const int32_t rnd = 1 << (qshift - 1); /* Half LSB */
+	int32_t *data = rp - nch + 1; /* Start of frame */
+	int taps = taps_x_nch / nch;
+	int taps1 = MIN(taps_x_nch, fir_end - data) / nch;
+	int j;
+
+	/* Initialize to half LSB for rounding. The channels are in reverse
+	 * order in the delay line frames.
+	 */
+	for (j = 0; j < nch; j++)
+		sum[j] = rnd;
+
+	src_sse42_fir_part(data, coef, taps1, nch, sum);
+	if (taps1 < taps)
+		src_sse42_fir_part(fir_start, coef + taps1, taps - taps1, nch,
+				   sum);
+
+	for (j = 0; j < nch; j++)
+		wp[j] = sat_int32(sum[nch - 1 - j] >> qshift);
+}
+
+#endif
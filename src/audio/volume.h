@@ -55,6 +55,11 @@
 
 #endif
 
+/* x86 SIMD variants used by the optimized host library modules */
+#if defined(__SSE4_2__) || defined(__AVX2__)
+#undef CONFIG_GENERIC
+#endif
+
 /** \brief Volume trace function. */
 #define trace_volume(__e, ...)	trace_event(TRACE_CLASS_VOLUME, __e, ##__VA_ARGS__)
 
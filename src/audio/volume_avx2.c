@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file audio/volume_avx2.c
+ * \brief Volume AVX2 processing implementation
+ */
+
+#include "volume.h"
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+/** \brief Number of 32 bit samples in one AVX2 register. */
+#define VOL_SIMD_LANES	8
+
+/** \brief SIMD register type of the shared processing loop. */
+#define vol_simd_t	__m256i
+
+/**
+ * \brief Loads 8 input samples as 32 bit values.
+ * \param[in] src Source samples.
+ * \param[in] fmt Source frame format.
+ * \param[in] lshift Amount of left shifts applied to the samples.
+ * \return Input samples.
+ */
+static inline __m256i vol_simd_load(const void *src,
+				    const enum sof_ipc_frame fmt,
+				    const int lshift)
+{
+	__m256i x;
+
+	if (fmt == SOF_IPC_FRAME_S16_LE)
+		x = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)
+							  src));
+	else
+		x = _mm256_loadu_si256((const __m256i *)src);
+
+	if (fmt == SOF_IPC_FRAME_S24_4LE)
+		x = _mm256_srai_epi32(_mm256_slli_epi32(x, 8), 8);
+
+	return _mm256_slli_epi32(x, lshift);
+}
+
+/**
+ * \brief Stores 8 output samples.
+ * \param[out] dest Destination samples.
+ * \param[in] y Output samples, already saturated to the sink format.
+ * \param[in] fmt Sink frame format.
+ */
+static inline void vol_simd_store(void *dest, __m256i y,
+				  const enum sof_ipc_frame fmt)
+{
+	__m128i lo;
+	__m128i hi;
+
+	if (fmt == SOF_IPC_FRAME_S16_LE) {
+		lo = _mm256_castsi256_si128(y);
+		hi = _mm256_extracti128_si256(y, 1);
+		_mm_storeu_si128((__m128i *)dest, _mm_packs_epi32(lo, hi));
+	} else {
+		_mm256_storeu_si256((__m256i *)dest, y);
+	}
+}
+
+/**
+ * \brief Loads 8 gains.
+ * \param[in] gain Gain table entries.
+ * \return Gains.
+ */
+static inline __m256i vol_simd_load_gain(const int32_t *gain)
+{
+	return _mm256_loadu_si256((const __m256i *)gain);
+}
+
+/**
+ * \brief Rounds, shifts and saturates 64 bit products.
+ * \param[in] p Products.
+ * \param[in] shift Amount of right shifts.
+ * \param[in] max Maximum output value.
+ * \return Output values in the low 32 bits of each lane.
+ *
+ * Equivalent of q_multsr_sat_32x32() rounding. AVX2 has no 64 bit
+ * arithmetic shift, so the sign bits are shifted in separately.
+ */
+static inline __m256i vol_simd_round_sat(__m256i p, const int shift,
+					 const int64_t max)
+{
+	__m256i vmax = _mm256_set1_epi64x(max);
+	__m256i vmin = _mm256_set1_epi64x(-max - 1);
+	__m256i sign;
+
+	p = _mm256_add_epi64(p, _mm256_set1_epi64x(1LL << (shift - 1)));
+	sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), p);
+	p = _mm256_or_si256(_mm256_srli_epi64(p, shift),
+			    _mm256_slli_epi64(sign, 64 - shift));
+
+	p = _mm256_blendv_epi8(p, vmax, _mm256_cmpgt_epi64(p, vmax));
+	return _mm256_blendv_epi8(p, vmin, _mm256_cmpgt_epi64(vmin, p));
+}
+
+/**
+ * \brief Multiplies 8 samples by their gains.
+ * \param[in] x Input samples.
+ * \param[in] vol Gains.
+ * \param[in] shift Amount of right shifts.
+ * \param[in] max Maximum output value.
+ * \return Output samples.
+ */
+static inline __m256i vol_simd_mult(__m256i x, __m256i vol, const int shift,
+				    const int64_t max)
+{
+	__m256i even = _mm256_mul_epi32(x, vol);
+	__m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(x, 32),
+				       _mm256_srli_epi64(vol, 32));
+
+	even = vol_simd_round_sat(even, shift, max);
+	odd = vol_simd_round_sat(odd, shift, max);
+
+	return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xaa);
+}
+
+#include "volume_simd.h"
+
+#endif
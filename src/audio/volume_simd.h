@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file audio/volume_simd.h
+ * \brief Volume processing shared by the x86 SIMD implementations
+ *
+ * Included once by each SIMD implementation after it defines
+ * VOL_SIMD_LANES, the vol_simd_t register type and the vol_simd_load(),
+ * vol_simd_load_gain(), vol_simd_mult() and vol_simd_store() helpers.
+ * Adds the processing loop and the func_map built on top of them.
+ */
+
+#ifndef VOLUME_SIMD_H
+#define VOLUME_SIMD_H
+
+#include "volume.h"
+
+/** \brief Size of the per-sample gain table. */
+#define VOL_SIMD_GAIN_SIZE \
+	(SOF_IPC_MAX_CHANNELS * VOL_SIMD_LANES + VOL_SIMD_LANES)
+
+/**
+ * \brief Fills gain table for interleaved frames.
+ * \param[in,out] dev Volume base component device.
+ * \param[out] gain Gain table.
+ * \param[in] period Gain table period in samples.
+ *
+ * Entry i holds the gain of channel i % channels, so loading
+ * VOL_SIMD_LANES entries from the current index gives the gains
+ * for the next interleaved samples without any shuffling.
+ */
+static void vol_simd_gain_table(struct comp_dev *dev, int32_t *gain,
+				uint32_t period)
+{
+	struct comp_data *cd = comp_get_drvdata(dev);
+	uint32_t i;
+
+	for (i = 0; i < period + VOL_SIMD_LANES; i++)
+		gain[i] = cd->volume[i % dev->params.channels];
+}
+
+/**
+ * \brief Returns maximum sample value of the frame format.
+ * \param[in] fmt Frame format.
+ * \return Maximum sample value.
+ */
+static inline int64_t vol_sat_max(const enum sof_ipc_frame fmt)
+{
+	switch (fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+		return INT16_MAX;
+	case SOF_IPC_FRAME_S24_4LE:
+		return INT24_MAXVALUE;
+	default:
+		return INT32_MAX;
+	}
+}
+
+/**
+ * \brief Multiplies one sample by its gain.
+ * \param[in] x Input sample.
+ * \param[in] vol Gain.
+ * \param[in] shift Amount of right shifts.
+ * \param[in] max Maximum output value.
+ * \return Output sample.
+ */
+static inline int32_t vol_simd_mult_scalar(int32_t x, int32_t vol,
+					   const int shift, const int64_t max)
+{
+	int64_t y = ((((int64_t)x * vol) >> (shift - 1)) + 1) >> 1;
+
+	if (y > max)
+		return max;
+	if (y < -max - 1)
+		return -max - 1;
+	return y;
+}
+
+/**
+ * \brief Common SIMD volume processing loop.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] frames Number of frames to process.
+ * \param[in] in_fmt Source frame format.
+ * \param[in] out_fmt Sink frame format.
+ * \param[in] lshift Amount of left shifts applied to source samples.
+ * \param[in] shift Amount of right shifts applied to products.
+ *
+ * Format parameters are constants in every caller, so the inlined
+ * loop is specialized for each conversion.
+ */
+static inline void vol_simd_process(struct comp_dev *dev,
+				    struct comp_buffer *sink,
+				    struct comp_buffer *source,
+				    uint32_t frames,
+				    const enum sof_ipc_frame in_fmt,
+				    const enum sof_ipc_frame out_fmt,
+				    const int lshift, const int shift)
+{
+	const uint32_t in_bytes = in_fmt == SOF_IPC_FRAME_S16_LE ?
+		sizeof(int16_t) : sizeof(int32_t);
+	const uint32_t out_bytes = out_fmt == SOF_IPC_FRAME_S16_LE ?
+		sizeof(int16_t) : sizeof(int32_t);
+	const int64_t max = vol_sat_max(out_fmt);
+	int32_t gain[VOL_SIMD_GAIN_SIZE];
+	void *src = source->r_ptr;
+	void *dest = sink->w_ptr;
+	uint32_t samples = frames * dev->params.channels;
+	uint32_t period = dev->params.channels * VOL_SIMD_LANES;
+	uint32_t idx = 0;
+	uint32_t n;
+	uint32_t i;
+	int32_t x;
+	int32_t y;
+	vol_simd_t vx;
+	vol_simd_t vg;
+	vol_simd_t vy;
+
+	vol_simd_gain_table(dev, gain, period);
+
+	while (samples) {
+		/* process up to the nearest source or sink wrap */
+		n = MIN(buffer_steps_without_wrap(source, src, in_bytes),
+			buffer_steps_without_wrap(sink, dest, out_bytes));
+		n = MIN(n, samples);
+
+		for (i = 0; i + VOL_SIMD_LANES <= n; i += VOL_SIMD_LANES) {
+			vx = vol_simd_load(src + i * in_bytes, in_fmt, lshift);
+			vg = vol_simd_load_gain(&gain[idx]);
+			vy = vol_simd_mult(vx, vg, shift, max);
+			vol_simd_store(dest + i * out_bytes, vy, out_fmt);
+
+			idx += VOL_SIMD_LANES;
+			if (idx >= period)
+				idx -= period;
+		}
+
+		/* samples left before the wrap */
+		for (; i < n; i++) {
+			if (in_fmt == SOF_IPC_FRAME_S16_LE)
+				x = ((int16_t *)src)[i];
+			else if (in_fmt == SOF_IPC_FRAME_S24_4LE)
+				x = sign_extend_s24(((int32_t *)src)[i]);
+			else
+				x = ((int32_t *)src)[i];
+
+			y = vol_simd_mult_scalar(x << lshift, gain[idx],
+						 shift, max);
+
+			if (out_fmt == SOF_IPC_FRAME_S16_LE)
+				((int16_t *)dest)[i] = y;
+			else
+				((int32_t *)dest)[i] = y;
+
+			if (++idx == period)
+				idx = 0;
+		}
+
+		samples -= n;
+		src = buffer_wrap(source, src + n * in_bytes);
+		dest = buffer_wrap(sink, dest + n * out_bytes);
+	}
+}
+
+/**
+ * \brief SIMD volume processing from 16 bit to 16 bit.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] frames Number of frames to process.
+ */
+static void vol_s16_to_s16(struct comp_dev *dev, struct comp_buffer *sink,
+			   struct comp_buffer *source, uint32_t frames)
+{
+	vol_simd_process(dev, sink, source, frames,
+			 SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S16_LE,
+			 0, Q_SHIFT_BITS_32(15, 16, 15));
+}
+
+/**
+ * \brief SIMD volume processing from 16 bit to 32 bit.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] frames Number of frames to process.
+ */
+static void vol_s16_to_s32(struct comp_dev *dev, struct comp_buffer *sink,
+			   struct comp_buffer *source, uint32_t frames)
+{
+	vol_simd_process(dev, sink, source, frames,
+			 SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S32_LE,
+			 8, Q_SHIFT_BITS_64(23, 16, 31));
+}
+
+/**
+ * \brief SIMD volume processing from 32 bit to 16 bit.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] frames Number of frames to process.
+ */
+static void vol_s32_to_s16(struct comp_dev *dev, struct comp_buffer *sink,
+			   struct comp_buffer *source, uint32_t frames)
+{
+	vol_simd_process(dev, sink, source, frames,
+			 SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S16_LE,
+			 0, Q_SHIFT_BITS_64(31, 16, 15));
+}
+
+/**
+ * \brief SIMD volume processing from 32 bit to 32 bit.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] frames Number of frames to process.
+ */
+static void vol_s32_to_s32(struct comp_dev *dev, struct comp_buffer *sink,
+			   struct comp_buffer *source, uint32_t frames)
+{
+	vol_simd_process(dev, sink, source, frames,
+			 SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S32_LE,
+			 0, Q_SHIFT_BITS_64(31, 16, 31));
+}
+
+/**
+ * \brief SIMD volume processing from 16 bit to 24/32 bit.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] frames Number of frames to process.
+ */
+static void vol_s16_to_s24(struct comp_dev *dev, struct comp_buffer *sink,
+			   struct comp_buffer *source, uint32_t frames)
+{
+	vol_simd_process(dev, sink, source, frames,
+			 SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S24_4LE,
+			 0, Q_SHIFT_BITS_64(15, 16, 23));
+}
+
+/**
+ * \brief SIMD volume processing from 24/32 bit to 16 bit.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] frames Number of frames to process.
+ */
+static void vol_s24_to_s16(struct comp_dev *dev, struct comp_buffer *sink,
+			   struct comp_buffer *source, uint32_t frames)
+{
+	vol_simd_process(dev, sink, source, frames,
+			 SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S16_LE,
+			 0, Q_SHIFT_BITS_64(23, 16, 15));
+}
+
+/**
+ * \brief SIMD volume processing from 32 bit to 24/32 bit.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] frames Number of frames to process.
+ */
+static void vol_s32_to_s24(struct comp_dev *dev, struct comp_buffer *sink,
+			   struct comp_buffer *source, uint32_t frames)
+{
+	vol_simd_process(dev, sink, source, frames,
+			 SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S24_4LE,
+			 0, Q_SHIFT_BITS_64(31, 16, 23));
+}
+
+/**
+ * \brief SIMD volume processing from 24/32 bit to 32 bit.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] frames Number of frames to process.
+ */
+static void vol_s24_to_s32(struct comp_dev *dev, struct comp_buffer *sink,
+			   struct comp_buffer *source, uint32_t frames)
+{
+	vol_simd_process(dev, sink, source, frames,
+			 SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S32_LE,
+			 0, Q_SHIFT_BITS_64(23, 16, 31));
+}
+
+/**
+ * \brief SIMD volume processing from 24/32 bit to 24/32 bit.
+ * \param[in,out] dev Volume base component device.
+ * \param[in,out] sink Destination buffer.
+ * \param[in,out] source Source buffer.
+ * \param[in] frames Number of frames to process.
+ */
+static void vol_s24_to_s24(struct comp_dev *dev, struct comp_buffer *sink,
+			   struct comp_buffer *source, uint32_t frames)
+{
+	vol_simd_process(dev, sink, source, frames,
+			 SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S24_4LE,
+			 0, Q_SHIFT_BITS_64(23, 16, 23));
+}
+
+const struct comp_func_map func_map[] = {
+	{SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S16_LE, vol_s16_to_s16},
+	{SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S32_LE, vol_s16_to_s32},
+	{SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S16_LE, vol_s32_to_s16},
+	{SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S32_LE, vol_s32_to_s32},
+	{SOF_IPC_FRAME_S16_LE, SOF_IPC_FRAME_S24_4LE, vol_s16_to_s24},
+	{SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S16_LE, vol_s24_to_s16},
+	{SOF_IPC_FRAME_S32_LE, SOF_IPC_FRAME_S24_4LE, vol_s32_to_s24},
+	{SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S32_LE, vol_s24_to_s32},
+	{SOF_IPC_FRAME_S24_4LE, SOF_IPC_FRAME_S24_4LE, vol_s24_to_s24},
+};
+
+const size_t func_count = ARRAY_SIZE(func_map);
+
+#endif /* VOLUME_SIMD_H */
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file audio/volume_sse42.c
+ * \brief Volume SSE4.2 processing implementation
+ */
+
+#include "volume.h"
+
+#if defined(__SSE4_2__) && !defined(__AVX2__)
+
+#include <immintrin.h>
+
+/** \brief Number of 32 bit samples in one SSE register. */
+#define VOL_SIMD_LANES	4
+
+/** \brief SIMD register type of the shared processing loop. */
+#define vol_simd_t	__m128i
+
+/**
+ * \brief Loads 4 input samples as 32 bit values.
+ * \param[in] src Source samples.
+ * \param[in] fmt Source frame format.
+ * \param[in] lshift Amount of left shifts applied to the samples.
+ * \return Input samples.
+ */
+static inline __m128i vol_simd_load(const void *src,
+				    const enum sof_ipc_frame fmt,
+				    const int lshift)
+{
+	__m128i x;
+
+	if (fmt == SOF_IPC_FRAME_S16_LE)
+		x = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)src));
+	else
+		x = _mm_loadu_si128((const __m128i *)src);
+
+	if (fmt == SOF_IPC_FRAME_S24_4LE)
+		x = _mm_srai_epi32(_mm_slli_epi32(x, 8), 8);
+
+	return _mm_slli_epi32(x, lshift);
+}
+
+/**
+ * \brief Stores 4 output samples.
+ * \param[out] dest Destination samples.
+ * \param[in] y Output samples, already saturated to the sink format.
+ * \param[in] fmt Sink frame format.
+ */
+static inline void vol_simd_store(void *dest, __m128i y,
+				  const enum sof_ipc_frame fmt)
+{
+	if (fmt == SOF_IPC_FRAME_S16_LE)
+		_mm_storel_epi64((__m128i *)dest, _mm_packs_epi32(y, y));
+	else
+		_mm_storeu_si128((__m128i *)dest, y);
+}
+
+/**
+ * \brief Loads 4 gains.
+ * \param[in] gain Gain table entries.
+ * \return Gains.
+ */
+static inline __m128i vol_simd_load_gain(const int32_t *gain)
+{
+	return _mm_loadu_si128((const __m128i *)gain);
+}
+
+/**
+ * \brief Rounds, shifts and saturates 64 bit products.
+ * \param[in] p Products.
+ * \param[in] shift Amount of right shifts.
+ * \param[in] max Maximum output value.
+ * \return Output values in the low 32 bits of each lane.
+ *
+ * Equivalent of q_multsr_sat_32x32() rounding. SSE has no 64 bit
+ * arithmetic shift, so the sign bits are shifted in separately.
+ */
+static inline __m128i vol_simd_round_sat(__m128i p, const int shift,
+					 const int64_t max)
+{
+	__m128i vmax = _mm_set1_epi64x(max);
+	__m128i vmin = _mm_set1_epi64x(-max - 1);
+	__m128i sign;
+
+	p = _mm_add_epi64(p, _mm_set1_epi64x(1LL << (shift - 1)));
+	sign = _mm_cmpgt_epi64(_mm_setzero_si128(), p);
+	p = _mm_or_si128(_mm_srli_epi64(p, shift),
+			 _mm_slli_epi64(sign, 64 - shift));
+
+	p = _mm_blendv_epi8(p, vmax, _mm_cmpgt_epi64(p, vmax));
+	return _mm_blendv_epi8(p, vmin, _mm_cmpgt_epi64(vmin, p));
+}
+
+/**
+ * \brief Multiplies 4 samples by their gains.
+ * \param[in] x Input samples.
+ * \param[in] vol Gains.
+ * \param[in] shift Amount of right shifts.
+ * \param[in] max Maximum output value.
+ * \return Output samples.
+ */
+static inline __m128i vol_simd_mult(__m128i x, __m128i vol, const int shift,
+				    const int64_t max)
+{
+	__m128i even = _mm_mul_epi32(x, vol);
+	__m128i odd = _mm_mul_epi32(_mm_srli_epi64(x, 32),
+				    _mm_srli_epi64(vol, 32));
+
+	even = vol_simd_round_sat(even, shift, max);
+	odd = vol_simd_round_sat(odd, shift, max);
+
+	return _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xcc);
+}
+
+#include "volume_simd.h"
+
+#endif
@@ -36,6 +36,7 @@
 #include <sof/string.h>
 #include <stdint.h>
 #include <sof/bit.h>
+#include <sof/list.h>
 #include <sof/platform.h>
 #include <platform/platform.h>
 #include <arch/spinlock.h>
@@ -57,6 +58,9 @@ struct sof;
  * 4) System Runtime Zone. Heap zone intended for runtime objects allocated
  * by the kernel part of the code.
  *
+ * Runtime zone allocations made while topology IPC creates objects for a
+ * pipeline are packed into a per pipeline arena, see alloc_arena_enter().
+ *
  * See platform/memory.h for heap size configuration and mappings.
  */
 
@@ -80,23 +84,47 @@ struct mm_info {
 	uint32_t free;
 };
 
+/* requested size histogram buckets, powers of two from 32 bytes up */
+#define MM_SIZE_BUCKETS		8
+
+/* heap statistics, always collected */
+struct mm_stats {
+	uint32_t peak_used;	/* most bytes used at once */
+	uint32_t failures;	/* failed allocations */
+	uint32_t sizes[MM_SIZE_BUCKETS];	/* requested size histogram */
+};
+
 struct block_hdr {
 	uint16_t size;		/* size in blocks for continuous allocation */
 	uint16_t used;		/* usage flags for page */
 } __attribute__ ((packed));
 
+/* block header usage flags, the headers after the first block of a
+ * pipeline arena chunk hold the distance to its first block in size
+ */
+#define BLOCK_USED		(1 << 0)	/* first block of allocation */
+#define BLOCK_USED_ARENA	(1 << 1)	/* block of an arena chunk */
+
 struct block_map {
 	uint16_t block_size;	/* size of block in bytes */
 	uint16_t count;		/* number of blocks in map */
 	uint16_t free_count;	/* number of free blocks */
 	uint16_t first_free;	/* index of first free block */
+	uint16_t peak_used;	/* most blocks used at once */
+	uint16_t failures;	/* requests that found the map full */
 	struct block_hdr *block;	/* base block header */
+	uint32_t *used_mask;	/* one bit per block, set when in use */
 	uint32_t base;		/* base address of space */
 } __attribute__ ((__aligned__(PLATFORM_DCACHE_ALIGN)));
 
+/* number of 32 bit words in the used mask of a map with cnt blocks */
+#define BLOCK_MASK_WORDS(cnt)	(((cnt) + 31) / 32)
+
+/* the used mask storage is a static compound literal per map */
 #define BLOCK_DEF(sz, cnt, hdr) \
 	{.block_size = sz, .count = cnt, .free_count = cnt, .block = hdr, \
-	 .first_free = 0}
+	 .first_free = 0, \
+	 .used_mask = (uint32_t [BLOCK_MASK_WORDS(cnt)]) { 0 } }
 
 struct mm_heap {
 	uint32_t blocks;
@@ -105,8 +133,25 @@ struct mm_heap {
 	uint32_t size;
 	uint32_t caps;
 	struct mm_info info;
+	struct mm_stats stats;
 } __attribute__ ((__aligned__(PLATFORM_DCACHE_ALIGN)));
 
+/* chunk of a pipeline arena, allocated from the buffer heap */
+struct mm_arena_chunk {
+	struct mm_arena_chunk *next;	/* next older chunk */
+	struct mm_arena *arena;	/* arena of the chunk */
+	uint32_t size;		/* chunk size in bytes including header */
+	uint32_t used;		/* bytes handed out including header */
+};
+
+/* pipeline arena - released at once when its last allocation is freed */
+struct mm_arena {
+	uint32_t pipeline_id;
+	uint32_t refs;		/* allocations not freed yet */
+	struct mm_arena_chunk *chunk;	/* newest chunk */
+	struct list_item list;	/* in mm arena list */
+};
+
 /* heap block memory map */
 struct mm {
 	/* system heap - used during init cannot be freed */
@@ -120,6 +165,13 @@ struct mm {
 
 	struct mm_info total;
 	uint32_t heap_trace_updated;	/* updates that can be presented */
+
+	/* pipeline arenas */
+	struct list_item arena_list;
+	uint32_t arena_pipeline_id;	/* pipeline of the open arena window */
+	int arena_core;		/* core of the open window or -1 if closed */
+	uint32_t arena_level;	/* interrupt level of the window opener */
+
 	spinlock_t lock;	/* all allocs and frees are atomic */
 } __attribute__ ((__aligned__(PLATFORM_DCACHE_ALIGN)));
 
@@ -184,6 +236,15 @@ void alloc_trace_buffer_heap(int zone, uint32_t caps, size_t bytes);
 /* system heap allocation for specific core */
 void *rzalloc_core_sys(int core, size_t bytes);
 
+/* heap statistics for the debug IPC */
+struct sof_ipc_heap_stats;
+int heap_get_stats(uint32_t type, uint32_t index,
+		   struct sof_ipc_heap_stats *stats, uint32_t flags);
+
+/* route runtime zone allocations on this core to the pipeline arena */
+void alloc_arena_enter(uint32_t pipeline_id);
+void alloc_arena_exit(void);
+
 /* utility */
 #define bzero(ptr, size) \
 	arch_bzero(ptr, size)
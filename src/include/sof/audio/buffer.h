@@ -243,4 +243,60 @@ static inline void *buffer_get_frag(struct comp_buffer *buffer, void *ptr,
 	return current;
 }
 
+/* linear segments of a circular buffer region, the second segment is only
+ * used when the region wraps and has zero size otherwise
+ */
+struct buffer_segments {
+	void *ptr[2];		/* segment start addresses */
+	uint32_t bytes[2];	/* segment sizes in bytes */
+};
+
+#define buffer_read_segments(buffer, bytes, seg) \
+	buffer_get_segments(buffer, buffer->r_ptr, bytes, seg)
+
+#define buffer_write_segments(buffer, bytes, seg) \
+	buffer_get_segments(buffer, buffer->w_ptr, bytes, seg)
+
+/* get the number of bytes that can be accessed from ptr before wrap */
+static inline uint32_t buffer_bytes_without_wrap(struct comp_buffer *buffer,
+						 void *ptr)
+{
+	return buffer->end_addr - ptr;
+}
+
+/* get the number of ptr advances of stride bytes until ptr needs to wrap */
+static inline uint32_t buffer_steps_without_wrap(struct comp_buffer *buffer,
+						 void *ptr, uint32_t stride)
+{
+	return (buffer_bytes_without_wrap(buffer, ptr) + stride - 1) / stride;
+}
+
+/* wrap a pointer that has been advanced past the buffer end */
+static inline void *buffer_wrap(struct comp_buffer *buffer, void *ptr)
+{
+	if (ptr >= buffer->end_addr)
+		ptr = buffer->addr + (ptr - buffer->end_addr);
+
+	return ptr;
+}
+
+/* split bytes starting at ptr into the linear parts before and after wrap */
+static inline void buffer_get_segments(struct comp_buffer *buffer, void *ptr,
+				       uint32_t bytes,
+				       struct buffer_segments *seg)
+{
+	uint32_t head = buffer_bytes_without_wrap(buffer, ptr);
+
+	seg->ptr[0] = ptr;
+	seg->ptr[1] = buffer->addr;
+
+	if (bytes > head) {
+		seg->bytes[0] = head;
+		seg->bytes[1] = bytes - head;
+	} else {
+		seg->bytes[0] = bytes;
+		seg->bytes[1] = 0;
+	}
+}
+
 #endif
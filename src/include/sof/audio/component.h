@@ -51,6 +51,7 @@
 #include <sof/audio/pipeline.h>
 #include <sof/cache.h>
 #include <sof/math/numbers.h>
+#include <sof/perf.h>
 #include <uapi/ipc/control.h>
 #include <uapi/ipc/stream.h>
 #include <uapi/ipc/topology.h>
@@ -264,6 +265,11 @@ struct comp_dev {
 	/* private data - core does not touch this */
 	void *private;		/**< private data */
 
+#if CONFIG_COMP_PERF
+	struct perf_cnt_data perf_copy;	/**< copy execution time */
+	uint64_t perf_bytes;		/**< bytes produced to sinks */
+#endif
+
 	/**
 	 * IPC config object header - MUST be at end as it's
 	 * variable size/type
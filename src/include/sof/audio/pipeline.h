@@ -33,6 +33,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include <sof/atomic.h>
 #include <sof/lock.h>
 #include <sof/list.h>
 #include <sof/stream.h>
@@ -40,6 +41,7 @@
 #include <sof/audio/component.h>
 #include <sof/trace.h>
 #include <sof/schedule.h>
+#include <sof/perf.h>
 #include <uapi/ipc/topology.h>
 
 /*
@@ -88,6 +90,26 @@ struct ipc;
 #define PPL_DIR_DOWNSTREAM	0
 #define PPL_DIR_UPSTREAM	1
 
+/* component in the flattened copy walk of a pipeline */
+struct pipeline_copy_entry {
+	struct comp_dev *comp;
+	uint32_t span;		/* entries of comp and the comps it feeds */
+	bool run;		/* upstream walk, comp is copied this period */
+};
+
+/* Copy walk of a pipeline flattened into execution order. Downstream walks
+ * are stored in pre-order and upstream walks in post-order, so the comps a
+ * comp leads to are always the span - 1 entries after or before it.
+ */
+struct pipeline_copy_list {
+	struct pipeline_copy_entry *entry;
+	uint32_t count;			/* entries in use */
+	uint32_t size;			/* entries allocated */
+	struct comp_dev *start;		/* first comp of the walk */
+	uint32_t dir;			/* walk direction */
+	int32_t graph_gen;		/* pipeline graph_gen of the walk */
+};
+
 /*
  * Audio pipeline.
  */
@@ -105,9 +127,17 @@ struct pipeline {
 	struct comp_dev *sched_comp;	/* component that drives scheduling in this pipe */
 	struct comp_dev *source_comp;	/* source component for this pipe */
 	struct comp_dev *sink_comp;	/* sink component for this pipe */
+	struct pipeline_copy_list copy_list; /* flattened copy walk */
+	atomic_t graph_gen;		/* bumped when the copy walk changes */
 
 	/* position update */
 	uint32_t posn_offset;		/* position update array offset*/
+
+#if CONFIG_COMP_PERF
+	struct perf_cnt_data perf_period;	/* copy time of periods */
+	uint32_t perf_overruns;		/* periods longer than budget */
+	uint32_t perf_budget;		/* period budget in timer ticks */
+#endif
 };
 
 /* static pipeline */
@@ -165,6 +195,9 @@ void pipeline_cache(struct pipeline *p, struct comp_dev *dev, int cmd);
 /* trigger pipeline - atomic */
 int pipeline_trigger(struct pipeline *p, struct comp_dev *host_cd, int cmd);
 
+/* rebuild the flattened copy walk after a graph change - not atomic */
+void pipeline_copy_list_update(struct pipeline *p);
+
 /* static pipeline creation */
 int init_static_pipeline(struct ipc *ipc);
 
@@ -52,9 +52,47 @@ struct dma_trace_buf {
 	uint32_t avail;		/* avail bytes in buffer */
 };
 
+/* per core event ring size in bytes, must be a power of 2 */
+#define DMA_TRACE_RING_SIZE	(DMA_TRACE_LOCAL_SIZE / 2)
+
+/*
+ * Per core event ring. Each core is the only producer of its own ring and
+ * trace_work() on the master core is the only consumer, so no lock is
+ * shared between cores. Positions are free running byte counts and every
+ * event is stored as its length in bytes followed by the event itself.
+ */
+struct dma_trace_ring {
+	uint32_t *addr;		/* uncached ring base address */
+	uint32_t reserve;	/* end of space handed out to producers */
+	uint32_t commit;	/* end of events visible to the consumer */
+	uint32_t nest;		/* producers between reserve and commit */
+	uint32_t read;		/* consumer position */
+	uint32_t dropped;	/* events dropped because the ring was full */
+	uint32_t dropped_logged; /* dropped events already reported */
+};
+
+/* largest compact event body, the index, both ids and all params */
+#define DTRACE_COMPACT_BODY_MAX		32
+
+/* body size in the compact event flags */
+#define DTRACE_COMPACT_SIZE_SHIFT	8
+
+/*
+ * Compact event as queued in the core rings, with the timestamp where
+ * log_entry_header has it. trace_work() turns the timestamp and flags
+ * into the record head when sending it to the host.
+ */
+struct dtrace_compact_event {
+	uint32_t flags;		/* TRACE_COMPACT_* flags, core and body size */
+	uint32_t timestamp_lo;
+	uint32_t timestamp_hi;
+	uint8_t body[DTRACE_COMPACT_BODY_MAX];
+};
+
 struct dma_trace_data {
 	struct dma_sg_config config;
 	struct dma_trace_buf dmatb;
+	struct dma_trace_ring ring[PLATFORM_CORE_COUNT];
 	struct dma_copy dc;
 	uint32_t old_host_offset;
 	uint32_t host_offset;
@@ -65,7 +103,10 @@ struct dma_trace_data {
 	uint32_t enabled;
 	uint32_t copy_in_progress;
 	uint32_t stream_tag;
-	spinlock_t lock; /* dma trace lock */
+#if CONFIG_TRACE_COMPACT
+	uint64_t compact_timestamp; /* timestamp of the last record sent */
+	uint32_t compact_sync; /* next record carries an absolute timestamp */
+#endif
 };
 
 int dma_trace_init_early(struct sof *sof);
@@ -79,9 +120,31 @@ void dma_trace_flush(void *t);
 void dtrace_event(const char *e, uint32_t size);
 void dtrace_event_atomic(const char *e, uint32_t length);
 
-static inline uint32_t dtrace_calc_buf_margin(struct dma_trace_buf *buffer)
+/* store value as unsigned LEB128, returns the number of bytes used */
+static inline uint32_t dtrace_varint_put(uint8_t *dst, uint32_t value)
 {
-	return buffer->end_addr - buffer->w_ptr;
+	uint32_t i = 0;
+
+	while (value >= 0x80) {
+		dst[i++] = value | 0x80;
+		value >>= 7;
+	}
+	dst[i++] = value;
+
+	return i;
+}
+
+static inline uint32_t dtrace_varint_put64(uint8_t *dst, uint64_t value)
+{
+	uint32_t i = 0;
+
+	while (value >= 0x80) {
+		dst[i++] = value | 0x80;
+		value >>= 7;
+	}
+	dst[i++] = value;
+
+	return i;
 }
 
 #endif
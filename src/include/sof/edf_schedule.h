@@ -63,6 +63,7 @@ struct sof;
 
 struct edf_task_pdata {
 	uint64_t deadline;
+	uint32_t queue_idx;	/* slot in the ready queue heap */
 };
 
 extern struct scheduler_ops schedule_edf_ops;
@@ -55,6 +55,10 @@ struct dai_config;
 
 #define MSG_QUEUE_SIZE		12
 
+/* component id hash buckets, must be a power of 2 */
+#define IPC_COMP_HASH_SIZE	64
+#define IPC_COMP_HASH(id)	((id) & (IPC_COMP_HASH_SIZE - 1))
+
 #define COMP_TYPE_COMPONENT	1
 #define COMP_TYPE_BUFFER	2
 #define COMP_TYPE_PIPELINE	3
@@ -72,6 +76,7 @@ struct dai_config;
 struct ipc_comp_dev {
 	uint16_t type;	/* COMP_TYPE_ */
 	uint16_t state;
+	uint32_t id;	/* host component, buffer or pipeline ID */
 
 	/* component type data */
 	union {
@@ -82,6 +87,7 @@ struct ipc_comp_dev {
 
 	/* lists */
 	struct list_item list;		/* list in components */
+	struct ipc_comp_dev *hash_next;	/* next in ID hash bucket */
 };
 
 struct ipc_msg {
@@ -103,6 +109,9 @@ struct ipc_shared_context {
 	struct ipc_msg message[MSG_QUEUE_SIZE];
 
 	struct list_item comp_list;	/* list of component devices */
+
+	/* component devices indexed by ID */
+	struct ipc_comp_dev *comp_hash[IPC_COMP_HASH_SIZE];
 };
 
 struct ipc {
@@ -188,6 +197,12 @@ int ipc_pipeline_complete(struct ipc *ipc, uint32_t comp_id);
 int ipc_comp_connect(struct ipc *ipc,
 	struct sof_ipc_pipe_comp_connect *connect);
 
+/*
+ * Topology batch, runs count commands packed back to back in cmds.
+ */
+int ipc_tplg_batch(struct ipc *ipc, const void *cmds, uint32_t size,
+		   uint32_t count, uint32_t *done);
+
 /*
  * Get component by ID.
  */
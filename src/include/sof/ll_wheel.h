@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * Timer wheel of the low latency scheduler. Tasks are hashed into slots by
+ * their start time, so a tick only looks at the slots inside the pending
+ * window instead of at every queued task.
+ */
+
+#ifndef __INCLUDE_SOF_LL_WHEEL_H__
+#define __INCLUDE_SOF_LL_WHEEL_H__
+
+#include <stdint.h>
+#include <sof/list.h>
+#include <sof/schedule.h>
+
+/* number of wheel slots, must be a power of two */
+#define LL_WHEEL_SLOTS		64
+
+/* slots covered by the pending window, sets the slot width */
+#define LL_WHEEL_WINDOW_SLOTS	2
+
+struct ll_wheel {
+	struct list_item slots[LL_WHEEL_SLOTS];	/* tasks hashed by start */
+	struct list_item pending[SOF_TASK_PRI_COUNT]; /* due tasks */
+	uint64_t window;	/* pending window in ticks */
+	uint32_t shift;		/* log2 of the slot width in ticks */
+	uint32_t pending_mask;	/* priorities that may have pending tasks */
+};
+
+void ll_wheel_init(struct ll_wheel *wheel, uint64_t window);
+void ll_wheel_set_window(struct ll_wheel *wheel, uint64_t window);
+void ll_wheel_insert(struct ll_wheel *wheel, struct task *task);
+int ll_wheel_collect(struct ll_wheel *wheel, uint64_t current);
+struct task *ll_wheel_next_pending(struct ll_wheel *wheel);
+
+/* is task on the wheel or pending ? task->list must have been initialised */
+static inline int ll_wheel_contains(struct task *task)
+{
+	return !list_is_empty(&task->list);
+}
+
+/* take task off the wheel or the pending lists */
+static inline void ll_wheel_remove(struct task *task)
+{
+	list_item_del(&task->list);
+}
+
+#endif /* __INCLUDE_SOF_LL_WHEEL_H__ */
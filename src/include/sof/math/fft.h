@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FFT_H
+#define FFT_H
+
+#include <stdint.h>
+#include <sof/audio/format.h>
+#include <sof/math/numbers.h>
+
+/* The radix-4 stages have a generic C version unless x86 SIMD versions
+ * are built for the optimized host library modules.
+ */
+#define FFT_GENERIC
+
+#if defined(__SSE4_2__) || defined(__AVX2__)
+#undef FFT_GENERIC
+#endif
+
+#define FFT_SIZE_MIN	4
+#define FFT_SIZE_MAX	8192
+
+/* Complex number with Q1.15 real and imaginary parts */
+struct icomplex16 {
+	int16_t real;
+	int16_t imag;
+};
+
+/* Complex number with Q1.31 real and imaginary parts */
+struct icomplex32 {
+	int32_t real;
+	int32_t imag;
+};
+
+/* Plan of complex and real FFTs for a power of two size */
+struct fft_plan {
+	uint32_t size; /* Number of points */
+	uint32_t len; /* Size as log2(size) */
+	struct icomplex32 *twiddle; /* exp(-j*2*pi*k/size), k < size / 2 */
+	struct icomplex16 *twiddle16; /* Same as twiddle in Q1.15 */
+};
+
+/* Allocate and initialize a plan, size must be a power of two between
+ * FFT_SIZE_MIN and FFT_SIZE_MAX. Returns NULL on error.
+ */
+struct fft_plan *fft_plan_new(uint32_t size);
+
+void fft_plan_free(struct fft_plan *plan);
+
+/* In-place FFT of data[plan->size]. The inverse transform is computed when
+ * ifft is non-zero. With scale set the result of every radix-2 stage is
+ * halved so the output is the transform divided by size and can't
+ * overflow for inputs with magnitude up to one. Larger inputs are limited
+ * in the stages. Without scale the stages saturate on overflow.
+ */
+void fft_execute_32(struct fft_plan *plan, struct icomplex32 *data, int ifft,
+		    int scale);
+
+void fft_execute_16(struct fft_plan *plan, struct icomplex16 *data, int ifft,
+		    int scale);
+
+/* In-place FFT of plan->size real samples. The data has plan->size / 2 + 1
+ * elements. The forward transform takes the samples packed as pairs to
+ * the real and imaginary parts of the first plan->size / 2 elements and
+ * returns the bins from DC to Nyquist, the rest of the spectrum is the
+ * conjugate of these. The inverse transform does the opposite. The
+ * scaling is the same as with the complex FFT.
+ */
+void fft_real_execute_32(struct fft_plan *plan, struct icomplex32 *data,
+			 int ifft, int scale);
+
+void fft_real_execute_16(struct fft_plan *plan, struct icomplex16 *data,
+			 int ifft, int scale);
+
+/* Radix-4 decimation in time stage of a n-point FFT that combines the
+ * radix-2 stages for spans of 2 * h and 4 * h points. The twiddle for
+ * exp(-j*2*pi*k/(4*h)) is twiddle[k * step].
+ */
+void fft_radix4_32(struct icomplex32 *data, const struct icomplex32 *twiddle,
+		   uint32_t n, uint32_t h, uint32_t step, int ifft, int scale);
+
+/* Complex multiply of x and w rounded to Q1.31, with conjugated w for
+ * inverse transform. The result can exceed Q1.31 range.
+ */
+static inline void fft_cmul_32(int64_t *re, int64_t *im, int64_t xr,
+			       int64_t xi, const struct icomplex32 *w,
+			       int ifft)
+{
+	int64_t rr = xr * w->real;
+	int64_t ii = xi * w->imag;
+	int64_t ri = xr * w->imag;
+	int64_t ir = xi * w->real;
+
+	/* Rounding as (x + 2^30) >> 31 is the same as Q_SHIFT_RND() */
+	if (ifft) {
+		*re = (rr + ii + (1LL << 30)) >> 31;
+		*im = (ir - ri + (1LL << 30)) >> 31;
+	} else {
+		*re = (rr - ii + (1LL << 30)) >> 31;
+		*im = (ir + ri + (1LL << 30)) >> 31;
+	}
+}
+
+#define FFT_HALF_MAX	(1 << 30)
+
+/* Half of complex multiply of x and w rounded to Q1.31. The result is
+ * limited to +/- 0.5 that is only reached with inputs of magnitude over
+ * one. The high word of the Q2.62 product is the half in Q1.31.
+ */
+static inline void fft_cmul_half_32(int32_t *re, int32_t *im, int64_t xr,
+				    int64_t xi, const struct icomplex32 *w,
+				    int ifft)
+{
+	int64_t rr = xr * w->real;
+	int64_t ii = xi * w->imag;
+	int64_t ri = xr * w->imag;
+	int64_t ir = xi * w->real;
+	int64_t tr;
+	int64_t ti;
+
+	if (ifft) {
+		tr = (rr + ii + (1LL << 31)) >> 32;
+		ti = (ir - ri + (1LL << 31)) >> 32;
+	} else {
+		tr = (rr - ii + (1LL << 31)) >> 32;
+		ti = (ir + ri + (1LL << 31)) >> 32;
+	}
+
+	*re = MAX(MIN(tr, FFT_HALF_MAX), -FFT_HALF_MAX);
+	*im = MAX(MIN(ti, FFT_HALF_MAX), -FFT_HALF_MAX);
+}
+
+/* Radix-4 butterfly for data[0], data[h], data[2 * h] and data[3 * h],
+ * it is two radix-2 stages with twiddles w2 and w1. The -j rotation of
+ * the second half of the second stage is exact. The results saturate.
+ */
+static inline void fft_butterfly4_32(struct icomplex32 *data, uint32_t h,
+				     const struct icomplex32 *w1,
+				     const struct icomplex32 *w2, int ifft)
+{
+	struct icomplex32 *a = data;
+	struct icomplex32 *b = data + h;
+	struct icomplex32 *c = data + 2 * h;
+	struct icomplex32 *d = data + 3 * h;
+	int64_t tr;
+	int64_t ti;
+	int32_t a1r;
+	int32_t a1i;
+	int32_t b1r;
+	int32_t b1i;
+	int32_t c1r;
+	int32_t c1i;
+	int32_t d1r;
+	int32_t d1i;
+
+	/* First stage */
+	fft_cmul_32(&tr, &ti, b->real, b->imag, w2, ifft);
+	a1r = sat_int32(a->real + tr);
+	a1i = sat_int32(a->imag + ti);
+	b1r = sat_int32(a->real - tr);
+	b1i = sat_int32(a->imag - ti);
+	fft_cmul_32(&tr, &ti, d->real, d->imag, w2, ifft);
+	c1r = sat_int32(c->real + tr);
+	c1i = sat_int32(c->imag + ti);
+	d1r = sat_int32(c->real - tr);
+	d1i = sat_int32(c->imag - ti);
+
+	/* Second stage */
+	fft_cmul_32(&tr, &ti, c1r, c1i, w1, ifft);
+	a->real = sat_int32(a1r + tr);
+	a->imag = sat_int32(a1i + ti);
+	c->real = sat_int32(a1r - tr);
+	c->imag = sat_int32(a1i - ti);
+	fft_cmul_32(&tr, &ti, d1r, d1i, w1, ifft);
+	if (ifft) {
+		/* Multiply by +j */
+		b->real = sat_int32(b1r - ti);
+		b->imag = sat_int32(b1i + tr);
+		d->real = sat_int32(b1r + ti);
+		d->imag = sat_int32(b1i - tr);
+	} else {
+		/* Multiply by -j */
+		b->real = sat_int32(b1r + ti);
+		b->imag = sat_int32(b1i - tr);
+		d->real = sat_int32(b1r - ti);
+		d->imag = sat_int32(b1i + tr);
+	}
+}
+
+/* Radix-4 butterfly with halving of the result of both radix-2 stages.
+ * The halved input plus or minus the halved product can't overflow.
+ */
+static inline void fft_butterfly4_scaled_32(struct icomplex32 *data,
+					    uint32_t h,
+					    const struct icomplex32 *w1,
+					    const struct icomplex32 *w2,
+					    int ifft)
+{
+	struct icomplex32 *a = data;
+	struct icomplex32 *b = data + h;
+	struct icomplex32 *c = data + 2 * h;
+	struct icomplex32 *d = data + 3 * h;
+	int32_t tr;
+	int32_t ti;
+	int32_t a1r;
+	int32_t a1i;
+	int32_t b1r;
+	int32_t b1i;
+	int32_t c1r;
+	int32_t c1i;
+	int32_t d1r;
+	int32_t d1i;
+
+	/* First stage */
+	fft_cmul_half_32(&tr, &ti, b->real, b->imag, w2, ifft);
+	a1r = (a->real >> 1) + tr;
+	a1i = (a->imag >> 1) + ti;
+	b1r = (a->real >> 1) - tr;
+	b1i = (a->imag >> 1) - ti;
+	fft_cmul_half_32(&tr, &ti, d->real, d->imag, w2, ifft);
+	c1r = (c->real >> 1) + tr;
+	c1i = (c->imag >> 1) + ti;
+	d1r = (c->real >> 1) - tr;
+	d1i = (c->imag >> 1) - ti;
+
+	/* Second stage */
+	fft_cmul_half_32(&tr, &ti, c1r, c1i, w1, ifft);
+	a->real = (a1r >> 1) + tr;
+	a->imag = (a1i >> 1) + ti;
+	c->real = (a1r >> 1) - tr;
+	c->imag = (a1i >> 1) - ti;
+	fft_cmul_half_32(&tr, &ti, d1r, d1i, w1, ifft);
+	if (ifft) {
+		b->real = (b1r >> 1) - ti;
+		b->imag = (b1i >> 1) + tr;
+		d->real = (b1r >> 1) + ti;
+		d->imag = (b1i >> 1) - tr;
+	} else {
+		b->real = (b1r >> 1) + ti;
+		b->imag = (b1i >> 1) - tr;
+		d->real = (b1r >> 1) - ti;
+		d->imag = (b1i >> 1) + tr;
+	}
+}
+
+#endif
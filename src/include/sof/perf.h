@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ * Execution time counters for components and pipelines.
+ */
+
+#ifndef __INCLUDE_PERF__
+#define __INCLUDE_PERF__
+
+#include <stdint.h>
+#include <config.h>
+
+#if CONFIG_COMP_PERF
+
+#if CONFIG_LIBRARY
+#include <time.h>
+#else
+#include <sof/clk.h>
+#include <sof/drivers/timer.h>
+#include <platform/platform.h>
+#endif
+
+/* execution time statistics in timer ticks */
+struct perf_cnt_data {
+	uint32_t count;		/* number of measurements */
+	uint32_t min;		/* shortest execution */
+	uint32_t max;		/* longest execution */
+	uint64_t total;		/* sum of all executions */
+};
+
+#if CONFIG_LIBRARY
+
+/* library builds count nanoseconds of the monotonic clock */
+static inline uint64_t perf_cnt_get_ticks(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static inline uint64_t perf_cnt_us_to_ticks(uint32_t us)
+{
+	return (uint64_t)us * 1000;
+}
+
+#else
+
+static inline uint64_t perf_cnt_get_ticks(void)
+{
+	return platform_timer_get(platform_timer);
+}
+
+static inline uint64_t perf_cnt_us_to_ticks(uint32_t us)
+{
+	return clock_ms_to_ticks(PLATFORM_DEFAULT_CLOCK, 1) * us / 1000;
+}
+
+#endif
+
+static inline void perf_cnt_reset(struct perf_cnt_data *pcd)
+{
+	pcd->count = 0;
+	pcd->min = 0;
+	pcd->max = 0;
+	pcd->total = 0;
+}
+
+/* add execution of ticks, longer ones are saturated to 32 bits */
+static inline void perf_cnt_add(struct perf_cnt_data *pcd, uint64_t ticks)
+{
+	uint32_t t = ticks > UINT32_MAX ? UINT32_MAX : ticks;
+
+	if (!pcd->count || t < pcd->min)
+		pcd->min = t;
+	if (t > pcd->max)
+		pcd->max = t;
+
+	pcd->total += t;
+	pcd->count++;
+}
+
+static inline uint32_t perf_cnt_avg(struct perf_cnt_data *pcd)
+{
+	return pcd->count ? pcd->total / pcd->count : 0;
+}
+
+#endif /* CONFIG_COMP_PERF */
+
+#endif
@@ -40,7 +40,9 @@
 #include <sof/debug.h>
 #include <sof/timer.h>
 #include <sof/preproc.h>
+#include <sof/platform.h>
 #include <platform/platform.h>
+#include <platform/memory.h>
 #include <platform/timer.h>
 #include <uapi/user/trace.h>
 
@@ -115,6 +117,12 @@
 #define TRACE_CLASS_SCHEDULE_LL	(31 << 24)
 #define TRACE_CLASS_SOUNDWIRE	(32 << 24)
 #define TRACE_CLASS_KEYWORD	(33 << 24)
+#define TRACE_CLASS_PROFILER	(34 << 24)
+
+/* runtime trace levels are kept per class, indexed by the high 8 bits */
+#define TRACE_CLASS_COUNT	64
+#define TRACE_CLASS_INDEX(class) \
+	(((class) >> 24) & (TRACE_CLASS_COUNT - 1))
 
 #ifdef CONFIG_LIBRARY
 extern int test_bench_trace;
@@ -210,6 +218,31 @@ void trace_flush(void);
 void trace_off(void);
 void trace_init(struct sof *sof);
 
+struct sof_ipc_trace_filter_elem;
+
+/*
+ * Runtime trace levels, a trace is sent if its level is not above the gate
+ * of its class. If the class has pipeline or component levels the ids are
+ * then checked by trace_filter_pass(). The levels are always accessed by
+ * the uncached alias, so updates are seen by all cores at once.
+ */
+struct trace_levels {
+	uint8_t gate[TRACE_CLASS_COUNT];	/* highest level sent */
+	uint8_t filtered[TRACE_CLASS_COUNT];	/* has id levels */
+} __attribute__ ((
+	__aligned__(PLATFORM_DCACHE_ALIGN)));	/* own cache lines */
+
+extern struct trace_levels trace_levels;
+
+/* levels are updated by the master core, every core reads them uncached */
+#define trace_levels_get() \
+	((struct trace_levels *)cache_to_uncache(&trace_levels))
+
+int trace_filter_pass(uint32_t index, uint32_t level, uint32_t id_0,
+		      uint32_t id_1);
+int trace_filter_update(const struct sof_ipc_trace_filter_elem *elems,
+			uint32_t count);
+
 #if CONFIG_TRACE
 /*
  * trace_event macro definition
@@ -262,13 +295,29 @@ void trace_init(struct sof *sof);
 
 /* verbose tracing */
 #if CONFIG_TRACEV
-#define tracev_event(...) trace_event(__VA_ARGS__)
-#define tracev_event_with_ids(...) trace_event_with_ids(__VA_ARGS__)
-#define tracev_event_atomic(...) trace_event_atomic(__VA_ARGS__)
-#define tracev_event_atomic_with_ids(...) trace_event_atomic_with_ids(__VA_ARGS__)
+#define tracev_event(class, format, ...) \
+	_tracev_event_with_ids(class, -1, -1, 0, format, ##__VA_ARGS__)
+#define tracev_event_atomic(class, format, ...) \
+	_tracev_event_atomic_with_ids(class, -1, -1, 0, format, ##__VA_ARGS__)
+
+#define tracev_event_with_ids(class, id_0, id_1, format, ...)	\
+	_tracev_event_with_ids(class, id_0, id_1, 1, format, ##__VA_ARGS__)
+#define tracev_event_atomic_with_ids(class, id_0, id_1, format, ...)	\
+	_tracev_event_atomic_with_ids(class, id_0, id_1, 1, format,	\
+				      ##__VA_ARGS__)
+
+/* no _atomic postfix for the function name */
+#define __nonatomic
+#define _tracev_event_with_ids(class, id_0, id_1, has_ids, format, ...)	\
+	_log_message(__mbox, __nonatomic, LOG_LEVEL_DEBUG, class, id_0,	\
+		     id_1, has_ids, format, ##__VA_ARGS__)
+#define _tracev_event_atomic_with_ids(class, id_0, id_1, has_ids, format, \
+				      ...)				  \
+	_log_message(__mbox, _atomic, LOG_LEVEL_DEBUG, class, id_0, id_1, \
+		     has_ids, format, ##__VA_ARGS__)
 
-#define tracev_value(x)	trace_value(x)
-#define tracev_value_atomic(x)	trace_value_atomic(x)
+#define tracev_value(x)	tracev_event(0, "value %u", x)
+#define tracev_value_atomic(x)	tracev_event_atomic(0, "value %u", x)
 #else
 #define tracev_event(...)
 #define tracev_event_with_ids(...)
@@ -343,12 +392,24 @@ _thrown_from_macro_BASE_LOG_in_trace_h
 			((uint32_t)entry, id_0, id_1, ##__VA_ARGS__);	\
 }
 
+/* errors are always sent, other traces by their runtime level */
+#define _trace_level_pass(lvl, comp_class, id_0, id_1)			\
+	((lvl) <= LOG_LEVEL_CRITICAL ||					\
+	 ((lvl) <= trace_levels_get()->					\
+		gate[TRACE_CLASS_INDEX(comp_class)] &&			\
+	  (!trace_levels_get()->					\
+		filtered[TRACE_CLASS_INDEX(comp_class)] ||		\
+	   trace_filter_pass(TRACE_CLASS_INDEX(comp_class), lvl,	\
+			     id_0, id_1))))
+
 #define __log_message(func_name, lvl, comp_class, id_0, id_1, has_ids,	\
 		      format, ...)					\
 do {									\
 	_DECLARE_LOG_ENTRY(lvl, format, comp_class,			\
 			   PP_NARG(__VA_ARGS__), has_ids);		\
-	BASE_LOG(func_name, id_0, id_1, &log_entry, ##__VA_ARGS__)	\
+	if (_trace_level_pass(lvl, comp_class, id_0, id_1))		\
+		BASE_LOG(func_name, id_0, id_1, &log_entry,		\
+			 ##__VA_ARGS__)					\
 } while (0)
 
 #define _log_message(mbox, atomic, level, comp_class, id_0, id_1,	\
@@ -110,6 +110,7 @@
 #define SOF_IPC_TPLG_PIPE_COMPLETE		SOF_CMD_TYPE(0x013)
 #define SOF_IPC_TPLG_BUFFER_NEW			SOF_CMD_TYPE(0x020)
 #define SOF_IPC_TPLG_BUFFER_FREE		SOF_CMD_TYPE(0x021)
+#define SOF_IPC_TPLG_BATCH			SOF_CMD_TYPE(0x030)
 
 /** @} */
 
@@ -170,6 +171,9 @@
 #define SOF_IPC_TRACE_DMA_PARAMS		SOF_CMD_TYPE(0x001)
 #define SOF_IPC_TRACE_DMA_POSITION		SOF_CMD_TYPE(0x002)
 #define SOF_IPC_TRACE_DMA_PARAMS_EXT		SOF_CMD_TYPE(0x003)
+#define SOF_IPC_TRACE_COMP_PERF			SOF_CMD_TYPE(0x004)
+#define SOF_IPC_TRACE_HEAP_STATS		SOF_CMD_TYPE(0x005)
+#define SOF_IPC_TRACE_FILTER_UPDATE		SOF_CMD_TYPE(0x006)
 
 /** @} */
 
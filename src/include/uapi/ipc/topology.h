@@ -267,4 +267,29 @@ struct sof_ipc_pipe_comp_connect {
 	uint32_t sink_id;
 } __attribute__((packed));
 
+/*
+ * Batch of topology commands - SOF_IPC_TPLG_BATCH
+ *
+ * The batch header is followed in the hostbox by payload_size bytes of
+ * packed SOF_IPC_TPLG_COMP_NEW, SOF_IPC_TPLG_BUFFER_NEW,
+ * SOF_IPC_TPLG_PIPE_NEW, SOF_IPC_TPLG_COMP_CONNECT and
+ * SOF_IPC_TPLG_PIPE_COMPLETE commands, each one starting with its own
+ * command header. Commands are run in order until the first failure and
+ * a single reply is sent for the whole batch.
+ */
+struct sof_ipc_tplg_batch {
+	struct sof_ipc_cmd_hdr hdr;
+	uint32_t count;		/**< number of commands in the batch */
+	uint32_t payload_size;	/**< bytes of commands after this header */
+
+	/* reserved for future use */
+	uint32_t reserved[2];
+} __attribute__((packed));
+
+struct sof_ipc_tplg_batch_reply {
+	struct sof_ipc_reply rhdr;
+	uint32_t count;		/**< number of commands completed */
+	int32_t error_index;	/**< index of the failed command or -1 */
+} __attribute__((packed));
+
 #endif
@@ -37,10 +37,13 @@
 
 #define SOF_EQ_FIR_IDX_SWITCH	0
 
-#define SOF_EQ_FIR_MAX_SIZE 4096 /* Max size allowed for coef data in bytes */
+#define SOF_EQ_FIR_MAX_SIZE 16384 /* Max size allowed for coef data in bytes */
 
 #define SOF_EQ_FIR_MAX_LENGTH 192 /* Max length for individual filter */
 
+/* Max length for individual filter with FFT convolution */
+#define SOF_EQ_FIR_FFT_MAX_LENGTH 4096
+
 #define SOF_EQ_FIR_MAX_RESPONSES 8 /* A blob can define max 8 FIR EQs */
 
 /*
@@ -53,6 +56,12 @@
  *         can be different from PLATFORM_MAX_CHANNELS.
  *     uint16_t number_of_responses
  *         0=no responses, 1=one response defined, 2=two responses defined, etc.
+ *     uint32_t fft_threshold
+ *         If non-zero and any of the channels uses a response with at least
+ *         this number of taps, all channels are filtered with partitioned
+ *         FFT convolution. It allows up to SOF_EQ_FIR_FFT_MAX_LENGTH taps
+ *         and delays the output by a partition that is the largest power
+ *         of two that fits in a period. Zero selects direct form always.
  *     int16_t data[]
  *         assign_response[channels_in_config]
  *             0 = use first response, 1 = use 2nd response, etc.
@@ -78,9 +87,10 @@ struct sof_eq_fir_config {
 	uint32_t size;
 	uint16_t channels_in_config;
 	uint16_t number_of_responses;
+	uint32_t fft_threshold;
 
 	/* reserved */
-	uint32_t reserved[4];
+	uint32_t reserved[3];
 
 	int16_t data[];
 } __attribute__((packed));
@@ -80,12 +80,14 @@ struct system_time {
 #define TRACE_CLASS_SELECTOR	(29 << 24)
 #define TRACE_CLASS_SCHEDULE	(30 << 24)
 #define TRACE_CLASS_SCHEDULE_LL	(31 << 24)
+#define TRACE_CLASS_PROFILER	(34 << 24)
 
 #define LOG_ENABLE		1  /* Enable logging */
 #define LOG_DISABLE		0  /* Disable logging */
 
 #define LOG_LEVEL_CRITICAL	1  /* (FDK fatal) */
 #define LOG_LEVEL_VERBOSE	2
+#define LOG_LEVEL_DEBUG		3  /* verbose traces, CONFIG_TRACEV */
 
 /*
  * Layout of a log fifo.
@@ -120,4 +122,30 @@ struct log_entry_header {
 	uint32_t log_entry_address;	/* Address of log entry in ELF */
 } __attribute__((packed));
 
+/*
+ *  Compact log record.
+ *
+ * Sent by DMA trace instead of log_entry_header and its arguments when
+ * the firmware is built with CONFIG_TRACE_COMPACT. Every field is an
+ * unsigned LEB128 varint:
+ *
+ *   head	timestamp << TRACE_COMPACT_TS_SHIFT | TRACE_COMPACT_* flags |
+ *		core id. The timestamp is the delta to the previous record,
+ *		or the absolute timestamp if TRACE_COMPACT_ABS is set.
+ *   index	(log entry address - log entries base address) / 4
+ *   id_0	only if TRACE_COMPACT_IDS is set, both ids are -1 otherwise
+ *   id_1
+ *   params	one for each argument of the log entry
+ *
+ * Records are not aligned. A TRACE_COMPACT_PAD byte, read where a record
+ * would start, is padding and is skipped.
+ */
+#define TRACE_COMPACT_CORE_MASK		0x7
+#define TRACE_COMPACT_IDS		(1 << 3)
+#define TRACE_COMPACT_ABS		(1 << 4)
+#define TRACE_COMPACT_TS_SHIFT		5
+
+/* absolute timestamp 0 on core 0, never sent as a record */
+#define TRACE_COMPACT_PAD		TRACE_COMPACT_ABS
+
 #endif //#ifndef __INCLUDE_LOGGING__
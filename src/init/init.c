@@ -42,6 +42,7 @@
 #include <sof/trace.h>
 #include <sof/dma-trace.h>
 #include <sof/pm_runtime.h>
+#include <sof/profiler.h>
 #include <sof/cpu.h>
 #include <platform/idc.h>
 #include <platform/platform.h>
@@ -82,6 +83,9 @@ int master_core_init(struct sof *sof)
 
 	trace_point(TRACE_BOOT_PLATFORM);
 
+	/* start sampling once the scheduler and DMA trace are up */
+	profiler_init(sof);
+
 	/* should not return */
 	err = do_task_master_core(sof);
 
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <sof/alloc.h>
+#include <sof/ipc.h>
+#include <uapi/ipc/header.h>
+#include <uapi/ipc/topology.h>
+
+/* run one command of a topology batch, hdr points to the command copy */
+static int ipc_tplg_batch_cmd(struct ipc *ipc, struct sof_ipc_cmd_hdr *hdr)
+{
+	if ((hdr->cmd & SOF_GLB_TYPE_MASK) != SOF_IPC_GLB_TPLG_MSG)
+		return -EINVAL;
+
+	switch (hdr->cmd & SOF_CMD_TYPE_MASK) {
+	case SOF_IPC_TPLG_COMP_NEW:
+		return ipc_comp_new(ipc, (struct sof_ipc_comp *)hdr);
+	case SOF_IPC_TPLG_BUFFER_NEW:
+		return ipc_buffer_new(ipc, (struct sof_ipc_buffer *)hdr);
+	case SOF_IPC_TPLG_PIPE_NEW:
+		return ipc_pipeline_new(ipc, (struct sof_ipc_pipe_new *)hdr);
+	case SOF_IPC_TPLG_COMP_CONNECT:
+		return ipc_comp_connect(ipc,
+				(struct sof_ipc_pipe_comp_connect *)hdr);
+	case SOF_IPC_TPLG_PIPE_COMPLETE:
+		return ipc_pipeline_complete(ipc,
+				((struct sof_ipc_pipe_ready *)hdr)->comp_id);
+	default:
+		return -EINVAL;
+	}
+}
+
+/*
+ * Run a batch of topology commands packed back to back in cmds. Each command
+ * is copied into the component data buffer and zero padded to the maximum
+ * message size, so commands from an older ABI can be used as the current
+ * structures. Stops at the first invalid or failing command, done returns
+ * the number of commands that completed.
+ */
+int ipc_tplg_batch(struct ipc *ipc, const void *cmds, uint32_t size,
+		   uint32_t count, uint32_t *done)
+{
+	struct sof_ipc_cmd_hdr *hdr = ipc->comp_data;
+	const uint8_t *cmd = cmds;
+	uint32_t offset = 0;
+	uint32_t cmd_size;
+	int ret;
+
+	for (*done = 0; *done < count; (*done)++) {
+		/* copy and validate the command header */
+		if (size - offset < sizeof(*hdr))
+			return -EINVAL;
+		ret = memcpy_s(hdr, SOF_IPC_MSG_MAX_SIZE, cmd + offset,
+			       sizeof(*hdr));
+		if (ret < 0)
+			return ret;
+
+		cmd_size = hdr->size;
+		if (cmd_size < sizeof(*hdr) ||
+		    cmd_size > SOF_IPC_MSG_MAX_SIZE ||
+		    cmd_size > size - offset)
+			return -EINVAL;
+
+		/* copy rest of the command */
+		ret = memcpy_s(hdr + 1, SOF_IPC_MSG_MAX_SIZE - sizeof(*hdr),
+			       cmd + offset + sizeof(*hdr),
+			       cmd_size - sizeof(*hdr));
+		if (ret < 0)
+			return ret;
+		bzero((uint8_t *)hdr + cmd_size,
+		      SOF_IPC_MSG_MAX_SIZE - cmd_size);
+
+		ret = ipc_tplg_batch_cmd(ipc, hdr);
+		if (ret < 0)
+			return ret;
+
+		offset += cmd_size;
+	}
+
+	return 0;
+}
@@ -708,10 +708,100 @@ static int ipc_glb_pm_message(uint32_t header)
 	}
 }
 
-#if CONFIG_TRACE
 /*
  * Debug IPC Operations.
  */
+
+/* read the execution time counters of a component and its pipeline */
+static int ipc_comp_perf(uint32_t header)
+{
+#if CONFIG_COMP_PERF
+	struct sof_ipc_comp_perf_params params;
+	struct sof_ipc_comp_perf reply;
+	struct ipc_comp_dev *icd;
+	struct comp_dev *cd;
+	struct pipeline *p = NULL;
+
+	/* copy message with ABI safe method */
+	IPC_COPY_CMD(params, _ipc->comp_data);
+
+	trace_ipc("ipc: comp %d -> perf", params.comp_id);
+
+	icd = ipc_get_comp(_ipc, params.comp_id);
+	if (!icd || icd->type != COMP_TYPE_COMPONENT) {
+		trace_ipc_error("ipc: comp %d not found", params.comp_id);
+		return -ENODEV;
+	}
+
+	cd = icd->cd;
+
+	/* periods are counted by the pipeline of the scheduling component */
+	if (cd->pipeline && cd->pipeline->sched_comp)
+		p = cd->pipeline->sched_comp->pipeline;
+
+	bzero(&reply, sizeof(reply));
+	reply.rhdr.hdr.size = sizeof(reply);
+	reply.rhdr.hdr.cmd = header;
+	reply.comp_id = params.comp_id;
+	reply.pipeline_id = cd->comp.pipeline_id;
+	reply.copies = cd->perf_copy.count;
+	reply.copy_min = cd->perf_copy.min;
+	reply.copy_avg = perf_cnt_avg(&cd->perf_copy);
+	reply.copy_max = cd->perf_copy.max;
+	reply.bytes = cd->perf_bytes;
+
+	if (p) {
+		reply.periods = p->perf_period.count;
+		reply.period_avg = perf_cnt_avg(&p->perf_period);
+		reply.period_max = p->perf_period.max;
+		reply.period_budget = p->perf_budget;
+		reply.overruns = p->perf_overruns;
+	}
+
+	if (params.flags & SOF_IPC_COMP_PERF_RESET) {
+		perf_cnt_reset(&cd->perf_copy);
+		cd->perf_bytes = 0;
+		if (p) {
+			perf_cnt_reset(&p->perf_period);
+			p->perf_overruns = 0;
+		}
+	}
+
+	mailbox_hostbox_write(0, &reply, sizeof(reply));
+	return 1;
+#else
+	return -EINVAL;
+#endif
+}
+
+/* read the statistics of one heap */
+static int ipc_heap_stats(uint32_t header)
+{
+	struct sof_ipc_heap_stats_params params;
+	struct sof_ipc_heap_stats reply;
+	int ret;
+
+	/* copy message with ABI safe method */
+	IPC_COPY_CMD(params, _ipc->comp_data);
+
+	trace_ipc("ipc: heap %d.%d -> stats", params.heap, params.index);
+
+	bzero(&reply, sizeof(reply));
+	ret = heap_get_stats(params.heap, params.index, &reply, params.flags);
+	if (ret < 0) {
+		trace_ipc_error("ipc: heap %d.%d not found", params.heap,
+				params.index);
+		return ret;
+	}
+
+	reply.rhdr.hdr.size = sizeof(reply);
+	reply.rhdr.hdr.cmd = header;
+
+	mailbox_hostbox_write(0, &reply, sizeof(reply));
+	return 1;
+}
+
+#if CONFIG_TRACE
 static int ipc_dma_trace_config(uint32_t header)
 {
 #ifdef CONFIG_HOST_PTABLE
@@ -789,6 +879,30 @@ error:
 	return -EINVAL;
 }
 
+/* set the runtime trace levels */
+static int ipc_trace_filter_update(uint32_t header)
+{
+	struct sof_ipc_trace_filter *filter = _ipc->comp_data;
+	uint32_t size = filter->hdr.size;
+	int ret;
+
+	if (size < sizeof(*filter) || size > SOF_IPC_MSG_MAX_SIZE ||
+	    filter->elem_cnt > (size - sizeof(*filter)) /
+			       sizeof(filter->elems[0])) {
+		trace_ipc_error("ipc: trace filter size %d elems %d", size,
+				filter->elem_cnt);
+		return -EINVAL;
+	}
+
+	trace_ipc("ipc: trace filter %d elems", filter->elem_cnt);
+
+	ret = trace_filter_update(filter->elems, filter->elem_cnt);
+	if (ret < 0)
+		trace_ipc_error("ipc: trace filter update failed %d", ret);
+
+	return ret;
+}
+
 /* send DMA trace host buffer position to host */
 int ipc_dma_trace_send_position(void)
 {
@@ -814,6 +928,12 @@ static int ipc_glb_debug_message(uint32_t header)
 	case SOF_IPC_TRACE_DMA_PARAMS:
 	case SOF_IPC_TRACE_DMA_PARAMS_EXT:
 		return ipc_dma_trace_config(header);
+	case SOF_IPC_TRACE_COMP_PERF:
+		return ipc_comp_perf(header);
+	case SOF_IPC_TRACE_HEAP_STATS:
+		return ipc_heap_stats(header);
+	case SOF_IPC_TRACE_FILTER_UPDATE:
+		return ipc_trace_filter_update(header);
 	default:
 		trace_ipc_error("ipc: unknown debug cmd 0x%x", cmd);
 		return -EINVAL;
@@ -823,8 +943,14 @@ static int ipc_glb_debug_message(uint32_t header)
 static int ipc_glb_debug_message(uint32_t header)
 {
 	/* traces are disabled - CONFIG_TRACE is not set */
-
-	return -EINVAL;
+	switch (iCS(header)) {
+	case SOF_IPC_TRACE_COMP_PERF:
+		return ipc_comp_perf(header);
+	case SOF_IPC_TRACE_HEAP_STATS:
+		return ipc_heap_stats(header);
+	default:
+		return -EINVAL;
+	}
 }
 #endif
 
@@ -1073,6 +1199,54 @@ static int ipc_glb_tplg_free(uint32_t header,
 	return ret;
 }
 
+/*
+ * Build topology from a batch of commands with one IPC round trip. Each
+ * command is read from the hostbox into the component data buffer and run
+ * in order. The reply reports how many commands completed and the index
+ * of the failed one, objects created before a failure are left for the
+ * host to free as they would be with single commands.
+ */
+static int ipc_glb_tplg_batch(uint32_t header)
+{
+	struct sof_ipc_tplg_batch batch;
+	struct sof_ipc_tplg_batch_reply reply;
+	uint32_t offset;
+	uint32_t end;
+	int ret;
+
+	/* copy message with ABI safe method */
+	IPC_COPY_CMD(batch, _ipc->comp_data);
+
+	trace_ipc("ipc: tplg batch %d cmds, %d bytes", batch.count,
+		  batch.payload_size);
+
+	offset = batch.hdr.size;
+	end = offset + batch.payload_size;
+	if (end < offset || end > MAILBOX_HOSTBOX_SIZE) {
+		trace_ipc_error("ipc: tplg batch size %d invalid",
+				batch.payload_size);
+		return -EINVAL;
+	}
+
+	reply.error_index = -1;
+
+	dcache_invalidate_region((void *)(MAILBOX_HOSTBOX_BASE + offset),
+				 batch.payload_size);
+	ret = ipc_tplg_batch(_ipc, (void *)(MAILBOX_HOSTBOX_BASE + offset),
+			     batch.payload_size, batch.count, &reply.count);
+	if (ret < 0) {
+		reply.error_index = reply.count;
+		trace_ipc_error("ipc: tplg batch cmd %d failed %d",
+				reply.count, ret);
+	}
+
+	reply.rhdr.hdr.size = sizeof(reply);
+	reply.rhdr.hdr.cmd = header;
+	reply.rhdr.error = ret < 0 ? ret : 0;
+	mailbox_hostbox_write(0, &reply, sizeof(reply));
+	return 1;
+}
+
 static int ipc_glb_tplg_message(uint32_t header)
 {
 	uint32_t cmd = iCS(header);
@@ -1094,6 +1268,8 @@ static int ipc_glb_tplg_message(uint32_t header)
 		return ipc_glb_tplg_buffer_new(header);
 	case SOF_IPC_TPLG_BUFFER_FREE:
 		return ipc_glb_tplg_free(header, ipc_buffer_free);
+	case SOF_IPC_TPLG_BATCH:
+		return ipc_glb_tplg_batch(header);
 	default:
 		trace_ipc_error("ipc: unknown tplg header 0x%x", header);
 		return -EINVAL;
@@ -44,81 +44,110 @@
 #include <sof/audio/pipeline.h>
 #include <sof/audio/buffer.h>
 
-/* Returns pipeline source component */
-#define ipc_get_ppl_src_comp(ipc, ppl_id) \
-	ipc_get_ppl_comp(ipc, ppl_id, PPL_DIR_UPSTREAM)
-
-/* Returns pipeline sink component */
-#define ipc_get_ppl_sink_comp(ipc, ppl_id) \
-	ipc_get_ppl_comp(ipc, ppl_id, PPL_DIR_DOWNSTREAM)
-
 /*
  * Components, buffers and pipelines all use the same set of monotonic ID
- * numbers passed in by the host. They are stored in different lists, hence
- * more than 1 list may need to be searched for the corresponding component.
+ * numbers passed in by the host. They are kept in one list for iteration and
+ * are also hashed by ID, so lookups don't have to walk the whole topology.
  */
 
 struct ipc_comp_dev *ipc_get_comp(struct ipc *ipc, uint32_t id)
 {
 	struct ipc_comp_dev *icd;
-	struct list_item *clist;
 
-	list_for_item(clist, &ipc->shared_ctx->comp_list) {
-		icd = container_of(clist, struct ipc_comp_dev, list);
-		switch (icd->type) {
-		case COMP_TYPE_COMPONENT:
-			if (icd->cd->comp.id == id)
-				return icd;
-			break;
-		case COMP_TYPE_BUFFER:
-			if (icd->cb->ipc_buffer.comp.id == id)
-				return icd;
-			break;
-		case COMP_TYPE_PIPELINE:
-			if (icd->pipeline->ipc_pipe.comp_id == id)
-				return icd;
-			break;
-		default:
-			break;
-		}
+	for (icd = ipc->shared_ctx->comp_hash[IPC_COMP_HASH(id)]; icd;
+	     icd = icd->hash_next) {
+		if (icd->id == id)
+			return icd;
 	}
 
 	return NULL;
 }
 
-static struct ipc_comp_dev *ipc_get_ppl_comp(struct ipc *ipc,
-					     uint32_t pipeline_id, int dir)
+/* add a new component device to the list and the ID hash */
+static void ipc_comp_dev_add(struct ipc *ipc, struct ipc_comp_dev *icd,
+			     uint32_t id)
+{
+	struct ipc_comp_dev **bucket =
+		&ipc->shared_ctx->comp_hash[IPC_COMP_HASH(id)];
+
+	icd->id = id;
+	icd->hash_next = *bucket;
+	*bucket = icd;
+
+	list_item_append(&icd->list, &ipc->shared_ctx->comp_list);
+}
+
+/* remove a component device from the list and the ID hash */
+static void ipc_comp_dev_del(struct ipc *ipc, struct ipc_comp_dev *icd)
+{
+	struct ipc_comp_dev **prev =
+		&ipc->shared_ctx->comp_hash[IPC_COMP_HASH(icd->id)];
+
+	while (*prev && *prev != icd)
+		prev = &(*prev)->hash_next;
+	if (*prev)
+		*prev = icd->hash_next;
+
+	list_item_del(&icd->list);
+}
+
+/* is icd connected in dir to a component of another pipeline */
+static int ipc_ppl_comp_is_connected(struct ipc_comp_dev *icd,
+				     uint32_t pipeline_id, int dir)
 {
-	struct ipc_comp_dev *icd;
 	struct comp_buffer *buffer;
 	struct comp_dev *buff_comp;
-	struct list_item *clist;
 
-	/* first try to find the module in the pipeline */
-	list_for_item(clist, &ipc->shared_ctx->comp_list) {
-		icd = container_of(clist, struct ipc_comp_dev, list);
-		if (icd->type == COMP_TYPE_COMPONENT &&
-		    icd->cd->comp.pipeline_id == pipeline_id &&
-		    list_is_empty(comp_buffer_list(icd->cd, dir)))
-			return icd;
-	}
+	buffer = buffer_from_list(comp_buffer_list(icd->cd, dir)->next,
+				  struct comp_buffer, dir);
+	buff_comp = buffer_get_comp(buffer, dir);
+
+	return buff_comp && buff_comp->comp.pipeline_id != pipeline_id;
+}
+
+/*
+ * Find pipeline source and sink components in a single pass. The endpoint
+ * of a pipeline is the module without buffers in that direction, or for a
+ * connected pipeline the module attached to another pipeline.
+ */
+static int ipc_get_ppl_comps(struct ipc *ipc, uint32_t pipeline_id,
+			     struct ipc_comp_dev **source,
+			     struct ipc_comp_dev **sink)
+{
+	struct ipc_comp_dev *end[2] = { NULL, NULL };
+	struct ipc_comp_dev *conn[2] = { NULL, NULL };
+	struct ipc_comp_dev *icd;
+	struct list_item *clist;
+	int dirs[2] = { PPL_DIR_UPSTREAM, PPL_DIR_DOWNSTREAM };
+	int i;
 
-	/* it's connected pipeline, so find the connected module */
 	list_for_item(clist, &ipc->shared_ctx->comp_list) {
 		icd = container_of(clist, struct ipc_comp_dev, list);
-		if (icd->type == COMP_TYPE_COMPONENT &&
-		    icd->cd->comp.pipeline_id == pipeline_id) {
-			buffer = buffer_from_list
-					(comp_buffer_list(icd->cd, dir)->next,
-					 struct comp_buffer, dir);
-			buff_comp = buffer_get_comp(buffer, dir);
-			if (buff_comp &&
-			    buff_comp->comp.pipeline_id != pipeline_id)
-				return icd;
+		if (icd->type != COMP_TYPE_COMPONENT ||
+		    icd->cd->comp.pipeline_id != pipeline_id)
+			continue;
+
+		for (i = 0; i < 2; i++) {
+			if (end[i])
+				continue;
+
+			if (list_is_empty(comp_buffer_list(icd->cd, dirs[i])))
+				end[i] = icd;
+			else if (!conn[i] &&
+				 ipc_ppl_comp_is_connected(icd, pipeline_id,
+							   dirs[i]))
+				conn[i] = icd;
 		}
+
+		/* both ends found, nothing can take precedence now */
+		if (end[0] && end[1])
+			break;
 	}
 
-	return NULL;
+	*source = end[0] ? end[0] : conn[0];
+	*sink = end[1] ? end[1] : conn[1];
+
+	return *source && *sink ? 0 : -EINVAL;
 }
 
 int ipc_get_posn_offset(struct ipc *ipc, struct pipeline *pipe)
@@ -156,9 +185,13 @@ int ipc_comp_new(struct ipc *ipc, struct sof_ipc_comp *comp)
 		return -EINVAL;
 	}
 
+	/* component state is packed into the pipeline arena */
+	alloc_arena_enter(comp->pipeline_id);
+
 	/* create component */
 	cd = comp_new(comp);
 	if (cd == NULL) {
+		alloc_arena_exit();
 		trace_ipc_error("ipc_comp_new() error: component cd = NULL");
 		return -EINVAL;
 	}
@@ -166,6 +199,7 @@ int ipc_comp_new(struct ipc *ipc, struct sof_ipc_comp *comp)
 	/* allocate the IPC component container */
 	icd = rzalloc(RZONE_RUNTIME | RZONE_FLAG_UNCACHED, SOF_MEM_CAPS_RAM,
 		      sizeof(struct ipc_comp_dev));
+	alloc_arena_exit();
 	if (icd == NULL) {
 		trace_ipc_error("ipc_comp_new() error: alloc failed");
 		rfree(cd);
@@ -175,7 +209,7 @@ int ipc_comp_new(struct ipc *ipc, struct sof_ipc_comp *comp)
 	icd->type = COMP_TYPE_COMPONENT;
 
 	/* add new component to the list */
-	list_item_append(&icd->list, &ipc->shared_ctx->comp_list);
+	ipc_comp_dev_add(ipc, icd, comp->id);
 	return ret;
 }
 
@@ -190,7 +224,7 @@ int ipc_comp_free(struct ipc *ipc, uint32_t comp_id)
 
 	/* free component and remove from list */
 	comp_free(icd->cd);
-	list_item_del(&icd->list);
+	ipc_comp_dev_del(ipc, icd);
 	rfree(icd);
 
 	return 0;
@@ -211,9 +245,12 @@ int ipc_buffer_new(struct ipc *ipc, struct sof_ipc_buffer *desc)
 		return -EINVAL;
 	}
 
+	alloc_arena_enter(desc->comp.pipeline_id);
+
 	/* register buffer with pipeline */
 	buffer = buffer_new(desc);
 	if (buffer == NULL) {
+		alloc_arena_exit();
 		trace_ipc_error("ipc_buffer_new() error: buffer_new() failed");
 		rfree(ibd);
 		return -ENOMEM;
@@ -221,6 +258,7 @@ int ipc_buffer_new(struct ipc *ipc, struct sof_ipc_buffer *desc)
 
 	ibd = rzalloc(RZONE_RUNTIME | RZONE_FLAG_UNCACHED, SOF_MEM_CAPS_RAM,
 		      sizeof(struct ipc_comp_dev));
+	alloc_arena_exit();
 	if (ibd == NULL) {
 		rfree(buffer);
 		return -ENOMEM;
@@ -229,7 +267,7 @@ int ipc_buffer_new(struct ipc *ipc, struct sof_ipc_buffer *desc)
 	ibd->type = COMP_TYPE_BUFFER;
 
 	/* add new buffer to the list */
-	list_item_append(&ibd->list, &ipc->shared_ctx->comp_list);
+	ipc_comp_dev_add(ipc, ibd, desc->comp.id);
 	return ret;
 }
 
@@ -244,7 +282,7 @@ int ipc_buffer_free(struct ipc *ipc, uint32_t buffer_id)
 
 	/* free buffer and remove from list */
 	buffer_free(ibd->cb);
-	list_item_del(&ibd->list);
+	ipc_comp_dev_del(ipc, ibd);
 	rfree(ibd);
 
 	return 0;
@@ -322,9 +360,12 @@ int ipc_pipeline_new(struct ipc *ipc,
 		return -EINVAL;
 	}
 
+	alloc_arena_enter(pipe_desc->pipeline_id);
+
 	/* create the pipeline */
 	pipe = pipeline_new(pipe_desc, icd->cd);
 	if (pipe == NULL) {
+		alloc_arena_exit();
 		trace_ipc_error("ipc_pipeline_new() error: "
 				"pipeline_new() failed");
 		return -ENOMEM;
@@ -333,6 +374,7 @@ int ipc_pipeline_new(struct ipc *ipc,
 	/* allocate the IPC pipeline container */
 	ipc_pipe = rzalloc(RZONE_RUNTIME | RZONE_FLAG_UNCACHED,
 			   SOF_MEM_CAPS_RAM, sizeof(struct ipc_comp_dev));
+	alloc_arena_exit();
 	if (ipc_pipe == NULL) {
 		pipeline_free(pipe);
 		return -ENOMEM;
@@ -342,13 +384,15 @@ int ipc_pipeline_new(struct ipc *ipc,
 	ipc_pipe->type = COMP_TYPE_PIPELINE;
 
 	/* add new pipeline to the list */
-	list_item_append(&ipc_pipe->list, &ipc->shared_ctx->comp_list);
+	ipc_comp_dev_add(ipc, ipc_pipe, pipe_desc->comp_id);
 	return 0;
 }
 
 int ipc_pipeline_free(struct ipc *ipc, uint32_t comp_id)
 {
 	struct ipc_comp_dev *ipc_pipe;
+	struct ipc_comp_dev *icd;
+	struct list_item *clist;
 	int ret;
 
 	/* check whether pipeline exists */
@@ -364,9 +408,16 @@ int ipc_pipeline_free(struct ipc *ipc, uint32_t comp_id)
 		return ret;
 	}
 
-	list_item_del(&ipc_pipe->list);
+	ipc_comp_dev_del(ipc, ipc_pipe);
 	rfree(ipc_pipe);
 
+	/* pipelines connected to the freed one walk a different graph now */
+	list_for_item(clist, &ipc->shared_ctx->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type == COMP_TYPE_PIPELINE)
+			pipeline_copy_list_update(icd->pipeline);
+	}
+
 	return 0;
 }
 
@@ -384,14 +435,9 @@ int ipc_pipeline_complete(struct ipc *ipc, uint32_t comp_id)
 
 	pipeline_id = ipc_pipe->pipeline->ipc_pipe.pipeline_id;
 
-	/* get pipeline source component */
-	ipc_ppl_source = ipc_get_ppl_src_comp(ipc, pipeline_id);
-	if (!ipc_ppl_source)
-		return -EINVAL;
-
-	/* get pipeline sink component */
-	ipc_ppl_sink = ipc_get_ppl_sink_comp(ipc, pipeline_id);
-	if (!ipc_ppl_sink)
+	/* get pipeline source and sink components */
+	if (ipc_get_ppl_comps(ipc, pipeline_id, &ipc_ppl_source,
+			      &ipc_ppl_sink) < 0)
 		return -EINVAL;
 
 	return pipeline_complete(ipc_pipe->pipeline, ipc_ppl_source->cd,
@@ -35,9 +35,12 @@
 #include <sof/panic.h>
 #include <sof/trace.h>
 #include <sof/lock.h>
+#include <sof/interrupt.h>
 #include <sof/cpu.h>
 #include <platform/memory.h>
+#include <uapi/ipc/trace.h>
 #include <stdint.h>
+#include <errno.h>
 
 /* debug to set memory value on every allocation */
 #define DEBUG_BLOCK_FREE 0
@@ -50,8 +53,17 @@
 #define trace_mem_init(__e, ...) \
 	trace_event(TRACE_CLASS_MEM, __e, ##__VA_ARGS__)
 
+/* pipeline arena chunk size, larger requests get a chunk of their own */
+#define ARENA_CHUNK_SIZE	2048
+
+/* arena objects never share a cache line, some of them are used uncached */
+#define ARENA_ALIGN(x)		ALIGN(x, PLATFORM_DCACHE_ALIGN)
+
 extern struct mm memmap;
 
+STATIC_ASSERT(MM_SIZE_BUCKETS == SOF_IPC_HEAP_STATS_SIZES,
+	      mm_size_buckets_match_ipc);
+
 /* We have 3 memory pools
  *
  * 1) System memory pool does not have a map and it's size is fixed at build
@@ -96,6 +108,9 @@ static inline void flush_block_map(struct block_map *map)
 {
 	dcache_writeback_invalidate_region(map->block,
 					   sizeof(*map->block) * map->count);
+	dcache_writeback_invalidate_region(map->used_mask,
+					   sizeof(*map->used_mask) *
+					   BLOCK_MASK_WORDS(map->count));
 	dcache_writeback_invalidate_region(map, sizeof(*map));
 }
 
@@ -103,7 +118,8 @@ static inline void flush_block_map(struct block_map *map)
 static inline uint32_t block_get_size(struct block_map *map)
 {
 	return sizeof(*map) + map->count *
-		(map->block_size + sizeof(struct block_hdr));
+		(map->block_size + sizeof(struct block_hdr)) +
+		BLOCK_MASK_WORDS(map->count) * sizeof(*map->used_mask);
 }
 
 /* total size of heap */
@@ -119,6 +135,120 @@ static inline uint32_t heap_get_size(struct mm_heap *heap)
 	return size;
 }
 
+/* find first block at or after start whose used bit equals used */
+static unsigned int block_find(struct block_map *map, unsigned int start,
+			       uint32_t used)
+{
+	unsigned int words = BLOCK_MASK_WORDS(map->count);
+	unsigned int w = start / 32;
+	uint32_t bits;
+
+	if (start >= map->count)
+		return map->count;
+
+	/* invert the mask so that the blocks we look for are set bits */
+	bits = (map->used_mask[w] ^ (used - 1)) & (0xffffffff << (start % 32));
+	while (!bits) {
+		if (++w == words)
+			return map->count;
+		bits = map->used_mask[w] ^ (used - 1);
+	}
+
+	/* bits past the map end are set as used so this never exceeds count */
+	return w * 32 + __builtin_ctz(bits);
+}
+
+/* find first free run of count blocks, returns map->count if none */
+static unsigned int block_find_run(struct block_map *map, unsigned int count)
+{
+	unsigned int start = map->first_free;
+	unsigned int end;
+
+	while (start + count <= map->count) {
+		start = block_find(map, start, 0);
+		if (start + count > map->count)
+			break;
+
+		/* run ends at the next used block */
+		end = block_find(map, start, 1);
+		if (end - start >= count)
+			return start;
+
+		start = end;
+	}
+
+	return map->count;
+}
+
+/* set or clear the used bits of count blocks starting at start */
+static void block_set_used(struct block_map *map, unsigned int start,
+			   unsigned int count, int used)
+{
+	unsigned int end = start + count;
+	unsigned int w;
+	uint32_t mask;
+
+	while (start < end) {
+		w = start / 32;
+		mask = 0xffffffff << (start % 32);
+		if (end - w * 32 < 32)
+			mask &= ~(0xffffffff << (end - w * 32));
+
+		if (used)
+			map->used_mask[w] |= mask;
+		else
+			map->used_mask[w] &= ~mask;
+
+		start = (w + 1) * 32;
+	}
+}
+
+/* longest run of free blocks in a map */
+static unsigned int block_largest_run(struct block_map *map)
+{
+	unsigned int start = map->first_free;
+	unsigned int largest = 0;
+	unsigned int end;
+
+	while (start < map->count) {
+		end = block_find(map, start, 1);
+		if (end - start > largest)
+			largest = end - start;
+
+		start = block_find(map, end, 0);
+	}
+
+	return largest;
+}
+
+/* size histogram bucket, sizes up to 32 << n bytes go to bucket n */
+static inline int heap_size_bucket(size_t bytes)
+{
+	int bucket;
+
+	if (bytes <= 32)
+		return 0;
+
+	bucket = 27 - __builtin_clz(bytes - 1);
+
+	return bucket < MM_SIZE_BUCKETS ? bucket : MM_SIZE_BUCKETS - 1;
+}
+
+/* update statistics after a successful allocation from map */
+static void heap_stats_alloc(struct mm_heap *heap, struct block_map *map,
+			     size_t bytes)
+{
+	uint16_t used = map->count - map->free_count;
+
+	heap->stats.sizes[heap_size_bucket(bytes)]++;
+
+	if (heap->info.used > heap->stats.peak_used)
+		heap->stats.peak_used = heap->info.used;
+
+	if (used > map->peak_used)
+		map->peak_used = used;
+}
+
 #if DEBUG_BLOCK_FREE
 static void write_pattern(struct mm_heap *heap_map, int heap_depth,
 						  uint8_t pattern)
@@ -140,6 +270,16 @@ static void write_pattern(struct mm_heap *heap_map, int heap_depth,
 }
 #endif
 
+/* blocks past the end of the map are marked as used in the last mask word */
+static void init_block_map(struct block_map *map)
+{
+	unsigned int words = BLOCK_MASK_WORDS(map->count);
+
+	bzero(map->used_mask, words * sizeof(*map->used_mask));
+	block_set_used(map, map->count, words * 32 - map->count, 1);
+	flush_block_map(map);
+}
+
 static void init_heap_map(struct mm_heap *heap, int count)
 {
 	struct block_map *next_map;
@@ -151,7 +291,7 @@ static void init_heap_map(struct mm_heap *heap, int count)
 		/* init the map[0] */
 		current_map = &heap[i].map[0];
 		current_map->base = heap[i].heap;
-		flush_block_map(current_map);
+		init_block_map(current_map);
 
 		/* map[j]'s base is calculated based on map[j-1] */
 		for (j = 1; j < heap[i].blocks; j++) {
@@ -160,7 +300,7 @@ static void init_heap_map(struct mm_heap *heap, int count)
 				current_map->block_size *
 				current_map->count;
 			current_map = &heap[i].map[j];
-			flush_block_map(current_map);
+			init_block_map(current_map);
 		}
 
 		dcache_writeback_invalidate_region(&heap[i], sizeof(heap[i]));
@@ -217,25 +357,17 @@ static void *alloc_block(struct mm_heap *heap, int level,
 	struct block_map *map = &heap->map[level];
 	struct block_hdr *hdr = &map->block[map->first_free];
 	void *ptr;
-	int i;
 
 	map->free_count--;
 	ptr = (void *)(map->base + map->first_free * map->block_size);
 	hdr->size = 1;
-	hdr->used = 1;
+	hdr->used = BLOCK_USED;
+	map->used_mask[map->first_free / 32] |= 1U << (map->first_free % 32);
 	heap->info.used += map->block_size;
 	heap->info.free -= map->block_size;
 
 	/* find next free */
-	for (i = map->first_free; i < map->count; ++i) {
-
-		hdr = &map->block[i];
-
-		if (hdr->used == 0) {
-			map->first_free = i;
-			break;
-		}
-	}
+	map->first_free = block_find(map, map->first_free + 1, 0);
 
 	return ptr;
 }
@@ -248,9 +380,7 @@ static void *alloc_cont_blocks(struct mm_heap *heap, int level,
 	struct block_hdr *hdr;
 	void *ptr;
 	unsigned int start;
-	unsigned int current;
 	unsigned int count = bytes / map->block_size;
-	unsigned int remaining = 0;
 
 	if (bytes % map->block_size)
 		count++;
@@ -258,35 +388,27 @@ static void *alloc_cont_blocks(struct mm_heap *heap, int level,
 	/* check if we have enough consecutive blocks for requested
 	 * allocation size.
 	 */
-	for (current = map->first_free; current < map->count; current++) {
-		hdr = &map->block[current];
-
-		if (!hdr->used)
-			remaining++;
-	}
-
-	if (count > map->count || remaining < count) {
+	start = count > map->free_count ? map->count :
+		block_find_run(map, count);
+	if (start == map->count) {
 		trace_mem_error("error: %d blocks needed for allocation "
-				"but only %d blocks are remaining",
-				count, remaining);
+				"but no free run found, %d blocks are free",
+				count, map->free_count);
 		return NULL;
 	}
 
 	/* we found enough space, let's allocate it */
-	start = map->first_free;
 	map->free_count -= count;
 	ptr = (void *)(map->base + start * map->block_size);
 	hdr = &map->block[start];
 	hdr->size = count;
+	hdr->used = BLOCK_USED;
+	block_set_used(map, start, count, 1);
 	heap->info.used += count * map->block_size;
 	heap->info.free -= count * map->block_size;
-	map->first_free = map->first_free + count;
 
-	/* update each block */
-	for (current = start; current < count; current++) {
-		hdr = &map->block[current];
-		hdr->used = 1;
-	}
+	if (start == map->first_free)
+		map->first_free = block_find(map, start + count, 0);
 
 	return ptr;
 }
@@ -321,6 +443,23 @@ static struct mm_heap *get_heap_from_ptr(void *ptr)
 	return NULL;
 }
 
+/* find the block map of heap that ptr belongs to */
+static struct block_map *get_map_from_ptr(struct mm_heap *heap, void *ptr)
+{
+	struct block_map *map;
+	int i;
+
+	for (i = 0; i < heap->blocks; i++) {
+		map = &heap->map[i];
+
+		/* is ptr in this block */
+		if ((uint32_t)ptr < map->base + map->block_size * map->count)
+			return map;
+	}
+
+	return NULL;
+}
+
 static struct mm_heap *get_heap_from_caps(struct mm_heap *heap, int count,
 					  uint32_t caps)
 {
@@ -352,15 +491,21 @@ static void *get_ptr_from_heap(struct mm_heap *heap, int zone, uint32_t caps,
 			continue;
 
 		/* does block have free space */
-		if (map->free_count == 0)
+		if (map->free_count == 0) {
+			map->failures++;
 			continue;
+		}
 
 		/* free block space exists */
 		ptr = alloc_block(heap, i, caps);
+		heap_stats_alloc(heap, map, bytes);
 
 		break;
 	}
 
+	if (!ptr)
+		heap->stats.failures++;
+
 	if (ptr && (zone & RZONE_FLAG_MASK) == RZONE_FLAG_UNCACHED)
 		ptr = cache_to_uncache(ptr);
 
@@ -373,7 +518,6 @@ static void free_block(void *ptr)
 	struct mm_heap *heap;
 	struct block_map *block_map;
 	struct block_hdr *hdr;
-	int i;
 	int block;
 	int used_blocks;
 
@@ -386,16 +530,8 @@ static void free_block(void *ptr)
 	}
 
 	/* find block that ptr belongs to */
-	for (i = 0; i < heap->blocks; i++) {
-		block_map = &heap->map[i];
-
-		/* is ptr in this block */
-		if ((uint32_t)ptr < (block_map->base +
-		    (block_map->block_size * block_map->count)))
-			break;
-	}
-
-	if (i == heap->blocks) {
+	block_map = get_map_from_ptr(heap, ptr);
+	if (!block_map) {
 		/* not found */
 		trace_error(TRACE_CLASS_MEM,
 			    "free_block() error: invalid ptr = %p cpu = %d",
@@ -411,18 +547,23 @@ static void free_block(void *ptr)
 	if (block_map->base + block_map->block_size * block != (uint32_t)ptr)
 		panic(SOF_IPC_PANIC_MEM);
 
-	/* free block header and continuous blocks */
-	used_blocks = block + hdr->size;
-
-	for (i = block; i < used_blocks; i++) {
-		hdr = &block_map->block[i];
-		hdr->size = 0;
-		hdr->used = 0;
-		block_map->free_count++;
-		heap->info.used -= block_map->block_size;
-		heap->info.free += block_map->block_size;
+	/* only the first block of an allocation has its header set */
+	if (!hdr->used) {
+		trace_error(TRACE_CLASS_MEM,
+			    "free_block() error: block not in use ptr = %p",
+			    (uintptr_t)ptr);
+		return;
 	}
 
+	/* free block header and continuous blocks */
+	used_blocks = hdr->size;
+	hdr->size = 0;
+	hdr->used = 0;
+	block_set_used(block_map, block, used_blocks, 0);
+	block_map->free_count += used_blocks;
+	heap->info.used -= used_blocks * block_map->block_size;
+	heap->info.free += used_blocks * block_map->block_size;
+
 	/* set first free block */
 	if (block < block_map->first_free)
 		block_map->first_free = block;
@@ -431,11 +572,11 @@ static void free_block(void *ptr)
 	/* memset the whole block incase some not aligned ptr */
 	validate_memory(
 		(void *)(block_map->base + block_map->block_size * block),
-		block_map->block_size * (i - block));
+		block_map->block_size * used_blocks);
 	memset(
 		(void *)(block_map->base + block_map->block_size * block),
 		DEBUG_BLOCK_FREE_VALUE, block_map->block_size *
-		(i - block));
+		used_blocks);
 #endif
 }
 
@@ -555,9 +696,13 @@ static void *rmalloc_runtime(int zone, uint32_t caps, size_t bytes)
 	return get_ptr_from_heap(heap, zone, caps, bytes);
 }
 
+static int arena_window_owner(uint32_t level);
+static void *arena_alloc(int zone, uint32_t caps, size_t bytes);
+
 /* allocates memory - not for direct use, clients use rmalloc() */
 void *_malloc(int zone, uint32_t caps, size_t bytes)
 {
+	uint32_t level = arch_interrupt_get_level();
 	uint32_t flags;
 	void *ptr = NULL;
 
@@ -571,7 +716,10 @@ void *_malloc(int zone, uint32_t caps, size_t bytes)
 		ptr = rmalloc_sys_runtime(zone, caps, cpu_get_id(), bytes);
 		break;
 	case RZONE_RUNTIME:
-		ptr = rmalloc_runtime(zone, caps, bytes);
+		if (arena_window_owner(level))
+			ptr = arena_alloc(zone, caps, bytes);
+		if (!ptr)
+			ptr = rmalloc_runtime(zone, caps, bytes);
 		break;
 	default:
 		trace_mem_error("rmalloc() error: invalid zone");
@@ -634,8 +782,12 @@ static void *alloc_heap_buffer(struct mm_heap *heap, int zone, uint32_t caps,
 		if (map->block_size >= bytes && map->free_count) {
 			/* found: grab a block */
 			ptr = alloc_block(heap, i, caps);
+			heap_stats_alloc(heap, map, bytes);
 			break;
 		}
+
+		if (map->block_size >= bytes)
+			map->failures++;
 	}
 
 	/* request spans > 1 block */
@@ -650,12 +802,19 @@ static void *alloc_heap_buffer(struct mm_heap *heap, int zone, uint32_t caps,
 			/* allocate if block size is smaller than request */
 			if (heap->size >= bytes && map->block_size < bytes) {
 				ptr = alloc_cont_blocks(heap, i, caps, bytes);
-				if (ptr)
+				if (ptr) {
+					heap_stats_alloc(heap, map, bytes);
 					break;
+				}
+
+				map->failures++;
 			}
 		}
 	}
 
+	if (!ptr)
+		heap->stats.failures++;
+
 	if (ptr && ((zone & RZONE_FLAG_MASK) == RZONE_FLAG_UNCACHED))
 		ptr = cache_to_uncache(ptr);
 
@@ -667,15 +826,12 @@ static void *alloc_heap_buffer(struct mm_heap *heap, int zone, uint32_t caps,
 	return ptr;
 }
 
-/* allocates continuous buffers - not for direct use, clients use rballoc() */
-void *_balloc(int zone, uint32_t caps, size_t bytes)
+/* allocates continuous buffers from the first heap that fits */
+static void *alloc_buffer_heaps(int zone, uint32_t caps, size_t bytes)
 {
 	struct mm_heap *heap;
 	unsigned int i, n;
 	void *ptr = NULL;
-	uint32_t flags;
-
-	spin_lock_irq(&memmap.lock, flags);
 
 	for (i = 0, n = PLATFORM_HEAP_BUFFER, heap = memmap.buffer;
 	     i < PLATFORM_HEAP_BUFFER;
@@ -691,6 +847,212 @@ void *_balloc(int zone, uint32_t caps, size_t bytes)
 		/* Continue from the next heap */
 	}
 
+	return ptr;
+}
+
+static struct mm_arena *arena_get(uint32_t pipeline_id)
+{
+	struct list_item *alist;
+	struct mm_arena *arena;
+
+	list_for_item(alist, &memmap.arena_list) {
+		arena = container_of(alist, struct mm_arena, list);
+		if (arena->pipeline_id == pipeline_id)
+			return arena;
+	}
+
+	return NULL;
+}
+
+/* flag the blocks of a chunk or clear the flags before it is freed, the
+ * headers after the first block point back to it so that rfree() finds
+ * the chunk of an object without searching the arenas
+ */
+static void arena_chunk_mark(struct mm_arena_chunk *chunk, int set)
+{
+	struct block_map *map = get_map_from_ptr(get_heap_from_ptr(chunk),
+						 chunk);
+	int block = ((uint32_t)chunk - map->base) / map->block_size;
+	struct block_hdr *hdr = &map->block[block];
+	int i;
+
+	if (set)
+		hdr->used |= BLOCK_USED_ARENA;
+	else
+		hdr->used &= ~BLOCK_USED_ARENA;
+
+	for (i = 1; i < hdr->size; i++) {
+		map->block[block + i].size = set ? i : 0;
+		map->block[block + i].used = set ? BLOCK_USED_ARENA : 0;
+	}
+}
+
+/* chunk that an arena object is in, NULL if ptr is not from an arena */
+static struct mm_arena_chunk *arena_chunk_get(void *ptr)
+{
+	struct mm_heap *heap = get_heap_from_ptr(ptr);
+	struct block_map *map;
+	struct block_hdr *hdr;
+	int block;
+
+	/* chunks are only taken from the buffer heaps */
+	if (!heap || heap < memmap.buffer ||
+	    heap >= memmap.buffer + PLATFORM_HEAP_BUFFER)
+		return NULL;
+
+	map = get_map_from_ptr(heap, ptr);
+	if (!map)
+		return NULL;
+
+	block = ((uint32_t)ptr - map->base) / map->block_size;
+	hdr = &map->block[block];
+	if (!(hdr->used & BLOCK_USED_ARENA))
+		return NULL;
+
+	if (!(hdr->used & BLOCK_USED))
+		block -= hdr->size;
+
+	return (struct mm_arena_chunk *)(map->base + block * map->block_size);
+}
+
+static struct mm_arena_chunk *arena_chunk_new(size_t bytes)
+{
+	struct mm_arena_chunk *chunk;
+	size_t size = bytes > ARENA_CHUNK_SIZE ? bytes : ARENA_CHUNK_SIZE;
+
+	chunk = alloc_buffer_heaps(RZONE_BUFFER, SOF_MEM_CAPS_RAM, size);
+	if (!chunk)
+		return NULL;
+
+	arena_chunk_mark(chunk, 1);
+	chunk->next = NULL;
+	chunk->size = size;
+	chunk->used = ARENA_ALIGN(sizeof(*chunk));
+
+	return chunk;
+}
+
+/* allocate from the arena of the open window, NULL falls back to the heap */
+static void *arena_alloc(int zone, uint32_t caps, size_t bytes)
+{
+	struct mm_arena *arena;
+	struct mm_arena_chunk *chunk;
+	uint32_t size = ARENA_ALIGN(bytes);
+	void *ptr;
+
+	/* chunks are plain RAM */
+	if (caps & ~SOF_MEM_CAPS_RAM)
+		return NULL;
+
+	/* the first allocation creates the arena in the head of its chunk */
+	arena = arena_get(memmap.arena_pipeline_id);
+	if (!arena) {
+		chunk = arena_chunk_new(ARENA_ALIGN(sizeof(*chunk)) +
+					ARENA_ALIGN(sizeof(*arena)) + size);
+		if (!chunk)
+			return NULL;
+
+		arena = (struct mm_arena *)((char *)chunk + chunk->used);
+		chunk->used += ARENA_ALIGN(sizeof(*arena));
+		arena->pipeline_id = memmap.arena_pipeline_id;
+		arena->refs = 0;
+		arena->chunk = chunk;
+		chunk->arena = arena;
+		list_item_append(&arena->list, &memmap.arena_list);
+	}
+
+	chunk = arena->chunk;
+	if (chunk->used + size > chunk->size) {
+		chunk = arena_chunk_new(ARENA_ALIGN(sizeof(*chunk)) + size);
+		if (!chunk)
+			return NULL;
+
+		chunk->next = arena->chunk;
+		chunk->arena = arena;
+		arena->chunk = chunk;
+	}
+
+	ptr = (char *)chunk + chunk->used;
+	chunk->used += size;
+	arena->refs++;
+
+	if ((zone & RZONE_FLAG_MASK) == RZONE_FLAG_UNCACHED)
+		ptr = cache_to_uncache(ptr);
+
+	return ptr;
+}
+
+/* give all arena chunks back to the buffer heap */
+static void arena_release(struct mm_arena *arena)
+{
+	struct mm_arena_chunk *chunk = arena->chunk;
+	struct mm_arena_chunk *next;
+
+	list_item_del(&arena->list);
+
+	/* the arena lives in its oldest chunk, which is freed last */
+	while (chunk) {
+		next = chunk->next;
+		arena_chunk_mark(chunk, 0);
+		free_block(chunk);
+		chunk = next;
+	}
+}
+
+/* drop an arena allocation, returns 0 if ptr is not from an arena */
+static int arena_free(void *ptr)
+{
+	struct mm_arena_chunk *chunk = arena_chunk_get(ptr);
+
+	if (!chunk)
+		return 0;
+
+	if (!--chunk->arena->refs)
+		arena_release(chunk->arena);
+
+	return 1;
+}
+
+/* Only the context that opened the window allocates from the arena. LL
+ * work that preempts the IPC task on the same core runs at a higher
+ * interrupt level, and the EDF tasks at the IPC task level don't preempt
+ * it, so the level read before taking the lock tells them apart.
+ */
+static int arena_window_owner(uint32_t level)
+{
+	return memmap.arena_core == cpu_get_id() &&
+		memmap.arena_level == level;
+}
+
+void alloc_arena_enter(uint32_t pipeline_id)
+{
+	uint32_t level = arch_interrupt_get_level();
+	uint32_t flags;
+
+	spin_lock_irq(&memmap.lock, flags);
+	memmap.arena_pipeline_id = pipeline_id;
+	memmap.arena_core = cpu_get_id();
+	memmap.arena_level = level;
+	spin_unlock_irq(&memmap.lock, flags);
+}
+
+void alloc_arena_exit(void)
+{
+	uint32_t flags;
+
+	spin_lock_irq(&memmap.lock, flags);
+	memmap.arena_core = -1;
+	spin_unlock_irq(&memmap.lock, flags);
+}
+
+/* allocates continuous buffers - not for direct use, clients use rballoc() */
+void *_balloc(int zone, uint32_t caps, size_t bytes)
+{
+	void *ptr;
+	uint32_t flags;
+
+	spin_lock_irq(&memmap.lock, flags);
+	ptr = alloc_buffer_heaps(zone, caps, bytes);
 	spin_unlock_irq(&memmap.lock, flags);
 
 	return ptr;
@@ -721,13 +1083,100 @@ void rfree(void *ptr)
 		panic(SOF_IPC_PANIC_MEM);
 	}
 
-	/* free the block */
+	/* free the block, arena chunks are freed with the last object */
 	spin_lock_irq(&memmap.lock, flags);
-	free_block(ptr);
+	if (!arena_free(ptr))
+		free_block(ptr);
 	spin_unlock_irq(&memmap.lock, flags);
 	memmap.heap_trace_updated = 1;
 }
 
+static struct mm_heap *heap_get(uint32_t type, uint32_t index)
+{
+	switch (type) {
+	case SOF_IPC_HEAP_SYS_RUNTIME:
+		if (index < PLATFORM_HEAP_SYSTEM_RUNTIME)
+			return memmap.system_runtime + index;
+		break;
+	case SOF_IPC_HEAP_RUNTIME:
+		if (index < PLATFORM_HEAP_RUNTIME)
+			return memmap.runtime + index;
+		break;
+	case SOF_IPC_HEAP_BUFFER:
+		if (index < PLATFORM_HEAP_BUFFER)
+			return memmap.buffer + index;
+		break;
+	}
+
+	return NULL;
+}
+
+/* read heap and block map statistics, free runs are measured on demand */
+int heap_get_stats(uint32_t type, uint32_t index,
+		   struct sof_ipc_heap_stats *stats, uint32_t flags)
+{
+	struct sof_ipc_heap_map_stats *map_stats;
+	struct mm_heap *heap = heap_get(type, index);
+	struct block_map *map;
+	uint32_t irq_flags;
+	uint32_t largest;
+	int i;
+
+	if (!heap)
+		return -EINVAL;
+
+	spin_lock_irq(&memmap.lock, irq_flags);
+
+	stats->heap = type;
+	stats->index = index;
+	stats->caps = heap->caps;
+	stats->size = heap->size;
+	stats->used = heap->info.used;
+	stats->free = heap->info.free;
+	stats->peak_used = heap->stats.peak_used;
+	stats->failures = heap->stats.failures;
+	stats->largest_free = 0;
+
+	for (i = 0; i < MM_SIZE_BUCKETS; i++)
+		stats->sizes[i] = heap->stats.sizes[i];
+
+	stats->num_maps = heap->blocks < SOF_IPC_HEAP_STATS_MAPS ?
+		heap->blocks : SOF_IPC_HEAP_STATS_MAPS;
+
+	for (i = 0; i < heap->blocks; i++) {
+		map = &heap->map[i];
+		largest = block_largest_run(map);
+
+		if (largest * map->block_size > stats->largest_free)
+			stats->largest_free = largest * map->block_size;
+
+		if (i < SOF_IPC_HEAP_STATS_MAPS) {
+			map_stats = &stats->map[i];
+			map_stats->block_size = map->block_size;
+			map_stats->count = map->count;
+			map_stats->free = map->free_count;
+			map_stats->peak_used = map->peak_used;
+			map_stats->largest_free = largest;
+			map_stats->failures = map->failures;
+		}
+
+		if (flags & SOF_IPC_HEAP_STATS_RESET) {
+			map->peak_used = map->count - map->free_count;
+			map->failures = 0;
+		}
+	}
+
+	if (flags & SOF_IPC_HEAP_STATS_RESET) {
+		heap->stats.peak_used = heap->info.used;
+		heap->stats.failures = 0;
+		bzero(heap->stats.sizes, sizeof(heap->stats.sizes));
+	}
+
+	spin_unlock_irq(&memmap.lock, irq_flags);
+
+	return 0;
+}
+
 /* TODO: all mm_pm_...() routines to be implemented for IMR storage */
 uint32_t mm_pm_context_size(void)
 {
@@ -787,6 +1236,8 @@ void heap_trace(struct mm_heap *heap, int size)
 			       heap->caps);
 		trace_mem_init("  used %d free %d", heap->info.used,
 			       heap->info.free);
+		trace_mem_init("  peak %d failures %d",
+			       heap->stats.peak_used, heap->stats.failures);
 
 		/* map[j]'s base is calculated based on map[j-1] */
 		for (j = 1; j < heap->blocks; j++) {
@@ -798,12 +1249,35 @@ void heap_trace(struct mm_heap *heap, int size)
 			trace_mem_init("   count %d free %d",
 				       current_map->count,
 				       current_map->free_count);
+			trace_mem_init("   peak %d largest free %d failures %d",
+				       current_map->peak_used,
+				       block_largest_run(current_map),
+				       current_map->failures);
 		}
 
 		heap++;
 	}
 }
 
+static void arena_trace(void)
+{
+	struct list_item *alist;
+	struct mm_arena *arena;
+	struct mm_arena_chunk *chunk;
+	int chunks;
+
+	list_for_item(alist, &memmap.arena_list) {
+		arena = container_of(alist, struct mm_arena, list);
+
+		chunks = 0;
+		for (chunk = arena->chunk; chunk; chunk = chunk->next)
+			chunks++;
+
+		trace_mem_init(" arena: pipeline %d refs %d chunks %d",
+			       arena->pipeline_id, arena->refs, chunks);
+	}
+}
+
 void heap_trace_all(int force)
 {
 	/* has heap changed since last shown */
@@ -812,6 +1286,8 @@ void heap_trace_all(int force)
 		heap_trace(memmap.buffer, PLATFORM_HEAP_BUFFER);
 		trace_mem_init("heap: runtime status");
 		heap_trace(memmap.runtime, PLATFORM_HEAP_RUNTIME);
+		trace_mem_init("heap: pipeline arenas");
+		arena_trace();
 	}
 	memmap.heap_trace_updated = 0;
 }
@@ -829,6 +1305,9 @@ void init_heap(struct sof *sof)
 
 	spinlock_init(&memmap.lock);
 
+	list_init(&memmap.arena_list);
+	memmap.arena_core = -1;
+
 	init_heap_map(memmap.system_runtime, PLATFORM_HEAP_SYSTEM_RUNTIME);
 
 	init_heap_map(memmap.runtime, PLATFORM_HEAP_RUNTIME);
@@ -39,27 +39,263 @@
 #include <platform/platform.h>
 #include <sof/lock.h>
 #include <sof/cpu.h>
+#include <sof/interrupt.h>
+#include <uapi/user/trace.h>
 #include <stdint.h>
 
 static struct dma_trace_data *trace_data = NULL;
 
-/* amount of dropped entries */
-static uint32_t dropped_entries;
-
 static int dma_trace_get_avail_data(struct dma_trace_data *d,
 				    struct dma_trace_buf *buffer,
 				    int avail);
 
+static void dtrace_ring_write(struct dma_trace_ring *ring, uint32_t pos,
+			      const void *src, uint32_t size)
+{
+	uint32_t offset = pos & (DMA_TRACE_RING_SIZE - 1);
+	uint32_t margin = DMA_TRACE_RING_SIZE - offset;
+	char *addr = (char *)ring->addr;
+
+	if (size <= margin) {
+		memcpy(addr + offset, src, size);
+	} else {
+		memcpy(addr + offset, src, margin);
+		memcpy(addr, (const char *)src + margin, size - margin);
+	}
+}
+
+static void dtrace_ring_read(struct dma_trace_ring *ring, uint32_t pos,
+			     void *dst, uint32_t size)
+{
+	uint32_t offset = pos & (DMA_TRACE_RING_SIZE - 1);
+	uint32_t margin = DMA_TRACE_RING_SIZE - offset;
+	char *addr = (char *)ring->addr;
+
+	if (size <= margin) {
+		memcpy(dst, addr + offset, size);
+	} else {
+		memcpy(dst, addr + offset, margin);
+		memcpy((char *)dst + margin, addr, size - margin);
+	}
+}
+
+/* get length and timestamp of the oldest committed event in the ring */
+static int dtrace_ring_peek(struct dma_trace_ring *ring, uint32_t *length,
+			    uint64_t *timestamp)
+{
+	struct log_entry_header header;
+
+	if (ring->read == ring->commit)
+		return 0;
+
+	dtrace_ring_read(ring, ring->read, length, sizeof(*length));
+	dtrace_ring_read(ring, ring->read + sizeof(*length), &header,
+			 sizeof(header));
+	*timestamp = header.timestamp;
+
+	return 1;
+}
+
+#if CONFIG_TRACE_COMPACT
+
+static void dtrace_buf_write(struct dma_trace_buf *buffer, const void *src,
+			     uint32_t size)
+{
+	uint32_t margin = buffer->end_addr - buffer->w_ptr;
+
+	if (size < margin) {
+		memcpy(buffer->w_ptr, src, size);
+		buffer->w_ptr += size;
+	} else {
+		/* data is bigger than remaining margin so we wrap */
+		memcpy(buffer->w_ptr, src, margin);
+		memcpy(buffer->addr, (const char *)src + margin, size - margin);
+		buffer->w_ptr = buffer->addr + size - margin;
+	}
+
+	buffer->avail += size;
+}
+
+/*
+ * Send one event from the ring as a compact record, its timestamp as the
+ * delta to the previous record. Returns the record size, or 0 if it does
+ * not fit in space bytes together with the padding of dtrace_buf_end().
+ */
+static uint32_t dtrace_buf_put(struct dma_trace_data *d,
+			       struct dma_trace_ring *ring, uint32_t length,
+			       uint32_t space)
+{
+	struct dtrace_compact_event event;
+	uint8_t head[10];
+	uint64_t timestamp;
+	uint64_t value;
+	uint32_t head_size;
+	uint32_t body_size;
+	uint32_t size;
+
+	dtrace_ring_read(ring, ring->read + sizeof(length), &event, length);
+	timestamp = (uint64_t)event.timestamp_hi << 32 | event.timestamp_lo;
+	body_size = event.flags >> DTRACE_COMPACT_SIZE_SHIFT;
+	value = event.flags & (TRACE_COMPACT_CORE_MASK | TRACE_COMPACT_IDS);
+
+	/* absolute timestamp to let the host resync, or if not in order */
+	if (d->compact_sync || timestamp < d->compact_timestamp)
+		value |= TRACE_COMPACT_ABS |
+			timestamp << TRACE_COMPACT_TS_SHIFT;
+	else
+		value |= (timestamp - d->compact_timestamp) <<
+			TRACE_COMPACT_TS_SHIFT;
+
+	head_size = dtrace_varint_put64(head, value);
+	size = head_size + body_size;
+	if (size + sizeof(uint32_t) - 1 > space)
+		return 0;
+
+	dtrace_buf_write(&d->dmatb, head, head_size);
+	dtrace_buf_write(&d->dmatb, event.body, body_size);
+
+	d->compact_timestamp = timestamp;
+	d->compact_sync = 0;
+
+	return size;
+}
+
+/* pad the records sent so far to the DMA width */
+static void dtrace_buf_end(struct dma_trace_data *d)
+{
+	struct dma_trace_buf *buffer = &d->dmatb;
+	uint8_t pad = TRACE_COMPACT_PAD;
+
+	while ((buffer->w_ptr - buffer->addr) % sizeof(uint32_t))
+		dtrace_buf_write(buffer, &pad, sizeof(pad));
+}
+
+#else
+
+/* append one event from the ring to the local DMA buffer */
+static void dtrace_buf_copy(struct dma_trace_buf *buffer,
+			    struct dma_trace_ring *ring, uint32_t length)
+{
+	uint32_t pos = ring->read + sizeof(length);
+	uint32_t margin = buffer->end_addr - buffer->w_ptr;
+
+	if (length < margin) {
+		dtrace_ring_read(ring, pos, buffer->w_ptr, length);
+		buffer->w_ptr += length;
+	} else {
+		/* data is bigger than remaining margin so we wrap */
+		dtrace_ring_read(ring, pos, buffer->w_ptr, margin);
+		dtrace_ring_read(ring, pos + margin, buffer->addr,
+				 length - margin);
+		buffer->w_ptr = buffer->addr + length - margin;
+	}
+
+	buffer->avail += length;
+}
+
+/* send one event from the ring as it is, if it fits in space bytes */
+static uint32_t dtrace_buf_put(struct dma_trace_data *d,
+			       struct dma_trace_ring *ring, uint32_t length,
+			       uint32_t space)
+{
+	if (length > space)
+		return 0;
+
+	dtrace_buf_copy(&d->dmatb, ring, length);
+
+	return length;
+}
+
+static inline void dtrace_buf_end(struct dma_trace_data *d)
+{
+}
+
+#endif
+
+/*
+ * Move committed events from the core rings to the local DMA buffer in
+ * timestamp order, while they fit in space bytes.
+ */
+static void dtrace_merge(struct dma_trace_data *d, uint32_t space)
+{
+	uint64_t timestamp[PLATFORM_CORE_COUNT];
+	uint32_t length[PLATFORM_CORE_COUNT];
+	int ready[PLATFORM_CORE_COUNT];
+	struct dma_trace_ring *ring;
+	uint32_t size;
+	int core;
+	int i;
+
+#if CONFIG_TRACE_COMPACT
+	/* start every batch with an absolute timestamp */
+	d->compact_sync = 1;
+#endif
+
+	for (i = 0; i < PLATFORM_CORE_COUNT; i++)
+		ready[i] = d->ring[i].addr &&
+			dtrace_ring_peek(&d->ring[i], &length[i],
+					 &timestamp[i]);
+
+	for (;;) {
+		/* pick the ring holding the oldest event */
+		core = -1;
+		for (i = 0; i < PLATFORM_CORE_COUNT; i++) {
+			if (ready[i] &&
+			    (core < 0 || timestamp[i] < timestamp[core]))
+				core = i;
+		}
+
+		if (core < 0)
+			break;
+
+		ring = &d->ring[core];
+		size = dtrace_buf_put(d, ring, length[core], space);
+		if (!size)
+			break;
+
+		ring->read += sizeof(length[core]) + length[core];
+		space -= size;
+		d->messages++;
+
+		ready[core] = dtrace_ring_peek(ring, &length[core],
+					       &timestamp[core]);
+	}
+
+	dtrace_buf_end(d);
+}
+
+/* log events dropped on any core since the last report */
+static void dtrace_report_dropped(struct dma_trace_data *d)
+{
+	struct dma_trace_ring *ring;
+	uint32_t dropped;
+	int i;
+
+	for (i = 0; i < PLATFORM_CORE_COUNT; i++) {
+		ring = &d->ring[i];
+		dropped = ring->dropped - ring->dropped_logged;
+		if (!dropped)
+			continue;
+
+		ring->dropped_logged += dropped;
+		trace_error(TRACE_CLASS_BUFFER, "trace_work() error: "
+			    "core %d dropped %u logs", i, dropped);
+	}
+}
+
 static uint64_t trace_work(void *data)
 {
 	struct dma_trace_data *d = (struct dma_trace_data *)data;
 	struct dma_trace_buf *buffer = &d->dmatb;
 	struct dma_sg_config *config = &d->config;
-	unsigned long flags;
-	uint32_t avail = buffer->avail;
+	uint32_t avail;
 	int32_t size;
 	uint32_t overflow;
 
+	/* gather new events from all cores */
+	dtrace_merge(d, DMA_TRACE_LOCAL_SIZE - buffer->avail);
+	avail = buffer->avail;
+
 	/* make sure we don't write more than buffer */
 	if (avail > DMA_TRACE_LOCAL_SIZE) {
 		overflow = avail - DMA_TRACE_LOCAL_SIZE;
@@ -82,6 +318,9 @@ static uint64_t trace_work(void *data)
 	/* DMA trace copying is working */
 	d->copy_in_progress = 1;
 
+	/* events dropped by full rings have left room for this by now */
+	dtrace_report_dropped(d);
+
 	/* copy this section to host */
 	size = dma_copy_to_host_nowait(&d->dc, config, d->host_offset,
 		buffer->r_ptr, size);
@@ -102,8 +341,6 @@ static uint64_t trace_work(void *data)
 		buffer->r_ptr -= DMA_TRACE_LOCAL_SIZE;
 
 out:
-	spin_lock_irq(&d->lock, flags);
-
 	/* disregard any old messages and don't resend them if we overflow */
 	if (size > 0) {
 		if (d->overflow)
@@ -115,8 +352,6 @@ out:
 	/* DMA trace copying is done, allow reschedule */
 	d->copy_in_progress = 0;
 
-	spin_unlock_irq(&d->lock, flags);
-
 	/* reschedule the trace copying work */
 	return DMA_TRACE_PERIOD;
 }
@@ -127,7 +362,6 @@ int dma_trace_init_early(struct sof *sof)
 			     sizeof(*trace_data));
 
 	dma_sg_init(&trace_data->config.elem_array);
-	spinlock_init(&trace_data->lock);
 	sof->dmat = trace_data;
 
 	return 0;
@@ -168,6 +402,19 @@ int dma_trace_host_buffer(struct dma_trace_data *d,
 static int dma_trace_buffer_init(struct dma_trace_data *d)
 {
 	struct dma_trace_buf *buffer = &d->dmatb;
+	int i;
+
+	/* event rings are uncached so the master core sees them as written */
+	for (i = 0; i < PLATFORM_CORE_COUNT; i++) {
+		d->ring[i].addr = rballoc(RZONE_BUFFER | RZONE_FLAG_UNCACHED,
+					  SOF_MEM_CAPS_RAM,
+					  DMA_TRACE_RING_SIZE);
+		if (!d->ring[i].addr) {
+			trace_buffer_error("dma_trace_buffer_init() error: "
+					   "ring alloc failed");
+			return -ENOMEM;
+		}
+	}
 
 	/* allocate new buffer */
 	buffer->addr = rballoc(RZONE_BUFFER,
@@ -344,6 +591,9 @@ void dma_trace_flush(void *t)
 		return;
 
 	buffer = &trace_data->dmatb;
+
+	/* take the latest events too, even over ones not sent yet */
+	dtrace_merge(trace_data, DMA_TRACE_LOCAL_SIZE);
 	avail = buffer->avail;
 
 	/* number of bytes to flush */
@@ -373,118 +623,80 @@ void dma_trace_flush(void *t)
 	dcache_writeback_invalidate_region((void *)t, size);
 }
 
-static int dtrace_calc_buf_overflow(struct dma_trace_buf *buffer,
-				    uint32_t length)
+/*
+ * Reserve space in the ring of the calling core, copy the event and
+ * commit it. Only interrupts on the same core can race with the producer,
+ * so masking them around the position updates is all the locking needed.
+ * Events reserved by interrupted producers become visible together once
+ * the outermost one commits, so the consumer never sees a partial event.
+ */
+static void dtrace_add_event(struct dma_trace_ring *ring, const char *e,
+			     uint32_t length)
 {
-	uint32_t margin;
-	uint32_t overflow_margin;
-	uint32_t overflow = 0;
+	uint32_t flags;
+	uint32_t pos;
 
-	margin = dtrace_calc_buf_margin(buffer);
+	flags = interrupt_global_disable();
 
-	/* overflow calculating */
-	if (buffer->w_ptr < buffer->r_ptr)
-		overflow_margin = buffer->r_ptr - buffer->w_ptr - 1;
-	else
-		overflow_margin = margin + buffer->r_ptr - buffer->addr - 1;
+	pos = ring->reserve;
+	if (pos + sizeof(length) + length - ring->read > DMA_TRACE_RING_SIZE) {
+		/* if there is not enough memory for new log, we drop it */
+		ring->dropped++;
+		interrupt_global_enable(flags);
+		return;
+	}
 
-	if (overflow_margin < length)
-		overflow = length - overflow_margin;
+	ring->reserve = pos + sizeof(length) + length;
+	ring->nest++;
 
-	return overflow;
+	interrupt_global_enable(flags);
+
+	dtrace_ring_write(ring, pos, &length, sizeof(length));
+	dtrace_ring_write(ring, pos + sizeof(length), e, length);
+
+	flags = interrupt_global_disable();
+
+	if (!--ring->nest)
+		ring->commit = ring->reserve;
+
+	interrupt_global_enable(flags);
 }
 
-static void dtrace_add_event(const char *e, uint32_t length)
+static int dtrace_half_full(struct dma_trace_data *d)
 {
-	struct dma_trace_buf *buffer = &trace_data->dmatb;
-	uint32_t margin;
-	uint32_t overflow = 0;
-
-	margin = dtrace_calc_buf_margin(buffer);
-	overflow = dtrace_calc_buf_overflow(buffer, length);
-
-	/* tracing dropped entries */
-	if (dropped_entries) {
-		if (!overflow) {
-			/*
-			 * if any dropped entries have appeared and there
-			 * is not any overflow, their amount will be logged
-			 */
-#if CONFIG_TRACE
-			uint32_t tmp_dropped_entries = dropped_entries;
-#endif
-			dropped_entries = 0;
-			/*
-			 * this trace_error invocation causes recursion,
-			 * so after it we have to recalculate margin and
-			 * overflow
-			 */
-			trace_error(0, "dtrace_add_event() error: "
-				    "number of dropped logs = %u",
-				    tmp_dropped_entries);
-			margin = dtrace_calc_buf_margin(buffer);
-			overflow = dtrace_calc_buf_overflow(buffer, length);
-		}
-	}
+	int i;
 
-	/* checking overflow */
-	if (!overflow) {
-		/* check for buffer wrap */
-		if (margin > length) {
-			/* no wrap */
-			memcpy(buffer->w_ptr, e, length);
-			dcache_writeback_invalidate_region(buffer->w_ptr,
-							   length);
-			buffer->w_ptr += length;
-		} else {
-			/* data is bigger than remaining margin so we wrap */
-			memcpy(buffer->w_ptr, e, margin);
-			dcache_writeback_invalidate_region(buffer->w_ptr,
-							   margin);
-			buffer->w_ptr = buffer->addr;
-
-			memcpy(buffer->w_ptr, e + margin, length - margin);
-			dcache_writeback_invalidate_region(buffer->w_ptr,
-							   length - margin);
-			buffer->w_ptr += length - margin;
-		}
-
-		buffer->avail += length;
-		trace_data->messages++;
-	} else {
-		/* if there is not enough memory for new log, we drop it */
-		dropped_entries++;
+	for (i = 0; i < PLATFORM_CORE_COUNT; i++) {
+		if (d->ring[i].commit - d->ring[i].read >=
+		    DMA_TRACE_RING_SIZE / 2)
+			return 1;
 	}
+
+	return d->dmatb.avail >= DMA_TRACE_LOCAL_SIZE / 2;
 }
 
 void dtrace_event(const char *e, uint32_t length)
 {
-	struct dma_trace_buf *buffer = NULL;
-	unsigned long flags;
+	struct dma_trace_ring *ring;
 
-	if (!trace_data || !trace_data->dmatb.addr ||
-	    length > DMA_TRACE_LOCAL_SIZE / 8 || length == 0)
+	if (!trace_data || length > DMA_TRACE_LOCAL_SIZE / 8 || length == 0)
 		return;
 
-	buffer = &trace_data->dmatb;
+	ring = &trace_data->ring[cpu_get_id()];
+	if (!ring->addr)
+		return;
 
-	spin_lock_irq(&trace_data->lock, flags);
-	dtrace_add_event(e, length);
+	dtrace_add_event(ring, e, length);
 
 	/* if DMA trace copying is working or slave core
 	 * don't check if local buffer is half full
 	 */
 	if (trace_data->copy_in_progress ||
-	    cpu_get_id() != PLATFORM_MASTER_CORE_ID) {
-		spin_unlock_irq(&trace_data->lock, flags);
+	    cpu_get_id() != PLATFORM_MASTER_CORE_ID)
 		return;
-	}
-
-	spin_unlock_irq(&trace_data->lock, flags);
 
 	/* schedule copy now if buffer > 50% full */
-	if (trace_data->enabled &&
-	    buffer->avail >= (DMA_TRACE_LOCAL_SIZE / 2)) {
+	if (trace_data->enabled && dtrace_half_full(trace_data)) {
 		reschedule_task(&trace_data->dmat_work,
 				DMA_TRACE_RESCHEDULE_TIME);
 		/* reschedule should not be interrupted
@@ -496,9 +708,14 @@ void dtrace_event(const char *e, uint32_t length)
 
 void dtrace_event_atomic(const char *e, uint32_t length)
 {
-	if (!trace_data || !trace_data->dmatb.addr ||
-	    length > DMA_TRACE_LOCAL_SIZE / 8 || length == 0)
+	struct dma_trace_ring *ring;
+
+	if (!trace_data || length > DMA_TRACE_LOCAL_SIZE / 8 || length == 0)
+		return;
+
+	ring = &trace_data->ring[cpu_get_id()];
+	if (!ring->addr)
 		return;
 
-	dtrace_add_event(e, length);
+	dtrace_add_event(ring, e, length);
 }
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <sof/alloc.h>
+#include <sof/string.h>
+#include <sof/edf_queue.h>
+
+/* does task a run before task b ? */
+static inline int edf_queue_before(struct task *a, struct task *b)
+{
+	struct edf_task_pdata *pa = edf_sch_get_pdata(a);
+	struct edf_task_pdata *pb = edf_sch_get_pdata(b);
+
+	if (a->priority != b->priority)
+		return a->priority < b->priority;
+
+	return pa->deadline < pb->deadline;
+}
+
+static inline void edf_queue_set(struct edf_queue *queue, uint32_t idx,
+				 struct task *task)
+{
+	struct edf_task_pdata *edf_pdata = edf_sch_get_pdata(task);
+
+	queue->tasks[idx] = task;
+	edf_pdata->queue_idx = idx;
+}
+
+static void edf_queue_sift_up(struct edf_queue *queue, uint32_t idx)
+{
+	struct task *task = queue->tasks[idx];
+	uint32_t parent;
+
+	while (idx) {
+		parent = (idx - 1) >> 1;
+		if (!edf_queue_before(task, queue->tasks[parent]))
+			break;
+
+		edf_queue_set(queue, idx, queue->tasks[parent]);
+		idx = parent;
+	}
+
+	edf_queue_set(queue, idx, task);
+}
+
+static void edf_queue_sift_down(struct edf_queue *queue, uint32_t idx)
+{
+	struct task *task = queue->tasks[idx];
+	uint32_t child;
+
+	for (;;) {
+		child = (idx << 1) + 1;
+		if (child >= queue->count)
+			break;
+
+		/* pick the earlier of the two children */
+		if (child + 1 < queue->count &&
+		    edf_queue_before(queue->tasks[child + 1],
+				     queue->tasks[child]))
+			child++;
+
+		if (!edf_queue_before(queue->tasks[child], task))
+			break;
+
+		edf_queue_set(queue, idx, queue->tasks[child]);
+		idx = child;
+	}
+
+	edf_queue_set(queue, idx, task);
+}
+
+static int edf_queue_grow(struct edf_queue *queue, uint32_t size)
+{
+	struct task **tasks;
+
+	tasks = rzalloc(RZONE_SYS_RUNTIME, SOF_MEM_CAPS_RAM,
+			size * sizeof(*tasks));
+	if (!tasks)
+		return -ENOMEM;
+
+	if (queue->tasks) {
+		memcpy_s(tasks, size * sizeof(*tasks), queue->tasks,
+			 queue->count * sizeof(*tasks));
+		rfree(queue->tasks);
+	}
+
+	queue->tasks = tasks;
+	queue->size = size;
+
+	return 0;
+}
+
+int edf_queue_init(struct edf_queue *queue)
+{
+	queue->tasks = NULL;
+	queue->count = 0;
+	queue->size = 0;
+
+	return edf_queue_grow(queue, EDF_QUEUE_INIT_SIZE);
+}
+
+void edf_queue_free(struct edf_queue *queue)
+{
+	rfree(queue->tasks);
+	queue->tasks = NULL;
+	queue->count = 0;
+	queue->size = 0;
+}
+
+/* add task to the queue, the heap only grows when it runs out of slots */
+int edf_queue_insert(struct edf_queue *queue, struct task *task)
+{
+	int ret;
+
+	if (queue->count == queue->size) {
+		ret = edf_queue_grow(queue, queue->size << 1);
+		if (ret < 0)
+			return ret;
+	}
+
+	queue->tasks[queue->count] = task;
+	edf_queue_sift_up(queue, queue->count++);
+
+	return 0;
+}
+
+void edf_queue_remove(struct edf_queue *queue, struct task *task)
+{
+	struct edf_task_pdata *edf_pdata = edf_sch_get_pdata(task);
+	uint32_t idx = edf_pdata->queue_idx;
+	struct task *last;
+
+	if (!edf_queue_contains(queue, task))
+		return;
+
+	last = queue->tasks[--queue->count];
+	if (last == task)
+		return;
+
+	/* move the last task into the hole and restore the heap order */
+	edf_queue_set(queue, idx, last);
+	edf_queue_update(queue, last);
+}
+
+/* restore heap order after the deadline or priority of task changed */
+void edf_queue_update(struct edf_queue *queue, struct task *task)
+{
+	struct edf_task_pdata *edf_pdata = edf_sch_get_pdata(task);
+	uint32_t idx = edf_pdata->queue_idx;
+
+	if (idx && edf_queue_before(task, queue->tasks[(idx - 1) >> 1]))
+		edf_queue_sift_up(queue, idx);
+	else
+		edf_queue_sift_down(queue, idx);
+}
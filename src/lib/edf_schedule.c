@@ -39,6 +39,7 @@
 #include <sof/debug.h>
 #include <sof/clk.h>
 #include <sof/edf_schedule.h>
+#include <sof/edf_queue.h>
 #include <sof/ll_schedule.h>
 #include <platform/timer.h>
 #include <platform/clk.h>
@@ -48,7 +49,7 @@
 
 struct edf_schedule_data {
 	spinlock_t lock;
-	struct list_item list;	/* list of tasks in priority queue */
+	struct edf_queue queue;	/* queued tasks ordered by priority/deadline */
 	struct list_item idle_list; /* list of queued idle tasks */
 	uint32_t clock;
 };
@@ -98,85 +99,50 @@ static inline void edf_reschedule(struct task *task, uint64_t current)
 }
 
 /*
- * Find the first non running task with the earliest deadline.
+ * Find the queued task with the highest priority and the earliest deadline.
+ * Tasks that missed their deadline are found when they reach the head of
+ * the queue. The first one is rescheduled and any further ones are
+ * cancelled.
  * TODO: Reduce cache invalidations by checking if the currently
  * running task AND the earliest queued task will both complete before their
  * deadlines. If so, then schedule the earlier queued task after the currently
  * running task has completed.
  */
-static inline struct task *edf_get_next(uint64_t current, struct task *ignore)
+static inline struct task *edf_get_next(uint64_t current)
 {
 	struct edf_schedule_data *sch =
 		(*arch_schedule_get_data())->edf_sch_data;
-	struct list_item *clist;
-	struct list_item *tlist;
-	uint64_t next_delta = UINT64_MAX;
-	int next_priority = SOF_TASK_PRI_LOW;
-	uint64_t delta;
-	uint64_t deadline;
 	int reschedule = 0;
-	struct task *edf_task_next = NULL;
 	struct task *edf_task;
 	struct edf_task_pdata *edf_pdata;
 
-	/* any tasks in the scheduler ? */
-	if (list_is_empty(&sch->list)) {
-		return NULL;
-	}
-
-	/* check every queued or running task in list */
-	list_for_item_safe(clist, tlist, &sch->list) {
-		edf_task = container_of(clist, struct task, list);
+	while ((edf_task = edf_queue_peek(&sch->queue))) {
+		edf_pdata = edf_sch_get_pdata(edf_task);
 
-		/* only check queued tasks */
-		if (edf_task->state != SOF_TASK_STATE_QUEUED)
-			continue;
+		if (current < edf_pdata->deadline)
+			return edf_task;
 
-		/* ignore the ignored tasks */
-		if (edf_task == ignore)
-			continue;
+		/* missed scheduling - will be rescheduled */
+		trace_edf_sch("edf_get_next(), "
+			   "missed scheduling - will be rescheduled");
 
-		edf_pdata = edf_sch_get_pdata(edf_task);
-
-		deadline = edf_pdata->deadline;
-
-		if (current < deadline) {
-			delta = deadline - current;
-
-			/* get highest priority */
-			if (edf_task->priority < next_priority) {
-				next_priority = edf_task->priority;
-				next_delta = delta;
-				edf_task_next = edf_task;
-			} else if (edf_task->priority == next_priority) {
-				/* get earliest deadline */
-				if (delta < next_delta) {
-					next_delta = delta;
-					edf_task_next = edf_task;
-				}
-			}
-		} else {
-			/* missed scheduling - will be rescheduled */
+		/* have we already tried to reschedule ? */
+		if (!reschedule) {
+			reschedule++;
 			trace_edf_sch("edf_get_next(), "
-				   "missed scheduling - will be rescheduled");
-
-			/* have we already tried to reschedule ? */
-			if (!reschedule) {
-				reschedule++;
-				trace_edf_sch("edf_get_next(), "
-					       "didn't try to reschedule yet");
-				edf_reschedule(edf_task, current);
-			} else {
-				/* reschedule failed */
-				list_item_del(&edf_task->list);
-				edf_task->state = SOF_TASK_STATE_CANCEL;
-				trace_edf_sch_error("edf_get_next(), "
-						     "task cancelled");
-			}
+				       "didn't try to reschedule yet");
+			edf_reschedule(edf_task, current);
+			edf_queue_update(&sch->queue, edf_task);
+		} else {
+			/* reschedule failed */
+			edf_queue_remove(&sch->queue, edf_task);
+			edf_task->state = SOF_TASK_STATE_CANCEL;
+			trace_edf_sch_error("edf_get_next(), "
+					     "task cancelled");
 		}
 	}
 
-	return edf_task_next;
+	return NULL;
 }
 
 /*
@@ -199,14 +165,14 @@ static struct task *sch_edf(void)
 
 	interrupt_clear(PLATFORM_SCHEDULE_IRQ);
 
-	while (!list_is_empty(&sch->list)) {
+	while (!edf_queue_is_empty(&sch->queue)) {
 		spin_lock_irq(&sch->lock, flags);
 
 		/* get the current time */
 		current = platform_timer_get(platform_timer);
 
 		/* get next task to be scheduled */
-		task = edf_get_next(current, NULL);
+		task = edf_get_next(current);
 		spin_unlock_irq(&sch->lock, flags);
 
 		/* any tasks ? */
@@ -221,7 +187,7 @@ static struct task *sch_edf(void)
 			/* init task for running */
 			spin_lock_irq(&sch->lock, flags);
 			task->state = SOF_TASK_STATE_PENDING;
-			list_item_del(&task->list);
+			edf_queue_remove(&sch->queue, task);
 			spin_unlock_irq(&sch->lock, flags);
 
 			/* now run task at correct run level */
@@ -258,7 +224,10 @@ static int schedule_edf_task_cancel(struct task *task)
 	if (task->state == SOF_TASK_STATE_QUEUED) {
 		/* delete task */
 		task->state = SOF_TASK_STATE_CANCEL;
-		list_item_del(&task->list);
+		if (edf_queue_contains(&sch->queue, task))
+			edf_queue_remove(&sch->queue, task);
+		else
+			list_item_del(&task->list);
 	}
 
 	spin_unlock_irq(&sch->lock, flags);
@@ -317,7 +286,12 @@ static void schedule_edf_task(struct task *task, uint64_t start,
 		list_item_append(&task->list, &sch->idle_list);
 		need_sched = false;
 	} else {
-		list_item_append(&task->list, &sch->list);
+		if (edf_queue_insert(&sch->queue, task) < 0) {
+			trace_edf_sch_error("schedule_edf_task() error: "
+					    "queue alloc failed");
+			spin_unlock_irq(&sch->lock, lock_flags);
+			return;
+		}
 		need_sched = true;
 	}
 
@@ -390,29 +364,22 @@ static void schedule_edf(void)
 {
 	struct edf_schedule_data *sch =
 		(*arch_schedule_get_data())->edf_sch_data;
-	struct list_item *tlist;
 	struct task *edf_task;
 	uint32_t flags;
-	uint64_t current;
 
 	tracev_edf_sch("schedule_edf()");
 
 	spin_lock_irq(&sch->lock, flags);
 
-	/* make sure we have a queued task in the list first before we
-	   start scheduling as contexts switches are not free. */
-	list_for_item(tlist, &sch->list) {
-		edf_task = container_of(tlist, struct task, list);
-
-		/* schedule if we find any queued tasks
-		 * which reached its deadline
-		 */
-		current = platform_timer_get(platform_timer);
-		if (edf_task->state == SOF_TASK_STATE_QUEUED &&
-		    edf_task->start <= current) {
-			spin_unlock_irq(&sch->lock, flags);
-			goto schedule;
-		}
+	/* make sure the next task can be started before we start
+	 * scheduling as contexts switches are not free. sch_edf() only
+	 * ever runs the head of the queue.
+	 */
+	edf_task = edf_queue_peek(&sch->queue);
+	if (edf_task &&
+	    edf_task->start <= platform_timer_get(platform_timer)) {
+		spin_unlock_irq(&sch->lock, flags);
+		goto schedule;
 	}
 
 	/* no task to schedule */
@@ -441,13 +408,17 @@ static int edf_scheduler_init(void)
 
 	struct schedule_data *sch_data = *arch_schedule_get_data();
 	struct edf_schedule_data *sch;
+	int ret;
 
 	sch_data->edf_sch_data = rzalloc(RZONE_SYS, SOF_MEM_CAPS_RAM,
 					 sizeof(*sch_data->edf_sch_data));
 
 	sch = sch_data->edf_sch_data;
 
-	list_init(&sch->list);
+	ret = edf_queue_init(&sch->queue);
+	if (ret < 0)
+		return ret;
+
 	list_init(&sch->idle_list);
 	spinlock_init(&sch->lock);
 	sch->clock = PLATFORM_SCHED_CLOCK;
@@ -479,7 +450,7 @@ static void edf_scheduler_free(void)
 	/* free arch tasks */
 	arch_free_tasks();
 
-	list_item_del(&sch->list);
+	edf_queue_free(&sch->queue);
 	list_item_del(&sch->idle_list);
 
 	spin_unlock_irq(&sch->lock, flags);
@@ -30,6 +30,7 @@
  */
 
 #include <sof/ll_schedule.h>
+#include <sof/ll_wheel.h>
 #include <sof/schedule.h>
 #include <sof/timer.h>
 #include <sof/list.h>
@@ -63,7 +64,7 @@
  */
 
 struct ll_schedule_data {
-	struct list_item tasks;			/* list of ll tasks */
+	struct ll_wheel wheel;			/* ll tasks by start time */
 	uint64_t timeout;			/* timeout for next queue run */
 	uint32_t window_size;			/* window size for pending ll */
 	spinlock_t lock;
@@ -136,46 +137,8 @@ static inline void ll_clear_timer(struct ll_schedule_data *queue)
 /* is there any work pending in the current time window ? */
 static int is_ll_pending(struct ll_schedule_data *queue)
 {
-	struct list_item *wlist;
-	struct task *ll_task;
-	uint64_t win_end;
-	uint64_t win_start;
-	int pending_count = 0;
-
-	/* get the current valid window of work */
-	win_end = ll_get_timer(queue);
-	win_start = win_end - queue->window_size;
-
-	/* mark each valid work item in this time period as pending */
-	list_for_item(wlist, &queue->tasks) {
-		ll_task = container_of(wlist, struct task, list);
-
-		/* correct the pending flag window for overflow */
-		if (win_end > win_start) {
-			/* mark pending work */
-			if (ll_task->start >= win_start &&
-				ll_task->start <= win_end) {
-				ll_task->state =
-					SOF_TASK_STATE_PENDING;
-				pending_count++;
-			} else {
-				ll_task->state = 0;
-			}
-		} else {
-			/* mark pending work */
-			if ((ll_task->start <= win_end ||
-				(ll_task->start >= win_start &&
-				ll_task->start < ULONG_LONG_MAX))) {
-				ll_task->state =
-					SOF_TASK_STATE_PENDING;
-				pending_count++;
-			} else {
-				ll_task->state = 0;
-			}
-		}
-	}
-
-	return pending_count;
+	/* move each valid work item in this time period to pending */
+	return ll_wheel_collect(&queue->wheel, ll_get_timer(queue));
 }
 
 static inline void ll_next_timeout(struct ll_schedule_data *queue,
@@ -198,39 +161,37 @@ static inline void ll_next_timeout(struct ll_schedule_data *queue,
 	}
 }
 
-/* run all pending work */
+/* run all pending work in priority order */
 static void run_ll(struct ll_schedule_data *queue, uint32_t *flags)
 {
-	struct list_item *wlist;
-	struct list_item *tlist;
 	struct task *ll_task;
 	uint64_t reschedule_usecs;
 	int cpu = cpu_get_id();
 
-	/* check each work item in queue for pending */
-	list_for_item_safe(wlist, tlist, &queue->tasks) {
-		ll_task = container_of(wlist, struct task, list);
-
-		/* run work if its pending and remove from the queue */
-		if (ll_task->state == SOF_TASK_STATE_PENDING) {
-			/* work can run in non atomic context */
-			spin_unlock_irq(&queue->lock, *flags);
-			reschedule_usecs = ll_task->func(ll_task->data);
-			spin_lock_irq(&queue->lock, *flags);
-
-			/* do we need reschedule this work ? */
-			if (reschedule_usecs == 0) {
-				list_item_del(&ll_task->list);
-				atomic_sub(&ll_shared_ctx->total_num_work, 1);
-
-				/* don't enable irq, if no more work to do */
-				if (!atomic_sub(&queue->num_ll, 1))
-					ll_shared_ctx->timers[cpu] = NULL;
-			} else {
-				/* get next work timeout */
-				ll_next_timeout(queue, ll_task,
-						reschedule_usecs);
-			}
+	/* pending work stays on its pending list while it runs */
+	while ((ll_task = ll_wheel_next_pending(&queue->wheel))) {
+		/* work can run in non atomic context */
+		spin_unlock_irq(&queue->lock, *flags);
+		reschedule_usecs = ll_task->func(ll_task->data);
+		spin_lock_irq(&queue->lock, *flags);
+
+		/* cancelled while it was running */
+		if (!ll_wheel_contains(ll_task))
+			continue;
+
+		ll_wheel_remove(ll_task);
+
+		/* do we need reschedule this work ? */
+		if (reschedule_usecs == 0) {
+			atomic_sub(&ll_shared_ctx->total_num_work, 1);
+
+			/* don't enable irq, if no more work to do */
+			if (!atomic_sub(&queue->num_ll, 1))
+				ll_shared_ctx->timers[cpu] = NULL;
+		} else {
+			/* get next work timeout */
+			ll_next_timeout(queue, ll_task, reschedule_usecs);
+			ll_wheel_insert(&queue->wheel, ll_task);
 		}
 	}
 }
@@ -249,34 +210,55 @@ static inline uint64_t calc_delta_ticks(uint64_t current, uint64_t work)
 	}
 }
 
+static void task_recalc_timer(struct ll_schedule_data *queue,
+			      struct task *ll_task, uint64_t current,
+			      struct clock_notify_data *clk_data)
+{
+	uint64_t delta_ticks;
+	uint64_t delta_msecs;
+
+	delta_ticks = calc_delta_ticks(current, ll_task->start);
+	delta_msecs = delta_ticks / clk_data->old_ticks_per_msec;
+
+	/* is work within next msec, then schedule it now */
+	if (delta_msecs > 0)
+		ll_task->start = current +
+			queue->ticks_per_msec * delta_msecs;
+	else
+		ll_task->start = current +
+			(queue->ticks_per_msec >> 3);
+}
+
 /* re calculate timers for queue after CPU frequency change */
 static void queue_recalc_timers(struct ll_schedule_data *queue,
 				struct clock_notify_data *clk_data)
 {
 	struct list_item *wlist;
 	struct task *ll_task;
-	uint64_t delta_ticks;
-	uint64_t delta_msecs;
 	uint64_t current;
+	int i;
 
 	/* get current time */
 	current = ll_get_timer(queue);
 
-	/* recalculate timers for each work item */
-	list_for_item(wlist, &queue->tasks) {
-		ll_task = container_of(wlist, struct task, list);
-		delta_ticks = calc_delta_ticks(current, ll_task->start);
-		delta_msecs = delta_ticks /
-			clk_data->old_ticks_per_msec;
-
-		/* is work within next msec, then schedule it now */
-		if (delta_msecs > 0)
-			ll_task->start = current +
-				queue->ticks_per_msec * delta_msecs;
-		else
-			ll_task->start = current +
-				(queue->ticks_per_msec >> 3);
+	/* recalculate timers for each work item, the slots are fixed up
+	 * by the new window below
+	 */
+	for (i = 0; i < LL_WHEEL_SLOTS; i++) {
+		list_for_item(wlist, &queue->wheel.slots[i]) {
+			ll_task = container_of(wlist, struct task, list);
+			task_recalc_timer(queue, ll_task, current, clk_data);
+		}
 	}
+
+	for (i = 0; i < SOF_TASK_PRI_COUNT; i++) {
+		list_for_item(wlist, &queue->wheel.pending[i]) {
+			ll_task = container_of(wlist, struct task, list);
+			task_recalc_timer(queue, ll_task, current, clk_data);
+		}
+	}
+
+	ll_wheel_set_window(&queue->wheel, queue->window_size);
 }
 
 /* enable all registered timers */
@@ -362,46 +344,17 @@ static void ll_notify(int message, void *data, void *event_data)
 	spin_unlock_irq(&queue->lock, flags);
 }
 
-static inline void insert_task_to_queue(struct task *w,
-					struct list_item *q_list)
-{
-	struct task *ll_task;
-	struct list_item *wlist;
-
-	/* works are adding to queue in order */
-	list_for_item(wlist, q_list) {
-		ll_task = container_of(wlist, struct task, list);
-		if (w->priority <= ll_task->priority) {
-			list_item_append(&w->list, &ll_task->list);
-			return;
-		}
-	}
-
-	/* if task has not been added, means that it has the lowest
-	 * priority in queue and it should be added at the end of the list
-	 */
-	list_item_append(&w->list, q_list);
-	return;
-}
-
 static void ll_schedule(struct ll_schedule_data *queue, struct task *w,
 			uint64_t start)
 {
 	struct ll_task_pdata *ll_pdata;
-	struct task *ll_task;
-	struct list_item *wlist;
 	uint32_t flags;
 
 	spin_lock_irq(&queue->lock, flags);
 
-	/* check to see if we are already scheduled ? */
-	list_for_item(wlist, &queue->tasks) {
-		ll_task = container_of(wlist, struct task, list);
-
-		/* keep original start */
-		if (ll_task == w)
-			goto out;
-	}
+	/* check to see if we are already scheduled ? keep original start */
+	if (ll_wheel_contains(w))
+		goto out;
 
 	w->start = queue->ticks_per_msec * start / 1000;
 	ll_pdata = ll_sch_get_pdata(w);
@@ -412,8 +365,8 @@ static void ll_schedule(struct ll_schedule_data *queue, struct task *w,
 	else
 		w->start += ll_shared_ctx->last_tick;
 
-	/* insert work into list */
-	insert_task_to_queue(w, &queue->tasks);
+	/* insert work into its wheel slot */
+	ll_wheel_insert(&queue->wheel, w);
 
 	ll_set_timer(queue);
 
@@ -432,29 +385,25 @@ static void schedule_ll_task(struct task *w, uint64_t start, uint64_t deadline,
 static void reschedule(struct ll_schedule_data *queue, struct task *w,
 		       uint64_t time)
 {
-	struct task *ll_task;
-	struct list_item *wlist;
 	uint32_t flags;
 
 	spin_lock_irq(&queue->lock, flags);
 
 	/* check to see if we are already scheduled */
-	list_for_item(wlist, &queue->tasks) {
-		ll_task = container_of(wlist, struct task, list);
+	if (ll_wheel_contains(w)) {
+		/* move it to the slot of its new start unless it is pending */
+		w->start = time;
+		if (w->state != SOF_TASK_STATE_PENDING) {
+			ll_wheel_remove(w);
+			ll_wheel_insert(&queue->wheel, w);
+		}
+	} else {
+		w->start = time;
+		ll_wheel_insert(&queue->wheel, w);
 
-		/* found it */
-		if (ll_task == w)
-			goto found;
+		ll_set_timer(queue);
 	}
 
-	insert_task_to_queue(w, &queue->tasks);
-
-	ll_set_timer(queue);
-
-found:
-	/* re-calc timer and re-arm */
-	w->start = time;
-
 	spin_unlock_irq(&queue->lock, flags);
 }
 
@@ -482,27 +431,20 @@ static int schedule_ll_task_cancel(struct task *w)
 {
 	struct ll_schedule_data *queue =
 		(*arch_schedule_get_data())->ll_sch_data;
-	struct task *ll_task;
-	struct list_item *wlist;
 	uint32_t flags;
 	int ret = 0;
 
 	spin_lock_irq(&queue->lock, flags);
 
 	/* check to see if we are scheduled */
-	list_for_item(wlist, &queue->tasks) {
-		ll_task = container_of(wlist, struct task, list);
+	if (ll_wheel_contains(w)) {
+		ll_clear_timer(queue);
 
-		/* found it */
-		if (ll_task == w) {
-			ll_clear_timer(queue);
-			break;
-		}
+		/* remove work from the wheel */
+		ll_wheel_remove(w);
 	}
 
-	/* remove work from list */
 	w->state = SOF_TASK_STATE_CANCEL;
-	list_item_del(&w->list);
 
 	spin_unlock_irq(&queue->lock, flags);
 
@@ -533,7 +475,6 @@ static struct ll_schedule_data *work_new_queue(struct timesource_data *ts)
 
 	/* init work queue */
 	queue = rmalloc(RZONE_SYS, SOF_MEM_CAPS_RAM, sizeof(*queue));
-	list_init(&queue->tasks);
 
 	spinlock_init(&queue->lock);
 	atomic_init(&queue->num_ll, 0);
@@ -541,6 +482,7 @@ static struct ll_schedule_data *work_new_queue(struct timesource_data *ts)
 	queue->ticks_per_msec = clock_ms_to_ticks(queue->ts->clk, 1);
 	queue->window_size = queue->ticks_per_msec *
 		PLATFORM_WORKQ_WINDOW / 1000;
+	ll_wheel_init(&queue->wheel, queue->window_size);
 
 	/* TODO: configurable through IPC */
 	queue->timeout = PLATFORM_WORKQ_DEFAULT_TIMEOUT;
@@ -598,6 +540,9 @@ static int schedule_ll_task_init(struct task *w, uint32_t xflags)
 
 	ll_sch_set_pdata(w, ll_pdata);
 
+	/* an empty list item means the task is not on the wheel */
+	list_init(&w->list);
+
 	ll_pdata->flags = xflags;
 
 	return 0;
@@ -615,8 +560,6 @@ static void ll_scheduler_free(void)
 
 	notifier_unregister(&queue->notifier);
 
-	list_item_del(&queue->tasks);
-
 	spin_unlock_irq(&queue->lock, flags);
 }
 
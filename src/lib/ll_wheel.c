@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdint.h>
+#include <sof/list.h>
+#include <sof/ll_wheel.h>
+
+static inline uint32_t ll_wheel_slot(struct ll_wheel *wheel, uint64_t start)
+{
+	return (start >> wheel->shift) & (LL_WHEEL_SLOTS - 1);
+}
+
+/* is start inside the window ending at current ? copes with timer wrap */
+static inline int ll_wheel_in_window(struct ll_wheel *wheel, uint64_t start,
+				     uint64_t current)
+{
+	return current - start <= wheel->window;
+}
+
+static void ll_wheel_set_shift(struct ll_wheel *wheel, uint64_t window)
+{
+	uint64_t width = window / LL_WHEEL_WINDOW_SLOTS;
+
+	wheel->window = window;
+	wheel->shift = 0;
+
+	while (width >> (wheel->shift + 1))
+		wheel->shift++;
+}
+
+void ll_wheel_init(struct ll_wheel *wheel, uint64_t window)
+{
+	int i;
+
+	for (i = 0; i < LL_WHEEL_SLOTS; i++)
+		list_init(&wheel->slots[i]);
+
+	for (i = 0; i < SOF_TASK_PRI_COUNT; i++)
+		list_init(&wheel->pending[i]);
+
+	wheel->pending_mask = 0;
+	ll_wheel_set_shift(wheel, window);
+}
+
+/* new window size, tasks on the wheel are hashed again as the slot width
+ * follows the window. Pending tasks are left where they are.
+ */
+void ll_wheel_set_window(struct ll_wheel *wheel, uint64_t window)
+{
+	struct list_item tasks;
+	struct list_item *tlist;
+	struct list_item *tmp;
+	int i;
+
+	list_init(&tasks);
+
+	for (i = 0; i < LL_WHEEL_SLOTS; i++) {
+		list_for_item_safe(tlist, tmp, &wheel->slots[i]) {
+			list_item_del(tlist);
+			list_item_append(tlist, &tasks);
+		}
+	}
+
+	ll_wheel_set_shift(wheel, window);
+
+	list_for_item_safe(tlist, tmp, &tasks) {
+		list_item_del(tlist);
+		ll_wheel_insert(wheel, container_of(tlist, struct task, list));
+	}
+}
+
+/* add task to the slot of its start time */
+void ll_wheel_insert(struct ll_wheel *wheel, struct task *task)
+{
+	task->state = SOF_TASK_STATE_QUEUED;
+	list_item_append(&task->list,
+			 &wheel->slots[ll_wheel_slot(wheel, task->start)]);
+}
+
+/*
+ * Move every task whose start is inside the window ending at current to
+ * the pending list of its priority and mark it pending. Only the slots
+ * covering the window are looked at. Tasks in those slots that are due in
+ * a later turn of the wheel, or that are older than the window, stay.
+ * Returns the number of pending tasks found.
+ */
+int ll_wheel_collect(struct ll_wheel *wheel, uint64_t current)
+{
+	struct list_item *tlist;
+	struct list_item *tmp;
+	struct task *task;
+	uint64_t slots;
+	uint32_t slot;
+	uint32_t pri;
+	int count = 0;
+
+	slots = (current >> wheel->shift) -
+		((current - wheel->window) >> wheel->shift) + 1;
+	if (slots > LL_WHEEL_SLOTS)
+		slots = LL_WHEEL_SLOTS;
+
+	slot = ll_wheel_slot(wheel, current - wheel->window);
+
+	while (slots--) {
+		list_for_item_safe(tlist, tmp, &wheel->slots[slot]) {
+			task = container_of(tlist, struct task, list);
+
+			if (!ll_wheel_in_window(wheel, task->start, current))
+				continue;
+
+			pri = task->priority < SOF_TASK_PRI_COUNT ?
+				task->priority : SOF_TASK_PRI_COUNT - 1;
+			list_item_del(tlist);
+			list_item_append(tlist, &wheel->pending[pri]);
+			wheel->pending_mask |= 1 << pri;
+			task->state = SOF_TASK_STATE_PENDING;
+			count++;
+		}
+
+		slot = (slot + 1) & (LL_WHEEL_SLOTS - 1);
+	}
+
+	return count;
+}
+
+/* highest priority pending task, it stays on its pending list until the
+ * caller removes it or puts it back on the wheel
+ */
+struct task *ll_wheel_next_pending(struct ll_wheel *wheel)
+{
+	int i;
+
+	while (wheel->pending_mask) {
+		i = __builtin_ctz(wheel->pending_mask);
+		if (!list_is_empty(&wheel->pending[i]))
+			return list_first_item(&wheel->pending[i],
+					       struct task, list);
+
+		/* all tasks of this priority have run */
+		wheel->pending_mask &= ~(1 << i);
+	}
+
+	return NULL;
+}
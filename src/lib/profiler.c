@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * Each core samples the PC interrupted by its CCOMPARE2 timer, which is a
+ * medium priority interrupt, so any code running with interrupts enabled
+ * below that level is seen. The drain task sends the samples as traces of
+ * the PROFILER class, where sof-logger -P picks them up. They can be muted
+ * at runtime with the trace filter like any other class.
+ */
+
+#include <sof/sof.h>
+#include <sof/profiler.h>
+#include <sof/alloc.h>
+#include <sof/cache.h>
+#include <sof/clk.h>
+#include <sof/cpu.h>
+#include <sof/interrupt.h>
+#include <sof/schedule.h>
+#include <sof/timer.h>
+#include <sof/trace.h>
+#include <platform/clk.h>
+#include <platform/interrupt.h>
+#include <platform/platform.h>
+#include <platform/timer.h>
+
+/* sampling timer, its handler must be able to read the EPC register */
+#define PROFILER_TIMER		TIMER2
+#define PROFILER_TIMER_IRQ	IRQ_NUM_TIMER3
+#define PROFILER_TIMER_LEVEL	arch_interrupt_level(XCHAL_TIMER2_INTERRUPT)
+
+#if PROFILER_TIMER_LEVEL > XCHAL_EXCM_LEVEL
+#error "profiler timer is a high priority interrupt on this platform"
+#endif
+
+/* drain before the ring fills at the sampling period */
+#define PROFILER_DRAIN_PERIOD \
+	(CONFIG_PROFILER_PERIOD * PROFILER_SAMPLES / 2)
+
+#define trace_profiler(__e, ...) \
+	trace_event(TRACE_CLASS_PROFILER, __e, ##__VA_ARGS__)
+#define trace_profiler_error(__e, ...) \
+	trace_error(TRACE_CLASS_PROFILER, __e, ##__VA_ARGS__)
+
+/* allocated by the master core, shared by all cores */
+static struct profiler *prof;
+
+static void profiler_sample(void *data)
+{
+	struct profiler_core *pc = &prof->core[cpu_get_id()];
+	uint32_t epc = arch_interrupt_get_epc(PROFILER_TIMER_LEVEL);
+
+	if (pc->head - pc->tail < PROFILER_SAMPLES)
+		pc->pc[pc->head++ & (PROFILER_SAMPLES - 1)] = epc;
+	else
+		pc->dropped++;
+
+	timer_set(&pc->timer, timer_get_system(&pc->timer) + pc->period);
+}
+
+static uint64_t profiler_drain(void *data)
+{
+	struct profiler_core *pc = data;
+	uint32_t pcs[PROFILER_SAMPLES + PROFILER_RECORD_SAMPLES - 1];
+	uint32_t dropped;
+	uint32_t count;
+	uint32_t flags;
+	uint32_t i;
+
+	flags = interrupt_global_disable();
+
+	count = pc->head - pc->tail;
+	for (i = 0; i < count; i++)
+		pcs[i] = pc->pc[(pc->tail + i) & (PROFILER_SAMPLES - 1)];
+	pc->tail = pc->head;
+
+	dropped = pc->dropped;
+	pc->dropped = 0;
+
+	interrupt_global_enable(flags);
+
+	/* a short last record is padded with 0, which is never a valid PC */
+	for (i = count; i < count + PROFILER_RECORD_SAMPLES - 1; i++)
+		pcs[i] = 0;
+
+	/* sof-logger -P counts the records starting with "samples" */
+	for (i = 0; i < count; i += PROFILER_RECORD_SAMPLES)
+		trace_profiler("samples 0x%08x 0x%08x 0x%08x 0x%08x",
+			       pcs[i], pcs[i + 1], pcs[i + 2], pcs[i + 3]);
+
+	if (dropped)
+		trace_profiler("profiler_drain() dropped %u samples", dropped);
+
+	return PROFILER_DRAIN_PERIOD;
+}
+
+/*
+ * Starts sampling on the calling core. The master core allocates the
+ * samples of all cores, so it must be initialised before the slave cores.
+ */
+void profiler_init(struct sof *sof)
+{
+	struct profiler_core *pc;
+	int core = cpu_get_id();
+	int ret;
+
+	if (core == PLATFORM_MASTER_CORE_ID) {
+		prof = rzalloc(RZONE_SYS | RZONE_FLAG_UNCACHED,
+			       SOF_MEM_CAPS_RAM, sizeof(*prof));
+		dcache_writeback_region(&prof, sizeof(prof));
+	}
+
+	if (!prof) {
+		trace_profiler_error("profiler_init() error: no samples");
+		return;
+	}
+
+	pc = &prof->core[core];
+	pc->period = clock_ms_to_ticks(CLK_CPU(core), 1) *
+		CONFIG_PROFILER_PERIOD / 1000;
+	pc->timer.id = PROFILER_TIMER;
+	pc->timer.irq = PROFILER_TIMER_IRQ;
+
+	trace_profiler("profiler_init() core %d, period %u ticks", core,
+		       (uint32_t)pc->period);
+
+	schedule_task_init(&pc->drain, SOF_SCHEDULE_LL, SOF_TASK_PRI_LOW,
+			   profiler_drain, pc, core, 0);
+	schedule_task(&pc->drain, PROFILER_DRAIN_PERIOD, 0, 0);
+
+	ret = timer_register(&pc->timer, profiler_sample, prof);
+	if (ret < 0) {
+		trace_profiler_error("profiler_init() error: timer %d", ret);
+		return;
+	}
+
+	timer_set(&pc->timer, timer_get_system(&pc->timer) + pc->period);
+	timer_enable(&pc->timer);
+}
@@ -39,16 +39,35 @@
 #include <sof/cpu.h>
 #include <sof/preproc.h>
 #include <sof/drivers/timer.h>
+#include <sof/math/numbers.h>
+#include <uapi/ipc/trace.h>
 #include <stdint.h>
 
+/* pipeline and component trace levels */
+#define TRACE_FILTER_COUNT	8
+
+/* level of the traces with matching ids, -1 matches all */
+struct trace_filter {
+	int32_t class_index;
+	int32_t pipe_id;
+	int32_t comp_id;
+	uint32_t level;
+};
+
 struct trace {
 	uint32_t pos ;	/* trace position */
 	uint32_t enable;
 	spinlock_t lock;
+	uint8_t level[TRACE_CLASS_COUNT];	/* level of each class */
+	struct trace_filter filter[TRACE_FILTER_COUNT];
+	uint32_t filter_count;
 };
 
 static struct trace *trace;
 
+/* checked inline by every trace, see _trace_level_pass() */
+struct trace_levels trace_levels;
+
 /* calculates total message size, both header and payload in bytes */
 #define MESSAGE_SIZE(args_num)	\
 	(sizeof(struct log_entry_header) + args_num * sizeof(uint32_t))
@@ -77,6 +96,60 @@ static void put_header(uint32_t *dst, uint32_t id_0, uint32_t id_1,
 	memcpy(dst, &header, sizeof(header));
 }
 
+#if CONFIG_TRACE_COMPACT
+
+/* log entries base address, .static_log_entries start */
+extern const char _static_log_entries_start[];
+
+/* queue the event for DMA trace as compact record body */
+static void dtrace_put(const uint32_t *dt, uint32_t params, int atomic)
+{
+	const struct log_entry_header *header =
+		(const struct log_entry_header *)dt;
+	struct dtrace_compact_event event;
+	uint8_t *body = event.body;
+	uint32_t length;
+	uint32_t i;
+
+	event.flags = header->core_id & TRACE_COMPACT_CORE_MASK;
+	event.timestamp_lo = header->timestamp;
+	event.timestamp_hi = header->timestamp >> 32;
+
+	body += dtrace_varint_put(body, (header->log_entry_address -
+		(uintptr_t)_static_log_entries_start) / sizeof(uint32_t));
+
+	/* the default ids of -1 are left out */
+	if (header->id_0 != TRACE_ID_MASK || header->id_1 != TRACE_ID_MASK) {
+		event.flags |= TRACE_COMPACT_IDS;
+		body += dtrace_varint_put(body, header->id_0);
+		body += dtrace_varint_put(body, header->id_1);
+	}
+
+	for (i = 0; i < params; i++)
+		body += dtrace_varint_put(body, dt[PAYLOAD_OFFSET(i)]);
+
+	event.flags |= (body - event.body) << DTRACE_COMPACT_SIZE_SHIFT;
+	length = ALIGN(body - (uint8_t *)&event, sizeof(uint32_t));
+
+	if (atomic)
+		dtrace_event_atomic((const char *)&event, length);
+	else
+		dtrace_event((const char *)&event, length);
+}
+
+#else
+
+/* queue the event for DMA trace as it is */
+static inline void dtrace_put(const uint32_t *dt, uint32_t params, int atomic)
+{
+	if (atomic)
+		dtrace_event_atomic((const char *)dt, MESSAGE_SIZE(params));
+	else
+		dtrace_event((const char *)dt, MESSAGE_SIZE(params));
+}
+
+#endif
+
 static void mtrace_event(const char *data, uint32_t length)
 {
 	volatile char *t;
@@ -131,10 +204,7 @@ META_IF_ELSE(is_atomic)(_atomic)()					\
 		   platform_timer_get(platform_timer));			\
 									\
 	_TRACE_EVENT_NTH_PAYLOAD_IMPL(arg_count)			\
-	META_IF_ELSE(is_atomic)						\
-		(dtrace_event_atomic)					\
-		(dtrace_event)						\
-			((const char *)dt, MESSAGE_SIZE(arg_count));	\
+	dtrace_put(dt, arg_count, is_atomic);				\
 	/* send event by mail box too. */				\
 	META_IF_ELSE(is_mbox)						\
 	(								\
@@ -229,6 +299,159 @@ void trace_off(void)
 	trace->enable = 0;
 }
 
+/* checks the ids of a trace in a class with pipeline or component levels,
+ * the last added matching level wins over the class level
+ */
+int trace_filter_pass(uint32_t index, uint32_t level, uint32_t id_0,
+		      uint32_t id_1)
+{
+	struct trace_filter *filter;
+	uint32_t pass = trace->level[index];
+	uint32_t i;
+
+	for (i = 0; i < trace->filter_count; i++) {
+		filter = &trace->filter[i];
+
+		if ((filter->class_index < 0 ||
+		     filter->class_index == index) &&
+		    (filter->pipe_id < 0 || filter->pipe_id == id_0) &&
+		    (filter->comp_id < 0 || filter->comp_id == id_1))
+			pass = filter->level;
+	}
+
+	return level <= pass;
+}
+
+/* recalculates the gates checked inline by the traces */
+static void trace_levels_update(void)
+{
+	struct trace_levels *levels = trace_levels_get();
+	struct trace_filter *filter;
+	uint32_t gate;
+	uint32_t filtered;
+	uint32_t i;
+	int c;
+
+	for (c = 0; c < TRACE_CLASS_COUNT; c++) {
+		gate = trace->level[c];
+		filtered = 0;
+
+		for (i = 0; i < trace->filter_count; i++) {
+			filter = &trace->filter[i];
+			if (filter->class_index >= 0 &&
+			    filter->class_index != c)
+				continue;
+
+			gate = MAX(gate, filter->level);
+			filtered = 1;
+		}
+
+		/* ids are checked before the gate is raised for them */
+		levels->filtered[c] = filtered;
+		levels->gate[c] = gate;
+	}
+}
+
+static int trace_filter_set(const struct trace_filter *filter)
+{
+	struct trace_filter *f;
+	uint32_t i;
+	int c;
+
+	/* class levels */
+	if (filter->pipe_id < 0 && filter->comp_id < 0) {
+		if (filter->class_index >= 0) {
+			trace->level[filter->class_index] = filter->level;
+			return 0;
+		}
+
+		/* all traces, pipeline and component levels are dropped */
+		for (c = 0; c < TRACE_CLASS_COUNT; c++)
+			trace->level[c] = filter->level;
+		trace->filter_count = 0;
+		return 0;
+	}
+
+	/* update the level of the same ids */
+	for (i = 0; i < trace->filter_count; i++) {
+		f = &trace->filter[i];
+		if (f->class_index == filter->class_index &&
+		    f->pipe_id == filter->pipe_id &&
+		    f->comp_id == filter->comp_id) {
+			f->level = filter->level;
+			return 0;
+		}
+	}
+
+	if (trace->filter_count == TRACE_FILTER_COUNT)
+		return -ENOMEM;
+
+	trace->filter[trace->filter_count++] = *filter;
+	return 0;
+}
+
+/* applies the SOF_IPC_TRACE_FILTER_UPDATE element groups */
+int trace_filter_update(const struct sof_ipc_trace_filter_elem *elems,
+			uint32_t count)
+{
+	struct trace_filter filter = { -1, -1, -1, 0 };
+	unsigned long flags;
+	uint32_t key;
+	uint32_t i;
+	int ret = 0;
+
+	spin_lock_irq(&trace->lock, flags);
+
+	for (i = 0; i < count && ret >= 0; i++) {
+		key = elems[i].key & SOF_IPC_TRACE_FILTER_ELEM_TYPE_MASK;
+
+		switch (key) {
+		case SOF_IPC_TRACE_FILTER_ELEM_BY_CLASS:
+			filter.class_index = elems[i].value;
+			if (filter.class_index < -1 ||
+			    filter.class_index >= TRACE_CLASS_COUNT)
+				ret = -EINVAL;
+			break;
+		case SOF_IPC_TRACE_FILTER_ELEM_BY_PIPE:
+			filter.pipe_id = elems[i].value;
+			break;
+		case SOF_IPC_TRACE_FILTER_ELEM_BY_COMP:
+			filter.comp_id = elems[i].value;
+			break;
+		case SOF_IPC_TRACE_FILTER_ELEM_SET_LEVEL:
+			/* errors can not be disabled */
+			filter.level = MIN(MAX(elems[i].value,
+					       LOG_LEVEL_CRITICAL),
+					   LOG_LEVEL_DEBUG);
+			break;
+		default:
+			ret = -EINVAL;
+			break;
+		}
+
+		if (ret < 0 || !(elems[i].key & SOF_IPC_TRACE_FILTER_ELEM_FIN))
+			continue;
+
+		/* each group ends with its level */
+		if (key != SOF_IPC_TRACE_FILTER_ELEM_SET_LEVEL) {
+			ret = -EINVAL;
+			continue;
+		}
+
+		ret = trace_filter_set(&filter);
+
+		filter.class_index = -1;
+		filter.pipe_id = -1;
+		filter.comp_id = -1;
+	}
+
+	trace_levels_update();
+
+	spin_unlock_irq(&trace->lock, flags);
+
+	return ret;
+}
+
 void trace_init(struct sof *sof)
 {
 	dma_trace_init_early(sof);
@@ -239,6 +462,12 @@ void trace_init(struct sof *sof)
 	trace->pos = 0;
 	spinlock_init(&trace->lock);
 
+	/* the levels are only accessed uncached from now on */
+	dcache_writeback_invalidate_region(&trace_levels,
+					   sizeof(trace_levels));
+	memset(trace->level, CONFIG_TRACE_LEVEL, sizeof(trace->level));
+	trace_levels_update();
+
 	bzero((void *)MAILBOX_TRACE_BASE, MAILBOX_TRACE_SIZE);
 	dcache_writeback_invalidate_region((void *)MAILBOX_TRACE_BASE,
 					   MAILBOX_TRACE_SIZE);
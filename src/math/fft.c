@@ -0,0 +1,558 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdint.h>
+#include <sof/alloc.h>
+#include <sof/audio/format.h>
+#include <sof/math/fft.h>
+
+/*
+ * Fixed-point FFT
+ *
+ * The complex FFT is a decimation in time FFT with radix-4 stages and a
+ * radix-2 stage first when the size is not a power of four. The radix-4
+ * stages are done with generic C or with SSE4.2 or AVX2 when built for
+ * the optimized host library. The real FFT of N points is computed with
+ * a N/2 point complex FFT and a split of the even and odd samples spectra.
+ */
+
+/* 2 * pi as Q4.60 */
+#define FFT_PI_MUL2_Q4_60	7244019458077122842LL
+
+#define FFT_ONE_Q31		(1LL << 31)
+
+/* Twiddle exp(-j*2*pi*k/size) for k < size / 2 to Q1.31. The sin_fixed()
+ * interpolated table is too coarse for Q1.31 FFT so the first octant is
+ * computed with Taylor series and the rest by symmetry.
+ */
+static void fft_twiddle(struct icomplex32 *w, uint32_t k, uint32_t len)
+{
+	uint32_t size = 1 << len;
+	int64_t x;
+	int64_t x2;
+	int64_t s;
+	int64_t c;
+	int64_t t;
+	int mirror = 0;
+	int swap = 0;
+
+	/* Reduce angle to [0, pi / 4] */
+	if (k > size / 4) {
+		k = size / 2 - k;
+		mirror = 1;
+	}
+
+	if (k > size / 8) {
+		k = size / 4 - k;
+		swap = 1;
+	}
+
+	x = Q_SHIFT_RND((FFT_PI_MUL2_Q4_60 >> len) * k, 60, 31);
+	x2 = (x * x) >> 31;
+
+	/* sin(x) = x(1 - x^2/6(1 - x^2/20(1 - x^2/42(1 - x^2/72(1 - ...)))))
+	 * and similarly for cos(x).
+	 */
+	t = FFT_ONE_Q31 - x2 / 110;
+	t = FFT_ONE_Q31 - ((x2 * t) >> 31) / 72;
+	t = FFT_ONE_Q31 - ((x2 * t) >> 31) / 42;
+	t = FFT_ONE_Q31 - ((x2 * t) >> 31) / 20;
+	t = FFT_ONE_Q31 - ((x2 * t) >> 31) / 6;
+	s = (x * t) >> 31;
+
+	t = FFT_ONE_Q31 - x2 / 90;
+	t = FFT_ONE_Q31 - ((x2 * t) >> 31) / 56;
+	t = FFT_ONE_Q31 - ((x2 * t) >> 31) / 30;
+	t = FFT_ONE_Q31 - ((x2 * t) >> 31) / 12;
+	c = FFT_ONE_Q31 - ((x2 * t) >> 31) / 2;
+
+	if (swap) {
+		t = s;
+		s = c;
+		c = t;
+	}
+
+	if (mirror)
+		c = -c;
+
+	w->real = sat_int32(c);
+	w->imag = sat_int32(-s);
+}
+
+struct fft_plan *fft_plan_new(uint32_t size)
+{
+	struct fft_plan *plan;
+	uint32_t len = 0;
+	uint32_t k;
+
+	/* Size must be a power of two in supported range */
+	if (size < FFT_SIZE_MIN || size > FFT_SIZE_MAX || (size & (size - 1)))
+		return NULL;
+
+	while ((1 << len) < size)
+		len++;
+
+	plan = rzalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, sizeof(*plan));
+	if (!plan)
+		return NULL;
+
+	plan->twiddle = rballoc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM,
+				size / 2 * sizeof(struct icomplex32));
+	plan->twiddle16 = rballoc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM,
+				  size / 2 * sizeof(struct icomplex16));
+	if (!plan->twiddle || !plan->twiddle16) {
+		fft_plan_free(plan);
+		return NULL;
+	}
+
+	plan->size = size;
+	plan->len = len;
+
+	for (k = 0; k < size / 2; k++) {
+		fft_twiddle(&plan->twiddle[k], k, len);
+		plan->twiddle16[k].real =
+			sat_int16(Q_SHIFT_RND(plan->twiddle[k].real, 31, 15));
+		plan->twiddle16[k].imag =
+			sat_int16(Q_SHIFT_RND(plan->twiddle[k].imag, 31, 15));
+	}
+
+	return plan;
+}
+
+void fft_plan_free(struct fft_plan *plan)
+{
+	if (!plan)
+		return;
+
+	rfree(plan->twiddle);
+	rfree(plan->twiddle16);
+	rfree(plan);
+}
+
+/* Reorder data to bit reversed index order */
+static void fft_bit_reverse_32(struct icomplex32 *data, uint32_t n)
+{
+	struct icomplex32 tmp;
+	uint32_t i;
+	uint32_t j = 0;
+	uint32_t m;
+
+	for (i = 0; i < n - 1; i++) {
+		if (i < j) {
+			tmp = data[i];
+			data[i] = data[j];
+			data[j] = tmp;
+		}
+
+		/* Increment j in reversed bit order */
+		m = n >> 1;
+		while (j & m) {
+			j ^= m;
+			m >>= 1;
+		}
+		j |= m;
+	}
+}
+
+static void fft_bit_reverse_16(struct icomplex16 *data, uint32_t n)
+{
+	struct icomplex16 tmp;
+	uint32_t i;
+	uint32_t j = 0;
+	uint32_t m;
+
+	for (i = 0; i < n - 1; i++) {
+		if (i < j) {
+			tmp = data[i];
+			data[i] = data[j];
+			data[j] = tmp;
+		}
+
+		m = n >> 1;
+		while (j & m) {
+			j ^= m;
+			m >>= 1;
+		}
+		j |= m;
+	}
+}
+
+#ifdef FFT_GENERIC
+
+void fft_radix4_32(struct icomplex32 *data, const struct icomplex32 *twiddle,
+		   uint32_t n, uint32_t h, uint32_t step, int ifft, int scale)
+{
+	uint32_t i;
+	uint32_t k;
+
+	for (i = 0; i < n; i += 4 * h) {
+		for (k = 0; k < h; k++) {
+			if (scale)
+				fft_butterfly4_scaled_32(&data[i + k], h,
+							 &twiddle[k * step],
+							 &twiddle[2 * k * step],
+							 ifft);
+			else
+				fft_butterfly4_32(&data[i + k], h,
+						  &twiddle[k * step],
+						  &twiddle[2 * k * step], ifft);
+		}
+	}
+}
+
+#endif
+
+/* Complex FFT of n points, twiddle[k * tw_step] is exp(-j*2*pi*k/n) */
+static void fft_stages_32(struct icomplex32 *data,
+			  const struct icomplex32 *twiddle, uint32_t n,
+			  uint32_t tw_step, int ifft, int scale)
+{
+	int shift = scale ? 1 : 0;
+	struct icomplex32 *a;
+	struct icomplex32 *b;
+	int32_t ar;
+	int32_t ai;
+	uint32_t h = 1;
+	uint32_t len = 0;
+	uint32_t i;
+
+	while ((1 << len) < n)
+		len++;
+
+	fft_bit_reverse_32(data, n);
+
+	/* Radix-2 first stage has only unity twiddles */
+	if (len & 1) {
+		for (i = 0; i < n; i += 2) {
+			a = &data[i];
+			b = &data[i + 1];
+			ar = a->real;
+			ai = a->imag;
+			a->real = sat_int32(((int64_t)ar + b->real) >> shift);
+			a->imag = sat_int32(((int64_t)ai + b->imag) >> shift);
+			b->real = sat_int32(((int64_t)ar - b->real) >> shift);
+			b->imag = sat_int32(((int64_t)ai - b->imag) >> shift);
+		}
+
+		h = 2;
+	}
+
+	for (; h < n; h <<= 2)
+		fft_radix4_32(data, twiddle, n, h, tw_step * n / (4 * h),
+			      ifft, scale);
+}
+
+void fft_execute_32(struct fft_plan *plan, struct icomplex32 *data, int ifft,
+		    int scale)
+{
+	fft_stages_32(data, plan->twiddle, plan->size, 1, ifft, scale);
+}
+
+/* Q1.15 complex multiply of x and w, with conjugated w for inverse */
+static inline void fft_cmul_16(int32_t *re, int32_t *im, int32_t xr,
+			       int32_t xi, const struct icomplex16 *w,
+			       int ifft)
+{
+	if (ifft) {
+		*re = (xr * w->real + xi * w->imag + (1 << 14)) >> 15;
+		*im = (xi * w->real - xr * w->imag + (1 << 14)) >> 15;
+	} else {
+		*re = (xr * w->real - xi * w->imag + (1 << 14)) >> 15;
+		*im = (xi * w->real + xr * w->imag + (1 << 14)) >> 15;
+	}
+}
+
+static inline void fft_butterfly4_16(struct icomplex16 *data, uint32_t h,
+				     const struct icomplex16 *w1,
+				     const struct icomplex16 *w2, int ifft,
+				     int shift)
+{
+	struct icomplex16 *a = data;
+	struct icomplex16 *b = data + h;
+	struct icomplex16 *c = data + 2 * h;
+	struct icomplex16 *d = data + 3 * h;
+	int32_t tr;
+	int32_t ti;
+	int16_t a1r;
+	int16_t a1i;
+	int16_t b1r;
+	int16_t b1i;
+	int16_t c1r;
+	int16_t c1i;
+	int16_t d1r;
+	int16_t d1i;
+
+	fft_cmul_16(&tr, &ti, b->real, b->imag, w2, ifft);
+	a1r = sat_int16((a->real + tr) >> shift);
+	a1i = sat_int16((a->imag + ti) >> shift);
+	b1r = sat_int16((a->real - tr) >> shift);
+	b1i = sat_int16((a->imag - ti) >> shift);
+	fft_cmul_16(&tr, &ti, d->real, d->imag, w2, ifft);
+	c1r = sat_int16((c->real + tr) >> shift);
+	c1i = sat_int16((c->imag + ti) >> shift);
+	d1r = sat_int16((c->real - tr) >> shift);
+	d1i = sat_int16((c->imag - ti) >> shift);
+
+	fft_cmul_16(&tr, &ti, c1r, c1i, w1, ifft);
+	a->real = sat_int16((a1r + tr) >> shift);
+	a->imag = sat_int16((a1i + ti) >> shift);
+	c->real = sat_int16((a1r - tr) >> shift);
+	c->imag = sat_int16((a1i - ti) >> shift);
+	fft_cmul_16(&tr, &ti, d1r, d1i, w1, ifft);
+	if (ifft) {
+		b->real = sat_int16((b1r - ti) >> shift);
+		b->imag = sat_int16((b1i + tr) >> shift);
+		d->real = sat_int16((b1r + ti) >> shift);
+		d->imag = sat_int16((b1i - tr) >> shift);
+	} else {
+		b->real = sat_int16((b1r + ti) >> shift);
+		b->imag = sat_int16((b1i - tr) >> shift);
+		d->real = sat_int16((b1r - ti) >> shift);
+		d->imag = sat_int16((b1i + tr) >> shift);
+	}
+}
+
+static void fft_stages_16(struct icomplex16 *data,
+			  const struct icomplex16 *twiddle, uint32_t n,
+			  uint32_t tw_step, int ifft, int shift)
+{
+	struct icomplex16 *a;
+	struct icomplex16 *b;
+	int16_t ar;
+	int16_t ai;
+	uint32_t h = 1;
+	uint32_t len = 0;
+	uint32_t step;
+	uint32_t i;
+	uint32_t k;
+
+	while ((1 << len) < n)
+		len++;
+
+	fft_bit_reverse_16(data, n);
+
+	if (len & 1) {
+		for (i = 0; i < n; i += 2) {
+			a = &data[i];
+			b = &data[i + 1];
+			ar = a->real;
+			ai = a->imag;
+			a->real = sat_int16((ar + b->real) >> shift);
+			a->imag = sat_int16((ai + b->imag) >> shift);
+			b->real = sat_int16((ar - b->real) >> shift);
+			b->imag = sat_int16((ai - b->imag) >> shift);
+		}
+
+		h = 2;
+	}
+
+	for (; h < n; h <<= 2) {
+		step = tw_step * n / (4 * h);
+		for (i = 0; i < n; i += 4 * h)
+			for (k = 0; k < h; k++)
+				fft_butterfly4_16(&data[i + k], h,
+						  &twiddle[k * step],
+						  &twiddle[2 * k * step],
+						  ifft, shift);
+	}
+}
+
+void fft_execute_16(struct fft_plan *plan, struct icomplex16 *data, int ifft,
+		    int scale)
+{
+	fft_stages_16(data, plan->twiddle16, plan->size, 1, ifft,
+		      scale ? 1 : 0);
+}
+
+/* Combine spectrum bin k from bins zk = Z[k] and zm = Z[n - k]. In forward
+ * direction Z is the spectrum of even and odd samples packed as complex
+ * and the result is half of the real signal spectrum bin. In inverse
+ * direction Z is the real signal spectrum and the result is half of the
+ * packed spectrum bin.
+ */
+static inline void fft_real_split_32(int64_t *re, int64_t *im,
+				     const struct icomplex32 *zk,
+				     const struct icomplex32 *zm,
+				     const struct icomplex32 *w, int ifft)
+{
+	int64_t er = ((int64_t)zk->real + zm->real) >> 1;
+	int64_t ei = ((int64_t)zk->imag - zm->imag) >> 1;
+	int64_t dr = ((int64_t)zk->real - zm->real) >> 1;
+	int64_t di = ((int64_t)zk->imag + zm->imag) >> 1;
+	int64_t tr;
+	int64_t ti;
+
+	/* Odd part is rotated by -j in forward and by +j in inverse */
+	if (ifft)
+		fft_cmul_32(&tr, &ti, -di, dr, w, ifft);
+	else
+		fft_cmul_32(&tr, &ti, di, -dr, w, ifft);
+
+	*re = er + tr;
+	*im = ei + ti;
+}
+
+void fft_real_execute_32(struct fft_plan *plan, struct icomplex32 *data,
+			 int ifft, int scale)
+{
+	const struct icomplex32 *w = plan->twiddle;
+	struct icomplex32 zk;
+	struct icomplex32 zm;
+	int64_t re;
+	int64_t im;
+	uint32_t n = plan->size / 2;
+	uint32_t k;
+
+	/* Output of split is half of the result in inverse unscaled
+	 * direction, correct it by a shift before saturation.
+	 */
+	int lshift = ifft && !scale ? 1 : 0;
+
+	/* The packed samples can have complex magnitude up to sqrt(2), the
+	 * scaled transform is done for the halved samples since the split
+	 * halves the spectrum.
+	 */
+	if (!ifft) {
+		if (scale) {
+			for (k = 0; k < n; k++) {
+				data[k].real >>= 1;
+				data[k].imag >>= 1;
+			}
+		}
+
+		fft_stages_32(data, w, n, 2, ifft, scale);
+	}
+
+	zk = data[0];
+	if (ifft) {
+		fft_real_split_32(&re, &im, &zk, &data[n], &w[0], ifft);
+		data[0].real = sat_int32(re << lshift);
+		data[0].imag = sat_int32(im << lshift);
+	} else {
+		data[0].real = sat_int32((int64_t)zk.real + zk.imag);
+		data[0].imag = 0;
+		data[n].real = sat_int32((int64_t)zk.real - zk.imag);
+		data[n].imag = 0;
+	}
+
+	for (k = 1; k <= n / 2; k++) {
+		zk = data[k];
+		zm = data[n - k];
+
+		fft_real_split_32(&re, &im, &zk, &zm, &w[k], ifft);
+		data[k].real = sat_int32(re << lshift);
+		data[k].imag = sat_int32(im << lshift);
+
+		if (k == n - k)
+			break;
+
+		fft_real_split_32(&re, &im, &zm, &zk, &w[n - k], ifft);
+		data[n - k].real = sat_int32(re << lshift);
+		data[n - k].imag = sat_int32(im << lshift);
+	}
+
+	if (ifft)
+		fft_stages_32(data, w, n, 2, ifft, scale);
+}
+
+static inline void fft_real_split_16(int32_t *re, int32_t *im,
+				     const struct icomplex16 *zk,
+				     const struct icomplex16 *zm,
+				     const struct icomplex16 *w, int ifft)
+{
+	int32_t er = (zk->real + zm->real) >> 1;
+	int32_t ei = (zk->imag - zm->imag) >> 1;
+	int32_t dr = (zk->real - zm->real) >> 1;
+	int32_t di = (zk->imag + zm->imag) >> 1;
+	int32_t tr;
+	int32_t ti;
+
+	if (ifft)
+		fft_cmul_16(&tr, &ti, -di, dr, w, ifft);
+	else
+		fft_cmul_16(&tr, &ti, di, -dr, w, ifft);
+
+	*re = er + tr;
+	*im = ei + ti;
+}
+
+void fft_real_execute_16(struct fft_plan *plan, struct icomplex16 *data,
+			 int ifft, int scale)
+{
+	const struct icomplex16 *w = plan->twiddle16;
+	struct icomplex16 zk;
+	struct icomplex16 zm;
+	int32_t re;
+	int32_t im;
+	uint32_t n = plan->size / 2;
+	uint32_t k;
+	int shift = scale ? 1 : 0;
+	int lshift = ifft && !scale ? 1 : 0;
+
+	if (!ifft) {
+		if (scale) {
+			for (k = 0; k < n; k++) {
+				data[k].real >>= 1;
+				data[k].imag >>= 1;
+			}
+		}
+
+		fft_stages_16(data, w, n, 2, ifft, shift);
+	}
+
+	zk = data[0];
+	if (ifft) {
+		fft_real_split_16(&re, &im, &zk, &data[n], &w[0], ifft);
+		data[0].real = sat_int16(re << lshift);
+		data[0].imag = sat_int16(im << lshift);
+	} else {
+		data[0].real = sat_int16(zk.real + zk.imag);
+		data[0].imag = 0;
+		data[n].real = sat_int16(zk.real - zk.imag);
+		data[n].imag = 0;
+	}
+
+	for (k = 1; k <= n / 2; k++) {
+		zk = data[k];
+		zm = data[n - k];
+
+		fft_real_split_16(&re, &im, &zk, &zm, &w[k], ifft);
+		data[k].real = sat_int16(re << lshift);
+		data[k].imag = sat_int16(im << lshift);
+
+		if (k == n - k)
+			break;
+
+		fft_real_split_16(&re, &im, &zm, &zk, &w[n - k], ifft);
+		data[n - k].real = sat_int16(re << lshift);
+		data[n - k].imag = sat_int16(im << lshift);
+	}
+
+	if (ifft)
+		fft_stages_16(data, w, n, 2, ifft, shift);
+}
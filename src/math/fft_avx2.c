@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdint.h>
+#include <sof/math/fft.h>
+
+#if defined(__AVX2__)
+
+#include <immintrin.h>
+
+/*
+ * Four complex numbers are processed in parallel. The scaled butterflies
+ * are computed with interleaved real and imaginary parts in 32 bit lanes
+ * and the saturating butterflies with real and imaginary parts sign
+ * extended to separate vectors of 64 bit lanes.
+ */
+
+struct fft_avx2_c4 {
+	__m256i re;
+	__m256i im;
+};
+
+/* Twiddles for k to k + 3, the twiddle real part is in the low and the
+ * imaginary part in the high 32 bits of the lanes of w.
+ */
+static inline __m256i fft_avx2_twiddle(const struct icomplex32 *w,
+				       uint32_t k, uint32_t step)
+{
+	__m128i idx = _mm_setr_epi32(k * step, (k + 1) * step,
+				     (k + 2) * step, (k + 3) * step);
+
+	return _mm256_i32gather_epi64((const long long *)w, idx, 8);
+}
+
+/* Half of complex multiply of x and w as fft_cmul_half_32() */
+static inline __m256i fft_avx2_cmul_half(__m256i x, __m256i w, int ifft)
+{
+	const __m256i rnd = _mm256_set1_epi64x(1LL << 31);
+	const __m256i max = _mm256_set1_epi32(FFT_HALF_MAX);
+	const __m256i min = _mm256_set1_epi32(-FFT_HALF_MAX);
+	__m256i xi = _mm256_srli_epi64(x, 32);
+	__m256i wi = _mm256_srli_epi64(w, 32);
+	__m256i rr = _mm256_mul_epi32(x, w);
+	__m256i ii = _mm256_mul_epi32(xi, wi);
+	__m256i ri = _mm256_mul_epi32(x, wi);
+	__m256i ir = _mm256_mul_epi32(xi, w);
+	__m256i re;
+	__m256i im;
+
+	if (ifft) {
+		re = _mm256_add_epi64(_mm256_add_epi64(rr, ii), rnd);
+		im = _mm256_add_epi64(_mm256_sub_epi64(ir, ri), rnd);
+	} else {
+		re = _mm256_add_epi64(_mm256_sub_epi64(rr, ii), rnd);
+		im = _mm256_add_epi64(_mm256_add_epi64(ir, ri), rnd);
+	}
+
+	/* The high words of the products are the interleaved results */
+	re = _mm256_blend_epi32(_mm256_srli_epi64(re, 32), im, 0xaa);
+	return _mm256_max_epi32(_mm256_min_epi32(re, max), min);
+}
+
+/* Four radix-4 butterflies as fft_butterfly4_scaled_32() */
+static inline void fft_avx2_butterfly4_scaled(struct icomplex32 *data,
+					      uint32_t h, __m256i w1,
+					      __m256i w2, int ifft)
+{
+	const __m256i neg = ifft ?
+		_mm256_setr_epi32(-1, 1, -1, 1, -1, 1, -1, 1) :
+		_mm256_setr_epi32(1, -1, 1, -1, 1, -1, 1, -1);
+	__m256i a = _mm256_loadu_si256((__m256i *)data);
+	__m256i b = _mm256_loadu_si256((__m256i *)(data + h));
+	__m256i c = _mm256_loadu_si256((__m256i *)(data + 2 * h));
+	__m256i d = _mm256_loadu_si256((__m256i *)(data + 3 * h));
+	__m256i t;
+
+	/* First stage */
+	a = _mm256_srai_epi32(a, 1);
+	c = _mm256_srai_epi32(c, 1);
+	t = fft_avx2_cmul_half(b, w2, ifft);
+	b = _mm256_sub_epi32(a, t);
+	a = _mm256_add_epi32(a, t);
+	t = fft_avx2_cmul_half(d, w2, ifft);
+	d = _mm256_sub_epi32(c, t);
+	c = _mm256_add_epi32(c, t);
+
+	/* Second stage, the twiddle of the second half is rotated by -j
+	 * in forward and by +j in inverse transform.
+	 */
+	a = _mm256_srai_epi32(a, 1);
+	b = _mm256_srai_epi32(b, 1);
+	t = fft_avx2_cmul_half(c, w1, ifft);
+	c = _mm256_sub_epi32(a, t);
+	a = _mm256_add_epi32(a, t);
+	t = fft_avx2_cmul_half(d, w1, ifft);
+	t = _mm256_sign_epi32(_mm256_shuffle_epi32(t, 0xb1), neg);
+	d = _mm256_sub_epi32(b, t);
+	b = _mm256_add_epi32(b, t);
+
+	_mm256_storeu_si256((__m256i *)data, a);
+	_mm256_storeu_si256((__m256i *)(data + h), b);
+	_mm256_storeu_si256((__m256i *)(data + 2 * h), c);
+	_mm256_storeu_si256((__m256i *)(data + 3 * h), d);
+}
+
+static inline struct fft_avx2_c4 fft_avx2_load(const struct icomplex32 *x)
+{
+	__m256i v = _mm256_loadu_si256((const __m256i *)x);
+	__m256i sign = _mm256_srai_epi32(v, 31);
+	struct fft_avx2_c4 c;
+
+	c.re = _mm256_blend_epi32(v, _mm256_slli_epi64(sign, 32), 0xaa);
+	c.im = _mm256_blend_epi32(_mm256_srli_epi64(v, 32), sign, 0xaa);
+	return c;
+}
+
+static inline void fft_avx2_store(struct icomplex32 *x, struct fft_avx2_c4 c)
+{
+	__m256i v = _mm256_blend_epi32(c.re, _mm256_slli_epi64(c.im, 32),
+				       0xaa);
+
+	_mm256_storeu_si256((__m256i *)x, v);
+}
+
+/* Round Q2.62 to Q2.31 as (x + 2^30) >> 31, there is no 64 bit arithmetic
+ * shift so shift logically and sign extend from bit 32.
+ */
+static inline __m256i fft_avx2_rnd(__m256i x)
+{
+	const __m256i rnd = _mm256_set1_epi64x(1LL << 30);
+	const __m256i sign = _mm256_set1_epi64x(1LL << 32);
+
+	x = _mm256_srli_epi64(_mm256_add_epi64(x, rnd), 31);
+	return _mm256_sub_epi64(_mm256_xor_si256(x, sign), sign);
+}
+
+/* Complex multiply of x and w as fft_cmul_32() */
+static inline struct fft_avx2_c4 fft_avx2_cmul(struct fft_avx2_c4 x,
+					       __m256i w, int ifft)
+{
+	__m256i wi = _mm256_srli_epi64(w, 32);
+	__m256i rr = _mm256_mul_epi32(x.re, w);
+	__m256i ii = _mm256_mul_epi32(x.im, wi);
+	__m256i ri = _mm256_mul_epi32(x.re, wi);
+	__m256i ir = _mm256_mul_epi32(x.im, w);
+	struct fft_avx2_c4 c;
+
+	if (ifft) {
+		c.re = fft_avx2_rnd(_mm256_add_epi64(rr, ii));
+		c.im = fft_avx2_rnd(_mm256_sub_epi64(ir, ri));
+	} else {
+		c.re = fft_avx2_rnd(_mm256_sub_epi64(rr, ii));
+		c.im = fft_avx2_rnd(_mm256_add_epi64(ir, ri));
+	}
+
+	return c;
+}
+
+static inline __m256i fft_avx2_sat(__m256i x)
+{
+	const __m256i max = _mm256_set1_epi64x(INT32_MAX);
+	const __m256i min = _mm256_set1_epi64x(INT32_MIN);
+
+	x = _mm256_blendv_epi8(x, max, _mm256_cmpgt_epi64(x, max));
+	return _mm256_blendv_epi8(x, min, _mm256_cmpgt_epi64(min, x));
+}
+
+/* Saturating radix-2 butterfly x + t and x - t */
+static inline void fft_avx2_butterfly(struct fft_avx2_c4 *top,
+				      struct fft_avx2_c4 *bottom,
+				      struct fft_avx2_c4 x,
+				      struct fft_avx2_c4 t)
+{
+	top->re = fft_avx2_sat(_mm256_add_epi64(x.re, t.re));
+	top->im = fft_avx2_sat(_mm256_add_epi64(x.im, t.im));
+	bottom->re = fft_avx2_sat(_mm256_sub_epi64(x.re, t.re));
+	bottom->im = fft_avx2_sat(_mm256_sub_epi64(x.im, t.im));
+}
+
+/* Four radix-4 butterflies as fft_butterfly4_32() */
+static inline void fft_avx2_butterfly4(struct icomplex32 *data, uint32_t h,
+				       __m256i w1, __m256i w2, int ifft)
+{
+	struct fft_avx2_c4 a = fft_avx2_load(data);
+	struct fft_avx2_c4 b = fft_avx2_load(data + h);
+	struct fft_avx2_c4 c = fft_avx2_load(data + 2 * h);
+	struct fft_avx2_c4 d = fft_avx2_load(data + 3 * h);
+	struct fft_avx2_c4 a1;
+	struct fft_avx2_c4 b1;
+	struct fft_avx2_c4 c1;
+	struct fft_avx2_c4 d1;
+	struct fft_avx2_c4 t;
+	__m256i tr;
+
+	fft_avx2_butterfly(&a1, &b1, a, fft_avx2_cmul(b, w2, ifft));
+	fft_avx2_butterfly(&c1, &d1, c, fft_avx2_cmul(d, w2, ifft));
+
+	fft_avx2_butterfly(&a, &c, a1, fft_avx2_cmul(c1, w1, ifft));
+	t = fft_avx2_cmul(d1, w1, ifft);
+	tr = t.re;
+	if (ifft) {
+		t.re = _mm256_sub_epi64(_mm256_setzero_si256(), t.im);
+		t.im = tr;
+	} else {
+		t.re = t.im;
+		t.im = _mm256_sub_epi64(_mm256_setzero_si256(), tr);
+	}
+
+	fft_avx2_butterfly(&b, &d, b1, t);
+
+	fft_avx2_store(data, a);
+	fft_avx2_store(data + h, b);
+	fft_avx2_store(data + 2 * h, c);
+	fft_avx2_store(data + 3 * h, d);
+}
+
+void fft_radix4_32(struct icomplex32 *data, const struct icomplex32 *twiddle,
+		   uint32_t n, uint32_t h, uint32_t step, int ifft, int scale)
+{
+	const struct icomplex32 *w1;
+	const struct icomplex32 *w2;
+	__m256i w1v;
+	__m256i w2v;
+	uint32_t i;
+	uint32_t k;
+
+	for (i = 0; i < n; i += 4 * h) {
+		for (k = 0; k + 4 <= h; k += 4) {
+			w1v = fft_avx2_twiddle(twiddle, k, step);
+			w2v = fft_avx2_twiddle(twiddle, k, 2 * step);
+			if (scale)
+				fft_avx2_butterfly4_scaled(&data[i + k], h,
+							   w1v, w2v, ifft);
+			else
+				fft_avx2_butterfly4(&data[i + k], h, w1v, w2v,
+						    ifft);
+		}
+
+		/* Short spans of the first stages */
+		for (; k < h; k++) {
+			w1 = &twiddle[k * step];
+			w2 = &twiddle[2 * k * step];
+			if (scale)
+				fft_butterfly4_scaled_32(&data[i + k], h, w1,
+							 w2, ifft);
+			else
+				fft_butterfly4_32(&data[i + k], h, w1, w2,
+						  ifft);
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdint.h>
+#include <sof/math/fft.h>
+
+#if defined(__SSE4_2__) && !defined(__AVX2__)
+
+#include <immintrin.h>
+
+/*
+ * Two complex numbers are processed in parallel. The scaled butterflies
+ * are computed with interleaved real and imaginary parts in 32 bit lanes
+ * and the saturating butterflies with real and imaginary parts sign
+ * extended to separate vectors of 64 bit lanes.
+ */
+
+struct fft_sse42_c2 {
+	__m128i re;
+	__m128i im;
+};
+
+/* Twiddles for k and k + 1, the twiddle real part is in the low and the
+ * imaginary part in the high 32 bits of the lanes of w.
+ */
+static inline __m128i fft_sse42_twiddle(const struct icomplex32 *w,
+					uint32_t k, uint32_t step)
+{
+	__m128i w0 = _mm_loadl_epi64((const __m128i *)&w[k * step]);
+	__m128i w1 = _mm_loadl_epi64((const __m128i *)&w[(k + 1) * step]);
+
+	return _mm_unpacklo_epi64(w0, w1);
+}
+
+/* Half of complex multiply of x and w as fft_cmul_half_32() */
+static inline __m128i fft_sse42_cmul_half(__m128i x, __m128i w, int ifft)
+{
+	const __m128i rnd = _mm_set1_epi64x(1LL << 31);
+	const __m128i max = _mm_set1_epi32(FFT_HALF_MAX);
+	const __m128i min = _mm_set1_epi32(-FFT_HALF_MAX);
+	__m128i xi = _mm_srli_epi64(x, 32);
+	__m128i wi = _mm_srli_epi64(w, 32);
+	__m128i rr = _mm_mul_epi32(x, w);
+	__m128i ii = _mm_mul_epi32(xi, wi);
+	__m128i ri = _mm_mul_epi32(x, wi);
+	__m128i ir = _mm_mul_epi32(xi, w);
+	__m128i re;
+	__m128i im;
+
+	if (ifft) {
+		re = _mm_add_epi64(_mm_add_epi64(rr, ii), rnd);
+		im = _mm_add_epi64(_mm_sub_epi64(ir, ri), rnd);
+	} else {
+		re = _mm_add_epi64(_mm_sub_epi64(rr, ii), rnd);
+		im = _mm_add_epi64(_mm_add_epi64(ir, ri), rnd);
+	}
+
+	/* The high words of the products are the interleaved results */
+	re = _mm_blend_epi16(_mm_srli_epi64(re, 32), im, 0xcc);
+	return _mm_max_epi32(_mm_min_epi32(re, max), min);
+}
+
+/* Two radix-4 butterflies as fft_butterfly4_scaled_32() */
+static inline void fft_sse42_butterfly4_scaled(struct icomplex32 *data,
+					       uint32_t h, __m128i w1,
+					       __m128i w2, int ifft)
+{
+	const __m128i neg = ifft ? _mm_setr_epi32(-1, 1, -1, 1) :
+		_mm_setr_epi32(1, -1, 1, -1);
+	__m128i a = _mm_loadu_si128((__m128i *)data);
+	__m128i b = _mm_loadu_si128((__m128i *)(data + h));
+	__m128i c = _mm_loadu_si128((__m128i *)(data + 2 * h));
+	__m128i d = _mm_loadu_si128((__m128i *)(data + 3 * h));
+	__m128i t;
+
+	/* First stage */
+	a = _mm_srai_epi32(a, 1);
+	c = _mm_srai_epi32(c, 1);
+	t = fft_sse42_cmul_half(b, w2, ifft);
+	b = _mm_sub_epi32(a, t);
+	a = _mm_add_epi32(a, t);
+	t = fft_sse42_cmul_half(d, w2, ifft);
+	d = _mm_sub_epi32(c, t);
+	c = _mm_add_epi32(c, t);
+
+	/* Second stage, the twiddle of the second half is rotated by -j
+	 * in forward and by +j in inverse transform.
+	 */
+	a = _mm_srai_epi32(a, 1);
+	b = _mm_srai_epi32(b, 1);
+	t = fft_sse42_cmul_half(c, w1, ifft);
+	c = _mm_sub_epi32(a, t);
+	a = _mm_add_epi32(a, t);
+	t = fft_sse42_cmul_half(d, w1, ifft);
+	t = _mm_sign_epi32(_mm_shuffle_epi32(t, 0xb1), neg);
+	d = _mm_sub_epi32(b, t);
+	b = _mm_add_epi32(b, t);
+
+	_mm_storeu_si128((__m128i *)data, a);
+	_mm_storeu_si128((__m128i *)(data + h), b);
+	_mm_storeu_si128((__m128i *)(data + 2 * h), c);
+	_mm_storeu_si128((__m128i *)(data + 3 * h), d);
+}
+
+static inline struct fft_sse42_c2 fft_sse42_load(const struct icomplex32 *x)
+{
+	__m128i v = _mm_loadu_si128((const __m128i *)x);
+	__m128i sign = _mm_srai_epi32(v, 31);
+	struct fft_sse42_c2 c;
+
+	c.re = _mm_blend_epi16(v, _mm_slli_epi64(sign, 32), 0xcc);
+	c.im = _mm_blend_epi16(_mm_srli_epi64(v, 32), sign, 0xcc);
+	return c;
+}
+
+static inline void fft_sse42_store(struct icomplex32 *x, struct fft_sse42_c2 c)
+{
+	__m128i v = _mm_blend_epi16(c.re, _mm_slli_epi64(c.im, 32), 0xcc);
+
+	_mm_storeu_si128((__m128i *)x, v);
+}
+
+/* Round Q2.62 to Q2.31 as (x + 2^30) >> 31, there is no 64 bit arithmetic
+ * shift so shift logically and sign extend from bit 32.
+ */
+static inline __m128i fft_sse42_rnd(__m128i x)
+{
+	const __m128i rnd = _mm_set1_epi64x(1LL << 30);
+	const __m128i sign = _mm_set1_epi64x(1LL << 32);
+
+	x = _mm_srli_epi64(_mm_add_epi64(x, rnd), 31);
+	return _mm_sub_epi64(_mm_xor_si128(x, sign), sign);
+}
+
+/* Complex multiply of x and w as fft_cmul_32() */
+static inline struct fft_sse42_c2 fft_sse42_cmul(struct fft_sse42_c2 x,
+						 __m128i w, int ifft)
+{
+	__m128i wi = _mm_srli_epi64(w, 32);
+	__m128i rr = _mm_mul_epi32(x.re, w);
+	__m128i ii = _mm_mul_epi32(x.im, wi);
+	__m128i ri = _mm_mul_epi32(x.re, wi);
+	__m128i ir = _mm_mul_epi32(x.im, w);
+	struct fft_sse42_c2 c;
+
+	if (ifft) {
+		c.re = fft_sse42_rnd(_mm_add_epi64(rr, ii));
+		c.im = fft_sse42_rnd(_mm_sub_epi64(ir, ri));
+	} else {
+		c.re = fft_sse42_rnd(_mm_sub_epi64(rr, ii));
+		c.im = fft_sse42_rnd(_mm_add_epi64(ir, ri));
+	}
+
+	return c;
+}
+
+static inline __m128i fft_sse42_sat(__m128i x)
+{
+	const __m128i max = _mm_set1_epi64x(INT32_MAX);
+	const __m128i min = _mm_set1_epi64x(INT32_MIN);
+
+	x = _mm_blendv_epi8(x, max, _mm_cmpgt_epi64(x, max));
+	return _mm_blendv_epi8(x, min, _mm_cmpgt_epi64(min, x));
+}
+
+/* Saturating radix-2 butterfly x + t and x - t */
+static inline void fft_sse42_butterfly(struct fft_sse42_c2 *top,
+				       struct fft_sse42_c2 *bottom,
+				       struct fft_sse42_c2 x,
+				       struct fft_sse42_c2 t)
+{
+	top->re = fft_sse42_sat(_mm_add_epi64(x.re, t.re));
+	top->im = fft_sse42_sat(_mm_add_epi64(x.im, t.im));
+	bottom->re = fft_sse42_sat(_mm_sub_epi64(x.re, t.re));
+	bottom->im = fft_sse42_sat(_mm_sub_epi64(x.im, t.im));
+}
+
+/* Two radix-4 butterflies as fft_butterfly4_32() */
+static inline void fft_sse42_butterfly4(struct icomplex32 *data, uint32_t h,
+					__m128i w1, __m128i w2, int ifft)
+{
+	struct fft_sse42_c2 a = fft_sse42_load(data);
+	struct fft_sse42_c2 b = fft_sse42_load(data + h);
+	struct fft_sse42_c2 c = fft_sse42_load(data + 2 * h);
+	struct fft_sse42_c2 d = fft_sse42_load(data + 3 * h);
+	struct fft_sse42_c2 a1;
+	struct fft_sse42_c2 b1;
+	struct fft_sse42_c2 c1;
+	struct fft_sse42_c2 d1;
+	struct fft_sse42_c2 t;
+	__m128i tr;
+
+	fft_sse42_butterfly(&a1, &b1, a, fft_sse42_cmul(b, w2, ifft));
+	fft_sse42_butterfly(&c1, &d1, c, fft_sse42_cmul(d, w2, ifft));
+
+	fft_sse42_butterfly(&a, &c, a1, fft_sse42_cmul(c1, w1, ifft));
+	t = fft_sse42_cmul(d1, w1, ifft);
+	tr = t.re;
+	if (ifft) {
+		t.re = _mm_sub_epi64(_mm_setzero_si128(), t.im);
+		t.im = tr;
+	} else {
+		t.re = t.im;
+		t.im = _mm_sub_epi64(_mm_setzero_si128(), tr);
+	}
+
+	fft_sse42_butterfly(&b, &d, b1, t);
+
+	fft_sse42_store(data, a);
+	fft_sse42_store(data + h, b);
+	fft_sse42_store(data + 2 * h, c);
+	fft_sse42_store(data + 3 * h, d);
+}
+
+void fft_radix4_32(struct icomplex32 *data, const struct icomplex32 *twiddle,
+		   uint32_t n, uint32_t h, uint32_t step, int ifft, int scale)
+{
+	const struct icomplex32 *w1;
+	const struct icomplex32 *w2;
+	__m128i w1v;
+	__m128i w2v;
+	uint32_t i;
+	uint32_t k;
+
+	for (i = 0; i < n; i += 4 * h) {
+		for (k = 0; k + 2 <= h; k += 2) {
+			w1v = fft_sse42_twiddle(twiddle, k, step);
+			w2v = fft_sse42_twiddle(twiddle, k, 2 * step);
+			if (scale)
+				fft_sse42_butterfly4_scaled(&data[i + k], h,
+							    w1v, w2v, ifft);
+			else
+				fft_sse42_butterfly4(&data[i + k], h, w1v,
+						     w2v, ifft);
+		}
+
+		/* Span of the first stage */
+		for (; k < h; k++) {
+			w1 = &twiddle[k * step];
+			w2 = &twiddle[2 * k * step];
+			if (scale)
+				fft_butterfly4_scaled_32(&data[i + k], h, w1,
+							 w2, ifft);
+			else
+				fft_butterfly4_32(&data[i + k], h, w1, w2,
+						  ifft);
+		}
+	}
+}
+
+#endif
@@ -37,6 +37,11 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#define PLATFORM_MASTER_CORE_ID	0
+
+/* virtual cores available to multi-threaded library users */
+#define PLATFORM_CORE_COUNT	4
+
 /*! \def PLATFORM_DEFAULT_CLOCK
  *  \brief clock source for audio pipeline
  *
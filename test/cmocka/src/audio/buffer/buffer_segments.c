@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sof/audio/component.h>
+#include <sof/audio/buffer.h>
+#include <sof/ipc.h>
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <math.h>
+#include <stdint.h>
+#include <cmocka.h>
+
+static void test_audio_buffer_segments_no_wrap(void **state)
+{
+	(void)state;
+
+	struct sof_ipc_buffer test_buf_desc = {
+		.size = 16
+	};
+
+	struct comp_buffer *buf = buffer_new(&test_buf_desc);
+	struct buffer_segments seg;
+
+	assert_non_null(buf);
+
+	buf->r_ptr = buf->addr + 4;
+	buffer_read_segments(buf, 8, &seg);
+
+	assert_ptr_equal(seg.ptr[0], buf->addr + 4);
+	assert_int_equal(seg.bytes[0], 8);
+	assert_int_equal(seg.bytes[1], 0);
+
+	buffer_free(buf);
+}
+
+static void test_audio_buffer_segments_wrap(void **state)
+{
+	(void)state;
+
+	struct sof_ipc_buffer test_buf_desc = {
+		.size = 16
+	};
+
+	struct comp_buffer *buf = buffer_new(&test_buf_desc);
+	struct buffer_segments seg;
+
+	assert_non_null(buf);
+
+	buf->w_ptr = buf->addr + 12;
+	buffer_write_segments(buf, 10, &seg);
+
+	assert_ptr_equal(seg.ptr[0], buf->addr + 12);
+	assert_int_equal(seg.bytes[0], 4);
+	assert_ptr_equal(seg.ptr[1], buf->addr);
+	assert_int_equal(seg.bytes[1], 6);
+
+	buffer_free(buf);
+}
+
+static void test_audio_buffer_segments_end_to_end(void **state)
+{
+	(void)state;
+
+	struct sof_ipc_buffer test_buf_desc = {
+		.size = 16
+	};
+
+	struct comp_buffer *buf = buffer_new(&test_buf_desc);
+	struct buffer_segments seg;
+
+	assert_non_null(buf);
+
+	buf->r_ptr = buf->addr + 8;
+	buffer_read_segments(buf, 8, &seg);
+
+	assert_ptr_equal(seg.ptr[0], buf->addr + 8);
+	assert_int_equal(seg.bytes[0], 8);
+	assert_int_equal(seg.bytes[1], 0);
+
+	buffer_free(buf);
+}
+
+static void test_audio_buffer_steps_without_wrap(void **state)
+{
+	(void)state;
+
+	struct sof_ipc_buffer test_buf_desc = {
+		.size = 24
+	};
+
+	struct comp_buffer *buf = buffer_new(&test_buf_desc);
+
+	assert_non_null(buf);
+
+	assert_int_equal(buffer_bytes_without_wrap(buf, buf->addr + 10), 14);
+
+	/* 2 byte samples, every step stays inside the buffer */
+	assert_int_equal(buffer_steps_without_wrap(buf, buf->addr + 10, 2), 7);
+
+	/* stride of interleaved frame, last step lands past the end */
+	assert_int_equal(buffer_steps_without_wrap(buf, buf->addr + 10, 8), 2);
+
+	buffer_free(buf);
+}
+
+static void test_audio_buffer_wrap_ptr(void **state)
+{
+	(void)state;
+
+	struct sof_ipc_buffer test_buf_desc = {
+		.size = 16
+	};
+
+	struct comp_buffer *buf = buffer_new(&test_buf_desc);
+
+	assert_non_null(buf);
+
+	assert_ptr_equal(buffer_wrap(buf, buf->addr + 15), buf->addr + 15);
+	assert_ptr_equal(buffer_wrap(buf, buf->addr + 16), buf->addr);
+	assert_ptr_equal(buffer_wrap(buf, buf->addr + 22), buf->addr + 6);
+
+	buffer_free(buf);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_audio_buffer_segments_no_wrap),
+		cmocka_unit_test(test_audio_buffer_segments_wrap),
+		cmocka_unit_test(test_audio_buffer_segments_end_to_end),
+		cmocka_unit_test(test_audio_buffer_steps_without_wrap),
+		cmocka_unit_test(test_audio_buffer_wrap_ptr),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
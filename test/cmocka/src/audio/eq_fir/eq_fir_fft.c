@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include <cmocka.h>
+
+#include <sof/alloc.h>
+#include <sof/audio/component.h>
+#include <sof/audio/format.h>
+#include <uapi/user/eq.h>
+#include "fir_fft.h"
+
+#include <mock_trace.h>
+
+TRACE_IMPL()
+
+/* Frames to process and frames per copy, the copy size is not a multiple
+ * of the partition size and the buffers wrap in the middle of a copy.
+ */
+#define TEST_FRAMES		2048
+#define TEST_COPY_FRAMES	48
+#define TEST_BUFFER_FRAMES	80
+#define TEST_CHANNELS		2
+
+struct fir_fft_test_parameters {
+	int length;
+	int out_shift;
+	int psize;
+	int frame_fmt;
+	int32_t tolerance; /* Max error as Q1.31 */
+};
+
+struct fir_fft_test_state {
+	struct fir_fft_test_parameters *params;
+	struct sof_eq_fir_coef_data *coef;
+	struct fir_fft fft;
+	int32_t *fft_data;
+	struct comp_buffer source;
+	struct comp_buffer sink;
+	int32_t *input;
+	int32_t *output;
+	int32_t *reference;
+};
+
+void *rballoc(int zone, uint32_t caps, size_t bytes)
+{
+	(void)zone;
+	(void)caps;
+
+	return malloc(bytes);
+}
+
+void *rzalloc(int zone, uint32_t caps, size_t bytes)
+{
+	(void)zone;
+	(void)caps;
+
+	return calloc(bytes, 1);
+}
+
+void rfree(void *ptr)
+{
+	free(ptr);
+}
+
+void __panic(uint32_t p, char *filename, uint32_t linenum)
+{
+	(void)p;
+	(void)filename;
+	(void)linenum;
+}
+
+static int sample_bytes(int frame_fmt)
+{
+	return frame_fmt == SOF_IPC_FRAME_S16_LE ?
+		sizeof(int16_t) : sizeof(int32_t);
+}
+
+/* Quantize Q1.31 to the test format and back */
+static int32_t quantize(int32_t x, int frame_fmt)
+{
+	switch (frame_fmt) {
+	case SOF_IPC_FRAME_S16_LE:
+		return sat_int16(Q_SHIFT_RND(x, 31, 15)) << 16;
+	case SOF_IPC_FRAME_S24_4LE:
+		return sat_int24(Q_SHIFT_RND(x, 31, 23)) << 8;
+	default:
+		return x;
+	}
+}
+
+/* Windowed sinc low-pass with a gain of 1/2^out_shift at DC */
+static void init_coef(struct sof_eq_fir_coef_data *coef, int length,
+		      int out_shift)
+{
+	double c = (length - 1) / 2.0;
+	double t;
+	double w;
+	int i;
+
+	coef->length = length;
+	coef->out_shift = out_shift;
+	for (i = 0; i < length; i++) {
+		t = (i - c) * 0.1 * M_PI;
+		w = 0.54 - 0.46 * cos(2 * M_PI * i / (length - 1));
+		coef->coef[i] = lrint(32767.0 * 0.1 * w *
+				      (t == 0.0 ? 1.0 : sin(t) / t));
+	}
+}
+
+/* Sum of tones and noise at about -3 dBFS */
+static void init_input(int32_t *x, int n, int frame_fmt)
+{
+	double v;
+	int i;
+
+	srand(1);
+	for (i = 0; i < n; i++) {
+		v = 0.3 * sin(0.01 * i) + 0.2 * sin(0.7 * i) +
+			0.2 * ((double)rand() / RAND_MAX - 0.5);
+		x[i] = quantize(lrint(v * INT32_MAX), frame_fmt);
+	}
+}
+
+/* Direct form reference with the same arithmetic as the EQ FIR */
+static void direct_form(struct sof_eq_fir_coef_data *coef, int32_t *x,
+			int32_t *y, int frames, int nch, int frame_fmt)
+{
+	int shift = 15 + coef->out_shift;
+	int64_t acc;
+	int ch;
+	int i;
+	int j;
+
+	for (ch = 0; ch < nch; ch++) {
+		for (i = 0; i < frames; i++) {
+			acc = 0;
+			for (j = 0; j < coef->length && j <= i; j++)
+				acc += (int64_t)coef->coef[j] *
+					x[(i - j) * nch + ch];
+
+			y[i * nch + ch] = quantize(sat_int32(acc >> shift),
+						   frame_fmt);
+		}
+	}
+}
+
+static void init_buffer(struct comp_buffer *buffer, int frame_fmt)
+{
+	buffer->size = TEST_BUFFER_FRAMES * TEST_CHANNELS *
+		sample_bytes(frame_fmt);
+	buffer->addr = calloc(buffer->size, 1);
+	buffer->end_addr = buffer->addr + buffer->size;
+	buffer->r_ptr = buffer->addr;
+	buffer->w_ptr = buffer->addr;
+}
+
+static int setup(void **state)
+{
+	struct fir_fft_test_parameters *params = *state;
+	struct fir_fft_test_state *test;
+	int32_t *data;
+	int bytes;
+	int ch;
+
+	test = calloc(1, sizeof(*test));
+	test->params = params;
+	test->coef = calloc(1, sizeof(struct sof_eq_fir_coef_data) +
+			    params->length * sizeof(int16_t));
+	init_coef(test->coef, params->length, params->out_shift);
+
+	assert_int_equal(fir_fft_init(&test->fft, params->psize), 0);
+
+	/* The first channel is filtered and the second is delayed only */
+	bytes = fir_fft_init_coef(&test->fft, &test->fft.state[0],
+				  test->coef);
+	assert_true(bytes > 0);
+	bytes += fir_fft_init_coef(&test->fft, &test->fft.state[1], NULL);
+
+	test->fft_data = malloc(bytes);
+	data = test->fft_data;
+	for (ch = 0; ch < TEST_CHANNELS; ch++)
+		fir_fft_init_data(&test->fft, &test->fft.state[ch], &data);
+
+	init_buffer(&test->source, params->frame_fmt);
+	init_buffer(&test->sink, params->frame_fmt);
+
+	test->input = calloc(TEST_FRAMES * TEST_CHANNELS, sizeof(int32_t));
+	test->output = calloc(TEST_FRAMES * TEST_CHANNELS, sizeof(int32_t));
+	test->reference = calloc(TEST_FRAMES * TEST_CHANNELS,
+				 sizeof(int32_t));
+	init_input(test->input, TEST_FRAMES * TEST_CHANNELS,
+		   params->frame_fmt);
+	direct_form(test->coef, test->input, test->reference, TEST_FRAMES,
+		    TEST_CHANNELS, params->frame_fmt);
+
+	*state = test;
+	return 0;
+}
+
+static int teardown(void **state)
+{
+	struct fir_fft_test_state *test = *state;
+
+	fir_fft_free(&test->fft);
+	free(test->fft_data);
+	free(test->coef);
+	free(test->source.addr);
+	free(test->sink.addr);
+	free(test->input);
+	free(test->output);
+	free(test->reference);
+	free(test);
+	return 0;
+}
+
+static void write_source(struct comp_buffer *buffer, int32_t *x, int n,
+			 int frame_fmt)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+		if (frame_fmt == SOF_IPC_FRAME_S16_LE)
+			*(int16_t *)buffer_write_frag_s16(buffer, i) =
+				x[i] >> 16;
+		else if (frame_fmt == SOF_IPC_FRAME_S24_4LE)
+			*(int32_t *)buffer_write_frag_s32(buffer, i) =
+				x[i] >> 8;
+		else
+			*(int32_t *)buffer_write_frag_s32(buffer, i) = x[i];
+	}
+
+	buffer->w_ptr = buffer_get_frag(buffer, buffer->w_ptr, n,
+					sample_bytes(frame_fmt));
+}
+
+static void read_sink(struct comp_buffer *buffer, int32_t *y, int n,
+		      int frame_fmt)
+{
+	int i;
+
+	for (i = 0; i < n; i++) {
+		if (frame_fmt == SOF_IPC_FRAME_S16_LE)
+			y[i] = *(int16_t *)buffer_read_frag_s16(buffer, i)
+				<< 16;
+		else if (frame_fmt == SOF_IPC_FRAME_S24_4LE)
+			y[i] = *(int32_t *)buffer_read_frag_s32(buffer, i)
+				<< 8;
+		else
+			y[i] = *(int32_t *)buffer_read_frag_s32(buffer, i);
+	}
+
+	buffer->r_ptr = buffer_get_frag(buffer, buffer->r_ptr, n,
+					sample_bytes(frame_fmt));
+}
+
+static void test_audio_eq_fir_fft(void **state)
+{
+	struct fir_fft_test_state *test = *state;
+	struct fir_fft_test_parameters *params = test->params;
+	int psize = params->psize;
+	int bytes = sample_bytes(params->frame_fmt);
+	int32_t *output = &test->output[psize * TEST_CHANNELS];
+	int32_t err;
+	int32_t max_err = 0;
+	int n;
+	int i;
+
+	/* Copy the input through the filter like a pipeline would do */
+	for (i = 0; i < TEST_FRAMES; i += TEST_COPY_FRAMES) {
+		n = MIN(TEST_COPY_FRAMES, TEST_FRAMES - i);
+		write_source(&test->source, &test->input[i * TEST_CHANNELS],
+			     n * TEST_CHANNELS, params->frame_fmt);
+
+		switch (params->frame_fmt) {
+		case SOF_IPC_FRAME_S16_LE:
+			eq_fir_fft_s16(&test->fft, &test->source,
+				       &test->sink, n, TEST_CHANNELS);
+			break;
+		case SOF_IPC_FRAME_S24_4LE:
+			eq_fir_fft_s24(&test->fft, &test->source,
+				       &test->sink, n, TEST_CHANNELS);
+			break;
+		default:
+			eq_fir_fft_s32(&test->fft, &test->source,
+				       &test->sink, n, TEST_CHANNELS);
+			break;
+		}
+
+		test->source.r_ptr = buffer_get_frag(&test->source,
+						     test->source.r_ptr,
+						     n * TEST_CHANNELS, bytes);
+		test->sink.w_ptr = buffer_get_frag(&test->sink,
+						   test->sink.w_ptr,
+						   n * TEST_CHANNELS, bytes);
+		read_sink(&test->sink, &test->output[i * TEST_CHANNELS],
+			  n * TEST_CHANNELS, params->frame_fmt);
+	}
+
+	/* The output is delayed by the partition size, the first channel
+	 * must match the direct form and the second the input.
+	 */
+	for (i = 0; i < psize * TEST_CHANNELS; i++)
+		assert_int_equal(test->output[i], 0);
+
+	for (i = 0; i < (TEST_FRAMES - psize) * TEST_CHANNELS; i++) {
+		if (i % TEST_CHANNELS) {
+			assert_int_equal(output[i], test->input[i]);
+			continue;
+		}
+
+		err = abs(output[i] - test->reference[i]);
+		max_err = MAX(max_err, err);
+	}
+
+	print_message("psize %d, length %d, max error %d\n", psize,
+		      params->length, max_err);
+	assert_true(max_err <= params->tolerance);
+}
+
+static struct fir_fft_test_parameters parameters[] = {
+	{ 64, 0, 16, SOF_IPC_FRAME_S16_LE, 1 << 16 },
+	{ 192, 0, 64, SOF_IPC_FRAME_S16_LE, 1 << 16 },
+	{ 1000, 1, 256, SOF_IPC_FRAME_S16_LE, 1 << 16 },
+	{ 1000, 1, 64, SOF_IPC_FRAME_S24_4LE, 1 << 10 },
+	{ 4096, 2, 512, SOF_IPC_FRAME_S24_4LE, 1 << 10 },
+	{ 192, 0, 64, SOF_IPC_FRAME_S32_LE, 1 << 12 },
+	{ 4096, 2, 1024, SOF_IPC_FRAME_S32_LE, 1 << 12 },
+};
+
+int main(void)
+{
+	struct CMUnitTest tests[ARRAY_SIZE(parameters)];
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(parameters); i++) {
+		tests[i].name = "test_audio_eq_fir_fft";
+		tests[i].test_func = test_audio_eq_fir_fft;
+		tests[i].setup_func = setup;
+		tests[i].teardown_func = teardown;
+		tests[i].initial_state = &parameters[i];
+	}
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cmocka.h>
+
+#include <sof/sof.h>
+#include <sof/audio/format.h>
+#include <sof/math/numbers.h>
+#include <uapi/user/eq.h>
+#include "iir.h"
+
+/* Frames to filter, processed in blocks of varying size */
+#define TEST_FRAMES	1000
+
+struct iir_lanes_test_parameters {
+	int channels;
+	int biquads[IIR_DF2T_LANES]; /* Zero for bypass */
+	int biquads_in_series[IIR_DF2T_LANES];
+	int max_shift; /* Biquad output shifts are 0..max_shift */
+	int32_t amplitude; /* Input peak value */
+};
+
+static int32_t rand_int32(int32_t amplitude)
+{
+	int64_t r = ((int64_t)rand() << 16) ^ rand();
+
+	return (int32_t)(r % (2 * (int64_t)amplitude + 1) - amplitude);
+}
+
+/* Random biquads, the coefficient range keeps the sum of products within
+ * the 64 bit delays but the filters may be unstable and saturate.
+ */
+static struct sof_eq_iir_header_df2t *
+iir_lanes_test_config(struct iir_lanes_test_parameters *p, int ch)
+{
+	struct sof_eq_iir_header_df2t *eq;
+	int32_t *coef;
+	int n = p->biquads[ch];
+	int i;
+
+	eq = calloc(1, sizeof(*eq) +
+		    n * SOF_EQ_IIR_NBIQUAD_DF2T * sizeof(int32_t));
+	eq->num_sections = n;
+	eq->num_sections_in_series = p->biquads_in_series[ch];
+	coef = eq->biquads;
+	for (i = 0; i < n; i++) {
+		coef[0] = rand_int32(1 << 28); /* a2 */
+		coef[1] = rand_int32(1 << 29); /* a1 */
+		coef[2] = rand_int32(1 << 29); /* b2 */
+		coef[3] = rand_int32(1 << 29); /* b1 */
+		coef[4] = rand_int32(1 << 29); /* b0 */
+		coef[5] = rand() % (p->max_shift + 1); /* shift */
+		coef[6] = rand_int32(1 << 15); /* gain */
+		coef += SOF_EQ_IIR_NBIQUAD_DF2T;
+	}
+
+	return eq;
+}
+
+static void test_audio_iir_lanes(void **state)
+{
+	struct iir_lanes_test_parameters *p = *state;
+	struct sof_eq_iir_header_df2t *config[IIR_DF2T_LANES];
+	struct iir_state_df2t iir[IIR_DF2T_LANES];
+	struct iir_lanes_df2t lanes;
+	int32_t x[IIR_BLOCK_FRAMES * IIR_DF2T_LANES];
+	int32_t y[IIR_BLOCK_FRAMES * IIR_DF2T_LANES];
+	int32_t *input;
+	int32_t *ref;
+	int64_t *delay;
+	int64_t *lanes_delay;
+	int64_t *iir_delay;
+	int size;
+	int frame = 0;
+	int n;
+	int ch;
+	int i;
+
+	srand(p->channels);
+	input = malloc(TEST_FRAMES * p->channels * sizeof(int32_t));
+	ref = malloc(TEST_FRAMES * p->channels * sizeof(int32_t));
+	for (i = 0; i < TEST_FRAMES * p->channels; i++)
+		input[i] = rand_int32(p->amplitude);
+
+	/* Reference with one channel at a time */
+	delay = calloc(IIR_DF2T_LANES * SOF_EQ_IIR_DF2T_BIQUADS_MAX,
+		       IIR_DF2T_NUM_DELAYS * sizeof(int64_t));
+	iir_delay = delay;
+	for (ch = 0; ch < p->channels; ch++) {
+		config[ch] = iir_lanes_test_config(p, ch);
+		if (p->biquads[ch]) {
+			iir_init_coef_df2t(&iir[ch], config[ch]);
+			iir_init_delay_df2t(&iir[ch], &iir_delay);
+		} else {
+			iir_reset_df2t(&iir[ch]);
+		}
+
+		for (i = 0; i < TEST_FRAMES; i++)
+			ref[i * p->channels + ch] =
+				iir_df2t(&iir[ch], input[i * p->channels + ch]);
+	}
+
+	/* Multichannel DF2T with fresh delay lines */
+	size = iir_init_coef_lanes_df2t(&lanes, iir, p->channels);
+	assert_true(size > 0);
+	lanes_delay = calloc(1, size);
+	iir_delay = lanes_delay;
+	iir_init_delay_lanes_df2t(&lanes, iir, &iir_delay);
+	assert_ptr_equal((char *)iir_delay, (char *)lanes_delay + size);
+
+	memset(x, 0, sizeof(x));
+	while (frame < TEST_FRAMES) {
+		n = MIN(1 + rand() % IIR_BLOCK_FRAMES, TEST_FRAMES - frame);
+		for (i = 0; i < n; i++)
+			for (ch = 0; ch < p->channels; ch++)
+				x[i * IIR_DF2T_LANES + ch] =
+					input[(frame + i) * p->channels + ch];
+
+		iir_df2t_lanes(&lanes, x, y, n);
+		for (i = 0; i < n; i++)
+			for (ch = 0; ch < p->channels; ch++)
+				assert_int_equal(y[i * IIR_DF2T_LANES + ch],
+						 ref[(frame + i) * p->channels +
+						     ch]);
+
+		frame += n;
+	}
+
+	for (ch = 0; ch < p->channels; ch++)
+		free(config[ch]);
+
+	free(lanes_delay);
+	free(delay);
+	free(ref);
+	free(input);
+}
+
+static struct iir_lanes_test_parameters parameters[] = {
+	/* Same structure in all channels */
+	{ 1, { 2 }, { 2 }, 0, 1 << 30 },
+	{ 2, { 3, 3 }, { 3, 3 }, 2, 1 << 28 },
+	{ 4, { 4, 4, 4, 4 }, { 4, 4, 4, 4 }, 1, INT32_MAX },
+	/* Different number of biquads and a bypassed channel */
+	{ 3, { 1, 5, 0 }, { 1, 5, 0 }, 1, 1 << 29 },
+	{ 4, { 0, 2, 8, 3 }, { 0, 2, 8, 3 }, 3, 1 << 30 },
+	/* Parallel sections */
+	{ 2, { 4, 6 }, { 2, 3 }, 1, 1 << 29 },
+	{ 4, { 6, 2, 0, 3 }, { 2, 2, 0, 1 }, 2, 1 << 30 },
+};
+
+int main(void)
+{
+	struct CMUnitTest tests[ARRAY_SIZE(parameters)];
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(parameters); i++) {
+		tests[i].name = "test_audio_iir_lanes";
+		tests[i].test_func = test_audio_iir_lanes;
+		tests[i].setup_func = NULL;
+		tests[i].teardown_func = NULL;
+		tests[i].initial_state = &parameters[i];
+	}
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -87,6 +87,7 @@ struct source {
 struct mix_test_case {
 	int num_sources;
 	int num_chans;
+	int32_t gain;
 	const char *name;
 	struct source *sources;
 };
@@ -95,12 +96,24 @@ struct mix_test_case {
 	{ \
 		.num_sources = (_num_sources), \
 		.num_chans = (_num_chans), \
+		.gain = MIXER_GAIN_UNITY, \
 		.name = ("test_audio_mixer_copy_" \
 			 #_num_sources "_srcs_" \
 			 #_num_chans "ch"), \
 		.sources = NULL \
 	}
 
+#define TEST_CASE_GAIN(_num_sources, _num_chans, _gain) \
+	{ \
+		.num_sources = (_num_sources), \
+		.num_chans = (_num_chans), \
+		.gain = (_gain), \
+		.name = ("test_audio_mixer_copy_" \
+			 #_num_sources "_srcs_" \
+			 #_num_chans "ch_gain_" #_gain), \
+		.sources = NULL \
+	}
+
 static struct mix_test_case mix_test_cases[] = {
 	TEST_CASE(1, 2),
 	TEST_CASE(1, 4),
@@ -111,7 +124,11 @@ static struct mix_test_case mix_test_cases[] = {
 	TEST_CASE(3, 2),
 	TEST_CASE(4, 2),
 	TEST_CASE(6, 2),
-	TEST_CASE(8, 2)
+	TEST_CASE(8, 2),
+	TEST_CASE_GAIN(2, 2, 0),
+	TEST_CASE_GAIN(2, 2, 0x8000),
+	TEST_CASE_GAIN(4, 2, 0x20000),
+	TEST_CASE_GAIN(8, 2, 0x4000)
 };
 
 static struct sof_ipc_comp mock_comp = {
@@ -275,6 +292,29 @@ static void test_audio_mixer_prepare_no_sources(void **state)
 	assert_int_equal(downstream, 0);
 }
 
+static void set_source_gains(struct mix_test_case *tc)
+{
+	struct sof_ipc_ctrl_data *cdata;
+	size_t size = sizeof(*cdata) +
+		      tc->num_sources * sizeof(struct sof_ipc_ctrl_value_chan);
+	int src_idx;
+
+	cdata = calloc(1, size);
+	cdata->cmd = SOF_CTRL_CMD_VOLUME;
+	cdata->num_elems = tc->num_sources;
+
+	for (src_idx = 0; src_idx < tc->num_sources; ++src_idx) {
+		cdata->chanv[src_idx].channel = src_idx;
+		cdata->chanv[src_idx].value = tc->gain;
+	}
+
+	assert_int_equal(mixer_drv_mock.ops.cmd(mixer_dev_mock,
+						COMP_CMD_SET_VALUE,
+						cdata, size), 0);
+
+	free(cdata);
+}
+
 static void test_audio_mixer_copy(void **state)
 {
 	int src_idx;
@@ -283,6 +323,9 @@ static void test_audio_mixer_copy(void **state)
 
 	mixer_dev_mock->params.channels = tc->num_chans;
 
+	if (tc->gain != MIXER_GAIN_UNITY)
+		set_source_gains(tc);
+
 	for (src_idx = 0; src_idx < tc->num_sources; ++src_idx) {
 		uint32_t *samples = tc->sources[src_idx].buf->addr;
 
@@ -299,14 +342,15 @@ static void test_audio_mixer_copy(void **state)
 	mixer_drv_mock.ops.copy(mixer_dev_mock);
 
 	for (smp = 0; smp < MIX_TEST_SAMPLES; ++smp) {
-		uint64_t sum = 0;
+		int64_t sum = 0;
 
 		for (src_idx = 0; src_idx < tc->num_sources; ++src_idx) {
 			assert_non_null(tc->sources[src_idx].buf);
 
-			uint32_t *samples = tc->sources[src_idx].buf->addr;
+			int32_t *samples = tc->sources[src_idx].buf->addr;
 
-			sum += samples[smp];
+			sum += q_multsr_32x32(samples[smp], tc->gain,
+					      MIXER_GAIN_QXY_Y);
 		}
 
 		sum = sat_int32(sum);
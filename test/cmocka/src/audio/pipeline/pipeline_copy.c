@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdint.h>
+#include <sof/audio/component.h>
+#include <sof/audio/pipeline.h>
+#include <sof/edf_schedule.h>
+#include "pipeline_mocks.h"
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <stdlib.h>
+#include <cmocka.h>
+
+#define TEST_PIPELINE_ID	1
+#define TEST_MAX_COMPS		8
+#define TEST_MAX_BUFFERS	8
+
+struct test_graph {
+	struct pipeline *p;
+	struct comp_dev *comp[TEST_MAX_COMPS];
+	struct comp_buffer *buffer[TEST_MAX_BUFFERS];
+	int buffers;
+	int copy_ret[TEST_MAX_COMPS];
+	int copied[2 * TEST_MAX_COMPS];
+	int copies;
+};
+
+static struct test_graph *graph;
+
+static int test_comp_copy(struct comp_dev *dev)
+{
+	graph->copied[graph->copies++] = dev->comp.id;
+
+	return graph->copy_ret[dev->comp.id];
+}
+
+static int test_comp_trigger(struct comp_dev *dev, int cmd)
+{
+	if (cmd == COMP_TRIGGER_START)
+		dev->state = COMP_STATE_ACTIVE;
+
+	return 0;
+}
+
+static struct comp_driver test_drv = {
+	.ops = {
+		.copy = test_comp_copy,
+		.trigger = test_comp_trigger,
+	},
+};
+
+static void test_graph_connect(int source, int sink)
+{
+	struct comp_buffer *buffer = calloc(sizeof(*buffer), 1);
+
+	list_init(&buffer->source_list);
+	list_init(&buffer->sink_list);
+	graph->buffer[graph->buffers++] = buffer;
+
+	pipeline_connect(graph->comp[source], buffer,
+			 PPL_CONN_DIR_COMP_TO_BUFFER);
+	pipeline_connect(graph->comp[sink], buffer,
+			 PPL_CONN_DIR_BUFFER_TO_COMP);
+}
+
+static int setup(void **state)
+{
+	struct comp_dev *cd;
+	int i;
+
+	graph = calloc(sizeof(*graph), 1);
+
+	for (i = 0; i < TEST_MAX_COMPS; i++) {
+		cd = calloc(sizeof(*cd), 1);
+		cd->comp.id = i;
+		cd->comp.pipeline_id = TEST_PIPELINE_ID;
+		cd->drv = &test_drv;
+		list_init(&cd->bsource_list);
+		list_init(&cd->bsink_list);
+		graph->comp[i] = cd;
+	}
+
+	*state = graph;
+	return 0;
+}
+
+static int teardown(void **state)
+{
+	int i;
+
+	for (i = 0; i < TEST_MAX_COMPS; i++)
+		free(graph->comp[i]);
+
+	for (i = 0; i < graph->buffers; i++)
+		free(graph->buffer[i]);
+
+	if (graph->p) {
+		free(graph->p->copy_list.entry);
+		free(graph->p);
+	}
+
+	free(graph);
+	return 0;
+}
+
+/* capture graph 1 -> 2 -> 3 -> 4, 3 -> 5 -> 6, downstream walk order is
+ * 1 2 3 5 6 4 since connecting prepends the buffer
+ */
+static void test_graph_capture(void)
+{
+	struct sof_ipc_pipe_new pipe_desc = {
+		.pipeline_id = TEST_PIPELINE_ID,
+		.frames_per_sched = 48,
+	};
+	int i;
+
+	for (i = 1; i <= 6; i++)
+		graph->comp[i]->params.direction = SOF_IPC_STREAM_CAPTURE;
+
+	test_graph_connect(1, 2);
+	test_graph_connect(2, 3);
+	test_graph_connect(3, 4);
+	test_graph_connect(3, 5);
+	test_graph_connect(5, 6);
+
+	graph->p = pipeline_new(&pipe_desc, graph->comp[6]);
+	assert_non_null(graph->p);
+	assert_int_equal(pipeline_complete(graph->p, graph->comp[1],
+					   graph->comp[6]), 0);
+	assert_int_equal(pipeline_trigger(graph->p, graph->comp[6],
+					  COMP_TRIGGER_START), 0);
+
+	/* the second sink is not on the trigger path */
+	graph->comp[4]->state = COMP_STATE_ACTIVE;
+}
+
+/* playback graph 1 -> 2 -> 4, 3 -> 4 -> 5, the sink 5 is copied first and
+ * the upstream walk from 4 copies 3 1 2 4
+ */
+static void test_graph_playback(void)
+{
+	struct sof_ipc_pipe_new pipe_desc = {
+		.pipeline_id = TEST_PIPELINE_ID,
+		.frames_per_sched = 48,
+	};
+	int i;
+
+	for (i = 1; i <= 5; i++)
+		graph->comp[i]->params.direction = SOF_IPC_STREAM_PLAYBACK;
+
+	test_graph_connect(1, 2);
+	test_graph_connect(2, 4);
+	test_graph_connect(3, 4);
+	test_graph_connect(4, 5);
+
+	graph->p = pipeline_new(&pipe_desc, graph->comp[5]);
+	assert_non_null(graph->p);
+	assert_int_equal(pipeline_complete(graph->p, graph->comp[1],
+					   graph->comp[5]), 0);
+	assert_int_equal(pipeline_trigger(graph->p, graph->comp[1],
+					  COMP_TRIGGER_START), 0);
+
+	/* the second source is not on the complete and trigger paths */
+	graph->comp[3]->pipeline = graph->p;
+	graph->comp[3]->state = COMP_STATE_ACTIVE;
+}
+
+static void test_graph_run(const int *expected, int count)
+{
+	int i;
+
+	graph->copies = 0;
+	graph->p->pipe_task.func(graph->p->pipe_task.data);
+
+	assert_int_equal(graph->copies, count);
+	for (i = 0; i < count; i++)
+		assert_int_equal(graph->copied[i], expected[i]);
+}
+
+static void test_audio_pipeline_copy_list_capture(void **state)
+{
+	const int expected[] = {1, 2, 3, 5, 6, 4};
+
+	test_graph_capture();
+
+	assert_int_equal(graph->p->copy_list.count, 6);
+	test_graph_run(expected, ARRAY_SIZE(expected));
+	test_graph_run(expected, ARRAY_SIZE(expected));
+}
+
+static void test_audio_pipeline_copy_list_path_stop(void **state)
+{
+	const int expected[] = {1, 2, 3, 5, 4};
+
+	test_graph_capture();
+
+	graph->copy_ret[5] = PPL_STATUS_PATH_STOP;
+	test_graph_run(expected, ARRAY_SIZE(expected));
+}
+
+static void test_audio_pipeline_copy_list_inactive(void **state)
+{
+	const int expected[] = {1, 2, 3, 4};
+
+	test_graph_capture();
+
+	graph->comp[5]->state = COMP_STATE_PAUSED;
+	test_graph_run(expected, ARRAY_SIZE(expected));
+}
+
+static void test_audio_pipeline_copy_list_graph_change(void **state)
+{
+	const int expected[] = {1, 2, 3, 5, 6, 7, 4};
+
+	test_graph_capture();
+
+	/* the list is rebuilt on connect, not by the next copy */
+	graph->comp[7]->pipeline = graph->p;
+	graph->comp[7]->state = COMP_STATE_ACTIVE;
+	test_graph_connect(6, 7);
+	assert_int_equal(graph->p->copy_list.count, ARRAY_SIZE(expected));
+
+	test_graph_run(expected, ARRAY_SIZE(expected));
+}
+
+static void test_audio_pipeline_copy_list_stale(void **state)
+{
+	const int expected[] = {1, 2, 3, 5, 6, 4};
+
+	test_graph_capture();
+
+	/* a stale list is not used or rebuilt by the copy, it walks */
+	atomic_add(&graph->p->graph_gen, 1);
+	graph->p->copy_list.count = 0;
+	test_graph_run(expected, ARRAY_SIZE(expected));
+	assert_int_equal(graph->p->copy_list.count, 0);
+
+	pipeline_copy_list_update(graph->p);
+	assert_int_equal(graph->p->copy_list.count, ARRAY_SIZE(expected));
+	test_graph_run(expected, ARRAY_SIZE(expected));
+}
+
+static void test_audio_pipeline_copy_list_other_graph(void **state)
+{
+	const int expected[] = {1, 2, 3, 5, 6, 4};
+	int32_t graph_gen;
+
+	test_graph_capture();
+	graph_gen = atomic_read(&graph->p->graph_gen);
+
+	/* comps of a pipeline not completed yet don't touch this one */
+	test_graph_connect(0, 7);
+	assert_int_equal(atomic_read(&graph->p->graph_gen), graph_gen);
+	test_graph_run(expected, ARRAY_SIZE(expected));
+}
+
+static void test_audio_pipeline_copy_list_playback(void **state)
+{
+	const int preload[] = {3, 1, 2, 4, 5};
+	const int expected[] = {5, 3, 1, 2, 4};
+
+	test_graph_playback();
+
+	/* preload walks the graph from the sink */
+	graph->p->preload = true;
+	test_graph_run(preload, ARRAY_SIZE(preload));
+
+	assert_int_equal(graph->p->copy_list.count, 4);
+	test_graph_run(expected, ARRAY_SIZE(expected));
+}
+
+static void test_audio_pipeline_copy_list_playback_inactive(void **state)
+{
+	const int expected[] = {5, 3, 4};
+
+	test_graph_playback();
+
+	graph->comp[2]->state = COMP_STATE_PAUSED;
+	test_graph_run(expected, ARRAY_SIZE(expected));
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test_setup_teardown(
+			test_audio_pipeline_copy_list_capture,
+			setup, teardown),
+		cmocka_unit_test_setup_teardown(
+			test_audio_pipeline_copy_list_path_stop,
+			setup, teardown),
+		cmocka_unit_test_setup_teardown(
+			test_audio_pipeline_copy_list_inactive,
+			setup, teardown),
+		cmocka_unit_test_setup_teardown(
+			test_audio_pipeline_copy_list_graph_change,
+			setup, teardown),
+		cmocka_unit_test_setup_teardown(
+			test_audio_pipeline_copy_list_stale,
+			setup, teardown),
+		cmocka_unit_test_setup_teardown(
+			test_audio_pipeline_copy_list_other_graph,
+			setup, teardown),
+		cmocka_unit_test_setup_teardown(
+			test_audio_pipeline_copy_list_playback,
+			setup, teardown),
+		cmocka_unit_test_setup_teardown(
+			test_audio_pipeline_copy_list_playback_inactive,
+			setup, teardown),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
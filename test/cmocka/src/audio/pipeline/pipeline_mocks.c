@@ -64,14 +64,14 @@ int schedule_task_init(struct task *task, uint16_t type, uint16_t priority,
 		       uint64_t (*func)(void *data), void *data, uint16_t core,
 		       uint32_t xflags)
 {
-	(void)task;
 	(void)type;
 	(void)priority;
-	(void)func;
-	(void)data;
 	(void)core;
 	(void)xflags;
 
+	task->func = func;
+	task->data = data;
+
 	return 0;
 }
 
@@ -95,6 +95,9 @@ static int setup(void **state)
 	sel_state->sink->w_ptr = test_calloc(parameters->buffer_size_ms,
 					     size);
 	sel_state->sink->size = parameters->buffer_size_ms * size;
+	sel_state->sink->addr = sel_state->sink->w_ptr;
+	sel_state->sink->end_addr = sel_state->sink->addr +
+		sel_state->sink->size;
 
 	/* allocate new source buffer */
 	sel_state->source = test_malloc(sizeof(*sel_state->source));
@@ -103,6 +106,9 @@ static int setup(void **state)
 	sel_state->source->r_ptr = test_calloc(parameters->buffer_size_ms,
 					       size);
 	sel_state->source->size = parameters->buffer_size_ms * size;
+	sel_state->source->addr = sel_state->source->r_ptr;
+	sel_state->source->end_addr = sel_state->source->addr +
+		sel_state->source->size;
 
 	/* assigns verification function */
 	sel_state->verify = parameters->verify;
@@ -108,6 +108,9 @@ static int setup(void **state)
 	vol_state->sink->w_ptr = test_calloc(parameters->buffer_size_ms,
 					     size);
 	vol_state->sink->size = parameters->buffer_size_ms * size;
+	vol_state->sink->addr = vol_state->sink->w_ptr;
+	vol_state->sink->end_addr = vol_state->sink->addr +
+		vol_state->sink->size;
 
 	/* allocate new source buffer */
 	vol_state->source = test_malloc(sizeof(*vol_state->source));
@@ -116,6 +119,9 @@ static int setup(void **state)
 	vol_state->source->r_ptr = test_calloc(parameters->buffer_size_ms,
 					       size);
 	vol_state->source->size = parameters->buffer_size_ms * size;
+	vol_state->source->addr = vol_state->source->r_ptr;
+	vol_state->source->end_addr = vol_state->source->addr +
+		vol_state->source->size;
 
 	/* assigns verification function */
 	vol_state->verify = parameters->verify;
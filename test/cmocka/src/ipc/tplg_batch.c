@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <string.h>
+#include <errno.h>
+#include <cmocka.h>
+
+#include <sof/ipc.h>
+#include <uapi/ipc/header.h>
+#include <uapi/ipc/topology.h>
+
+#define TEST_BATCH_SIZE	1024
+
+static struct ipc *ipc;
+
+/* topology handlers, each returns the value queued with will_return() */
+
+int ipc_comp_new(struct ipc *ipc, struct sof_ipc_comp *new)
+{
+	check_expected(new->id);
+	return mock();
+}
+
+int ipc_buffer_new(struct ipc *ipc, struct sof_ipc_buffer *buffer)
+{
+	check_expected(buffer->comp.id);
+	return mock();
+}
+
+int ipc_pipeline_new(struct ipc *ipc, struct sof_ipc_pipe_new *pipeline)
+{
+	check_expected(pipeline->pipeline_id);
+	return mock();
+}
+
+int ipc_comp_connect(struct ipc *ipc,
+		     struct sof_ipc_pipe_comp_connect *connect)
+{
+	check_expected(connect->source_id);
+	return mock();
+}
+
+int ipc_pipeline_complete(struct ipc *ipc, uint32_t comp_id)
+{
+	check_expected(comp_id);
+	return mock();
+}
+
+/* append a topology command of size bytes, ID fields are set to id */
+static void batch_add(uint8_t *batch, uint32_t *size, uint32_t cmd,
+		      uint32_t cmd_size, uint32_t id)
+{
+	struct sof_ipc_cmd_hdr *hdr = (struct sof_ipc_cmd_hdr *)(batch + *size);
+	struct sof_ipc_comp *comp = (struct sof_ipc_comp *)hdr;
+	struct sof_ipc_buffer *buffer = (struct sof_ipc_buffer *)hdr;
+	struct sof_ipc_pipe_new *pipe = (struct sof_ipc_pipe_new *)hdr;
+	struct sof_ipc_pipe_comp_connect *connect =
+		(struct sof_ipc_pipe_comp_connect *)hdr;
+	struct sof_ipc_pipe_ready *ready = (struct sof_ipc_pipe_ready *)hdr;
+
+	memset(hdr, 0, cmd_size);
+	hdr->cmd = SOF_IPC_GLB_TPLG_MSG | cmd;
+	hdr->size = cmd_size;
+
+	switch (cmd) {
+	case SOF_IPC_TPLG_COMP_NEW:
+		comp->id = id;
+		break;
+	case SOF_IPC_TPLG_BUFFER_NEW:
+		buffer->comp.id = id;
+		break;
+	case SOF_IPC_TPLG_PIPE_NEW:
+		pipe->pipeline_id = id;
+		break;
+	case SOF_IPC_TPLG_COMP_CONNECT:
+		connect->source_id = id;
+		break;
+	case SOF_IPC_TPLG_PIPE_COMPLETE:
+		ready->comp_id = id;
+		break;
+	}
+
+	*size += cmd_size;
+}
+
+static int setup(void **state)
+{
+	ipc = calloc(1, sizeof(*ipc));
+	ipc->comp_data = malloc(SOF_IPC_MSG_MAX_SIZE);
+
+	return 0;
+}
+
+static int teardown(void **state)
+{
+	free(ipc->comp_data);
+	free(ipc);
+
+	return 0;
+}
+
+static void test_ipc_tplg_batch_valid(void **state)
+{
+	uint8_t batch[TEST_BATCH_SIZE];
+	uint32_t size = 0;
+	uint32_t done;
+
+	(void)state;
+
+	batch_add(batch, &size, SOF_IPC_TPLG_PIPE_NEW,
+		  sizeof(struct sof_ipc_pipe_new), 1);
+	batch_add(batch, &size, SOF_IPC_TPLG_COMP_NEW,
+		  sizeof(struct sof_ipc_comp), 2);
+	batch_add(batch, &size, SOF_IPC_TPLG_BUFFER_NEW,
+		  sizeof(struct sof_ipc_buffer), 3);
+	batch_add(batch, &size, SOF_IPC_TPLG_COMP_CONNECT,
+		  sizeof(struct sof_ipc_pipe_comp_connect), 2);
+	batch_add(batch, &size, SOF_IPC_TPLG_PIPE_COMPLETE,
+		  sizeof(struct sof_ipc_pipe_ready), 4);
+
+	expect_value(ipc_pipeline_new, pipeline->pipeline_id, 1);
+	will_return(ipc_pipeline_new, 0);
+	expect_value(ipc_comp_new, new->id, 2);
+	will_return(ipc_comp_new, 0);
+	expect_value(ipc_buffer_new, buffer->comp.id, 3);
+	will_return(ipc_buffer_new, 0);
+	expect_value(ipc_comp_connect, connect->source_id, 2);
+	will_return(ipc_comp_connect, 0);
+	expect_value(ipc_pipeline_complete, comp_id, 4);
+	will_return(ipc_pipeline_complete, 0);
+
+	assert_int_equal(ipc_tplg_batch(ipc, batch, size, 5, &done), 0);
+	assert_int_equal(done, 5);
+}
+
+/* element size must cover its header and fit the message and the batch */
+static void test_ipc_tplg_batch_overlong(void **state)
+{
+	uint8_t batch[TEST_BATCH_SIZE];
+	uint32_t size = 0;
+	uint32_t done;
+
+	(void)state;
+
+	batch_add(batch, &size, SOF_IPC_TPLG_COMP_NEW,
+		  sizeof(struct sof_ipc_comp), 1);
+	batch_add(batch, &size, SOF_IPC_TPLG_COMP_NEW,
+		  SOF_IPC_MSG_MAX_SIZE + 4, 2);
+
+	expect_value(ipc_comp_new, new->id, 1);
+	will_return(ipc_comp_new, 0);
+
+	assert_int_equal(ipc_tplg_batch(ipc, batch, size, 2, &done), -EINVAL);
+	assert_int_equal(done, 1);
+
+	/* last element runs past the end of the batch */
+	size = 0;
+	batch_add(batch, &size, SOF_IPC_TPLG_COMP_NEW,
+		  sizeof(struct sof_ipc_comp), 1);
+	batch_add(batch, &size, SOF_IPC_TPLG_COMP_NEW,
+		  sizeof(struct sof_ipc_comp), 2);
+
+	expect_value(ipc_comp_new, new->id, 1);
+	will_return(ipc_comp_new, 0);
+
+	assert_int_equal(ipc_tplg_batch(ipc, batch, size - 4, 2, &done),
+			 -EINVAL);
+	assert_int_equal(done, 1);
+}
+
+/* commands after a failing one are not run */
+static void test_ipc_tplg_batch_failed_cmd(void **state)
+{
+	uint8_t batch[TEST_BATCH_SIZE];
+	uint32_t size = 0;
+	uint32_t done;
+
+	(void)state;
+
+	batch_add(batch, &size, SOF_IPC_TPLG_COMP_NEW,
+		  sizeof(struct sof_ipc_comp), 1);
+	batch_add(batch, &size, SOF_IPC_TPLG_BUFFER_NEW,
+		  sizeof(struct sof_ipc_buffer), 2);
+	batch_add(batch, &size, SOF_IPC_TPLG_COMP_NEW,
+		  sizeof(struct sof_ipc_comp), 3);
+
+	expect_value(ipc_comp_new, new->id, 1);
+	will_return(ipc_comp_new, 0);
+	expect_value(ipc_buffer_new, buffer->comp.id, 2);
+	will_return(ipc_buffer_new, -ENOMEM);
+
+	assert_int_equal(ipc_tplg_batch(ipc, batch, size, 3, &done), -ENOMEM);
+	assert_int_equal(done, 1);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_ipc_tplg_batch_valid),
+		cmocka_unit_test(test_ipc_tplg_batch_overlong),
+		cmocka_unit_test(test_ipc_tplg_batch_failed_cmd),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, setup, teardown);
+}
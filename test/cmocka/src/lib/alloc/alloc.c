@@ -33,10 +33,12 @@
 #include <stdarg.h>
 #include <stddef.h>
 #include <setjmp.h>
+#include <time.h>
 #include <cmocka.h>
 
 #include <sof/sof.h>
 #include <sof/alloc.h>
+#include <platform/memory.h>
 #include <uapi/ipc/header.h>
 
 extern struct mm memmap;
@@ -46,7 +48,9 @@ static struct sof *sof;
 enum test_type {
 	TEST_BULK = 0,
 	TEST_ZERO,
-	TEST_IMMEDIATE_FREE
+	TEST_IMMEDIATE_FREE,
+	TEST_FRAGMENT,
+	TEST_CHURN
 };
 
 struct test_case {
@@ -214,9 +218,31 @@ static struct test_case test_cases[] = {
 	TEST_CASE(256, RZONE_BUFFER, SOF_MEM_CAPS_RAM | SOF_MEM_CAPS_DMA, 2,
 		  TEST_BULK, "rballoc_dma"),
 	TEST_CASE(2048, RZONE_BUFFER, SOF_MEM_CAPS_RAM | SOF_MEM_CAPS_DMA, 100,
-		  TEST_IMMEDIATE_FREE, "rballoc_dma")
+		  TEST_IMMEDIATE_FREE, "rballoc_dma"),
+
+	/*
+	 * continuous allocations must not reuse single block holes
+	 */
+
+	TEST_CASE(HEAP_BUFFER_BLOCK_SIZE, RZONE_BUFFER, SOF_MEM_CAPS_RAM, 8,
+		  TEST_FRAGMENT, "rballoc"),
+	TEST_CASE(HEAP_BUFFER_BLOCK_SIZE, RZONE_BUFFER, SOF_MEM_CAPS_RAM, 64,
+		  TEST_FRAGMENT, "rballoc"),
+
+	/*
+	 * rmalloc/rfree timing with random frees in a populated map
+	 */
+
+	TEST_CASE(64, RZONE_RUNTIME, SOF_MEM_CAPS_RAM, 32, TEST_CHURN,
+		  "rmalloc"),
+	TEST_CASE(HEAP_BUFFER_BLOCK_SIZE, RZONE_BUFFER, SOF_MEM_CAPS_RAM, 128,
+		  TEST_CHURN, "rballoc"),
+	TEST_CASE(HEAP_BUFFER_BLOCK_SIZE * 3, RZONE_BUFFER, SOF_MEM_CAPS_RAM,
+		  32, TEST_CHURN, "rballoc")
 };
 
+#define TEST_CHURN_ROUNDS	4096
+
 static int setup(void **state)
 {
 	sof = malloc(sizeof(struct sof));
@@ -320,6 +346,82 @@ static void test_lib_alloc_zero(struct test_case *tc)
 	free(all_mem);
 }
 
+static int alloc_overlap(char *a, size_t a_size, char *b, size_t b_size)
+{
+	return a < b + b_size && b < a + a_size;
+}
+
+static void test_lib_alloc_fragment(struct test_case *tc)
+{
+	void **all_mem = malloc(sizeof(void *) * tc->alloc_num);
+	void *hole;
+	char *run;
+	size_t run_size = tc->alloc_size * 2;
+	int i;
+
+	for (i = 0; i < tc->alloc_num; ++i) {
+		all_mem[i] = alloc(tc);
+		assert_non_null(all_mem[i]);
+	}
+
+	/* leave single block holes between the odd allocations */
+	hole = all_mem[0];
+	for (i = 0; i < tc->alloc_num; i += 2)
+		rfree(all_mem[i]);
+
+	run = rballoc(tc->alloc_zone, tc->alloc_caps, run_size);
+	assert_non_null(run);
+
+	for (i = 1; i < tc->alloc_num; i += 2)
+		assert_false(alloc_overlap(run, run_size, all_mem[i],
+					   tc->alloc_size));
+
+	/* single blocks go back into the lowest hole */
+	all_mem[0] = alloc(tc);
+	assert_ptr_equal(all_mem[0], hole);
+	rfree(all_mem[0]);
+
+	rfree(run);
+	for (i = 1; i < tc->alloc_num; i += 2)
+		rfree(all_mem[i]);
+
+	free(all_mem);
+}
+
+static void test_lib_alloc_churn(struct test_case *tc)
+{
+	void **all_mem = malloc(sizeof(void *) * tc->alloc_num);
+	clock_t start;
+	clock_t ticks;
+	unsigned int seed = 1;
+	int i;
+	int n;
+
+	for (i = 0; i < tc->alloc_num; ++i) {
+		all_mem[i] = alloc(tc);
+		assert_non_null(all_mem[i]);
+	}
+
+	/* free and allocate again at pseudo random positions */
+	start = clock();
+	for (i = 0; i < TEST_CHURN_ROUNDS; ++i) {
+		seed = seed * 1103515245 + 12345;
+		n = (seed >> 16) % tc->alloc_num;
+
+		rfree(all_mem[n]);
+		all_mem[n] = alloc(tc);
+		assert_non_null(all_mem[n]);
+	}
+	ticks = clock() - start;
+
+	print_message("# %u clock ticks per %d rmalloc/rfree pairs\n",
+		      (unsigned int)ticks, TEST_CHURN_ROUNDS);
+
+	alloc_free(all_mem, tc);
+
+	free(all_mem);
+}
+
 static void test_lib_alloc(void **state)
 {
 	struct test_case *tc = *((struct test_case **)state);
@@ -336,6 +438,14 @@ static void test_lib_alloc(void **state)
 	case TEST_IMMEDIATE_FREE:
 		test_lib_alloc_immediate_free(tc);
 		break;
+
+	case TEST_FRAGMENT:
+		test_lib_alloc_fragment(tc);
+		break;
+
+	case TEST_CHURN:
+		test_lib_alloc_churn(tc);
+		break;
 	}
 }
 
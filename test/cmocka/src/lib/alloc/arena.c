@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <sof/sof.h>
+#include <sof/alloc.h>
+#include <uapi/ipc/header.h>
+
+extern struct mm memmap;
+
+static struct sof *sof;
+
+#define TEST_ARENA_OBJECTS	8
+
+static uint32_t buffer_heap_free(void)
+{
+	uint32_t free = 0;
+	int i;
+
+	for (i = 0; i < PLATFORM_HEAP_BUFFER; i++)
+		free += memmap.buffer[i].info.free;
+
+	return free;
+}
+
+static int setup(void **state)
+{
+	sof = malloc(sizeof(struct sof));
+	platform_init_memmap();
+	init_heap(sof);
+
+	return 0;
+}
+
+static int teardown(void **state)
+{
+	free(sof);
+
+	return 0;
+}
+
+static void test_lib_alloc_arena_packed(void **state)
+{
+	char *obj[TEST_ARENA_OBJECTS];
+	uint32_t free = buffer_heap_free();
+	int i;
+
+	(void)state;
+
+	alloc_arena_enter(1);
+	for (i = 0; i < TEST_ARENA_OBJECTS; i++) {
+		obj[i] = rzalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, 40);
+		assert_non_null(obj[i]);
+	}
+	alloc_arena_exit();
+
+	/* objects follow each other in one chunk from the buffer heap */
+	assert_true(buffer_heap_free() < free);
+	for (i = 1; i < TEST_ARENA_OBJECTS; i++) {
+		assert_true(obj[i] > obj[i - 1]);
+		assert_true(obj[i] - obj[i - 1] <= 64);
+	}
+
+	for (i = 0; i < TEST_ARENA_OBJECTS; i++)
+		rfree(obj[i]);
+
+	/* the last free releases the whole arena */
+	assert_int_equal(buffer_heap_free(), free);
+}
+
+static void test_lib_alloc_arena_window(void **state)
+{
+	uint32_t free = buffer_heap_free();
+	char *in;
+	char *out;
+
+	(void)state;
+
+	alloc_arena_enter(2);
+	in = rzalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, 64);
+	alloc_arena_exit();
+	assert_non_null(in);
+
+	/* allocations after the window come from the runtime heap */
+	out = rzalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, 64);
+	assert_non_null(out);
+	assert_true(out < (char *)memmap.buffer[0].heap ||
+		    out >= (char *)memmap.buffer[0].heap +
+			   memmap.buffer[0].size);
+
+	rfree(out);
+	assert_int_not_equal(buffer_heap_free(), free);
+
+	rfree(in);
+	assert_int_equal(buffer_heap_free(), free);
+}
+
+static void test_lib_alloc_arena_grow(void **state)
+{
+	char *big[3];
+	char *small;
+	uint32_t free = buffer_heap_free();
+	int i;
+
+	(void)state;
+
+	/* each large object needs a new chunk */
+	alloc_arena_enter(3);
+	for (i = 0; i < ARRAY_SIZE(big); i++) {
+		big[i] = rzalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, 1500);
+		assert_non_null(big[i]);
+	}
+	small = rzalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, 16);
+	assert_non_null(small);
+	alloc_arena_exit();
+
+	/* freeing in any order keeps the arena until the last object */
+	rfree(big[1]);
+	rfree(small);
+	rfree(big[0]);
+	assert_int_not_equal(buffer_heap_free(), free);
+
+	rfree(big[2]);
+	assert_int_equal(buffer_heap_free(), free);
+}
+
+static void test_lib_alloc_arena_pipelines(void **state)
+{
+	char *a;
+	char *b;
+	uint32_t free = buffer_heap_free();
+
+	(void)state;
+
+	alloc_arena_enter(4);
+	a = rzalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, 32);
+	alloc_arena_exit();
+
+	alloc_arena_enter(5);
+	b = rzalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, 32);
+	alloc_arena_exit();
+
+	assert_non_null(a);
+	assert_non_null(b);
+
+	/* freeing one pipeline leaves the other arena intact */
+	rfree(a);
+	assert_int_not_equal(buffer_heap_free(), free);
+	memset(b, 0x5a, 32);
+
+	rfree(b);
+	assert_int_equal(buffer_heap_free(), free);
+}
+
+static void test_lib_alloc_arena_buffers(void **state)
+{
+	char *obj[TEST_ARENA_OBJECTS / 2];
+	uint32_t free = buffer_heap_free();
+	char *buf;
+	int i;
+
+	(void)state;
+
+	/* the later objects are past the first block of the chunk */
+	alloc_arena_enter(6);
+	for (i = 0; i < ARRAY_SIZE(obj); i++) {
+		obj[i] = rzalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, 256);
+		assert_non_null(obj[i]);
+	}
+	alloc_arena_exit();
+
+	/* buffers next to the chunk are not arena objects */
+	buf = rballoc(RZONE_BUFFER, SOF_MEM_CAPS_RAM, 3000);
+	assert_non_null(buf);
+	rfree(buf);
+
+	for (i = ARRAY_SIZE(obj) - 1; i >= 0; i--) {
+		assert_int_not_equal(buffer_heap_free(), free);
+		rfree(obj[i]);
+	}
+	assert_int_equal(buffer_heap_free(), free);
+
+	/* the blocks of the released chunk are plain buffer blocks again */
+	buf = rballoc(RZONE_BUFFER, SOF_MEM_CAPS_RAM, 3000);
+	assert_non_null(buf);
+	rfree(buf);
+	assert_int_equal(buffer_heap_free(), free);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_lib_alloc_arena_packed),
+		cmocka_unit_test(test_lib_alloc_arena_window),
+		cmocka_unit_test(test_lib_alloc_arena_grow),
+		cmocka_unit_test(test_lib_alloc_arena_pipelines),
+		cmocka_unit_test(test_lib_alloc_arena_buffers),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, setup, teardown);
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <sof/sof.h>
+#include <sof/alloc.h>
+#include <uapi/ipc/header.h>
+#include <uapi/ipc/trace.h>
+
+extern struct mm memmap;
+
+static struct sof *sof;
+
+static int setup(void **state)
+{
+	sof = malloc(sizeof(struct sof));
+	platform_init_memmap();
+	init_heap(sof);
+
+	return 0;
+}
+
+static int teardown(void **state)
+{
+	free(sof);
+
+	return 0;
+}
+
+static void get_stats(uint32_t type, struct sof_ipc_heap_stats *stats,
+		      uint32_t flags)
+{
+	assert_int_equal(heap_get_stats(type, 0, stats, flags), 0);
+}
+
+static void test_lib_alloc_stats_sizes(void **state)
+{
+	struct sof_ipc_heap_stats stats;
+	void *small;
+	void *medium;
+	void *large;
+
+	(void)state;
+
+	get_stats(SOF_IPC_HEAP_RUNTIME, &stats, SOF_IPC_HEAP_STATS_RESET);
+
+	small = rmalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, 16);
+	medium = rmalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, 100);
+	large = rmalloc(RZONE_RUNTIME, SOF_MEM_CAPS_RAM, 600);
+	assert_non_null(small);
+	assert_non_null(medium);
+	assert_non_null(large);
+
+	get_stats(SOF_IPC_HEAP_RUNTIME, &stats, 0);
+	assert_int_equal(stats.sizes[0], 1);
+	assert_int_equal(stats.sizes[2], 1);
+	assert_int_equal(stats.sizes[5], 1);
+	assert_int_equal(stats.peak_used, stats.used);
+
+	rfree(small);
+	rfree(medium);
+	rfree(large);
+
+	/* the peak stays until it is reset */
+	get_stats(SOF_IPC_HEAP_RUNTIME, &stats, SOF_IPC_HEAP_STATS_RESET);
+	assert_true(stats.peak_used > stats.used);
+
+	get_stats(SOF_IPC_HEAP_RUNTIME, &stats, 0);
+	assert_int_equal(stats.peak_used, stats.used);
+	assert_int_equal(stats.sizes[0], 0);
+}
+
+static void test_lib_alloc_stats_fragments(void **state)
+{
+	struct sof_ipc_heap_stats stats;
+	struct block_map *map = &memmap.buffer[0].map[0];
+	uint32_t block_size = map->block_size;
+	void **all_mem = malloc(sizeof(void *) * map->count);
+	void *mem;
+	int count = 0;
+	int i;
+
+	(void)state;
+
+	get_stats(SOF_IPC_HEAP_BUFFER, &stats, SOF_IPC_HEAP_STATS_RESET);
+	assert_int_equal(stats.failures, 0);
+	assert_int_equal(stats.map[0].largest_free, map->count);
+
+	/* use up the first map of the first buffer heap */
+	while (map->free_count) {
+		all_mem[count] = rballoc(RZONE_BUFFER, SOF_MEM_CAPS_RAM,
+					 block_size);
+		assert_non_null(all_mem[count]);
+		count++;
+	}
+
+	/* may be served by another heap but this one reports a failure */
+	mem = rballoc(RZONE_BUFFER, SOF_MEM_CAPS_RAM, block_size);
+
+	get_stats(SOF_IPC_HEAP_BUFFER, &stats, 0);
+	assert_int_equal(stats.failures, 1);
+	assert_int_equal(stats.map[0].failures, 1);
+	assert_int_equal(stats.map[0].largest_free, 0);
+	assert_int_equal(stats.map[0].peak_used, map->count);
+
+	/* two single block holes are not one continuous space */
+	rfree(all_mem[1]);
+	rfree(all_mem[3]);
+	get_stats(SOF_IPC_HEAP_BUFFER, &stats, 0);
+	assert_int_equal(stats.map[0].free, 2);
+	assert_int_equal(stats.map[0].largest_free, 1);
+
+	rfree(all_mem[2]);
+	get_stats(SOF_IPC_HEAP_BUFFER, &stats, 0);
+	assert_int_equal(stats.map[0].largest_free, 3);
+	assert_true(stats.largest_free >= 3 * block_size);
+
+	rfree(mem);
+	for (i = 0; i < count; i++) {
+		if (i < 1 || i > 3)
+			rfree(all_mem[i]);
+	}
+
+	free(all_mem);
+}
+
+static void test_lib_alloc_stats_invalid(void **state)
+{
+	struct sof_ipc_heap_stats stats;
+
+	(void)state;
+
+	assert_int_equal(heap_get_stats(SOF_IPC_HEAP_BUFFER,
+					PLATFORM_HEAP_BUFFER, &stats, 0),
+			 -EINVAL);
+	assert_int_equal(heap_get_stats(SOF_IPC_HEAP_BUFFER + 1, 0, &stats,
+					0), -EINVAL);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test(test_lib_alloc_stats_sizes),
+		cmocka_unit_test(test_lib_alloc_stats_fragments),
+		cmocka_unit_test(test_lib_alloc_stats_invalid),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, setup, teardown);
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <sof/alloc.h>
+#include <sof/edf_queue.h>
+
+#define TEST_EDF_TASKS		100
+
+struct test_task {
+	struct task task;
+	struct edf_task_pdata pdata;
+};
+
+static struct test_task tasks[TEST_EDF_TASKS];
+static struct edf_queue queue;
+
+void *_zalloc(int zone, uint32_t caps, size_t bytes)
+{
+	(void)zone;
+	(void)caps;
+
+	return calloc(bytes, 1);
+}
+
+void rfree(void *ptr)
+{
+	free(ptr);
+}
+
+static int setup(void **state)
+{
+	int i;
+
+	srand(1);
+
+	for (i = 0; i < TEST_EDF_TASKS; i++) {
+		tasks[i].task.priority = rand() % SOF_TASK_PRI_COUNT;
+		tasks[i].pdata.deadline = rand() % 100000;
+		edf_sch_set_pdata((&tasks[i].task), &tasks[i].pdata);
+	}
+
+	return edf_queue_init(&queue);
+}
+
+static int teardown(void **state)
+{
+	edf_queue_free(&queue);
+
+	return 0;
+}
+
+static int task_before(struct task *a, struct task *b)
+{
+	struct edf_task_pdata *pa = edf_sch_get_pdata(a);
+	struct edf_task_pdata *pb = edf_sch_get_pdata(b);
+
+	if (a->priority != b->priority)
+		return a->priority < b->priority;
+
+	return pa->deadline <= pb->deadline;
+}
+
+/* pop every task and check they come out in priority/deadline order */
+static void check_drain(int count)
+{
+	struct task *prev = NULL;
+	struct task *task;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		task = edf_queue_peek(&queue);
+		assert_non_null(task);
+		if (prev)
+			assert_true(task_before(prev, task));
+
+		edf_queue_remove(&queue, task);
+		assert_false(edf_queue_contains(&queue, task));
+		prev = task;
+	}
+
+	assert_true(edf_queue_is_empty(&queue));
+	assert_null(edf_queue_peek(&queue));
+}
+
+static void test_lib_edf_queue_order(void **state)
+{
+	int i;
+
+	(void)state;
+
+	/* more tasks than EDF_QUEUE_INIT_SIZE make the heap grow */
+	for (i = 0; i < TEST_EDF_TASKS; i++)
+		assert_int_equal(edf_queue_insert(&queue, &tasks[i].task), 0);
+
+	assert_true(queue.size >= TEST_EDF_TASKS);
+
+	check_drain(TEST_EDF_TASKS);
+}
+
+static void test_lib_edf_queue_remove(void **state)
+{
+	int i;
+
+	(void)state;
+
+	for (i = 0; i < TEST_EDF_TASKS; i++)
+		edf_queue_insert(&queue, &tasks[i].task);
+
+	/* cancel every third task from the middle of the heap */
+	for (i = 0; i < TEST_EDF_TASKS; i += 3)
+		edf_queue_remove(&queue, &tasks[i].task);
+
+	for (i = 0; i < TEST_EDF_TASKS; i++)
+		assert_int_equal(edf_queue_contains(&queue, &tasks[i].task),
+				 i % 3 != 0);
+
+	check_drain(TEST_EDF_TASKS - (TEST_EDF_TASKS + 2) / 3);
+}
+
+static void test_lib_edf_queue_update(void **state)
+{
+	int i;
+
+	(void)state;
+
+	for (i = 0; i < TEST_EDF_TASKS; i++)
+		edf_queue_insert(&queue, &tasks[i].task);
+
+	/* move deadlines both ways like a reschedule does */
+	for (i = 0; i < TEST_EDF_TASKS; i += 2) {
+		tasks[i].pdata.deadline = rand() % 100000;
+		edf_queue_update(&queue, &tasks[i].task);
+	}
+
+	check_drain(TEST_EDF_TASKS);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test_setup_teardown(test_lib_edf_queue_order,
+						setup, teardown),
+		cmocka_unit_test_setup_teardown(test_lib_edf_queue_remove,
+						setup, teardown),
+		cmocka_unit_test_setup_teardown(test_lib_edf_queue_update,
+						setup, teardown),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
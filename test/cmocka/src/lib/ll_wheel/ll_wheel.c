@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <cmocka.h>
+
+#include <sof/ll_wheel.h>
+
+#define TEST_LL_WINDOW		2000
+#define TEST_LL_TASKS		8
+
+static struct task tasks[TEST_LL_TASKS];
+static struct ll_wheel wheel;
+
+static int setup(void **state)
+{
+	int i;
+
+	for (i = 0; i < TEST_LL_TASKS; i++) {
+		tasks[i].priority = SOF_TASK_PRI_MED;
+		tasks[i].state = SOF_TASK_STATE_INIT;
+		list_init(&tasks[i].list);
+	}
+
+	ll_wheel_init(&wheel, TEST_LL_WINDOW);
+
+	return 0;
+}
+
+static void test_lib_ll_wheel_window(void **state)
+{
+	uint64_t current = 100000;
+	uint64_t span = (uint64_t)LL_WHEEL_SLOTS << wheel.shift;
+
+	(void)state;
+
+	/* due now, inside the window, too old, in the future and one
+	 * full wheel turn ahead of a due slot
+	 */
+	tasks[0].start = current;
+	tasks[1].start = current - TEST_LL_WINDOW;
+	tasks[2].start = current - TEST_LL_WINDOW - 1;
+	tasks[3].start = current + 1;
+	tasks[4].start = current - 10 + span;
+
+	ll_wheel_insert(&wheel, &tasks[0]);
+	ll_wheel_insert(&wheel, &tasks[1]);
+	ll_wheel_insert(&wheel, &tasks[2]);
+	ll_wheel_insert(&wheel, &tasks[3]);
+	ll_wheel_insert(&wheel, &tasks[4]);
+
+	assert_int_equal(ll_wheel_collect(&wheel, current), 2);
+	assert_int_equal(tasks[0].state, SOF_TASK_STATE_PENDING);
+	assert_int_equal(tasks[1].state, SOF_TASK_STATE_PENDING);
+	assert_int_equal(tasks[2].state, SOF_TASK_STATE_QUEUED);
+	assert_int_equal(tasks[3].state, SOF_TASK_STATE_QUEUED);
+	assert_int_equal(tasks[4].state, SOF_TASK_STATE_QUEUED);
+
+	/* the future task is picked up by the next tick */
+	assert_int_equal(ll_wheel_collect(&wheel, current + 1000), 1);
+	assert_int_equal(tasks[3].state, SOF_TASK_STATE_PENDING);
+}
+
+static void test_lib_ll_wheel_priority(void **state)
+{
+	struct task *task;
+	int i;
+
+	(void)state;
+
+	/* spread over several slots with the priorities reversed */
+	for (i = 0; i < TEST_LL_TASKS; i++) {
+		tasks[i].priority = TEST_LL_TASKS - 1 - i;
+		tasks[i].start = 10000 + i * 200;
+		ll_wheel_insert(&wheel, &tasks[i]);
+	}
+
+	assert_int_equal(ll_wheel_collect(&wheel, 12000), TEST_LL_TASKS);
+
+	for (i = TEST_LL_TASKS - 1; i >= 0; i--) {
+		task = ll_wheel_next_pending(&wheel);
+		assert_ptr_equal(task, &tasks[i]);
+		ll_wheel_remove(task);
+		assert_false(ll_wheel_contains(task));
+	}
+
+	assert_null(ll_wheel_next_pending(&wheel));
+}
+
+static void test_lib_ll_wheel_wrap(void **state)
+{
+	(void)state;
+
+	/* the window reaches back over the timer wrap */
+	tasks[0].start = UINT64_MAX - 100;
+	tasks[1].start = 500;
+	tasks[2].start = UINT64_MAX - TEST_LL_WINDOW;
+
+	ll_wheel_insert(&wheel, &tasks[0]);
+	ll_wheel_insert(&wheel, &tasks[1]);
+	ll_wheel_insert(&wheel, &tasks[2]);
+
+	assert_int_equal(ll_wheel_collect(&wheel, 1000), 2);
+	assert_int_equal(tasks[0].state, SOF_TASK_STATE_PENDING);
+	assert_int_equal(tasks[1].state, SOF_TASK_STATE_PENDING);
+	assert_int_equal(tasks[2].state, SOF_TASK_STATE_QUEUED);
+}
+
+static void test_lib_ll_wheel_set_window(void **state)
+{
+	int i;
+
+	(void)state;
+
+	for (i = 0; i < TEST_LL_TASKS; i++) {
+		tasks[i].start = 50000 + i * 1000;
+		ll_wheel_insert(&wheel, &tasks[i]);
+	}
+
+	/* a faster clock doubles the window and the slot width */
+	ll_wheel_set_window(&wheel, 2 * TEST_LL_WINDOW);
+
+	for (i = 0; i < TEST_LL_TASKS; i++)
+		assert_true(ll_wheel_contains(&tasks[i]));
+
+	assert_int_equal(ll_wheel_collect(&wheel, 50000 + 7000), 5);
+	assert_int_equal(tasks[2].state, SOF_TASK_STATE_QUEUED);
+	assert_int_equal(tasks[3].state, SOF_TASK_STATE_PENDING);
+}
+
+int main(void)
+{
+	const struct CMUnitTest tests[] = {
+		cmocka_unit_test_setup(test_lib_ll_wheel_window, setup),
+		cmocka_unit_test_setup(test_lib_ll_wheel_priority, setup),
+		cmocka_unit_test_setup(test_lib_ll_wheel_wrap, setup),
+		cmocka_unit_test_setup(test_lib_ll_wheel_set_window, setup),
+	};
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <math.h>
+#include <cmocka.h>
+
+#include <sof/alloc.h>
+#include <sof/math/fft.h>
+
+/* Complex number for the double precision reference FFT */
+struct dcomplex {
+	double real;
+	double imag;
+};
+
+struct fft_test_parameters {
+	uint32_t size;
+	int real; /* Real or complex FFT */
+	int bits; /* 16 or 32 */
+	int ifft;
+	int scale;
+	double amplitude; /* Input peak value in Q1.x */
+	double max_error; /* Max error in output LSBs */
+};
+
+void *rballoc(int zone, uint32_t caps, size_t bytes)
+{
+	(void)zone;
+	(void)caps;
+
+	return malloc(bytes);
+}
+
+void *rzalloc(int zone, uint32_t caps, size_t bytes)
+{
+	(void)zone;
+	(void)caps;
+
+	return calloc(bytes, 1);
+}
+
+void rfree(void *ptr)
+{
+	free(ptr);
+}
+
+/* Recursive radix-2 reference, the inverse is not normalized */
+static void ref_fft(struct dcomplex *x, uint32_t n, int ifft)
+{
+	struct dcomplex *even;
+	struct dcomplex *odd;
+	struct dcomplex t;
+	double sign = ifft ? 1.0 : -1.0;
+	double a;
+	uint32_t k;
+
+	if (n == 1)
+		return;
+
+	even = malloc(n / 2 * sizeof(*even));
+	odd = malloc(n / 2 * sizeof(*odd));
+	for (k = 0; k < n / 2; k++) {
+		even[k] = x[2 * k];
+		odd[k] = x[2 * k + 1];
+	}
+
+	ref_fft(even, n / 2, ifft);
+	ref_fft(odd, n / 2, ifft);
+	for (k = 0; k < n / 2; k++) {
+		a = sign * 2 * M_PI * k / n;
+		t.real = cos(a) * odd[k].real - sin(a) * odd[k].imag;
+		t.imag = cos(a) * odd[k].imag + sin(a) * odd[k].real;
+		x[k].real = even[k].real + t.real;
+		x[k].imag = even[k].imag + t.imag;
+		x[k + n / 2].real = even[k].real - t.real;
+		x[k + n / 2].imag = even[k].imag - t.imag;
+	}
+
+	free(even);
+	free(odd);
+}
+
+static double rand_value(double amplitude)
+{
+	return amplitude * (2.0 * rand() / RAND_MAX - 1.0);
+}
+
+/* Random signal for forward transforms. Inverse transforms get the
+ * spectrum of a random signal divided by size as a scaled forward FFT
+ * would return it, it is conjugate symmetric for the real FFT.
+ */
+static void init_input(struct fft_test_parameters *p, struct dcomplex *x,
+		       double one)
+{
+	uint32_t n = p->size;
+	uint32_t k;
+
+	for (k = 0; k < n; k++) {
+		x[k].real = round(one * rand_value(p->amplitude));
+		x[k].imag = p->real ? 0 : round(one * rand_value(p->amplitude));
+	}
+
+	if (!p->ifft)
+		return;
+
+	ref_fft(x, n, 0);
+	for (k = 0; k < n; k++) {
+		x[k].real = round(x[k].real / n);
+		x[k].imag = round(x[k].imag / n);
+	}
+
+	if (p->real) {
+		x[0].imag = 0;
+		x[n / 2].imag = 0;
+	}
+}
+
+/* Pack input to fixed-point data in the layout of the tested function */
+static void pack(struct fft_test_parameters *p, struct dcomplex *x,
+		 void *data)
+{
+	struct icomplex32 *d32 = data;
+	struct icomplex16 *d16 = data;
+	int32_t *r32 = data;
+	int16_t *r16 = data;
+	uint32_t n = p->size;
+	uint32_t k;
+
+	if (!p->real || p->ifft) {
+		if (p->real)
+			n = n / 2 + 1;
+
+		for (k = 0; k < n; k++) {
+			if (p->bits == 32) {
+				d32[k].real = x[k].real;
+				d32[k].imag = x[k].imag;
+			} else {
+				d16[k].real = x[k].real;
+				d16[k].imag = x[k].imag;
+			}
+		}
+
+		return;
+	}
+
+	for (k = 0; k < n; k++) {
+		if (p->bits == 32)
+			r32[k] = x[k].real;
+		else
+			r16[k] = x[k].real;
+	}
+}
+
+static struct dcomplex unpack(struct fft_test_parameters *p, void *data,
+			      uint32_t k)
+{
+	struct icomplex32 *d32 = data;
+	struct icomplex16 *d16 = data;
+	int32_t *r32 = data;
+	int16_t *r16 = data;
+	struct dcomplex y;
+
+	if (p->real && p->ifft) {
+		y.real = p->bits == 32 ? r32[k] : r16[k];
+		y.imag = 0;
+	} else if (p->bits == 32) {
+		y.real = d32[k].real;
+		y.imag = d32[k].imag;
+	} else {
+		y.real = d16[k].real;
+		y.imag = d16[k].imag;
+	}
+
+	return y;
+}
+
+static void test_math_fft(void **state)
+{
+	struct fft_test_parameters *p = *state;
+	struct fft_plan *plan;
+	struct dcomplex *x;
+	struct dcomplex y;
+	void *data;
+	double one = p->bits == 32 ? 2147483648.0 : 32768.0;
+	double norm = p->scale ? 1.0 / p->size : 1.0;
+	double err;
+	double max_err = 0;
+	uint32_t n = p->size;
+	uint32_t k;
+
+	plan = fft_plan_new(p->size);
+	assert_non_null(plan);
+
+	x = malloc(p->size * sizeof(*x));
+	data = calloc(p->size + 1, sizeof(struct icomplex32));
+	srand(p->size);
+	init_input(p, x, one);
+	pack(p, x, data);
+
+	if (p->real && p->bits == 32)
+		fft_real_execute_32(plan, data, p->ifft, p->scale);
+	else if (p->real)
+		fft_real_execute_16(plan, data, p->ifft, p->scale);
+	else if (p->bits == 32)
+		fft_execute_32(plan, data, p->ifft, p->scale);
+	else
+		fft_execute_16(plan, data, p->ifft, p->scale);
+
+	ref_fft(x, p->size, p->ifft);
+
+	/* Real forward transform returns only bins up to Nyquist */
+	if (p->real && !p->ifft)
+		n = n / 2 + 1;
+
+	for (k = 0; k < n; k++) {
+		y = unpack(p, data, k);
+		err = fabs(y.real - x[k].real * norm);
+		max_err = fmax(max_err, err);
+		err = fabs(y.imag - x[k].imag * norm);
+		max_err = fmax(max_err, err);
+	}
+
+	print_message("%s%s %d bit size %u %s max error %.2f LSB\n",
+		      p->real ? "real " : "", p->ifft ? "ifft" : "fft",
+		      p->bits, p->size, p->scale ? "scaled" : "unscaled",
+		      max_err);
+	assert_true(max_err <= p->max_error);
+
+	free(data);
+	free(x);
+	fft_plan_free(plan);
+}
+
+static struct fft_test_parameters parameters[] = {
+	{ 64, 0, 32, 0, 1, 0.9, 8.0 },
+	{ 256, 0, 32, 1, 1, 0.9, 8.0 },
+	{ 1024, 0, 32, 0, 1, 0.9, 8.0 },
+	{ 4096, 0, 32, 1, 1, 0.9, 8.0 },
+	{ 512, 0, 32, 0, 0, 0.001, 64.0 },
+	{ 64, 1, 32, 0, 1, 0.9, 8.0 },
+	{ 128, 1, 32, 1, 1, 0.9, 8.0 },
+	{ 1024, 1, 32, 0, 1, 0.9, 8.0 },
+	{ 4096, 1, 32, 1, 1, 0.9, 8.0 },
+	{ 2048, 1, 32, 0, 0, 0.0001, 64.0 },
+	{ 256, 1, 32, 1, 0, 0.0001, 64.0 },
+	{ 64, 0, 16, 0, 1, 0.9, 8.0 },
+	{ 1024, 0, 16, 1, 1, 0.9, 8.0 },
+	{ 256, 0, 16, 0, 0, 0.001, 32.0 },
+	{ 64, 1, 16, 0, 1, 0.9, 8.0 },
+	{ 2048, 1, 16, 1, 1, 0.9, 8.0 },
+	{ 4096, 1, 16, 0, 1, 0.9, 8.0 },
+};
+
+int main(void)
+{
+	struct CMUnitTest tests[ARRAY_SIZE(parameters)];
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(parameters); i++) {
+		tests[i].name = "test_math_fft";
+		tests[i].test_func = test_math_fft;
+		tests[i].setup_func = NULL;
+		tests[i].teardown_func = NULL;
+		tests[i].initial_state = &parameters[i];
+	}
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
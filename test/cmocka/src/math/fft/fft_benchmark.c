@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <setjmp.h>
+#include <time.h>
+#include <cmocka.h>
+
+#include <sof/alloc.h>
+#include <sof/math/fft.h>
+
+/* Minimum measurement time per transform size in seconds */
+#define FFT_BENCHMARK_TIME	0.05
+
+void *rballoc(int zone, uint32_t caps, size_t bytes)
+{
+	(void)zone;
+	(void)caps;
+
+	return malloc(bytes);
+}
+
+void *rzalloc(int zone, uint32_t caps, size_t bytes)
+{
+	(void)zone;
+	(void)caps;
+
+	return calloc(bytes, 1);
+}
+
+void rfree(void *ptr)
+{
+	free(ptr);
+}
+
+/* Run forward and inverse scaled transforms back to back so the data
+ * stays in range and report the time per transform and per point.
+ */
+static void test_math_fft_benchmark(void **state)
+{
+	uint32_t size = *(uint32_t *)*state;
+	struct fft_plan *plan = fft_plan_new(size);
+	struct icomplex32 *data;
+	clock_t start;
+	clock_t ticks;
+	double seconds;
+	double ns;
+	uint32_t rounds = 0;
+	uint32_t i;
+
+	assert_non_null(plan);
+	data = malloc(size * sizeof(*data));
+	assert_non_null(data);
+	for (i = 0; i < size; i++) {
+		data[i].real = (int32_t)(rand() << 8);
+		data[i].imag = (int32_t)(rand() << 8);
+	}
+
+	start = clock();
+	do {
+		for (i = 0; i < 16; i++) {
+			fft_execute_32(plan, data, 0, 1);
+			fft_execute_32(plan, data, 1, 1);
+		}
+
+		rounds += 32;
+		ticks = clock() - start;
+		seconds = (double)ticks / CLOCKS_PER_SEC;
+	} while (seconds < FFT_BENCHMARK_TIME);
+
+	ns = 1e9 * seconds / rounds;
+	print_message("fft 32 bit size %u: %.0f ns per transform, ",
+		      size, ns);
+	print_message("%.2f ns per point\n", ns / size);
+
+	free(data);
+	fft_plan_free(plan);
+}
+
+static uint32_t sizes[] = { 64, 256, 1024, 4096 };
+
+int main(void)
+{
+	struct CMUnitTest tests[ARRAY_SIZE(sizes)];
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(sizes); i++) {
+		tests[i].name = "test_math_fft_benchmark";
+		tests[i].test_func = test_math_fft_benchmark;
+		tests[i].setup_func = NULL;
+		tests[i].teardown_func = NULL;
+		tests[i].initial_state = &sizes[i];
+	}
+
+	cmocka_set_message_output(CM_OUTPUT_TAP);
+
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
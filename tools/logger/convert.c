@@ -19,9 +19,11 @@
 #include <errno.h>
 #include <unistd.h>
 #include <math.h>
+#include <time.h>
 #include "convert.h"
 
 #define CEIL(a, b) ((a+b-1)/b)
+#define ALIGN_UP(a, b) (CEIL(a, b) * (b))
 
 #define TRACE_MAX_PARAMS_COUNT		4
 #define TRACE_MAX_TEXT_LEN		1024
@@ -29,6 +31,12 @@
 #define TRACE_MAX_IDS_STR		10
 #define TRACE_IDS_MASK			((1 << TRACE_ID_LENGTH) - 1)
 
+/* DMA dump bytes fetched per read */
+#define TRACE_READ_SIZE			(64 * 1024)
+
+/* initial dictionary index slots, doubled at half load */
+#define LDC_INDEX_MIN_SIZE		256
+
 struct ldc_entry_header {
 	uint32_t level;
 	uint32_t component_class;
@@ -39,11 +47,32 @@ struct ldc_entry_header {
 	uint32_t text_len;
 };
 
+/* dictionary entry, decoded once on first use */
 struct ldc_entry {
 	struct ldc_entry_header header;
-	char *file_name;
-	char *text;
-	uint32_t *params;
+	uint32_t address;
+	const char *file_name; /* already shortened for printing */
+	const char *text; /* NULL for a free index slot */
+	const char *class_name;
+	char *format; /* text as format for its params, NULL if it can't be */
+};
+
+/* whole .ldc file with its entries indexed by firmware address */
+struct ldc_dict {
+	struct snd_sof_logs_header snd;
+	uint8_t *data;
+	size_t size;
+	struct ldc_entry *index;
+	uint32_t index_mask;
+	uint32_t index_count;
+	uint8_t *starts; /* bitmap of words starting an entry, compact only */
+};
+
+/* buffered bulk reads of the DMA dump */
+struct dma_reader {
+	uint8_t *buf;
+	size_t pos;
+	size_t len;
 };
 
 static double to_usecs(uint64_t time, double clk)
@@ -71,7 +100,8 @@ static inline void print_table_header(FILE *out_fd)
 #define CASE(x) \
 	case(TRACE_CLASS_##x): return #x
 
-static const char * get_component_name(uint32_t component_id) {
+const char *get_component_name(uint32_t component_id)
+{
 	switch (component_id) {
 		CASE(IRQ);
 		CASE(IPC);
@@ -101,6 +131,7 @@ static const char * get_component_name(uint32_t component_id) {
 		CASE(SELECTOR);
 		CASE(SCHEDULE);
 		CASE(SCHEDULE_LL);
+		CASE(PROFILER);
 	default: return "unknown";
 	}
 }
@@ -127,9 +158,11 @@ static char *format_file_name(char *file_name_raw, int full_name)
 
 static void print_entry_params(FILE *out_fd,
 	const struct log_entry_header *dma_log, const struct ldc_entry *entry,
-	uint64_t last_timestamp, double clock, int use_colors, int raw_output)
+	const uint32_t *params, uint64_t last_timestamp, double clock,
+	int use_colors, int raw_output)
 {	
 	char ids[TRACE_MAX_IDS_STR];
+	uint32_t i;
 	float dt = to_usecs(dma_log->timestamp - last_timestamp, clock);
 	const char *entry_fmt = raw_output ?
 		"%s%u %u %s%s%s %.6f %.6f (%s:%u) " :
@@ -146,167 +179,381 @@ static void print_entry_params(FILE *out_fd,
 			(LOG_LEVEL_CRITICAL ? KRED : KNRM) : "",
 		dma_log->core_id,
 		entry->header.level,
-		get_component_name(entry->header.component_class),
+		entry->class_name,
 		raw_output && entry->header.has_ids ? "-" : "",
 		entry->header.has_ids ? ids : "",
 		to_usecs(dma_log->timestamp, clock),
 		dt,
-		format_file_name(entry->file_name, raw_output),
+		entry->file_name,
 		entry->header.line_idx);
 
-	switch (entry->header.params_num) {
+	switch (entry->format ? entry->header.params_num : 0) {
 	case 0:
 		fprintf(out_fd, "%s", entry->text);
 		break;
 	case 1:
-		fprintf(out_fd, entry->text, entry->params[0]);
+		fprintf(out_fd, entry->format, params[0]);
 		break;
 	case 2:
-		fprintf(out_fd, entry->text, entry->params[0], entry->params[1]);
+		fprintf(out_fd, entry->format, params[0], params[1]);
 		break;
 	case 3:
-		fprintf(out_fd, entry->text, entry->params[0], entry->params[1],
-			entry->params[2]);
+		fprintf(out_fd, entry->format, params[0], params[1], params[2]);
 		break;
 	case 4:
-		fprintf(out_fd, entry->text, entry->params[0], entry->params[1],
-			entry->params[2], entry->params[3]);
+		fprintf(out_fd, entry->format, params[0], params[1], params[2],
+			params[3]);
 		break;
 	}
+
+	/* params of a text that isn't a usable format are shown raw */
+	if (!entry->format)
+		for (i = 0; i < entry->header.params_num; i++)
+			fprintf(out_fd, " 0x%08x", params[i]);
 	fprintf(out_fd, "%s\n", use_colors ? KNRM : "");
-	fflush(out_fd);
 }
 
-static int fetch_entry(const struct convert_config *config,
-	uint32_t base_address, uint32_t data_offset,
-	const struct log_entry_header *dma_log, uint64_t *last_timestamp)
+/* in profile mode the profiler samples are counted instead of printed */
+static void print_entry(const struct convert_config *config,
+	const struct log_entry_header *dma_log, const struct ldc_entry *entry,
+	const uint32_t *params, uint64_t last_timestamp)
 {
-	struct ldc_entry entry;
-	uint32_t entry_offset;
+	uint32_t i;
 
-	int ret;
+	/* up to four PCs per record, a short record is padded with 0 */
+	if (config->profile &&
+	    entry->header.component_class == TRACE_CLASS_PROFILER &&
+	    !strncmp(entry->text, "samples ", strlen("samples "))) {
+		for (i = 0; i < entry->header.params_num; i++)
+			if (params[i])
+				profile_add(config->profile, dma_log->core_id,
+					    params[i]);
+		return;
+	}
 
-	entry.file_name = NULL;
-	entry.text = NULL;
-	entry.params = NULL;
+	print_entry_params(config->out_fd, dma_log, entry, params,
+			   last_timestamp, config->clock, config->use_colors,
+			   config->raw_output);
+}
+
+/*
+ * Convert text to a safe format for params_num uint32_t params, so the
+ * hot path can pass it to fprintf() without looking at it again. Every
+ * param is 32 bits in the firmware, so length modifiers are dropped and
+ * %p is printed as 0x%x. Returns NULL if text can't be converted.
+ */
+static char *format_convert(const char *text, uint32_t params_num)
+{
+	/* %p is the longest growth, from 2 to 4 characters */
+	char *format = malloc(strlen(text) * 2 + 1);
+	const char *c = text;
+	uint32_t count = 0;
+	char *out = format;
+	size_t flags;
+	size_t length;
+	char conv;
 
-	/* evaluate entry offset in input file */
-	entry_offset = dma_log->log_entry_address - base_address;
+	if (!format)
+		return NULL;
 
-	/* set file position to beginning of processed entry */
-	fseek(config->ldc_fd, entry_offset + data_offset, SEEK_SET);
+	while (*c) {
+		if (*c != '%') {
+			*out++ = *c++;
+			continue;
+		}
 
-	/* fetching elf header params */
-	ret = fread(&entry.header, sizeof(entry.header), 1, config->ldc_fd);
-	if (!ret) {
-		ret = -ferror(config->ldc_fd);
-		goto out;
+		if (c[1] == '%') {
+			*out++ = *c++;
+			*out++ = *c++;
+			continue;
+		}
+
+		/* flags, width and precision, no '*' */
+		c++;
+		flags = strspn(c, "-+ #0123456789.");
+		length = strspn(c + flags, "hlzjt");
+		conv = c[flags + length];
+		if (conv == 'p') {
+			*out++ = '0';
+			*out++ = 'x';
+			conv = 'x';
+		} else if (!conv || !strchr("diouxXc", conv)) {
+			free(format);
+			return NULL;
+		}
+
+		*out++ = '%';
+		memcpy(out, c, flags);
+		out += flags;
+		*out++ = conv;
+		c += flags + length + 1;
+		count++;
 	}
-	if (entry.header.file_name_len > TRACE_MAX_FILENAME_LEN) {
-		fprintf(stderr, "Error: Invalid filename length or ldc file does not match firmware\n");
-		ret = -EINVAL;
-		goto out;
+	*out = '\0';
+
+	if (count != params_num) {
+		free(format);
+		return NULL;
 	}
-	entry.file_name = (char *)malloc(entry.header.file_name_len);
 
-	if (!entry.file_name) {
-		fprintf(stderr, "error: can't allocate %d byte for "
-			"entry.file_name\n", entry.header.file_name_len);
-		ret = -ENOMEM;
-		goto out;
+	return format;
+}
+
+static uint32_t ldc_hash(uint32_t address)
+{
+	/* entries are word aligned, spread the remaining bits */
+	return (address >> 2) * 2654435761u;
+}
+
+static struct ldc_entry *ldc_slot(struct ldc_entry *index, uint32_t mask,
+				  uint32_t address)
+{
+	uint32_t i = ldc_hash(address) & mask;
+
+	while (index[i].text && index[i].address != address)
+		i = (i + 1) & mask;
+
+	return &index[i];
+}
+
+static int ldc_index_grow(struct ldc_dict *dict)
+{
+	uint32_t size = dict->index ? (dict->index_mask + 1) * 2 :
+		LDC_INDEX_MIN_SIZE;
+	struct ldc_entry *index;
+	uint32_t i;
+
+	index = calloc(size, sizeof(*index));
+	if (!index) {
+		fprintf(stderr, "error: can't allocate ldc index\n");
+		return -ENOMEM;
 	}
 
-	ret = fread(entry.file_name, sizeof(char), entry.header.file_name_len,
-		config->ldc_fd);
-	if (ret != entry.header.file_name_len) {
-		ret = -ferror(config->ldc_fd);
-		goto out;
+	for (i = 0; dict->index && i <= dict->index_mask; i++) {
+		if (dict->index[i].text)
+			*ldc_slot(index, size - 1, dict->index[i].address) =
+				dict->index[i];
 	}
 
-	/* fetching text */
-	if (entry.header.text_len > TRACE_MAX_TEXT_LEN) {
-		fprintf(stderr, "Error: Invalid text length. \n");
-		ret = -EINVAL;
-		goto out;
+	free(dict->index);
+	dict->index = index;
+	dict->index_mask = size - 1;
+	return 0;
+}
+
+/* decode the entry at address from the loaded .ldc data */
+static int ldc_entry_decode(const struct convert_config *config,
+			    struct ldc_dict *dict, uint32_t address,
+			    struct ldc_entry *entry)
+{
+	size_t offset = (size_t)(address - dict->snd.base_address) +
+		dict->snd.data_offset;
+	struct ldc_entry_header *header = &entry->header;
+	char *file_name;
+	char *text;
+
+	if (offset + sizeof(*header) > dict->size) {
+		fprintf(stderr, "Error: Invalid entry address 0x%x\n", address);
+		return -EINVAL;
 	}
-	entry.text = (char *)malloc(entry.header.text_len);
-	if (entry.text == NULL) {
-		fprintf(stderr, "error: can't allocate %d byte for "
-			"entry.text\n", entry.header.text_len);
-		ret = -ENOMEM;
-		goto out;
+
+	memcpy(header, dict->data + offset, sizeof(*header));
+	offset += sizeof(*header);
+
+	if (!header->file_name_len ||
+	    header->file_name_len > TRACE_MAX_FILENAME_LEN) {
+		fprintf(stderr, "Error: Invalid filename length or ldc file "
+			"does not match firmware\n");
+		return -EINVAL;
 	}
-	ret = fread(entry.text, sizeof(char), entry.header.text_len, config->ldc_fd);
-	if (ret != entry.header.text_len) {
-		ret = -ferror(config->ldc_fd);
-		goto out;
+
+	if (!header->text_len || header->text_len > TRACE_MAX_TEXT_LEN ||
+	    offset + header->file_name_len + header->text_len > dict->size) {
+		fprintf(stderr, "Error: Invalid text length. \n");
+		return -EINVAL;
 	}
 
-	/* fetching entry params from dma dump */
-	if (entry.header.params_num > TRACE_MAX_PARAMS_COUNT) {
+	if (header->params_num > TRACE_MAX_PARAMS_COUNT) {
 		fprintf(stderr, "Error: Invalid number of parameters. \n");
-		ret = -EINVAL;
-		goto out;
+		return -EINVAL;
 	}
-	entry.params = (uint32_t *)malloc(sizeof(uint32_t) *
-		entry.header.params_num);
-	if (entry.params == NULL) {
-		fprintf(stderr, "error: can't allocate %d byte for "
-			"entry.params\n", (int)(sizeof(uint32_t) *
-			entry.header.params_num));
-		ret = -ENOMEM;
-		goto out;
+
+	file_name = (char *)dict->data + offset;
+	text = file_name + header->file_name_len;
+	if (file_name[header->file_name_len - 1] ||
+	    text[header->text_len - 1]) {
+		fprintf(stderr, "Error: Unterminated entry strings at 0x%x\n",
+			address);
+		return -EINVAL;
 	}
 
-	if (config->serial_fd < 0) {
-		ret = fread(entry.params, sizeof(uint32_t),
-			    entry.header.params_num, config->in_fd);
-		if (ret != entry.header.params_num) {
-			ret = -ferror(config->in_fd);
-			goto out;
-		}
-	} else {
-		size_t size = sizeof(uint32_t) * entry.header.params_num;
-		uint8_t *n;
-
-		for (n = (uint8_t *)entry.params; size;
-		     n += ret, size -= ret) {
-			ret = read(config->serial_fd, n, size);
-			if (ret < 0) {
-				ret = -errno;
-				goto out;
-			}
-			if (ret != size)
-				fprintf(stderr,
-					"Partial read of %u bytes of %lu.\n",
-					ret, size);
-		}
+	entry->address = address;
+	entry->file_name = format_file_name(file_name, config->raw_output);
+	entry->text = text;
+	entry->class_name = get_component_name(header->component_class);
+	entry->format = format_convert(text, header->params_num);
+
+	return 0;
+}
+
+/* get entry from the index, decoding it the first time it is used */
+static const struct ldc_entry *ldc_entry_get(
+	const struct convert_config *config, struct ldc_dict *dict,
+	uint32_t address)
+{
+	struct ldc_entry *entry;
+
+	if ((dict->index_count + 1) * 2 > dict->index_mask + 1 &&
+	    ldc_index_grow(dict) < 0)
+		return NULL;
+
+	entry = ldc_slot(dict->index, dict->index_mask, address);
+	if (entry->text)
+		return entry;
+
+	if (ldc_entry_decode(config, dict, address, entry) < 0) {
+		entry->text = NULL;
+		return NULL;
+	}
+
+	dict->index_count++;
+	return entry;
+}
+
+/* load the whole .ldc file, its header has already been read */
+static int ldc_dict_load(const struct convert_config *config,
+			 struct ldc_dict *dict)
+{
+	long size = -1;
+
+	if (!fseek(config->ldc_fd, 0, SEEK_END))
+		size = ftell(config->ldc_fd);
+	if (size < 0) {
+		fprintf(stderr, "Error while reading %s.\n", config->ldc_file);
+		return -errno;
 	}
 
-	/* printing entry content */
-	print_entry_params(config->out_fd, dma_log, &entry, *last_timestamp,
-			   config->clock, config->use_colors, config->raw_output);
-	*last_timestamp = dma_log->timestamp;
+	dict->size = size;
+	dict->data = malloc(dict->size);
+	if (!dict->data) {
+		fprintf(stderr, "error: can't allocate %zu bytes for %s\n",
+			dict->size, config->ldc_file);
+		return -ENOMEM;
+	}
 
-	/* set f_ldc file position to the beginning */
 	rewind(config->ldc_fd);
+	if (fread(dict->data, 1, dict->size, config->ldc_fd) != dict->size) {
+		fprintf(stderr, "Error while reading %s.\n", config->ldc_file);
+		return -ferror(config->ldc_fd) ?: -EINVAL;
+	}
 
-	ret = 0;
-out:
-	/* free alocated memory */
-	free(entry.params);
-	free(entry.text);
-	free(entry.file_name);
+	return ldc_index_grow(dict);
+}
 
-	return ret;
+/* mark where entries start, compact records can't be checked otherwise */
+static int ldc_dict_starts(struct ldc_dict *dict)
+{
+	struct ldc_entry_header header;
+	size_t offset = dict->snd.data_offset;
+	size_t end = offset + dict->snd.data_length;
+	size_t word;
+
+	dict->starts = calloc(CEIL(dict->snd.data_length / 4 + 1, 8), 1);
+	if (!dict->starts)
+		return -ENOMEM;
+
+	if (end > dict->size)
+		end = dict->size;
+
+	while (offset + sizeof(header) <= end) {
+		memcpy(&header, dict->data + offset, sizeof(header));
+		word = (offset - dict->snd.data_offset) / sizeof(uint32_t);
+		dict->starts[word / 8] |= 1 << (word % 8);
+
+		offset += sizeof(header);
+		if (header.file_name_len > end - offset ||
+		    header.text_len > end - offset - header.file_name_len)
+			break;
+		offset = ALIGN_UP(offset + header.file_name_len +
+				  header.text_len, sizeof(uint32_t));
+	}
+
+	return 0;
+}
+
+static void ldc_dict_free(struct ldc_dict *dict)
+{
+	uint32_t i;
+
+	for (i = 0; dict->index && i <= dict->index_mask; i++)
+		free(dict->index[i].format);
+
+	free(dict->starts);
+	free(dict->index);
+	free(dict->data);
+}
+
+static int entry_address_valid(const struct snd_sof_logs_header *snd,
+			       uint32_t address)
+{
+	return address >= snd->base_address &&
+		address <= snd->base_address + snd->data_length;
+}
+
+static int stop;
+
+void convert_stop(void)
+{
+	__atomic_store_n(&stop, 1, __ATOMIC_RELAXED);
+}
+
+static inline int convert_stopped(void)
+{
+	return __atomic_load_n(&stop, __ATOMIC_RELAXED);
+}
+
+/*
+ * Make at least size bytes available at rd->pos. Returns 0 at the end of
+ * the input, reads return what is there so live traces are not held back.
+ */
+static int dma_reader_fill(const struct convert_config *config,
+			   struct dma_reader *rd, size_t size)
+{
+	ssize_t ret;
+
+	while (rd->len - rd->pos < size) {
+		/* about to wait for input, show what is decoded so far */
+		fflush(config->out_fd);
+
+		if (convert_stopped())
+			return 0;
+
+		memmove(rd->buf, rd->buf + rd->pos, rd->len - rd->pos);
+		rd->len -= rd->pos;
+		rd->pos = 0;
+
+		ret = read(fileno(config->in_fd), rd->buf + rd->len,
+			   TRACE_READ_SIZE - rd->len);
+		if (ret <= 0)
+			return ret < 0 && !convert_stopped() ? -errno : 0;
+
+		rd->len += ret;
+	}
+
+	return 1;
 }
 
 static int serial_read(const struct convert_config *config,
-	struct snd_sof_logs_header *snd, uint64_t *last_timestamp)
+	struct ldc_dict *dict, uint64_t *last_timestamp)
 {
+	const struct snd_sof_logs_header *snd = &dict->snd;
+	uint32_t params[TRACE_MAX_PARAMS_COUNT];
+	const struct ldc_entry *entry;
 	struct log_entry_header dma_log;
 	size_t len;
 	uint32_t *n;
+	uint8_t *p;
+	size_t size;
 	int ret;
 
 	for (len = 0, n = (uint32_t *)&dma_log; len < sizeof(dma_log); n++) {
@@ -322,8 +569,7 @@ static int serial_read(const struct convert_config *config,
 	}
 
 	/* Skip all trace_point() values, although this test isn't 100% reliable */
-	while ((dma_log.log_entry_address < snd->base_address) ||
-	       dma_log.log_entry_address > snd->base_address + snd->data_length) {
+	while (!entry_address_valid(snd, dma_log.log_entry_address)) {
 		/*
 		 * 8 characters and a '\n' come from the serial port, append a
 		 * '\0'
@@ -348,17 +594,221 @@ static int serial_read(const struct convert_config *config,
 		}
 	}
 
-	/* fetching entry from elf dump */
-	return fetch_entry(config, snd->base_address, snd->data_offset,
-			   &dma_log, last_timestamp);
+	/* fetching entry from the dictionary */
+	entry = ldc_entry_get(config, dict, dma_log.log_entry_address);
+	if (!entry)
+		return -EINVAL;
+
+	/* fetching entry params from the serial port */
+	size = sizeof(uint32_t) * entry->header.params_num;
+	for (p = (uint8_t *)params; size; p += ret, size -= ret) {
+		ret = read(config->serial_fd, p, size);
+		if (ret < 0)
+			return -errno;
+		if (ret != size)
+			fprintf(stderr, "Partial read of %u bytes of %lu.\n",
+				ret, size);
+	}
+
+	print_entry(config, &dma_log, entry, params, *last_timestamp);
+	fflush(config->out_fd);
+	*last_timestamp = dma_log.timestamp;
+
+	return 0;
+}
+
+/* decode an unsigned LEB128 varint, returns its size or 0 if incomplete */
+static int varint_get(const uint8_t *p, size_t len, uint64_t *value)
+{
+	size_t i;
+
+	*value = 0;
+	for (i = 0; i < len; i++) {
+		/* longer than any uint64_t */
+		if (i == 10)
+			return -EINVAL;
+
+		*value |= (uint64_t)(p[i] & 0x7f) << (7 * i);
+		if (!(p[i] & 0x80))
+			return i + 1;
+	}
+
+	return 0;
+}
+
+static size_t varint_put(uint8_t *p, uint64_t value)
+{
+	size_t i = 0;
+
+	while (value >= 0x80) {
+		p[i++] = value | 0x80;
+		value >>= 7;
+	}
+	p[i++] = value;
+
+	return i;
+}
+
+/*
+ * Parse the compact record at the start of buf, see TRACE_COMPACT_*.
+ * Returns its size, 0 if it is not complete yet, -EINVAL if it is not a
+ * record or -ENOENT if its dictionary entry is broken. timestamp holds
+ * the previous record timestamp and is updated.
+ */
+static int compact_parse(const struct convert_config *config,
+	struct ldc_dict *dict, const uint8_t *buf, size_t len,
+	uint64_t *timestamp, struct log_entry_header *dma_log,
+	uint32_t *params, const struct ldc_entry **entry)
+{
+	uint64_t values[3 + TRACE_MAX_PARAMS_COUNT];
+	uint64_t head;
+	size_t pos = 0;
+	int count;
+	int ret;
+	int i;
+
+	/* head and index, and ids if there are any */
+	count = 2;
+	for (i = 0; i < count; i++) {
+		ret = varint_get(buf + pos, len - pos, &values[i]);
+		if (ret <= 0)
+			return ret;
+		pos += ret;
+
+		if (!i && values[0] & TRACE_COMPACT_IDS)
+			count = 4;
+	}
+
+	head = values[0];
+	if (values[1] > dict->snd.data_length / sizeof(uint32_t) ||
+	    !(dict->starts[values[1] / 8] & 1 << (values[1] % 8)))
+		return -EINVAL;
+
+	dma_log->log_entry_address = dict->snd.base_address +
+		values[1] * sizeof(uint32_t);
+	dma_log->id_0 = count > 2 ? values[2] : TRACE_IDS_MASK;
+	dma_log->id_1 = count > 2 ? values[3] : TRACE_IDS_MASK;
+	dma_log->core_id = head & TRACE_COMPACT_CORE_MASK;
+
+	*entry = ldc_entry_get(config, dict, dma_log->log_entry_address);
+	if (!*entry)
+		return -ENOENT;
+
+	for (i = 0; i < (*entry)->header.params_num; i++) {
+		ret = varint_get(buf + pos, len - pos, &values[0]);
+		if (ret <= 0)
+			return ret;
+		if (values[0] > UINT32_MAX)
+			return -EINVAL;
+		params[i] = values[0];
+		pos += ret;
+	}
+
+	if (head & TRACE_COMPACT_ABS)
+		*timestamp = 0;
+	*timestamp += head >> TRACE_COMPACT_TS_SHIFT;
+	dma_log->timestamp = *timestamp;
+
+	return pos;
+}
+
+/* store a compact record, timestamp holds the previous record timestamp */
+static size_t compact_put(uint8_t *buf, const struct snd_sof_logs_header *snd,
+	const struct log_entry_header *dma_log, const uint32_t *params,
+	int params_num, uint64_t *timestamp)
+{
+	uint64_t head = dma_log->core_id & TRACE_COMPACT_CORE_MASK;
+	size_t pos;
+	int i;
+
+	if (dma_log->id_0 != TRACE_IDS_MASK || dma_log->id_1 != TRACE_IDS_MASK)
+		head |= TRACE_COMPACT_IDS;
+	if (dma_log->timestamp < *timestamp) {
+		head |= TRACE_COMPACT_ABS;
+		*timestamp = 0;
+	}
+	head |= (dma_log->timestamp - *timestamp) << TRACE_COMPACT_TS_SHIFT;
+	*timestamp = dma_log->timestamp;
+
+	pos = varint_put(buf, head);
+	pos += varint_put(buf + pos, (dma_log->log_entry_address -
+				      snd->base_address) / sizeof(uint32_t));
+	if (head & TRACE_COMPACT_IDS) {
+		pos += varint_put(buf + pos, dma_log->id_0);
+		pos += varint_put(buf + pos, dma_log->id_1);
+	}
+	for (i = 0; i < params_num; i++)
+		pos += varint_put(buf + pos, params[i]);
+
+	return pos;
+}
+
+static int compact_read(const struct convert_config *config,
+	struct ldc_dict *dict, struct dma_reader *rd)
+{
+	uint32_t params[TRACE_MAX_PARAMS_COUNT];
+	const struct ldc_entry *entry;
+	struct log_entry_header dma_log;
+	uint64_t last_timestamp = 0;
+	uint64_t timestamp = 0;
+	size_t size = 1;
+	int ret;
+
+	ret = ldc_dict_starts(dict);
+	if (ret < 0)
+		return ret;
+
+	for (;;) {
+		ret = dma_reader_fill(config, rd, size);
+
+		/* wait for more trace, the record is parsed again then */
+		if (!ret && config->trace && !convert_stopped()) {
+			freopen(NULL, "r", config->in_fd);
+			continue;
+		}
+
+		if (ret <= 0)
+			return ret;
+
+		size = 1;
+		if (rd->buf[rd->pos] == TRACE_COMPACT_PAD) {
+			rd->pos++;
+			continue;
+		}
+
+		ret = compact_parse(config, dict, rd->buf + rd->pos,
+				    rd->len - rd->pos, &timestamp, &dma_log,
+				    params, &entry);
+		if (ret == -ENOENT)
+			return -EINVAL;
+
+		/* not a record, move forward by one byte and resync */
+		if (ret < 0) {
+			rd->pos++;
+			continue;
+		}
+
+		/* record continues past what has been read so far */
+		if (!ret) {
+			size = rd->len - rd->pos + 1;
+			continue;
+		}
+
+		print_entry(config, &dma_log, entry, params, last_timestamp);
+		last_timestamp = dma_log.timestamp;
+		rd->pos += ret;
+	}
 }
 
 static int logger_read(const struct convert_config *config,
-	struct snd_sof_logs_header *snd)
+	struct ldc_dict *dict)
 {
 	struct log_entry_header dma_log;
-	int ret = 0;
+	const struct ldc_entry *entry;
+	struct dma_reader rd = { 0 };
 	uint64_t last_timestamp = 0;
+	size_t size;
+	int ret = 0;
 
 	if (!config->raw_output)
 		print_table_header(config->out_fd);
@@ -366,52 +816,195 @@ static int logger_read(const struct convert_config *config,
 	if (config->serial_fd >= 0)
 		/* Wait for CTRL-C */
 		for (;;) {
-			ret = serial_read(config, snd, &last_timestamp);
+			ret = serial_read(config, dict, &last_timestamp);
+			if (convert_stopped())
+				return 0;
 			if (ret < 0)
 				return ret;
 		}
 
-	while (!ferror(config->in_fd)) {
-		/* getting entry parameters from dma dump */
-		ret = fread(&dma_log, sizeof(dma_log), 1, config->in_fd);
-		if (!ret) {
-			if (config->trace && !ferror(config->in_fd)) {
-				freopen(NULL, "r", config->in_fd);
+	rd.buf = malloc(TRACE_READ_SIZE);
+	if (!rd.buf) {
+		fprintf(stderr, "error: can't allocate trace read buffer\n");
+		return -ENOMEM;
+	}
+
+	if (config->compact) {
+		ret = compact_read(config, dict, &rd);
+		goto out;
+	}
+
+	for (size = sizeof(dma_log);; size = sizeof(dma_log)) {
+		/* getting entry header, and then its params, from dma dump */
+		ret = dma_reader_fill(config, &rd, size);
+		if (ret > 0) {
+			memcpy(&dma_log, rd.buf + rd.pos, sizeof(dma_log));
+
+			/* checking if received trace address is located in
+			 * entry section in elf file.
+			 */
+			if (!entry_address_valid(&dict->snd,
+						 dma_log.log_entry_address)) {
+				/* in case the address is not correct input
+				 * should be moved forward by one DWORD, not
+				 * entire struct dma_log
+				 */
+				rd.pos += sizeof(uint32_t);
 				continue;
 			}
 
-			return -ferror(config->in_fd);
+			entry = ldc_entry_get(config, dict,
+					      dma_log.log_entry_address);
+			if (!entry) {
+				ret = -EINVAL;
+				break;
+			}
+
+			size += sizeof(uint32_t) * entry->header.params_num;
+			ret = dma_reader_fill(config, &rd, size);
 		}
 
-		/* checking if received trace address is located in
-		 * entry section in elf file.
-		 */
-		if ((dma_log.log_entry_address < snd->base_address) ||
-			dma_log.log_entry_address > snd->base_address + snd->data_length) {
-			/* in case the address is not correct input fd should be
-			 * move forward by one DWORD, not entire struct dma_log
-			 */
-			fseek(config->in_fd, -(sizeof(dma_log) - sizeof(uint32_t)), SEEK_CUR);
+		/* wait for more trace, the record is parsed again then */
+		if (!ret && config->trace && !convert_stopped()) {
+			freopen(NULL, "r", config->in_fd);
 			continue;
 		}
 
-		/* fetching entry from elf dump */
-		ret = fetch_entry(config, snd->base_address, snd->data_offset,
-				  &dma_log, &last_timestamp);
-		if (ret)
+		if (ret <= 0)
 			break;
+
+		print_entry(config, &dma_log, entry,
+			    (uint32_t *)(rd.buf + rd.pos + sizeof(dma_log)),
+			    last_timestamp);
+		last_timestamp = dma_log.timestamp;
+		rd.pos += size;
 	}
 
+out:
+	fflush(config->out_fd);
+	free(rd.buf);
+	return ret;
+}
+
+static double bench_time(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*
+ * Decode a synthetic dump of config->bench_records records, using every
+ * entry found in the .ldc in turn, and report the throughput.
+ */
+static int logger_bench(const struct convert_config *config,
+			struct ldc_dict *dict)
+{
+	struct convert_config bench = *config;
+	uint32_t params[TRACE_MAX_PARAMS_COUNT];
+	const struct ldc_entry *entry;
+	struct log_entry_header dma_log;
+	uint64_t timestamp = 0;
+	uint32_t *addresses = NULL;
+	uint32_t count = 0;
+	uint32_t offset;
+	uint8_t *dump;
+	size_t size = 0;
+	double t;
+	int ret;
+	int i;
+	int j;
+
+	/* entries are packed word aligned, walk them in order */
+	for (offset = 0; offset < dict->snd.data_length;
+	     offset = ALIGN_UP(offset + sizeof(entry->header) +
+			       entry->header.file_name_len +
+			       entry->header.text_len, sizeof(uint32_t))) {
+		entry = ldc_entry_get(config, dict,
+				      dict->snd.base_address + offset);
+		if (!entry)
+			break;
+
+		addresses = realloc(addresses, (count + 1) * sizeof(uint32_t));
+		if (!addresses)
+			return -ENOMEM;
+		addresses[count++] = entry->address;
+	}
+
+	if (!count) {
+		fprintf(stderr, "error: no entries in %s\n", config->ldc_file);
+		return -EINVAL;
+	}
+
+	dump = malloc((size_t)config->bench_records *
+		      (sizeof(dma_log) +
+		       TRACE_MAX_PARAMS_COUNT * sizeof(uint32_t)));
+	if (!dump) {
+		free(addresses);
+		return -ENOMEM;
+	}
+
+	for (i = 0; i < config->bench_records; i++) {
+		entry = ldc_entry_get(config, dict, addresses[i % count]);
+
+		dma_log.id_0 = i;
+		dma_log.id_1 = i >> TRACE_ID_LENGTH;
+		dma_log.core_id = i % 4;
+		dma_log.timestamp = (uint64_t)i * 1000;
+		dma_log.log_entry_address = entry->address;
+		for (j = 0; j < entry->header.params_num; j++)
+			params[j] = i + j;
+
+		if (config->compact) {
+			size += compact_put(dump + size, &dict->snd, &dma_log,
+					    params, j, &timestamp);
+			continue;
+		}
+
+		memcpy(dump + size, &dma_log, sizeof(dma_log));
+		size += sizeof(dma_log);
+		memcpy(dump + size, params, j * sizeof(uint32_t));
+		size += j * sizeof(uint32_t);
+	}
+
+	bench.in_fd = tmpfile();
+	bench.trace = 0;
+	bench.serial_fd = -EINVAL;
+	if (!bench.in_fd || fwrite(dump, 1, size, bench.in_fd) != size) {
+		fprintf(stderr, "error: can't write synthetic dump\n");
+		ret = -EIO;
+		goto out;
+	}
+	fflush(bench.in_fd);
+	lseek(fileno(bench.in_fd), 0, SEEK_SET);
+
+	t = bench_time();
+	ret = logger_read(&bench, dict);
+	t = bench_time() - t;
+
+	fprintf(stderr, "%d records from %u entries, %.1f MB in %.3f s: ",
+		config->bench_records, count, size / 1e6, t);
+	fprintf(stderr, "%.0f records/s, %.1f MB/s, %.1f bytes/record\n",
+		config->bench_records / t, size / 1e6 / t,
+		(double)size / config->bench_records);
+
+out:
+	if (bench.in_fd)
+		fclose(bench.in_fd);
+	free(dump);
+	free(addresses);
 	return ret;
 }
 
 int convert(const struct convert_config *config) {
 	struct snd_sof_logs_header snd;
+	struct ldc_dict dict;
 	int count, ret = 0;
 
 	count = fread(&snd, sizeof(snd), 1, config->ldc_fd);
 	if (!count) {
-		fprintf(stderr, "Error while reading %s. \n", config->ldc_file);
+		fprintf(stderr, "Error while reading %s.\n", config->ldc_file);
 		return -ferror(config->ldc_fd);
 	}
 
@@ -471,5 +1064,15 @@ int convert(const struct convert_config *config) {
 				SOF_ABI_VERSION_PATCH(snd.version.abi_version));
 		return -EINVAL;
 	}
-	return logger_read(config, &snd);
+
+	/* entries are looked up in memory from now on */
+	memset(&dict, 0, sizeof(dict));
+	dict.snd = snd;
+	ret = ldc_dict_load(config, &dict);
+	if (!ret)
+		ret = config->bench_records ? logger_bench(config, &dict) :
+			logger_read(config, &dict);
+
+	ldc_dict_free(&dict);
+	return ret;
 }
@@ -16,6 +16,7 @@
 #include <uapi/user/trace.h>
 #include <uapi/ipc/info.h>
 #include <rimage/file_format.h>
+#include "profile.h"
 
 #define KNRM	"\x1B[0m"
 #define KRED	"\x1B[31m"
@@ -36,6 +37,13 @@ struct convert_config {
 	int use_colors;
 	int serial_fd;
 	int raw_output;
+	int bench_records; /* decode a synthetic dump of this many records */
+	int compact; /* input uses compact trace records */
+	struct profile *profile; /* counts the PROFILER samples */
 };
 
 int convert(const struct convert_config *config);
+const char *get_component_name(uint32_t component_id);
+
+/* ends reading a live trace, safe to call from a signal handler */
+void convert_stop(void);
@@ -21,6 +21,7 @@
 #include <fcntl.h>
 #include <stdbool.h>
 #include <termios.h>
+#include <signal.h>
 #include "convert.h"
 
 #define APP_NAME "sof-logger"
@@ -47,9 +48,34 @@ static void usage(void)
 	fprintf(stdout, "%s:\t -t\t\t\tDisplay trace data\n", APP_NAME);
 	fprintf(stdout, "%s:\t -u baud\t\tInput data from a UART\n", APP_NAME);
 	fprintf(stdout, "%s:\t -r less formatted output for chained log processors\n", APP_NAME);
+	fprintf(stdout, "%s:\t -B records\t\tBenchmark decoding a synthetic "
+		"dump\n", APP_NAME);
+	fprintf(stdout, "%s:\t -z\t\t\tRead compact trace records, for "
+		"CONFIG_TRACE_COMPACT\n", APP_NAME);
+	fprintf(stdout, "%s:\t -F level=class[:pipe[.comp]]\tSet runtime "
+		"trace level, * matches all\n", APP_NAME);
+	fprintf(stdout, "%s:\t -P elf_file\t\tPrint a flat profile of the "
+		"CONFIG_PROFILER samples, on CTRL-C with -t\n", APP_NAME);
 	exit(0);
 }
 
+static void stop_convert(int sig)
+{
+	convert_stop();
+}
+
+/* the handler interrupts a blocking read, a second CTRL-C quits */
+static void signal_stop_convert(void)
+{
+	struct sigaction action;
+
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = stop_convert;
+	action.sa_flags = SA_RESETHAND;
+	sigemptyset(&action.sa_mask);
+	sigaction(SIGINT, &action, NULL);
+}
+
 static int snapshot(const char *name)
 {
 	const char *path = "/sys/kernel/debug/sof";
@@ -128,11 +154,119 @@ static int configure_uart(const char *file, unsigned int baud)
 	return ret < 0 ? -errno : fd;
 }
 
+static const char * const trace_levels[] = {
+	[LOG_LEVEL_CRITICAL]	= "critical",
+	[LOG_LEVEL_VERBOSE]	= "verbose",
+	[LOG_LEVEL_DEBUG]	= "debug",
+};
+
+/* parses a pipeline or component id, * or nothing matches all */
+static int filter_id(const char *str, const char *end, int *id)
+{
+	char *last;
+
+	if (str == end || (end - str == 1 && *str == '*')) {
+		*id = -1;
+		return 0;
+	}
+
+	*id = strtol(str, &last, 0);
+	return last == end && *id >= 0 ? 0 : -EINVAL;
+}
+
+/*
+ * Converts a -F level=class[:pipe[.comp]] filter to the
+ * "level class pipe comp;" form of the kernel trace filter file.
+ * Classes are given by name, e.g. src or kpb, and -1 matches all.
+ */
+static int filter_parse(const char *arg, char *out, size_t size)
+{
+	const char *class, *ids, *comp, *name;
+	int level = 0, class_id = -1, pipe_id, comp_id;
+	size_t len;
+	int i;
+
+	class = strchr(arg, '=');
+	if (!class)
+		goto err;
+
+	len = class++ - arg;
+	for (i = LOG_LEVEL_CRITICAL; i < ARRAY_SIZE(trace_levels); i++) {
+		if (len && !strncasecmp(arg, trace_levels[i], len))
+			level = i;
+	}
+	if (!level && (len != 1 || *arg < '1' || *arg > '3'))
+		goto err;
+	if (!level)
+		level = *arg - '0';
+
+	ids = strchr(class, ':');
+	if (!ids)
+		ids = class + strlen(class);
+	len = ids - class;
+
+	if (len && (len != 1 || *class != '*')) {
+		for (i = 1; i < 256 && class_id < 0; i++) {
+			name = get_component_name((uint32_t)i << 24);
+			if (strlen(name) == len &&
+			    !strncasecmp(name, class, len))
+				class_id = i;
+		}
+		if (class_id < 0)
+			goto err;
+	}
+
+	if (*ids)
+		ids++;
+	comp = strchr(ids, '.');
+	if (!comp)
+		comp = ids + strlen(ids);
+
+	if (filter_id(ids, comp, &pipe_id) < 0 ||
+	    filter_id(*comp ? comp + 1 : comp, comp + strlen(comp),
+		      &comp_id) < 0)
+		goto err;
+
+	len = strlen(out);
+	snprintf(out + len, size - len, "%d %d %d %d;", level, class_id,
+		 pipe_id, comp_id);
+	return 0;
+
+err:
+	fprintf(stderr, "error: invalid trace filter %s\n", arg);
+	return -EINVAL;
+}
+
+static int filter_write(const char *filters)
+{
+	const char *path = "/sys/kernel/debug/sof/filter";
+	FILE *fd;
+	int ret = 0;
+
+	fd = fopen(path, "w");
+	if (!fd) {
+		fprintf(stderr, "error: Unable to open filter file %s\n", path);
+		return errno;
+	}
+
+	if (fputs(filters, fd) < 0)
+		ret = errno;
+	if (fclose(fd) && !ret)
+		ret = errno;
+	if (ret)
+		fprintf(stderr, "error: Unable to set trace filter %s %d\n",
+			filters, ret);
+
+	return ret;
+}
+
 int main(int argc, char *argv[])
 {
 	struct convert_config config;
 	unsigned int baud = 0;
 	const char *snapshot_file = 0;
+	const char *elf_file = NULL;
+	char filters[1024] = "";
 	int opt, ret = 0;
 
 	config.trace = 0;
@@ -151,8 +285,11 @@ int main(int argc, char *argv[])
 	config.use_colors = 1;
 	config.serial_fd = -EINVAL;
 	config.raw_output = 0;
+	config.bench_records = 0;
+	config.compact = 0;
+	config.profile = NULL;
 
-	while ((opt = getopt(argc, argv, "ho:i:l:ps:c:u:tev:r")) != -1) {
+	while ((opt = getopt(argc, argv, "ho:i:l:ps:c:u:tev:rB:zF:P:")) != -1) {
 		switch (opt) {
 		case 'o':
 			config.out_file = optarg;
@@ -188,6 +325,20 @@ int main(int argc, char *argv[])
 		case 'r':
 			config.raw_output = 1;
 			break;
+		case 'B':
+			config.bench_records = atoi(optarg);
+			break;
+		case 'z':
+			config.compact = 1;
+			break;
+		case 'F':
+			ret = -filter_parse(optarg, filters, sizeof(filters));
+			if (ret)
+				return ret;
+			break;
+		case 'P':
+			elf_file = optarg;
+			break;
 		case 'v':
 			/* enabling checking fw version with ver_file file */
 			config.version_fw = 1;
@@ -202,6 +353,13 @@ int main(int argc, char *argv[])
 	if (snapshot_file)
 		return baud ? EINVAL : -snapshot(snapshot_file);
 
+	/* set the trace levels, then read the trace if asked to */
+	if (*filters) {
+		ret = filter_write(filters);
+		if (ret || !config.ldc_file)
+			return ret;
+	}
+
 	if (!config.ldc_file) {
 		fprintf(stderr, "error: Missing ldc file\n");
 		usage();
@@ -215,6 +373,14 @@ int main(int argc, char *argv[])
 		goto out;
 	}
 
+	if (elf_file) {
+		config.profile = profile_load(elf_file);
+		if (!config.profile) {
+			ret = EINVAL;
+			goto out;
+		}
+	}
+
 	if (config.version_fw) {
 		config.version_fd = fopen(config.version_file, "rb");
 		if (!config.version_fd) {
@@ -245,7 +411,9 @@ int main(int argc, char *argv[])
 	if (!config.in_file)
 		config.in_file = "/sys/kernel/debug/sof/etrace";
 
-	if (config.input_std) {
+	if (config.bench_records) {
+		/* the benchmark makes up its own input */
+	} else if (config.input_std) {
 		config.in_fd = stdin;
 	} else if (baud) {
 		config.serial_fd = configure_uart(config.in_file, baud);
@@ -265,8 +433,16 @@ int main(int argc, char *argv[])
 	if (isatty(fileno(config.out_fd)) != 1)
 		config.use_colors = 0;
 
+	/* a live trace is read until CTRL-C, the profile is printed then */
+	if (config.profile)
+		signal_stop_convert();
+
 	ret = -convert(&config);
 
+	/* samples are only counted while the trace is read */
+	if (config.profile && !ret)
+		profile_print(config.profile, config.out_fd);
+
 out:
 	/* close files */
 	if (config.out_fd)
@@ -281,5 +457,8 @@ out:
 	if (config.version_fd)
 		fclose(config.version_fd);
 
+	if (config.profile)
+		profile_free(config.profile);
+
 	return ret;
 }
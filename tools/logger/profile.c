@@ -0,0 +1,273 @@
+/*
+ * flat profile of firmware PC samples.
+ *
+ * Copyright (c) 2019, Intel Corporation.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <rimage/elf.h>
+#include "profile.h"
+
+/* firmware function from the ELF symbol table */
+struct profile_sym {
+	uint32_t addr;
+	uint32_t size; /* 0 when unknown, the function then ends at the next */
+	const char *name;
+	uint64_t samples;
+};
+
+struct profile {
+	struct profile_sym *syms; /* sorted by address */
+	uint32_t sym_count;
+	char *strings;
+	uint64_t samples;
+	uint64_t unknown; /* samples outside of any function */
+	uint64_t core_samples[PROFILE_MAX_CORES];
+};
+
+static int sym_cmp_addr(const void *a, const void *b)
+{
+	const struct profile_sym *sa = a;
+	const struct profile_sym *sb = b;
+
+	if (sa->addr != sb->addr)
+		return sa->addr < sb->addr ? -1 : 1;
+	return 0;
+}
+
+static int sym_cmp_samples(const void *a, const void *b)
+{
+	const struct profile_sym *sa = *(const struct profile_sym **)a;
+	const struct profile_sym *sb = *(const struct profile_sym **)b;
+
+	if (sa->samples != sb->samples)
+		return sa->samples > sb->samples ? -1 : 1;
+	return sym_cmp_addr(sa, sb);
+}
+
+static void *elf_read(FILE *fd, const char *elf_file, uint32_t off,
+		      size_t size)
+{
+	void *buf = malloc(size ? size : 1);
+
+	if (!buf) {
+		fprintf(stderr, "error: can't allocate %zu bytes\n", size);
+		return NULL;
+	}
+
+	if (fseek(fd, off, SEEK_SET) || fread(buf, 1, size, fd) != size) {
+		fprintf(stderr, "error: can't read %s at 0x%x\n", elf_file,
+			off);
+		free(buf);
+		return NULL;
+	}
+
+	return buf;
+}
+
+/* keeps the functions of the first symbol table, names point to its strings */
+static int elf_load_syms(struct profile *prof, FILE *fd, const char *elf_file)
+{
+	Elf32_Shdr *section = NULL;
+	Elf32_Shdr *strtab;
+	Elf32_Sym *sym = NULL;
+	Elf32_Ehdr hdr;
+	uint32_t count;
+	uint32_t i;
+	int ret = -EINVAL;
+
+	if (fread(&hdr, sizeof(hdr), 1, fd) != 1 ||
+	    memcmp(hdr.ident, ELFMAG, SELFMAG) ||
+	    hdr.ident[EI_CLASS] != ELFCLASS32 ||
+	    hdr.shentsize != sizeof(Elf32_Shdr)) {
+		fprintf(stderr, "error: %s is not a 32 bit ELF file\n",
+			elf_file);
+		return -EINVAL;
+	}
+
+	section = elf_read(fd, elf_file, hdr.shoff,
+			   sizeof(*section) * hdr.shnum);
+	if (!section)
+		return -EINVAL;
+
+	for (i = 0; i < hdr.shnum; i++)
+		if (section[i].type == SHT_SYMTAB &&
+		    section[i].link < hdr.shnum)
+			break;
+
+	if (i == hdr.shnum) {
+		fprintf(stderr, "error: %s has no symbol table\n", elf_file);
+		goto out;
+	}
+
+	count = section[i].size / sizeof(*sym);
+	strtab = &section[section[i].link];
+	sym = elf_read(fd, elf_file, section[i].off, sizeof(*sym) * count);
+	prof->strings = elf_read(fd, elf_file, strtab->off, strtab->size);
+	if (!sym || !prof->strings)
+		goto out;
+
+	prof->syms = calloc(count, sizeof(*prof->syms));
+	if (!prof->syms) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	for (i = 0; i < count; i++) {
+		if (ELF32_ST_TYPE(sym[i].info) != STT_FUNC || !sym[i].value ||
+		    sym[i].shndx == SHN_UNDEF ||
+		    sym[i].name >= strtab->size ||
+		    !memchr(prof->strings + sym[i].name, '\0',
+			    strtab->size - sym[i].name))
+			continue;
+
+		prof->syms[prof->sym_count].addr = sym[i].value;
+		prof->syms[prof->sym_count].size = sym[i].size;
+		prof->syms[prof->sym_count].name = prof->strings +
+			sym[i].name;
+		prof->sym_count++;
+	}
+
+	if (!prof->sym_count) {
+		fprintf(stderr, "error: no functions in %s\n", elf_file);
+		goto out;
+	}
+
+	qsort(prof->syms, prof->sym_count, sizeof(*prof->syms),
+	      sym_cmp_addr);
+	ret = 0;
+
+out:
+	free(section);
+	free(sym);
+	return ret;
+}
+
+struct profile *profile_load(const char *elf_file)
+{
+	struct profile *prof;
+	FILE *fd;
+	int ret;
+
+	fd = fopen(elf_file, "rb");
+	if (!fd) {
+		fprintf(stderr, "error: Unable to open ELF file %s\n",
+			elf_file);
+		return NULL;
+	}
+
+	prof = calloc(1, sizeof(*prof));
+	if (!prof) {
+		fclose(fd);
+		return NULL;
+	}
+
+	ret = elf_load_syms(prof, fd, elf_file);
+	fclose(fd);
+	if (ret < 0) {
+		profile_free(prof);
+		return NULL;
+	}
+
+	return prof;
+}
+
+/* function containing pc, the last one starting at or before it */
+static struct profile_sym *profile_find(struct profile *prof, uint32_t pc)
+{
+	struct profile_sym *sym;
+	uint32_t low = 0;
+	uint32_t high = prof->sym_count;
+	uint32_t mid;
+
+	while (low < high) {
+		mid = low + (high - low) / 2;
+		if (prof->syms[mid].addr <= pc)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	if (!low)
+		return NULL;
+
+	sym = &prof->syms[low - 1];
+	if (sym->size && pc - sym->addr >= sym->size)
+		return NULL;
+
+	return sym;
+}
+
+void profile_add(struct profile *prof, uint32_t core, uint32_t pc)
+{
+	struct profile_sym *sym = profile_find(prof, pc);
+
+	if (sym)
+		sym->samples++;
+	else
+		prof->unknown++;
+
+	if (core < PROFILE_MAX_CORES)
+		prof->core_samples[core]++;
+	prof->samples++;
+}
+
+void profile_print(const struct profile *prof, FILE *out_fd)
+{
+	struct profile_sym **hot;
+	uint32_t count = 0;
+	uint32_t i;
+
+	fprintf(out_fd, "Flat profile of %llu samples\n",
+		(unsigned long long)prof->samples);
+	if (!prof->samples)
+		return;
+
+	for (i = 0; i < PROFILE_MAX_CORES; i++)
+		if (prof->core_samples[i])
+			fprintf(out_fd, "core %u: %llu samples\n", i,
+				(unsigned long long)prof->core_samples[i]);
+
+	hot = calloc(prof->sym_count, sizeof(*hot));
+	if (!hot) {
+		fprintf(stderr, "error: can't sort the profile\n");
+		return;
+	}
+
+	for (i = 0; i < prof->sym_count; i++)
+		if (prof->syms[i].samples)
+			hot[count++] = &prof->syms[i];
+
+	qsort(hot, count, sizeof(*hot), sym_cmp_samples);
+
+	fprintf(out_fd, "%10s %7s  %s\n", "samples", "%", "function");
+	for (i = 0; i < count; i++)
+		fprintf(out_fd, "%10llu %6.2f%%  %s\n",
+			(unsigned long long)hot[i]->samples,
+			100.0 * hot[i]->samples / prof->samples,
+			hot[i]->name);
+
+	if (prof->unknown)
+		fprintf(out_fd, "%10llu %6.2f%%  [unknown]\n",
+			(unsigned long long)prof->unknown,
+			100.0 * prof->unknown / prof->samples);
+
+	free(hot);
+}
+
+void profile_free(struct profile *prof)
+{
+	free(prof->syms);
+	free(prof->strings);
+	free(prof);
+}
@@ -0,0 +1,26 @@
+/*
+ * flat profile of firmware PC samples.
+ *
+ * Copyright (c) 2019, Intel Corporation.
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms and conditions of the GNU General Public License,
+ * version 2, as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License for
+ * more details.
+ */
+#include <stdint.h>
+#include <stdio.h>
+
+/* cores counted separately, samples of other cores only go to the total */
+#define PROFILE_MAX_CORES	8
+
+struct profile;
+
+struct profile *profile_load(const char *elf_file);
+void profile_add(struct profile *prof, uint32_t core, uint32_t pc);
+void profile_print(const struct profile *prof, FILE *out_fd);
+void profile_free(struct profile *prof);
@@ -36,28 +36,83 @@
 #include <stdio.h>
 #include <malloc.h>
 #include <sof/alloc.h>
+#include <sof/lock.h>
 #include "testbench/common_test.h"
 
+/* heap statistics, fragmentation is up to the C library here */
+static struct mm_stats tb_stats;
+static size_t tb_used;
+static spinlock_t tb_stats_lock; /* threaded cores allocate concurrently */
+
+static void *tb_account(void *ptr, size_t bytes)
+{
+	int bucket = 0;
+
+	while (bucket < MM_SIZE_BUCKETS - 1 && bytes > (32 << bucket))
+		bucket++;
+
+	spin_lock(&tb_stats_lock);
+
+	if (!ptr) {
+		tb_stats.failures++;
+	} else {
+		tb_stats.sizes[bucket]++;
+		tb_used += malloc_usable_size(ptr);
+		if (tb_used > tb_stats.peak_used)
+			tb_stats.peak_used = tb_used;
+	}
+
+	spin_unlock(&tb_stats_lock);
+
+	return ptr;
+}
+
 /* testbench mem alloc definition */
 
 void *rmalloc(int zone, uint32_t caps, size_t bytes)
 {
-	return malloc(bytes);
+	return tb_account(malloc(bytes), bytes);
 }
 
 void *rzalloc(int zone, uint32_t caps, size_t bytes)
 {
-	return calloc(bytes, 1);
+	return tb_account(calloc(bytes, 1), bytes);
 }
 
 void rfree(void *ptr)
 {
+	if (ptr) {
+		spin_lock(&tb_stats_lock);
+		tb_used -= malloc_usable_size(ptr);
+		spin_unlock(&tb_stats_lock);
+	}
 	free(ptr);
 }
 
 void *rballoc(int zone, uint32_t caps, size_t bytes)
 {
-	return malloc(bytes);
+	return tb_account(malloc(bytes), bytes);
+}
+
+void tb_print_heap_stats(void)
+{
+	int i;
+
+	printf("Heap: used %zu bytes, peak %u bytes, failures %u\n",
+	       tb_used, tb_stats.peak_used, tb_stats.failures);
+	printf("Heap requests by size:");
+	for (i = 0; i < MM_SIZE_BUCKETS - 1; i++)
+		printf(" <=%d:%u", 32 << i, tb_stats.sizes[i]);
+	printf(" >%d:%u\n", 32 << (MM_SIZE_BUCKETS - 2), tb_stats.sizes[i]);
+}
+
+/* allocations are not packed into pipeline arenas in testbench */
+void alloc_arena_enter(uint32_t pipeline_id)
+{
+}
+
+void alloc_arena_exit(void)
+{
 }
 
 void heap_trace(struct mm_heap *heap, int size)
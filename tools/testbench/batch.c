@@ -0,0 +1,452 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Batch mode runs one job per manifest line. The topology is parsed once
+ * and every job gets its own instance of it, so only the IPC replay and the
+ * processing itself are paid per job. Jobs are split into one contiguous
+ * range per worker thread, a worker that runs out of jobs steals from the
+ * front of the largest remaining range.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sof/ipc.h>
+#include <sof/cpu.h>
+#include <sof/audio/pipeline.h>
+#include "testbench/common_test.h"
+#include "testbench/topology.h"
+#include "testbench/trace.h"
+#include "testbench/file.h"
+
+/* manifest line: <input_file> <output_file> <input_format> */
+#define TB_BATCH_FIELDS	3
+
+struct tb_batch_job {
+	char *input_file;
+	char *output_file;
+	char *bits_in;
+	int worker; /* worker that ran the job */
+	int stolen; /* taken from the range of another worker */
+	int ret;
+	int n_in;
+	int n_out;
+	int channels;
+	uint32_t fs_out;
+	uint64_t elapsed_ns;
+};
+
+struct tb_batch;
+
+struct tb_batch_worker {
+	pthread_t thread;
+	pthread_mutex_t lock; /* protects head and tail */
+	int head; /* next job a thief takes */
+	int tail; /* one past the next job the owner takes */
+	int id; /* also the topology instance of the worker */
+	struct tb_batch *batch;
+};
+
+struct tb_batch {
+	struct sof *sof;
+	struct testbench_prm *tp;
+	struct tplg_record rec;
+	pthread_mutex_t lock; /* IPC, topology and comp registration */
+	struct tb_batch_job *jobs;
+	int num_jobs;
+	struct tb_batch_worker *workers;
+	int num_workers;
+};
+
+static uint64_t tb_batch_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void tb_batch_jobs_free(struct tb_batch *batch)
+{
+	int i;
+
+	for (i = 0; i < batch->num_jobs; i++) {
+		free(batch->jobs[i].input_file);
+		free(batch->jobs[i].output_file);
+		free(batch->jobs[i].bits_in);
+	}
+
+	free(batch->jobs);
+}
+
+/* read jobs from manifest, empty lines and lines starting with # skipped */
+static int tb_batch_parse(struct tb_batch *batch, const char *manifest)
+{
+	struct tb_batch_job *job;
+	char *field[TB_BATCH_FIELDS];
+	char *line = NULL;
+	char *saveptr;
+	size_t len = 0;
+	int line_num = 0;
+	int ret = 0;
+	FILE *fh;
+	int i;
+
+	fh = fopen(manifest, "r");
+	if (!fh) {
+		fprintf(stderr, "error: opening manifest %s\n", manifest);
+		return -EINVAL;
+	}
+
+	while (getline(&line, &len, fh) != -1) {
+		line_num++;
+
+		field[0] = strtok_r(line, " \t\r\n", &saveptr);
+		if (!field[0] || field[0][0] == '#')
+			continue;
+
+		for (i = 1; i < TB_BATCH_FIELDS; i++)
+			field[i] = strtok_r(NULL, " \t\r\n", &saveptr);
+
+		if (!field[TB_BATCH_FIELDS - 1]) {
+			fprintf(stderr, "error: manifest line %d needs %s\n",
+				line_num, "input, output and format");
+			ret = -EINVAL;
+			break;
+		}
+
+		job = realloc(batch->jobs,
+			      (batch->num_jobs + 1) * sizeof(*job));
+		if (!job) {
+			ret = -ENOMEM;
+			break;
+		}
+		batch->jobs = job;
+
+		job = &batch->jobs[batch->num_jobs++];
+		memset(job, 0, sizeof(*job));
+		job->input_file = strdup(field[0]);
+		job->output_file = strdup(field[1]);
+		job->bits_in = strdup(field[2]);
+	}
+
+	free(line);
+	fclose(fh);
+
+	if (!ret && !batch->num_jobs) {
+		fprintf(stderr, "error: no jobs in manifest %s\n", manifest);
+		ret = -EINVAL;
+	}
+
+	return ret;
+}
+
+/* owner takes jobs from the back of its own range */
+static int tb_batch_pop(struct tb_batch_worker *worker)
+{
+	int job = -1;
+
+	pthread_mutex_lock(&worker->lock);
+	if (worker->head < worker->tail)
+		job = --worker->tail;
+	pthread_mutex_unlock(&worker->lock);
+
+	return job;
+}
+
+/* thieves take from the front of the largest range left */
+static int tb_batch_steal(struct tb_batch *batch)
+{
+	struct tb_batch_worker *victim;
+	int job = -1;
+	int left;
+	int most;
+	int i;
+
+	do {
+		victim = NULL;
+		most = 0;
+
+		/* unlocked sizes are only a hint, rechecked below */
+		for (i = 0; i < batch->num_workers; i++) {
+			left = batch->workers[i].tail - batch->workers[i].head;
+			if (left > most) {
+				most = left;
+				victim = &batch->workers[i];
+			}
+		}
+
+		if (!victim)
+			return -1;
+
+		pthread_mutex_lock(&victim->lock);
+		if (victim->head < victim->tail)
+			job = victim->head++;
+		pthread_mutex_unlock(&victim->lock);
+	} while (job < 0);
+
+	return job;
+}
+
+static int tb_batch_job_run(struct tb_batch *batch, int instance,
+			    struct tb_batch_job *job)
+{
+	struct tplg_record *rec = &batch->rec;
+	struct testbench_prm tp = *batch->tp;
+	struct ipc *ipc = batch->sof->ipc;
+	uint32_t id_base = instance * rec->num_comps;
+	struct file_comp_data *frcd;
+	struct file_comp_data *fwcd;
+	struct ipc_comp_dev *icd;
+	struct pipeline *p;
+	uint64_t start;
+	int ret;
+
+	tp.input_file = job->input_file;
+	tp.output_file = job->output_file;
+	tp.bits_in = job->bits_in;
+
+	/* the job owns the format string a WAV header replaces */
+	ret = tb_file_params(&tp);
+	job->bits_in = tp.bits_in;
+	job->channels = tp.channels;
+	if (ret < 0)
+		return ret;
+
+	pthread_mutex_lock(&batch->lock);
+
+	ret = tplg_instantiate(batch->sof, rec, &tp, instance);
+	if (ret < 0)
+		goto out;
+
+	icd = ipc_get_comp(ipc, id_base + rec->sched_id);
+	p = icd->cd->pipeline;
+	icd = ipc_get_comp(ipc, id_base + rec->fr_id);
+	frcd = comp_get_drvdata(icd->cd);
+	icd = ipc_get_comp(ipc, id_base + rec->fw_id);
+	fwcd = comp_get_drvdata(icd->cd);
+
+	if (!tp.fs_in)
+		tp.fs_in = p->ipc_pipe.period * p->ipc_pipe.frames_per_sched;
+	if (!tp.fs_out)
+		tp.fs_out = p->ipc_pipe.period * p->ipc_pipe.frames_per_sched;
+	job->fs_out = tp.fs_out;
+
+	/* this thread runs the pipeline as the core it was assigned */
+	arch_cpu_set_id(p->ipc_pipe.core);
+
+	ret = tb_pipeline_start(ipc, tp.channels, &p->ipc_pipe, &tp);
+	if (ret < 0)
+		goto out;
+
+	pthread_mutex_unlock(&batch->lock);
+
+	start = tb_batch_ns();
+	while (!frcd->fs.reached_eof)
+		pipeline_schedule_copy(p, 0);
+	job->elapsed_ns = tb_batch_ns() - start;
+
+	pthread_mutex_lock(&batch->lock);
+
+	ret = pipeline_reset(p, p->sched_comp);
+	job->n_in = frcd->fs.n;
+	job->n_out = fwcd->fs.n;
+
+out:
+	tplg_instance_free(batch->sof, rec, instance);
+	pthread_mutex_unlock(&batch->lock);
+
+	return ret;
+}
+
+static void *tb_batch_thread(void *arg)
+{
+	struct tb_batch_worker *worker = arg;
+	struct tb_batch *batch = worker->batch;
+	struct tb_batch_job *job;
+	int stolen;
+	int i;
+
+	for (;;) {
+		stolen = 0;
+		i = tb_batch_pop(worker);
+		if (i < 0) {
+			i = tb_batch_steal(batch);
+			if (i < 0)
+				break;
+			stolen = 1;
+		}
+
+		job = &batch->jobs[i];
+		job->worker = worker->id;
+		job->stolen = stolen;
+		job->ret = tb_batch_job_run(batch, worker->id, job);
+	}
+
+	return NULL;
+}
+
+static double tb_batch_audio_s(struct tb_batch_job *job)
+{
+	if (job->ret < 0 || !job->fs_out)
+		return 0.0;
+
+	return (double)job->n_out / job->channels / job->fs_out;
+}
+
+static void tb_batch_print(struct tb_batch *batch, uint64_t elapsed_ns)
+{
+	struct tb_batch_job *job;
+	double audio_s = 0.0;
+	double t;
+	int failed = 0;
+	int stolen = 0;
+	int i;
+
+	printf("Batch jobs:\n");
+	printf("%6s %6s %10s %10s %10s  %s\n", "job", "worker", "samples",
+	       "time ms", "realtime", "input -> output");
+
+	for (i = 0; i < batch->num_jobs; i++) {
+		job = &batch->jobs[i];
+		t = job->elapsed_ns / 1e9;
+
+		failed += job->ret < 0;
+		stolen += job->stolen;
+		audio_s += tb_batch_audio_s(job);
+
+		if (job->ret < 0) {
+			printf("%6d %6d %10s %10s %10s  %s -> %s\n", i,
+			       job->worker, "failed", "-", "-",
+			       job->input_file, job->output_file);
+			continue;
+		}
+
+		printf("%6d %5d%c %10d %10.2f %9.1fx  %s -> %s\n", i,
+		       job->worker, job->stolen ? '*' : ' ', job->n_out,
+		       t * 1e3, t > 0 ? tb_batch_audio_s(job) / t : 0.0,
+		       job->input_file, job->output_file);
+	}
+
+	t = elapsed_ns / 1e9;
+	printf("Batch: %d jobs, %d failed, %d stolen (*), %d workers\n",
+	       batch->num_jobs, failed, stolen, batch->num_workers);
+	printf("Batch time: %.2f ms, %.1f jobs/s, %.1f x realtime\n",
+	       t * 1e3, t > 0 ? batch->num_jobs / t : 0.0,
+	       t > 0 ? audio_s / t : 0.0);
+}
+
+/* run all jobs of tp->batch_file on tp->batch_workers threads */
+int tb_batch_run(struct sof *sof, struct shared_lib_table *library_table,
+		 struct testbench_prm *tp)
+{
+	struct tb_batch batch = { .sof = sof, .tp = tp };
+	struct testbench_prm rec_tp = *tp;
+	struct tb_batch_worker *worker;
+	uint64_t start;
+	int ret;
+	int i;
+
+	ret = tb_batch_parse(&batch, tp->batch_file);
+	if (ret < 0)
+		goto out;
+
+	/* comps are registered and libraries opened by this single parse */
+	rec_tp.input_file = batch.jobs[0].input_file;
+	rec_tp.output_file = batch.jobs[0].output_file;
+	ret = tplg_record(sof, library_table, &rec_tp, &batch.rec);
+	if (ret < 0) {
+		fprintf(stderr, "error: parsing topology\n");
+		goto out;
+	}
+
+	batch.num_workers = tp->batch_workers;
+	if (batch.num_workers <= 0)
+		batch.num_workers = sysconf(_SC_NPROCESSORS_ONLN);
+	if (batch.num_workers > batch.num_jobs)
+		batch.num_workers = batch.num_jobs;
+
+	batch.workers = calloc(batch.num_workers, sizeof(*batch.workers));
+	if (!batch.workers) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	pthread_mutex_init(&batch.lock, NULL);
+
+	for (i = 0; i < batch.num_workers; i++) {
+		worker = &batch.workers[i];
+		worker->id = i;
+		worker->batch = &batch;
+		worker->head = (int64_t)i * batch.num_jobs / batch.num_workers;
+		worker->tail = (int64_t)(i + 1) * batch.num_jobs /
+			batch.num_workers;
+		pthread_mutex_init(&worker->lock, NULL);
+	}
+
+	tb_enable_trace(false); /* reduce trace output */
+	start = tb_batch_ns();
+
+	for (i = 0; i < batch.num_workers; i++) {
+		if (pthread_create(&batch.workers[i].thread, NULL,
+				   tb_batch_thread, &batch.workers[i])) {
+			fprintf(stderr, "error: batch worker %d\n", i);
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	for (i = 0; i < batch.num_workers; i++)
+		pthread_join(batch.workers[i].thread, NULL);
+
+	start = tb_batch_ns() - start;
+	tb_enable_trace(true);
+
+	tb_batch_print(&batch, start);
+
+	for (i = 0; i < batch.num_workers; i++)
+		pthread_mutex_destroy(&batch.workers[i].lock);
+	pthread_mutex_destroy(&batch.lock);
+
+	for (i = 0; i < batch.num_jobs; i++) {
+		if (batch.jobs[i].ret < 0)
+			ret = batch.jobs[i].ret;
+	}
+
+out:
+	free(batch.workers);
+	tplg_record_free(&batch.rec);
+	tb_batch_jobs_free(&batch);
+	return ret;
+}
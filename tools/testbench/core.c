@@ -0,0 +1,354 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/* multi-threaded scheduler backend, one worker thread per virtual core */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <sof/list.h>
+#include <sof/cpu.h>
+#include <sof/schedule.h>
+#include <platform/platform.h>
+#include "testbench/core.h"
+
+struct tb_core {
+	pthread_t thread;
+	pthread_mutex_t lock; /* protects everything below */
+	pthread_cond_t work; /* task queued, call posted or stop */
+	pthread_cond_t done; /* task function or call finished */
+	pthread_mutex_t call_lock; /* serialises callers of tb_core_call() */
+	struct list_item tasks; /* queued tasks ordered by start */
+	struct task *running; /* task whose function is executing */
+	int (*call)(void *data);
+	void *call_data;
+	int call_ret;
+	int call_done;
+	int stop;
+	int id;
+	struct tb_core_stats stats;
+};
+
+static struct tb_core *cores;
+static int num_cores;
+
+static uint64_t tb_core_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static struct tb_core *tb_core_get(int id)
+{
+	if (id < 0 || id >= num_cores) {
+		fprintf(stderr, "error: task on disabled core %d\n", id);
+		return NULL;
+	}
+
+	return &cores[id];
+}
+
+/* insert task by start time, equal starts by priority; lock held */
+static void tb_core_insert(struct tb_core *core, struct task *task)
+{
+	struct list_item *tlist;
+	struct task *curr;
+
+	list_for_item(tlist, &core->tasks) {
+		curr = list_item(tlist, struct task, list);
+		if (curr->start > task->start ||
+		    (curr->start == task->start &&
+		     curr->priority > task->priority))
+			break;
+	}
+
+	/* appending to an item places the task right before it */
+	list_item_append(&task->list, tlist);
+	task->state = SOF_TASK_STATE_QUEUED;
+}
+
+static void *tb_core_thread(void *arg)
+{
+	struct tb_core *core = arg;
+	struct task *task;
+	int (*call)(void *data);
+	uint64_t period;
+	uint64_t start;
+	uint64_t busy;
+	int ret;
+
+	arch_cpu_set_id(core->id);
+	cpu_enable_core(core->id);
+
+	pthread_mutex_lock(&core->lock);
+
+	while (!core->stop) {
+		/* posted calls emulate IDC and run before any task */
+		if (core->call) {
+			call = core->call;
+			core->call = NULL;
+			pthread_mutex_unlock(&core->lock);
+
+			ret = call(core->call_data);
+
+			pthread_mutex_lock(&core->lock);
+			core->call_ret = ret;
+			core->call_done = 1;
+			pthread_cond_broadcast(&core->done);
+			continue;
+		}
+
+		if (list_is_empty(&core->tasks)) {
+			pthread_cond_wait(&core->work, &core->lock);
+			continue;
+		}
+
+		/* virtual timer jumps straight to the next task start */
+		task = list_first_item(&core->tasks, struct task, list);
+		list_item_del(&task->list);
+		if (task->start > core->stats.time)
+			core->stats.time = task->start;
+
+		task->state = SOF_TASK_STATE_RUNNING;
+		core->running = task;
+		pthread_mutex_unlock(&core->lock);
+
+		start = tb_core_ns();
+		period = task->func ? task->func(task->data) : 0;
+		busy = tb_core_ns() - start;
+
+		pthread_mutex_lock(&core->lock);
+		core->running = NULL;
+		core->stats.runs++;
+		core->stats.busy_ns += busy;
+
+		/* task may have been cancelled or rescheduled meanwhile */
+		if (task->state == SOF_TASK_STATE_RUNNING) {
+			if (period) {
+				task->start = core->stats.time + period;
+				tb_core_insert(core, task);
+			} else {
+				task->state = SOF_TASK_STATE_COMPLETED;
+			}
+		}
+
+		pthread_cond_broadcast(&core->done);
+	}
+
+	pthread_mutex_unlock(&core->lock);
+
+	cpu_disable_core(core->id);
+
+	return NULL;
+}
+
+int tb_cores_init(int count)
+{
+	struct tb_core *core;
+	int i;
+
+	if (count < 1 || count > PLATFORM_CORE_COUNT) {
+		fprintf(stderr, "error: %d cores, 1 to %d supported\n",
+			count, PLATFORM_CORE_COUNT);
+		return -EINVAL;
+	}
+
+	cores = calloc(count, sizeof(*cores));
+	if (!cores)
+		return -ENOMEM;
+
+	for (i = 0; i < count; i++) {
+		core = &cores[i];
+		core->id = i;
+		list_init(&core->tasks);
+		pthread_mutex_init(&core->lock, NULL);
+		pthread_mutex_init(&core->call_lock, NULL);
+		pthread_cond_init(&core->work, NULL);
+		pthread_cond_init(&core->done, NULL);
+	}
+
+	for (i = 0; i < count; i++) {
+		if (pthread_create(&cores[i].thread, NULL, tb_core_thread,
+				   &cores[i])) {
+			fprintf(stderr, "error: core %d thread\n", i);
+			num_cores = i;
+			tb_cores_free();
+			return -EINVAL;
+		}
+	}
+
+	num_cores = count;
+
+	return 0;
+}
+
+/* pipelines must be stopped, any task still queued is dropped */
+void tb_cores_free(void)
+{
+	struct tb_core *core;
+	int i;
+
+	for (i = 0; i < num_cores; i++) {
+		core = &cores[i];
+		pthread_mutex_lock(&core->lock);
+		core->stop = 1;
+		pthread_cond_signal(&core->work);
+		pthread_mutex_unlock(&core->lock);
+	}
+
+	for (i = 0; i < num_cores; i++) {
+		core = &cores[i];
+		pthread_join(core->thread, NULL);
+		pthread_cond_destroy(&core->done);
+		pthread_cond_destroy(&core->work);
+		pthread_mutex_destroy(&core->call_lock);
+		pthread_mutex_destroy(&core->lock);
+	}
+
+	free(cores);
+	cores = NULL;
+	num_cores = 0;
+}
+
+/* number of running workers, 0 when tasks run inline */
+int tb_cores_count(void)
+{
+	return num_cores;
+}
+
+/* no core has anything queued or running */
+int tb_cores_idle(void)
+{
+	struct tb_core *core;
+	int idle = 1;
+	int i;
+
+	for (i = 0; i < num_cores && idle; i++) {
+		core = &cores[i];
+		pthread_mutex_lock(&core->lock);
+		idle = list_is_empty(&core->tasks) && !core->running &&
+			!core->call;
+		pthread_mutex_unlock(&core->lock);
+	}
+
+	return idle;
+}
+
+/* queue task on its core to start after delay microseconds */
+void tb_core_schedule(struct task *task, uint64_t delay)
+{
+	struct tb_core *core = tb_core_get(task->core);
+
+	if (!core)
+		return;
+
+	pthread_mutex_lock(&core->lock);
+
+	if (task->state == SOF_TASK_STATE_QUEUED)
+		list_item_del(&task->list);
+
+	task->start = core->stats.time + delay;
+	tb_core_insert(core, task);
+
+	pthread_cond_signal(&core->work);
+	pthread_mutex_unlock(&core->lock);
+}
+
+/* dequeue task and wait for its function to return, unless called by it */
+int tb_core_cancel(struct task *task)
+{
+	struct tb_core *core = tb_core_get(task->core);
+
+	if (!core)
+		return -EINVAL;
+
+	pthread_mutex_lock(&core->lock);
+
+	if (task->state == SOF_TASK_STATE_QUEUED) {
+		list_item_del(&task->list);
+		task->state = SOF_TASK_STATE_CANCEL;
+	} else if (task->state == SOF_TASK_STATE_RUNNING) {
+		task->state = SOF_TASK_STATE_CANCEL;
+		if (!pthread_equal(pthread_self(), core->thread)) {
+			while (core->running == task)
+				pthread_cond_wait(&core->done, &core->lock);
+		}
+	}
+
+	pthread_mutex_unlock(&core->lock);
+
+	return 0;
+}
+
+/* run func on the worker of core between tasks and return its result */
+int tb_core_call(int id, int (*func)(void *data), void *data)
+{
+	struct tb_core *core = tb_core_get(id);
+	int ret;
+
+	if (!core)
+		return -EINVAL;
+
+	if (pthread_equal(pthread_self(), core->thread))
+		return func(data);
+
+	pthread_mutex_lock(&core->call_lock);
+	pthread_mutex_lock(&core->lock);
+
+	core->call = func;
+	core->call_data = data;
+	core->call_done = 0;
+	pthread_cond_signal(&core->work);
+
+	while (!core->call_done)
+		pthread_cond_wait(&core->done, &core->lock);
+	ret = core->call_ret;
+
+	pthread_mutex_unlock(&core->lock);
+	pthread_mutex_unlock(&core->call_lock);
+
+	return ret;
+}
+
+void tb_core_get_stats(int id, struct tb_core_stats *stats)
+{
+	struct tb_core *core = tb_core_get(id);
+
+	if (!core)
+		return;
+
+	pthread_mutex_lock(&core->lock);
+	*stats = core->stats;
+	pthread_mutex_unlock(&core->lock);
+}
@@ -33,6 +33,7 @@
 #include <stdint.h>
 #include <sof/edf_schedule.h>
 #include <sof/wait.h>
+#include "testbench/core.h"
 
  /* scheduler testbench definition */
 
@@ -56,7 +57,9 @@ static void schedule_edf_task_free(struct task *task);
 
 static void schedule_edf_task_complete(struct task *task)
 {
+	spin_lock(&sch->lock);
 	list_item_del(&task->list);
+	spin_unlock(&sch->lock);
 	task->state = SOF_TASK_STATE_COMPLETED;
 }
 
@@ -65,7 +68,17 @@ static void schedule_edf_task(struct task *task, uint64_t start,
 			      uint64_t deadline, uint32_t flags)
 {
 	(void)deadline;
+
+	/* threaded cores run the task later on the worker of task->core */
+	if (tb_cores_count()) {
+		tb_core_schedule(task, start);
+		return;
+	}
+
+	/* batch workers run their pipelines inline concurrently */
+	spin_lock(&sch->lock);
 	list_item_prepend(&task->list, &sch->list);
+	spin_unlock(&sch->lock);
 	task->state = SOF_TASK_STATE_QUEUED;
 
 	if (task->func)
@@ -108,10 +121,15 @@ static void schedule_edf(void)
 
 static int schedule_edf_task_cancel(struct task *task)
 {
+	if (tb_cores_count())
+		return tb_core_cancel(task);
+
 	if (task->state == SOF_TASK_STATE_QUEUED) {
 		/* delete task */
 		task->state = SOF_TASK_STATE_CANCEL;
+		spin_lock(&sch->lock);
 		list_item_del(&task->list);
+		spin_unlock(&sch->lock);
 	}
 
 	return 0;
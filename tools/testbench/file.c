@@ -36,6 +36,12 @@
 #include <stddef.h>
 #include <errno.h>
 #include <inttypes.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sof/sof.h>
 #include <sof/lock.h>
 #include <sof/list.h>
@@ -48,6 +54,30 @@
 #include <uapi/ipc/stream.h>
 #include "testbench/common_test.h"
 #include "testbench/file.h"
+#include "testbench/topology.h"
+
+/* output files grow by at least this many bytes */
+#define FILE_MAP_GROW		(1 << 20)
+
+#define WAV_FORMAT_PCM		1
+#define WAV_FORMAT_EXTENSIBLE	0xfffe
+
+/* canonical WAV header for output files, its fields need no packing */
+struct wav_header {
+	char riff[4];
+	uint32_t riff_size;
+	char wave[4];
+	char fmt[4];
+	uint32_t fmt_size;
+	uint16_t format;
+	uint16_t channels;
+	uint32_t rate;
+	uint32_t byte_rate;
+	uint16_t block_align;
+	uint16_t bits;
+	char data[4];
+	uint32_t data_size;
+};
 
 static inline void buffer_check_wrap_32(int32_t **ptr, int32_t *end,
 					size_t size)
@@ -410,13 +440,380 @@ static int file_s24(struct comp_dev *dev, struct comp_buffer *sink,
 	return n_samples;
 }
 
+static uint16_t wav_u16(const uint8_t *p)
+{
+	return p[0] | p[1] << 8;
+}
+
+static uint32_t wav_u32(const uint8_t *p)
+{
+	return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+/* find format and samples of a mapped RIFF/WAVE file */
+static int file_wav_parse(struct file_comp_data *cd)
+{
+	struct file_map *map = &cd->fs.map;
+	uint8_t *end = map->addr + map->size;
+	uint8_t *chunk = map->addr + 12;
+	uint16_t block_align = 0;
+	uint16_t format = 0;
+	uint16_t bits = 0;
+	uint32_t size;
+
+	if (map->size < 12 || memcmp(map->addr, "RIFF", 4) ||
+	    memcmp(map->addr + 8, "WAVE", 4)) {
+		fprintf(stderr, "error: %s is not a WAV file\n", cd->fs.fn);
+		return -EINVAL;
+	}
+
+	map->end = 0;
+	while (chunk + 8 <= end) {
+		size = wav_u32(chunk + 4);
+
+		if (!memcmp(chunk, "fmt ", 4) && size >= 16) {
+			format = wav_u16(chunk + 8);
+			cd->channels = wav_u16(chunk + 10);
+			cd->rate = wav_u32(chunk + 12);
+			block_align = wav_u16(chunk + 20);
+			bits = wav_u16(chunk + 22);
+
+			/* only extensible PCM without padding bits */
+			if (format == WAV_FORMAT_EXTENSIBLE && size >= 40 &&
+			    wav_u16(chunk + 26) == bits)
+				format = wav_u16(chunk + 32);
+		} else if (!memcmp(chunk, "data", 4)) {
+			map->data = chunk + 8 - map->addr;
+			map->end = map->data + size;
+			if (map->end > map->size)
+				map->end = map->size;
+			break;
+		}
+
+		/* chunks are padded to an even size */
+		chunk += 8 + size + (size & 1);
+	}
+
+	if (format != WAV_FORMAT_PCM || !cd->channels || !map->end ||
+	    block_align != cd->channels * bits / 8) {
+		fprintf(stderr, "error: %s is not a supported PCM WAV file\n",
+			cd->fs.fn);
+		return -EINVAL;
+	}
+
+	cd->sample_bytes = bits / 8;
+	switch (bits) {
+	case 16:
+		cd->frame_fmt = SOF_IPC_FRAME_S16_LE;
+		break;
+	case 24:
+		cd->frame_fmt = SOF_IPC_FRAME_S24_4LE;
+		break;
+	case 32:
+		cd->frame_fmt = SOF_IPC_FRAME_S32_LE;
+		break;
+	default:
+		fprintf(stderr, "error: %s has %u bit samples\n", cd->fs.fn,
+			bits);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* fill in the header of a WAV output before it is closed */
+static void file_wav_header(struct comp_dev *dev)
+{
+	struct file_comp_data *cd = comp_get_drvdata(dev);
+	struct wav_header *hdr = (struct wav_header *)cd->fs.map.addr;
+	uint32_t data_size = cd->fs.map.pos - cd->fs.map.data;
+
+	memcpy(hdr->riff, "RIFF", 4);
+	hdr->riff_size = sizeof(*hdr) - 8 + data_size;
+	memcpy(hdr->wave, "WAVE", 4);
+	memcpy(hdr->fmt, "fmt ", 4);
+	hdr->fmt_size = 16;
+	hdr->format = WAV_FORMAT_PCM;
+	hdr->channels = dev->params.channels;
+	hdr->rate = dev->params.rate;
+	hdr->block_align = dev->params.channels * cd->sample_bytes;
+	hdr->byte_rate = hdr->rate * hdr->block_align;
+	hdr->bits = cd->sample_bytes * 8;
+	memcpy(hdr->data, "data", 4);
+	hdr->data_size = data_size;
+}
+
+/* mapped outputs, cut to their written length if the testbench exits
+ * before the file comps are freed
+ */
+static struct list_item file_map_outputs = {
+	&file_map_outputs, &file_map_outputs
+};
+
+static pthread_mutex_t file_map_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void file_map_exit(void)
+{
+	struct file_map *map;
+	struct list_item *clist;
+
+	pthread_mutex_lock(&file_map_lock);
+	list_for_item(clist, &file_map_outputs) {
+		map = container_of(clist, struct file_map, list);
+		if (ftruncate(map->fd, map->pos) < 0)
+			fprintf(stderr, "error: truncating output\n");
+	}
+	pthread_mutex_unlock(&file_map_lock);
+}
+
+static void file_map_output_add(struct file_map *map)
+{
+	static int registered;
+
+	pthread_mutex_lock(&file_map_lock);
+	if (!registered)
+		registered = !atexit(file_map_exit);
+	list_item_append(&map->list, &file_map_outputs);
+	pthread_mutex_unlock(&file_map_lock);
+}
+
+static void file_map_output_del(struct file_map *map)
+{
+	pthread_mutex_lock(&file_map_lock);
+	list_item_del(&map->list);
+	pthread_mutex_unlock(&file_map_lock);
+}
+
+/* make room for bytes more samples in a mapped output */
+static int file_map_reserve(struct file_map *map, size_t bytes)
+{
+	size_t size = map->size;
+
+	if (map->pos + bytes <= map->size)
+		return 0;
+
+	while (size < map->pos + bytes)
+		size += size > FILE_MAP_GROW ? size : FILE_MAP_GROW;
+
+	if (ftruncate(map->fd, size) < 0)
+		return -errno;
+
+	if (map->addr)
+		munmap(map->addr, map->size);
+
+	map->addr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+			 map->fd, 0);
+	if (map->addr == MAP_FAILED) {
+		map->addr = NULL;
+		map->size = 0;
+		return -ENOMEM;
+	}
+
+	map->size = size;
+	return 0;
+}
+
+/*
+ * Map a raw or WAV file. Returns -ENODEV for files that can't be mapped,
+ * like pipes, raw ones are then accessed through stdio instead.
+ */
+static int file_map_open(struct file_comp_data *cd)
+{
+	struct file_map *map = &cd->fs.map;
+	struct stat st;
+	int ret;
+
+	if (cd->fs.mode == FILE_READ)
+		map->fd = open(cd->fs.fn, O_RDONLY);
+	else
+		map->fd = open(cd->fs.fn, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (map->fd < 0)
+		return -errno;
+
+	if (fstat(map->fd, &st) < 0 || !S_ISREG(st.st_mode)) {
+		close(map->fd);
+		return -ENODEV;
+	}
+
+	map->addr = NULL;
+	map->size = 0;
+	map->data = 0;
+	map->pos = 0;
+	cd->fs.mapped = 1;
+
+	/* outputs start empty, a WAV header is written when closed */
+	if (cd->fs.mode != FILE_READ) {
+		if (cd->fs.f_format == FILE_WAV)
+			map->data = sizeof(struct wav_header);
+		map->pos = map->data;
+		file_map_output_add(map);
+		return file_map_reserve(map, 0);
+	}
+
+	map->size = st.st_size;
+	map->end = map->size;
+	if (map->size) {
+		map->addr = mmap(NULL, map->size, PROT_READ, MAP_PRIVATE,
+				 map->fd, 0);
+		if (map->addr == MAP_FAILED) {
+			map->addr = NULL;
+			return -ENOMEM;
+		}
+		madvise(map->addr, map->size, MADV_SEQUENTIAL);
+	}
+
+	if (cd->fs.f_format == FILE_WAV) {
+		ret = file_wav_parse(cd);
+		if (ret < 0)
+			return ret;
+	}
+
+	map->pos = map->data;
+	return 0;
+}
+
+static void file_map_close(struct file_comp_data *cd)
+{
+	struct file_map *map = &cd->fs.map;
+
+	if (map->addr)
+		munmap(map->addr, map->size);
+
+	/* drop the unused part of the last output step */
+	if (cd->fs.mode == FILE_WRITE) {
+		file_map_output_del(map);
+		if (ftruncate(map->fd, map->pos) < 0)
+			fprintf(stderr, "error: truncating %s\n", cd->fs.fn);
+	}
+
+	close(map->fd);
+}
+
+/* convert a block of file samples to the buffer format */
+static void file_block_read(struct file_comp_data *cd, uint32_t fmt,
+			    void *dst, const uint8_t *src, int n)
+{
+	int32_t *dest = dst;
+	int i;
+
+	switch (fmt) {
+	case SOF_IPC_FRAME_S24_4LE:
+		/* packed WAV samples */
+		if (cd->sample_bytes == 3) {
+			for (i = 0; i < n; i++, src += 3)
+				dest[i] = src[0] | src[1] << 8 | src[2] << 16;
+			break;
+		}
+
+		/* mask bits of 24-bit samples */
+		memcpy(dst, src, n * sizeof(int32_t));
+		for (i = 0; i < n; i++)
+			dest[i] &= 0x00ffffff;
+		break;
+	default:
+		memcpy(dst, src, n * cd->sample_bytes);
+		break;
+	}
+}
+
+/* convert a block of buffer samples to the file format */
+static void file_block_write(struct file_comp_data *cd, uint32_t fmt,
+			     uint8_t *dst, const void *src, int n)
+{
+	const int32_t *source = src;
+	int32_t *dest = (int32_t *)dst;
+	int i;
+
+	switch (fmt) {
+	case SOF_IPC_FRAME_S24_4LE:
+		/* packed WAV samples */
+		if (cd->sample_bytes == 3) {
+			for (i = 0; i < n; i++, dst += 3) {
+				dst[0] = source[i];
+				dst[1] = source[i] >> 8;
+				dst[2] = source[i] >> 16;
+			}
+			break;
+		}
+
+		/* sign extend 24-bit samples */
+		for (i = 0; i < n; i++)
+			dest[i] = (int32_t)((uint32_t)source[i] << 8) >> 8;
+		break;
+	default:
+		memcpy(dst, src, n * cd->sample_bytes);
+		break;
+	}
+}
+
+/* copy whole blocks between a mapped file and the buffer ring */
+static int file_map_copy(struct comp_dev *dev, struct comp_buffer *sink,
+			 struct comp_buffer *source, uint32_t frames)
+{
+	struct file_comp_data *cd = comp_get_drvdata(dev);
+	struct sof_ipc_comp_config *config = COMP_GET_CONFIG(dev);
+	struct file_map *map = &cd->fs.map;
+	struct comp_buffer *buffer;
+	int bytes = dev->params.sample_container_bytes;
+	int n = frames * dev->params.channels;
+	size_t avail;
+	uint8_t *ptr;
+	int left;
+	int m;
+
+	if (cd->fs.mode == FILE_READ) {
+		buffer = sink;
+		ptr = sink->w_ptr;
+
+		/* last block, eof is flagged as by the stdio reads */
+		avail = (map->end - map->pos) / cd->sample_bytes;
+		if (n > avail) {
+			n = avail;
+			cd->fs.reached_eof = 1;
+		}
+	} else {
+		buffer = source;
+		ptr = source->r_ptr;
+
+		if (file_map_reserve(map, (size_t)n * cd->sample_bytes) < 0) {
+			fprintf(stderr, "error: growing %s\n", cd->fs.fn);
+			return 0;
+		}
+	}
+
+	/* at most two blocks, before and after the buffer wrap */
+	for (left = n; left > 0; left -= m) {
+		m = ((uint8_t *)buffer->end_addr - ptr) / bytes;
+		if (m > left)
+			m = left;
+
+		if (cd->fs.mode == FILE_READ)
+			file_block_read(cd, config->frame_fmt, ptr,
+					map->addr + map->pos, m);
+		else
+			file_block_write(cd, config->frame_fmt,
+					 map->addr + map->pos, ptr, m);
+
+		map->pos += m * cd->sample_bytes;
+		ptr += m * bytes;
+		if (ptr >= (uint8_t *)buffer->end_addr)
+			ptr = buffer->addr;
+	}
+
+	cd->fs.n += n;
+	return n;
+}
+
 static enum file_format get_file_format(char *filename)
 {
 	char *ext = strrchr(filename, '.');
 
-	if (!strcmp(ext, ".txt"))
+	if (ext && !strcmp(ext, ".txt"))
 		return FILE_TEXT;
 
+	if (ext && !strcmp(ext, ".wav"))
+		return FILE_WAV;
+
 	return FILE_RAW;
 }
 
@@ -427,6 +824,7 @@ static struct comp_dev *file_new(struct sof_ipc_comp *comp)
 	struct sof_ipc_comp_file *ipc_file =
 		(struct sof_ipc_comp_file *)comp;
 	struct file_comp_data *cd;
+	int ret;
 
 	if (IPC_IS_SIZE_INVALID(ipc_file->config)) {
 		fprintf(stderr, "error: file_new() Invalid IPC size.\n");
@@ -463,25 +861,33 @@ static struct comp_dev *file_new(struct sof_ipc_comp *comp)
 	/* set file comp mode */
 	cd->fs.mode = ipc_file->mode;
 
+	/* map raw and WAV files, stdio is left for text and pipes */
+	if (cd->fs.f_format != FILE_TEXT && cd->fs.mode != FILE_DUPLEX) {
+		ret = file_map_open(cd);
+		if (ret < 0 && (ret != -ENODEV || cd->fs.f_format == FILE_WAV))
+			goto error;
+	}
+
+	/* the WAV header overrides the topology input format */
+	if (cd->fs.mapped && cd->fs.mode == FILE_READ &&
+	    cd->fs.f_format == FILE_WAV)
+		file->config.frame_fmt = cd->frame_fmt;
+
 	/* open file handle(s) depending on mode */
 	switch (cd->fs.mode) {
 	case FILE_READ:
+		if (cd->fs.mapped)
+			break;
 		cd->fs.rfh = fopen(cd->fs.fn, "r");
-		if (!cd->fs.rfh) {
-			fprintf(stderr, "error: opening file %s\n", cd->fs.fn);
-			free(cd);
-			free(dev);
-			return NULL;
-		}
+		if (!cd->fs.rfh)
+			goto error;
 		break;
 	case FILE_WRITE:
+		if (cd->fs.mapped)
+			break;
 		cd->fs.wfh = fopen(cd->fs.fn, "w");
-		if (!cd->fs.wfh) {
-			fprintf(stderr, "error: opening file %s\n", cd->fs.fn);
-			free(cd);
-			free(dev);
-			return NULL;
-		}
+		if (!cd->fs.wfh)
+			goto error;
 		break;
 	default:
 		/* TODO: duplex mode */
@@ -494,16 +900,31 @@ static struct comp_dev *file_new(struct sof_ipc_comp *comp)
 	dev->state = COMP_STATE_READY;
 
 	return dev;
+
+error:
+	fprintf(stderr, "error: opening file %s\n", cd->fs.fn);
+	if (cd->fs.mapped)
+		file_map_close(cd);
+	free(cd->fs.fn);
+	free(cd);
+	free(dev);
+	return NULL;
 }
 
 static void file_free(struct comp_dev *dev)
 {
 	struct file_comp_data *cd = comp_get_drvdata(dev);
 
-	if (cd->fs.mode == FILE_READ)
+	if (cd->fs.mapped) {
+		if (cd->fs.mode == FILE_WRITE && cd->fs.f_format == FILE_WAV &&
+		    cd->fs.map.addr)
+			file_wav_header(dev);
+		file_map_close(cd);
+	} else if (cd->fs.mode == FILE_READ) {
 		fclose(cd->fs.rfh);
-	else
+	} else {
 		fclose(cd->fs.wfh);
+	}
 
 	free(cd->fs.fn);
 	free(cd);
@@ -696,6 +1117,20 @@ static int file_prepare(struct comp_dev *dev)
 		return -EINVAL;
 	}
 
+	/* mapped files copy whole periods, WAV has packed 24-bit samples */
+	if (cd->fs.mapped) {
+		if (cd->fs.mode != FILE_READ || cd->fs.f_format != FILE_WAV) {
+			if (config->frame_fmt == SOF_IPC_FRAME_S16_LE)
+				cd->sample_bytes = 2;
+			else if (config->frame_fmt == SOF_IPC_FRAME_S24_4LE &&
+				 cd->fs.f_format == FILE_WAV)
+				cd->sample_bytes = 3;
+			else
+				cd->sample_bytes = 4;
+		}
+		cd->file_func = file_map_copy;
+	}
+
 	dev->state = COMP_STATE_PREPARE;
 
 	return ret;
@@ -708,6 +1143,41 @@ static int file_reset(struct comp_dev *dev)
 	return 0;
 }
 
+/*
+ * Take input format, rate and channels from a WAV header, before the
+ * topology is parsed so the file comps get the right format.
+ */
+int tb_file_params(struct testbench_prm *tp)
+{
+	struct file_comp_data cd = {
+		.fs = {
+			.fn = tp->input_file,
+			.mode = FILE_READ,
+			.f_format = get_file_format(tp->input_file),
+		},
+	};
+	int ret;
+
+	if (cd.fs.f_format != FILE_WAV)
+		return 0;
+
+	ret = file_map_open(&cd);
+	if (cd.fs.mapped)
+		file_map_close(&cd);
+	if (ret < 0) {
+		fprintf(stderr, "error: opening file %s\n", tp->input_file);
+		return ret;
+	}
+
+	if (!tp->fs_in)
+		tp->fs_in = cd.rate;
+	tp->channels = cd.channels;
+
+	free(tp->bits_in);
+	tp->bits_in = strdup(find_format_name(cd.frame_fmt));
+	return 0;
+}
+
 struct comp_driver comp_file = {
 	.type = SOF_COMP_FILEREAD,
 	.ops = {
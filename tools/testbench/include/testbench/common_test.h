@@ -43,6 +43,7 @@
 
 #define DEBUG_MSG_LEN		256
 #define MAX_LIB_NAME_LEN	256
+#define TESTBENCH_NCH		2 /* Stereo */
 
 /* number of widgets types supported in testbench */
 #define NUM_WIDGETS_SUPPORTED	3
@@ -60,6 +61,13 @@ struct testbench_prm {
 	 */
 	uint32_t fs_in;
 	uint32_t fs_out;
+	int channels; /* TESTBENCH_NCH unless set by a WAV input */
+	int sched_bench_tasks; /* run the EDF scheduler benchmark */
+	int num_cores; /* virtual cores with worker threads, 0 runs inline */
+	char *batch_file; /* manifest of batch jobs */
+	int batch_workers; /* batch worker threads, 0 uses all CPUs */
+	int profile_period; /* SIGPROF sampling period in us, 0 disables */
+	int simd_check; /* check the SIMD modules against the generic ones */
 };
 
 struct shared_lib_table {
@@ -78,6 +86,8 @@ void sys_comp_file_init(void);
 
 void sys_comp_filewrite_init(void);
 
+int tb_file_params(struct testbench_prm *tp);
+
 int tb_pipeline_setup(struct sof *sof);
 
 int tb_pipeline_start(struct ipc *ipc, int nch,
@@ -90,6 +100,17 @@ int tb_pipeline_params(struct ipc *ipc, int nch,
 
 void debug_print(char *message);
 
+void tb_print_heap_stats(void);
+
+int tb_sched_bench(int num_tasks, int iterations);
+
+int tb_ll_sched_bench(int num_tasks, int ticks);
+
+int tb_simd_check(void);
+
+int tb_batch_run(struct sof *sof, struct shared_lib_table *library_table,
+		 struct testbench_prm *tp);
+
 int get_index_by_name(char *comp_name,
 		      struct shared_lib_table *lib_table);
 
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef _INCLUDE_HOST_CORE_H_
+#define _INCLUDE_HOST_CORE_H_
+
+#include <stdint.h>
+#include <sof/schedule.h>
+
+/*
+ * Multi-threaded scheduler backend. Every virtual core gets a worker thread
+ * with its own virtual timer in microseconds and a queue of tasks ordered by
+ * start time. Tasks run on the worker of task->core and are requeued one
+ * period later while their function keeps returning a period. The virtual
+ * timer jumps to the next task start so pipelines run at full host speed.
+ */
+
+/* per core scheduling statistics */
+struct tb_core_stats {
+	uint64_t runs; /* task functions executed */
+	uint64_t time; /* virtual timer at the last run */
+	uint64_t busy_ns; /* host time spent inside task functions */
+};
+
+int tb_cores_init(int count);
+
+void tb_cores_free(void);
+
+int tb_cores_count(void);
+
+int tb_cores_idle(void);
+
+void tb_core_schedule(struct task *task, uint64_t delay);
+
+int tb_core_cancel(struct task *task);
+
+int tb_core_call(int id, int (*func)(void *data), void *data);
+
+void tb_core_get_stats(int id, struct tb_core_stats *stats);
+
+#endif /* _INCLUDE_HOST_CORE_H_ */
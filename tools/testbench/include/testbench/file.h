@@ -43,12 +43,26 @@ enum file_mode {
 enum file_format {
 	FILE_TEXT = 0,
 	FILE_RAW,
+	FILE_WAV,
+};
+
+/* raw and WAV files are memory mapped and copied in blocks */
+struct file_map {
+	int fd;
+	uint8_t *addr;
+	size_t size; /* mapped bytes, output files grow in steps */
+	size_t data; /* offset of the first sample */
+	size_t end; /* offset after the last sample */
+	size_t pos; /* offset of the next sample */
+	struct list_item list; /* in the open outputs */
 };
 
 /* file component state */
 struct file_state {
 	char *fn;
 	FILE *rfh, *wfh; /* read/write file handle */
+	struct file_map map;
+	int mapped; /* samples go through map instead of rfh/wfh */
 	int reached_eof;
 	int n;
 	enum file_mode mode;
@@ -58,9 +72,11 @@ struct file_state {
 /* file comp data */
 struct file_comp_data {
 	uint32_t period_bytes;
-	uint32_t channels;
+	uint32_t channels; /* WAV input channels */
 	uint32_t frame_bytes;
-	uint32_t rate;
+	uint32_t rate; /* WAV input sample rate */
+	uint32_t frame_fmt; /* WAV input frame format */
+	uint32_t sample_bytes; /* bytes of one sample in a mapped file */
 	struct file_state fs;
 	int (*file_func)(struct comp_dev *dev, struct comp_buffer *sink,
 			 struct comp_buffer *source, uint32_t frames);
@@ -103,6 +103,8 @@ struct sof_topology_token {
 
 enum sof_ipc_frame find_format(const char *name);
 
+const char *find_format_name(enum sof_ipc_frame frame);
+
 int get_token_uint32_t(void *elem, void *object, uint32_t offset,
 		       uint32_t size);
 
@@ -197,4 +199,37 @@ int parse_topology(struct sof *sof, struct shared_lib_table *library_table,
 		   struct testbench_prm *tp, int *fr_id, int *fw_id,
 		   int *sched_id, char *pipeline_msg);
 
+/* topology IPC message kept by tplg_record() */
+struct tplg_msg {
+	uint32_t cmd; /* SOF_IPC_TPLG_ command */
+	size_t size;
+	void *data;
+};
+
+/* topology parsed once and instantiated many times, the IDs are those of
+ * instance 0
+ */
+struct tplg_record {
+	struct tplg_msg *msg;
+	int count;
+	size_t max_size; /* largest message */
+	uint32_t num_comps; /* comp IDs used by each instance */
+	uint32_t num_pipelines; /* pipeline IDs used by each instance */
+	int fr_id;
+	int fw_id;
+	int sched_id;
+	char pipeline_msg[DEBUG_MSG_LEN];
+};
+
+int tplg_record(struct sof *sof, struct shared_lib_table *library_table,
+		struct testbench_prm *tp, struct tplg_record *rec);
+
+void tplg_record_free(struct tplg_record *rec);
+
+int tplg_instantiate(struct sof *sof, struct tplg_record *rec,
+		     struct testbench_prm *tp, int instance);
+
+void tplg_instance_free(struct sof *sof, struct tplg_record *rec,
+			int instance);
+
 #endif
@@ -32,18 +32,65 @@
 #include <sof/task.h>
 #include <stdint.h>
 #include <sof/wait.h>
+#include "testbench/core.h"
+
+/* timer driven tasks share the worker queues with EDF tasks, without
+ * threaded cores they run once inline like EDF tasks do
+ */
+static void schedule_ll_task(struct task *task, uint64_t start,
+			     uint64_t period, uint32_t flags)
+{
+	(void)period;
+	(void)flags;
+
+	if (tb_cores_count()) {
+		tb_core_schedule(task, start);
+		return;
+	}
+
+	task->state = SOF_TASK_STATE_RUNNING;
+
+	if (task->func)
+		task->func(task->data);
+
+	task->state = SOF_TASK_STATE_COMPLETED;
+}
+
+static int schedule_ll_task_init(struct task *task, uint32_t xflags)
+{
+	(void)xflags;
+
+	list_init(&task->list);
+
+	return 0;
+}
+
+static int schedule_ll_task_cancel(struct task *task)
+{
+	if (tb_cores_count())
+		return tb_core_cancel(task);
+
+	task->state = SOF_TASK_STATE_CANCEL;
+
+	return 0;
+}
+
+static void schedule_ll_task_free(struct task *task)
+{
+	task->state = SOF_TASK_STATE_FREE;
+	task->func = NULL;
+	task->data = NULL;
+}
 
-/* TODO: Make host ll ops implementation */
 struct scheduler_ops schedule_ll_ops = {
-	.schedule_task = NULL,
-	.schedule_task_init = NULL,
+	.schedule_task = schedule_ll_task,
+	.schedule_task_init = schedule_ll_task_init,
 	.schedule_task_running = NULL,
 	.schedule_task_complete = NULL,
 	.reschedule_task = NULL,
-	.schedule_task_cancel = NULL,
-	.schedule_task_free = NULL,
+	.schedule_task_cancel = schedule_ll_task_cancel,
+	.schedule_task_free = schedule_ll_task_free,
 	.scheduler_init = NULL,
 	.scheduler_free = NULL,
 	.scheduler_run = NULL
 };
-
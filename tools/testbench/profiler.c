@@ -0,0 +1,442 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/* SIGPROF sampling profiler, prints the same flat profile as sof-logger -P */
+
+#define _GNU_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <link.h>
+#include <ucontext.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sof/cpu.h>
+#include "testbench/profiler.h"
+
+/* samples kept for one run, later ones are only counted */
+#define TB_PROFILER_SAMPLES	(1 << 18)
+
+/* cores counted separately in the summary */
+#define TB_PROFILER_CORES	8
+
+/* ELF types of the host */
+#define tb_elf_ehdr_t	ElfW(Ehdr)
+#define tb_elf_shdr_t	ElfW(Shdr)
+#define tb_elf_sym_t	ElfW(Sym)
+
+struct tb_profiler_sample {
+	uintptr_t pc;
+	int core;
+};
+
+/* function from the symbol table of a loaded object */
+struct tb_profiler_sym {
+	uintptr_t addr; /* relative to the object load address */
+	uintptr_t size; /* 0 when unknown, the function then ends at the next */
+	const char *name;
+	const char *object;
+	uint64_t samples;
+};
+
+/* executable or shared library mapped in the process */
+struct tb_profiler_object {
+	char *file;
+	const char *name; /* file name without its directory */
+	uintptr_t base; /* load address symbol values are relative to */
+	uintptr_t start; /* lowest and highest mapped address */
+	uintptr_t end;
+	void *map; /* file mapping the symbol names point to */
+	size_t map_size;
+	struct tb_profiler_sym *syms; /* sorted by address */
+	size_t sym_count;
+	int loaded; /* symbols were read */
+	uint64_t unknown; /* samples outside of any function */
+	struct tb_profiler_object *next;
+};
+
+static struct tb_profiler_sample *samples;
+static uint32_t sample_count; /* incremented by the signal handler */
+static struct sigaction old_action;
+
+static uintptr_t tb_profiler_pc(const ucontext_t *uc)
+{
+#if defined(__x86_64__)
+	return uc->uc_mcontext.gregs[REG_RIP];
+#elif defined(__i386__)
+	return uc->uc_mcontext.gregs[REG_EIP];
+#elif defined(__aarch64__)
+	return uc->uc_mcontext.pc;
+#else
+	return 0;
+#endif
+}
+
+static void tb_profiler_signal(int sig, siginfo_t *info, void *context)
+{
+	uint32_t n = __atomic_fetch_add(&sample_count, 1, __ATOMIC_RELAXED);
+
+	if (n >= TB_PROFILER_SAMPLES)
+		return;
+
+	samples[n].pc = tb_profiler_pc(context);
+	samples[n].core = cpu_get_id();
+}
+
+int tb_profiler_start(uint32_t period_us)
+{
+	struct itimerval timer;
+	struct sigaction action;
+
+	samples = calloc(TB_PROFILER_SAMPLES, sizeof(*samples));
+	if (!samples)
+		return -ENOMEM;
+	sample_count = 0;
+
+	memset(&action, 0, sizeof(action));
+	action.sa_sigaction = tb_profiler_signal;
+	action.sa_flags = SA_SIGINFO | SA_RESTART;
+	sigemptyset(&action.sa_mask);
+	if (sigaction(SIGPROF, &action, &old_action) < 0)
+		goto err;
+
+	timer.it_interval.tv_sec = period_us / 1000000;
+	timer.it_interval.tv_usec = period_us % 1000000;
+	timer.it_value = timer.it_interval;
+	if (setitimer(ITIMER_PROF, &timer, NULL) < 0) {
+		sigaction(SIGPROF, &old_action, NULL);
+		goto err;
+	}
+
+	return 0;
+
+err:
+	free(samples);
+	samples = NULL;
+	return -errno;
+}
+
+void tb_profiler_stop(void)
+{
+	struct itimerval timer;
+
+	if (!samples)
+		return;
+
+	memset(&timer, 0, sizeof(timer));
+	setitimer(ITIMER_PROF, &timer, NULL);
+	sigaction(SIGPROF, &old_action, NULL);
+}
+
+static int tb_profiler_sym_cmp(const void *a, const void *b)
+{
+	const struct tb_profiler_sym *sa = a;
+	const struct tb_profiler_sym *sb = b;
+
+	if (sa->addr != sb->addr)
+		return sa->addr < sb->addr ? -1 : 1;
+	return 0;
+}
+
+static int tb_profiler_hot_cmp(const void *a, const void *b)
+{
+	const struct tb_profiler_sym *sa = *(const struct tb_profiler_sym **)a;
+	const struct tb_profiler_sym *sb = *(const struct tb_profiler_sym **)b;
+
+	if (sa->samples != sb->samples)
+		return sa->samples > sb->samples ? -1 : 1;
+	return strcmp(sa->name, sb->name);
+}
+
+/* keeps the functions of the full symbol table, or of the dynamic one */
+static void tb_profiler_load_syms(struct tb_profiler_object *obj)
+{
+	const tb_elf_ehdr_t *hdr;
+	const tb_elf_shdr_t *section;
+	const tb_elf_shdr_t *symtab = NULL;
+	const tb_elf_shdr_t *strtab;
+	const tb_elf_sym_t *sym;
+	const char *map;
+	struct stat st;
+	size_t count;
+	size_t i;
+	int fd;
+
+	obj->loaded = 1;
+	fd = open(obj->file, O_RDONLY);
+	if (fd < 0)
+		return;
+
+	if (fstat(fd, &st) < 0 || st.st_size < sizeof(*hdr)) {
+		close(fd);
+		return;
+	}
+
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return;
+
+	obj->map = (void *)map;
+	obj->map_size = st.st_size;
+
+	hdr = (const tb_elf_ehdr_t *)map;
+	if (memcmp(hdr->e_ident, ELFMAG, SELFMAG) ||
+	    hdr->e_shentsize != sizeof(*section) ||
+	    hdr->e_shoff + hdr->e_shnum * sizeof(*section) > st.st_size)
+		return;
+
+	section = (const tb_elf_shdr_t *)(map + hdr->e_shoff);
+	for (i = 0; i < hdr->e_shnum; i++) {
+		if (section[i].sh_link >= hdr->e_shnum ||
+		    section[i].sh_offset + section[i].sh_size > st.st_size)
+			continue;
+		if (section[i].sh_type == SHT_SYMTAB ||
+		    (section[i].sh_type == SHT_DYNSYM && !symtab))
+			symtab = &section[i];
+	}
+
+	if (!symtab)
+		return;
+
+	strtab = &section[symtab->sh_link];
+	if (strtab->sh_offset + strtab->sh_size > st.st_size)
+		return;
+
+	sym = (const tb_elf_sym_t *)(map + symtab->sh_offset);
+	count = symtab->sh_size / sizeof(*sym);
+	obj->syms = calloc(count, sizeof(*obj->syms));
+	if (!obj->syms)
+		return;
+
+	for (i = 0; i < count; i++) {
+		if (ELF64_ST_TYPE(sym[i].st_info) != STT_FUNC ||
+		    !sym[i].st_value || sym[i].st_shndx == SHN_UNDEF ||
+		    sym[i].st_name >= strtab->sh_size ||
+		    !memchr(map + strtab->sh_offset + sym[i].st_name, '\0',
+			    strtab->sh_size - sym[i].st_name))
+			continue;
+
+		obj->syms[obj->sym_count].addr = sym[i].st_value;
+		obj->syms[obj->sym_count].size = sym[i].st_size;
+		obj->syms[obj->sym_count].name = map + strtab->sh_offset +
+			sym[i].st_name;
+		obj->syms[obj->sym_count].object = obj->name;
+		obj->sym_count++;
+	}
+
+	qsort(obj->syms, obj->sym_count, sizeof(*obj->syms),
+	      tb_profiler_sym_cmp);
+}
+
+static int tb_profiler_add_object(struct dl_phdr_info *info, size_t size,
+				  void *data)
+{
+	struct tb_profiler_object **objects = data;
+	struct tb_profiler_object *obj;
+	const char *slash;
+	uintptr_t start;
+	uintptr_t end;
+	int i;
+
+	obj = calloc(1, sizeof(*obj));
+	if (!obj)
+		return -ENOMEM;
+
+	/* the executable itself has no name */
+	obj->file = strdup(*info->dlpi_name ? info->dlpi_name :
+			   "/proc/self/exe");
+	if (!obj->file) {
+		free(obj);
+		return -ENOMEM;
+	}
+
+	slash = strrchr(info->dlpi_name, '/');
+	obj->name = *info->dlpi_name ? (slash ? slash + 1 : info->dlpi_name) :
+		program_invocation_short_name;
+	obj->base = info->dlpi_addr;
+	obj->start = UINTPTR_MAX;
+
+	for (i = 0; i < info->dlpi_phnum; i++) {
+		if (info->dlpi_phdr[i].p_type != PT_LOAD)
+			continue;
+		start = info->dlpi_addr + info->dlpi_phdr[i].p_vaddr;
+		end = start + info->dlpi_phdr[i].p_memsz;
+		if (start < obj->start)
+			obj->start = start;
+		if (end > obj->end)
+			obj->end = end;
+	}
+
+	obj->next = *objects;
+	*objects = obj;
+	return 0;
+}
+
+static struct tb_profiler_sym *tb_profiler_find(struct tb_profiler_object *obj,
+						uintptr_t pc)
+{
+	struct tb_profiler_sym *sym;
+	size_t low = 0;
+	size_t high = obj->sym_count;
+	size_t mid;
+
+	pc -= obj->base;
+	while (low < high) {
+		mid = low + (high - low) / 2;
+		if (obj->syms[mid].addr <= pc)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	if (!low)
+		return NULL;
+
+	sym = &obj->syms[low - 1];
+	if (sym->size && pc - sym->addr >= sym->size)
+		return NULL;
+
+	return sym;
+}
+
+static void tb_profiler_free(struct tb_profiler_object *objects)
+{
+	struct tb_profiler_object *obj;
+
+	while (objects) {
+		obj = objects;
+		objects = obj->next;
+		if (obj->map)
+			munmap(obj->map, obj->map_size);
+		free(obj->syms);
+		free(obj->file);
+		free(obj);
+	}
+}
+
+void tb_profiler_print(void)
+{
+	struct tb_profiler_object *objects = NULL;
+	struct tb_profiler_object *obj;
+	struct tb_profiler_sym **hot = NULL;
+	struct tb_profiler_sym *sym;
+	uint64_t core_samples[TB_PROFILER_CORES] = { 0 };
+	uint64_t unknown = 0;
+	size_t hot_count = 0;
+	size_t sym_count = 0;
+	uint32_t count;
+	uint32_t i;
+
+	if (!samples)
+		return;
+
+	count = sample_count < TB_PROFILER_SAMPLES ?
+		sample_count : TB_PROFILER_SAMPLES;
+
+	printf("Flat profile of %u samples", count);
+	if (sample_count > count)
+		printf(", %u dropped", sample_count - count);
+	printf("\n");
+
+	dl_iterate_phdr(tb_profiler_add_object, &objects);
+
+	for (i = 0; i < count; i++) {
+		if (samples[i].core >= 0 && samples[i].core < TB_PROFILER_CORES)
+			core_samples[samples[i].core]++;
+
+		for (obj = objects; obj; obj = obj->next)
+			if (samples[i].pc >= obj->start &&
+			    samples[i].pc < obj->end)
+				break;
+
+		if (!obj) {
+			unknown++;
+			continue;
+		}
+
+		/* symbols are only read from the objects samples hit */
+		if (!obj->loaded) {
+			tb_profiler_load_syms(obj);
+			sym_count += obj->sym_count;
+		}
+
+		sym = tb_profiler_find(obj, samples[i].pc);
+		if (sym)
+			sym->samples++;
+		else
+			obj->unknown++;
+	}
+
+	for (i = 0; i < TB_PROFILER_CORES; i++)
+		if (core_samples[i])
+			printf("core %u: %llu samples\n", i,
+			       (unsigned long long)core_samples[i]);
+
+	if (sym_count)
+		hot = calloc(sym_count, sizeof(*hot));
+
+	for (obj = objects; obj && hot; obj = obj->next)
+		for (i = 0; i < obj->sym_count; i++)
+			if (obj->syms[i].samples)
+				hot[hot_count++] = &obj->syms[i];
+
+	qsort(hot, hot_count, sizeof(*hot), tb_profiler_hot_cmp);
+
+	if (count)
+		printf("%10s %7s  %s\n", "samples", "%", "function");
+
+	for (i = 0; i < hot_count; i++)
+		printf("%10llu %6.2f%%  %s (%s)\n",
+		       (unsigned long long)hot[i]->samples,
+		       100.0 * hot[i]->samples / count, hot[i]->name,
+		       hot[i]->object);
+
+	for (obj = objects; obj; obj = obj->next)
+		if (obj->unknown)
+			printf("%10llu %6.2f%%  [unknown] (%s)\n",
+			       (unsigned long long)obj->unknown,
+			       100.0 * obj->unknown / count, obj->name);
+
+	if (unknown)
+		printf("%10llu %6.2f%%  [unknown]\n",
+		       (unsigned long long)unknown, 100.0 * unknown / count);
+
+	free(hot);
+	tb_profiler_free(objects);
+	free(samples);
+	samples = NULL;
+}
@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2018, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/* EDF ready queue and LL timer wheel stress benchmarks */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <sof/list.h>
+#include <sof/schedule.h>
+#include <sof/edf_schedule.h>
+#include <sof/edf_queue.h>
+#include <sof/ll_wheel.h>
+#include "testbench/common_test.h"
+
+/* shortest and longest synthetic task period in timer ticks */
+#define SCHED_BENCH_PERIOD_MIN	1000
+#define SCHED_BENCH_PERIOD_MAX	20000
+
+/* every Nth decision also cancels and requeues a random task */
+#define SCHED_BENCH_CANCEL_RATE	8
+
+/* LL tick period and pending window in timer ticks */
+#define SCHED_BENCH_LL_TICK	1000
+#define SCHED_BENCH_LL_WINDOW	2000
+
+/* longest synthetic LL task period in scheduler ticks */
+#define SCHED_BENCH_LL_PERIODS	8
+
+struct sched_bench_task {
+	struct task task;
+	struct edf_task_pdata pdata;
+	uint64_t period;
+};
+
+static uint64_t sched_bench_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void sched_bench_tasks_init(struct sched_bench_task *bt, int num_tasks)
+{
+	int i;
+
+	srand(1);
+
+	for (i = 0; i < num_tasks; i++) {
+		bt[i].period = SCHED_BENCH_PERIOD_MIN +
+			rand() % (SCHED_BENCH_PERIOD_MAX -
+				  SCHED_BENCH_PERIOD_MIN);
+		bt[i].task.priority = rand() % SOF_TASK_PRI_COUNT;
+		bt[i].task.start = rand() % bt[i].period;
+		bt[i].task.state = SOF_TASK_STATE_QUEUED;
+		bt[i].pdata.deadline = bt[i].task.start + bt[i].period;
+		edf_sch_set_pdata((&bt[i].task), &bt[i].pdata);
+	}
+}
+
+/* the task has run, move it to its next period */
+static void sched_bench_task_run(struct task *task)
+{
+	struct sched_bench_task *bt =
+		container_of(task, struct sched_bench_task, task);
+
+	bt->task.start += bt->period;
+	bt->pdata.deadline += bt->period;
+}
+
+/* linear scan of a task list, the way the EDF queue used to be searched */
+static struct task *sched_bench_list_next(struct list_item *list)
+{
+	struct list_item *tlist;
+	struct task *task;
+	struct task *next = NULL;
+	uint64_t deadline = UINT64_MAX;
+	int priority = SOF_TASK_PRI_LOW + 1;
+	struct edf_task_pdata *edf_pdata;
+
+	list_for_item(tlist, list) {
+		task = container_of(tlist, struct task, list);
+		edf_pdata = edf_sch_get_pdata(task);
+
+		if (task->priority < priority ||
+		    (task->priority == priority &&
+		     edf_pdata->deadline < deadline)) {
+			priority = task->priority;
+			deadline = edf_pdata->deadline;
+			next = task;
+		}
+	}
+
+	return next;
+}
+
+static uint64_t sched_bench_list(struct sched_bench_task *bt, int num_tasks,
+				 int iterations)
+{
+	struct list_item list;
+	struct task *task;
+	uint64_t tic;
+	int i;
+
+	sched_bench_tasks_init(bt, num_tasks);
+
+	list_init(&list);
+	for (i = 0; i < num_tasks; i++)
+		list_item_append(&bt[i].task.list, &list);
+
+	tic = sched_bench_ns();
+
+	for (i = 0; i < iterations; i++) {
+		task = sched_bench_list_next(&list);
+		list_item_del(&task->list);
+		sched_bench_task_run(task);
+		list_item_append(&task->list, &list);
+
+		if (i % SCHED_BENCH_CANCEL_RATE == 0) {
+			task = &bt[rand() % num_tasks].task;
+			list_item_del(&task->list);
+			list_item_append(&task->list, &list);
+		}
+	}
+
+	return sched_bench_ns() - tic;
+}
+
+static int64_t sched_bench_queue(struct sched_bench_task *bt, int num_tasks,
+				 int iterations)
+{
+	struct edf_queue queue;
+	struct task *task;
+	uint64_t tic;
+	int i;
+
+	sched_bench_tasks_init(bt, num_tasks);
+
+	if (edf_queue_init(&queue) < 0)
+		return -ENOMEM;
+
+	for (i = 0; i < num_tasks; i++) {
+		if (edf_queue_insert(&queue, &bt[i].task) < 0) {
+			edf_queue_free(&queue);
+			return -ENOMEM;
+		}
+	}
+
+	tic = sched_bench_ns();
+
+	/* the queue never grows again as every task is queued only once */
+	for (i = 0; i < iterations; i++) {
+		task = edf_queue_peek(&queue);
+		edf_queue_remove(&queue, task);
+		sched_bench_task_run(task);
+		edf_queue_insert(&queue, task);
+
+		if (i % SCHED_BENCH_CANCEL_RATE == 0) {
+			task = &bt[rand() % num_tasks].task;
+			edf_queue_remove(&queue, task);
+			edf_queue_insert(&queue, task);
+		}
+	}
+
+	tic = sched_bench_ns() - tic;
+	edf_queue_free(&queue);
+
+	return tic;
+}
+
+/* run num_tasks synthetic periodic tasks through the EDF ready queue
+ * and through a linear list scan, and print the cost per decision
+ */
+int tb_sched_bench(int num_tasks, int iterations)
+{
+	struct sched_bench_task *bt;
+	int64_t t_queue;
+	uint64_t t_list;
+
+	if (num_tasks <= 0 || iterations <= 0)
+		return -EINVAL;
+
+	bt = calloc(num_tasks, sizeof(*bt));
+	if (!bt)
+		return -ENOMEM;
+
+	t_queue = sched_bench_queue(bt, num_tasks, iterations);
+	if (t_queue < 0) {
+		free(bt);
+		return t_queue;
+	}
+
+	t_list = sched_bench_list(bt, num_tasks, iterations);
+
+	printf("EDF scheduler benchmark: %d tasks, %d decisions\n",
+	       num_tasks, iterations);
+	printf("ready queue: %.1f ns per decision\n",
+	       (double)t_queue / iterations);
+	printf("list scan:   %.1f ns per decision\n",
+	       (double)t_list / iterations);
+	printf("speedup:     %.1fx\n",
+	       t_queue ? (double)t_list / t_queue : 0.0);
+
+	free(bt);
+
+	return 0;
+}
+
+static void sched_bench_ll_tasks_init(struct sched_bench_task *bt,
+				      int num_tasks)
+{
+	int i;
+
+	srand(1);
+
+	for (i = 0; i < num_tasks; i++) {
+		bt[i].period = SCHED_BENCH_LL_TICK *
+			(1 + rand() % SCHED_BENCH_LL_PERIODS);
+		bt[i].task.priority = rand() % SOF_TASK_PRI_COUNT;
+		bt[i].task.start = SCHED_BENCH_LL_TICK +
+			rand() % bt[i].period;
+		bt[i].task.state = SOF_TASK_STATE_QUEUED;
+		list_init(&bt[i].task.list);
+	}
+}
+
+/* insert by priority and mark every task in the window on each tick,
+ * the way the LL queue used to work
+ */
+static uint64_t sched_bench_ll_list(struct sched_bench_task *bt,
+				    int num_tasks, int ticks, int *runs)
+{
+	struct list_item list;
+	struct list_item *tlist;
+	struct task *task;
+	uint64_t current;
+	uint64_t tic;
+	int i;
+
+	sched_bench_ll_tasks_init(bt, num_tasks);
+	*runs = 0;
+
+	list_init(&list);
+	for (i = 0; i < num_tasks; i++) {
+		list_for_item(tlist, &list) {
+			task = container_of(tlist, struct task, list);
+			if (bt[i].task.priority <= task->priority)
+				break;
+		}
+		list_item_append(&bt[i].task.list, tlist);
+	}
+
+	tic = sched_bench_ns();
+
+	for (i = 1; i <= ticks; i++) {
+		current = (uint64_t)i * SCHED_BENCH_LL_TICK;
+
+		list_for_item(tlist, &list) {
+			task = container_of(tlist, struct task, list);
+			if (current - task->start <= SCHED_BENCH_LL_WINDOW)
+				task->state = SOF_TASK_STATE_PENDING;
+			else
+				task->state = 0;
+		}
+
+		list_for_item(tlist, &list) {
+			task = container_of(tlist, struct task, list);
+			if (task->state != SOF_TASK_STATE_PENDING)
+				continue;
+
+			sched_bench_task_run(task);
+			(*runs)++;
+		}
+	}
+
+	return sched_bench_ns() - tic;
+}
+
+static uint64_t sched_bench_ll_wheel(struct sched_bench_task *bt,
+				     int num_tasks, int ticks, int *runs)
+{
+	struct ll_wheel wheel;
+	struct task *task;
+	uint64_t current;
+	uint64_t tic;
+	int i;
+
+	sched_bench_ll_tasks_init(bt, num_tasks);
+	*runs = 0;
+
+	ll_wheel_init(&wheel, SCHED_BENCH_LL_WINDOW);
+	for (i = 0; i < num_tasks; i++)
+		ll_wheel_insert(&wheel, &bt[i].task);
+
+	tic = sched_bench_ns();
+
+	for (i = 1; i <= ticks; i++) {
+		current = (uint64_t)i * SCHED_BENCH_LL_TICK;
+
+		ll_wheel_collect(&wheel, current);
+
+		while ((task = ll_wheel_next_pending(&wheel))) {
+			ll_wheel_remove(task);
+			sched_bench_task_run(task);
+			ll_wheel_insert(&wheel, task);
+			(*runs)++;
+		}
+	}
+
+	return sched_bench_ns() - tic;
+}
+
+/* run num_tasks synthetic periodic tasks through the LL timer wheel and
+ * through a priority sorted list, and print the cost per tick
+ */
+int tb_ll_sched_bench(int num_tasks, int ticks)
+{
+	struct sched_bench_task *bt;
+	uint64_t t_wheel;
+	uint64_t t_list;
+	int runs_wheel;
+	int runs_list;
+
+	if (num_tasks <= 0 || ticks <= 0)
+		return -EINVAL;
+
+	bt = calloc(num_tasks, sizeof(*bt));
+	if (!bt)
+		return -ENOMEM;
+
+	t_wheel = sched_bench_ll_wheel(bt, num_tasks, ticks, &runs_wheel);
+	t_list = sched_bench_ll_list(bt, num_tasks, ticks, &runs_list);
+
+	free(bt);
+
+	/* both must have run the same work */
+	if (runs_wheel != runs_list) {
+		fprintf(stderr, "error: LL wheel ran %d tasks, list ran %d\n",
+			runs_wheel, runs_list);
+		return -EINVAL;
+	}
+
+	printf("LL scheduler benchmark: %d tasks, %d ticks, %d runs\n",
+	       num_tasks, ticks, runs_wheel);
+	printf("timer wheel: %.1f ns per tick\n", (double)t_wheel / ticks);
+	printf("list scan:   %.1f ns per tick\n", (double)t_list / ticks);
+	printf("speedup:     %.1fx\n",
+	       t_wheel ? (double)t_list / t_wheel : 0.0);
+
+	return 0;
+}
@@ -0,0 +1,1348 @@
+/*
+ * Copyright (c) 2019, Intel Corporation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *   * Neither the name of the Intel Corporation nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/* bit exact check of the x86 SIMD modules against the generic ones */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <dlfcn.h>
+#include <sof/audio/component.h>
+#include <sof/audio/buffer.h>
+#include <sof/audio/mixer.h>
+#include <sof/math/fft.h>
+#include <uapi/user/eq.h>
+#include "volume.h"
+#include "src_config.h"
+#include "src.h"
+#include "fir.h"
+#include "iir.h"
+#include "testbench/common_test.h"
+
+/* spare samples around the data, so the wrap isn't at a vector boundary */
+#define SIMD_CHECK_SPARE	5
+
+/* bytes compared past the buffer end to catch overruns */
+#define SIMD_CHECK_GUARD	64
+
+#define SIMD_CHECK_FILL		0x5a
+
+/* runs of every channel and frame count, with different gains and wraps */
+#define SIMD_CHECK_RUNS		4
+
+/* length of the case name in the errors */
+#define SIMD_CHECK_WHAT_SIZE	64
+
+/* module library name length */
+#define SIMD_CHECK_LIB_SIZE	64
+
+/* most sources mixed, one more on every run */
+#define SIMD_CHECK_MIX_SOURCES	SIMD_CHECK_RUNS
+
+/* longest SRC filter of the checked stages */
+#define SIMD_CHECK_SRC_TAPS	1092
+
+/* calls of the FIR, the second one starts with history in the delay */
+#define SIMD_CHECK_FIR_CALLS	2
+
+/* FFT runs of every size, direction and scaling */
+#define SIMD_CHECK_FFT_RUNS	2
+
+struct simd_check_opt {
+	const char *name; /* optimization of the module library name */
+	const char *cpu; /* CPU feature the module is built for */
+};
+
+static const struct simd_check_opt simd_check_opts[] = {
+	{"sse42", "sse4.2"},
+	{"avx", "avx"},
+	{"avx2", "avx2"},
+	{"fma", "fma"},
+};
+
+static const int simd_check_channels[] = {1, 2, 3, 4, 5, 6, 8};
+
+/* frames per call, odd ones leave samples after the last full vector */
+static const int simd_check_frames[] = {1, 3, 7, 16, 37, 251};
+
+struct simd_check_buffer {
+	struct comp_buffer buffer;
+	uint8_t *data; /* buffer data followed by the guard */
+	uint32_t size;
+};
+
+/* __builtin_cpu_supports() only takes literals */
+static int simd_check_cpu_supports(const char *cpu)
+{
+	if (!strcmp(cpu, "sse4.2"))
+		return __builtin_cpu_supports("sse4.2");
+	if (!strcmp(cpu, "avx"))
+		return __builtin_cpu_supports("avx");
+	if (!strcmp(cpu, "avx2"))
+		return __builtin_cpu_supports("avx2");
+	if (!strcmp(cpu, "fma"))
+		return __builtin_cpu_supports("fma");
+	return 0;
+}
+
+/* opens the module built for opt, or the generic one if opt is NULL */
+static void *simd_check_open(const char *module,
+			     const struct simd_check_opt *opt, char *lib)
+{
+	void *handle;
+
+	if (!opt) {
+		snprintf(lib, SIMD_CHECK_LIB_SIZE, "libsof_%s.so", module);
+		handle = dlopen(lib, RTLD_NOW | RTLD_LOCAL);
+		if (!handle)
+			fprintf(stderr, "error: %s\n", dlerror());
+		return handle;
+	}
+
+	snprintf(lib, SIMD_CHECK_LIB_SIZE, "libsof_%s_%s.so", module,
+		 opt->name);
+	if (!simd_check_cpu_supports(opt->cpu)) {
+		printf("%s: skipped, no %s\n", lib, opt->cpu);
+		return NULL;
+	}
+
+	handle = dlopen(lib, RTLD_NOW | RTLD_LOCAL);
+	if (!handle)
+		printf("%s: skipped, %s\n", lib, dlerror());
+	return handle;
+}
+
+static int simd_check_sample_bytes(uint16_t fmt)
+{
+	return fmt == SOF_IPC_FRAME_S16_LE ? sizeof(int16_t) :
+		sizeof(int32_t);
+}
+
+static int simd_check_buffer_init(struct simd_check_buffer *b,
+				  uint32_t samples, int sample_bytes)
+{
+	b->size = (samples + SIMD_CHECK_SPARE) * sample_bytes;
+	b->data = malloc(b->size + SIMD_CHECK_GUARD);
+	if (!b->data)
+		return -ENOMEM;
+
+	memset(&b->buffer, 0, sizeof(b->buffer));
+	memset(b->data, SIMD_CHECK_FILL, b->size + SIMD_CHECK_GUARD);
+	b->buffer.addr = b->data;
+	b->buffer.end_addr = b->data + b->size;
+	b->buffer.size = b->size;
+	return 0;
+}
+
+/* data starts at sample start of the buffer */
+static void simd_check_buffer_start(struct simd_check_buffer *b,
+				    uint32_t start, int sample_bytes)
+{
+	uint8_t *ptr = b->data + start * sample_bytes;
+
+	b->buffer.r_ptr = ptr;
+	b->buffer.w_ptr = ptr;
+}
+
+static void simd_check_random(uint8_t *data, uint32_t bytes)
+{
+	uint32_t i;
+
+	for (i = 0; i < bytes; i++)
+		data[i] = rand();
+}
+
+/* arithmetic right shift of 16 or 32 bit samples, for headroom */
+static void simd_check_shift(uint8_t *data, uint32_t samples,
+			     int sample_bytes, int shift)
+{
+	int16_t *d16 = (int16_t *)data;
+	int32_t *d32 = (int32_t *)data;
+	uint32_t i;
+
+	for (i = 0; i < samples; i++) {
+		if (sample_bytes == sizeof(int16_t))
+			d16[i] >>= shift;
+		else
+			d32[i] >>= shift;
+	}
+}
+
+/* runs the case of every channel count, frame count and run of a check,
+ * what names the case in the errors, returns the failed cases
+ */
+static int simd_check_matrix(const char *lib, const char *what,
+			     int (*check_run)(const void *ctx, int channels,
+					      int frames, int run),
+			     const void *ctx, int *cases)
+{
+	int channels;
+	int frames;
+	int failed = 0;
+	int c;
+	int f;
+	int run;
+	int ret;
+
+	for (c = 0; c < ARRAY_SIZE(simd_check_channels); c++) {
+		channels = simd_check_channels[c];
+		for (f = 0; f < ARRAY_SIZE(simd_check_frames); f++) {
+			frames = simd_check_frames[f];
+			for (run = 0; run < SIMD_CHECK_RUNS; run++) {
+				ret = check_run(ctx, channels, frames, run);
+				if (ret == -ENOMEM)
+					return ret;
+
+				(*cases)++;
+				if (!ret)
+					continue;
+
+				fprintf(stderr, "error: %s %s differs", lib,
+					what);
+				fprintf(stderr, ", %d ch %d frames run %d\n",
+					channels, frames, run);
+				failed++;
+			}
+		}
+	}
+
+	return failed;
+}
+
+static void simd_check_gains(struct comp_data *cd, int channels, int run)
+{
+	int i;
+
+	for (i = 0; i < channels; i++) {
+		switch ((run + i) % 4) {
+		case 0:
+			/* saturates every format */
+			cd->volume[i] = VOL_MAX;
+			break;
+		case 1:
+			cd->volume[i] = VOL_ZERO_DB;
+			break;
+		default:
+			cd->volume[i] = rand() % (VOL_MAX + 1);
+			break;
+		}
+	}
+}
+
+struct simd_check_volume {
+	const struct comp_func_map *ref;
+	const struct comp_func_map *opt;
+};
+
+/* runs one processing function of both modules on the same data */
+static int simd_check_volume_run(const void *ctx, int channels, int frames,
+				 int run)
+{
+	const struct comp_func_map *ref =
+		((const struct simd_check_volume *)ctx)->ref;
+	const struct comp_func_map *opt =
+		((const struct simd_check_volume *)ctx)->opt;
+	struct simd_check_buffer source;
+	struct simd_check_buffer sink_ref;
+	struct simd_check_buffer sink_opt;
+	struct comp_data cd;
+	struct comp_dev dev;
+	uint32_t samples = channels * frames;
+	int in_bytes = simd_check_sample_bytes(ref->source);
+	int out_bytes = simd_check_sample_bytes(ref->sink);
+	uint32_t start;
+	int ret;
+
+	memset(&dev, 0, sizeof(dev));
+	memset(&cd, 0, sizeof(cd));
+	dev.params.channels = channels;
+	dev.private = &cd;
+	simd_check_gains(&cd, channels, run);
+
+	ret = simd_check_buffer_init(&source, samples, in_bytes);
+	if (ret < 0)
+		return ret;
+	ret = simd_check_buffer_init(&sink_ref, samples, out_bytes);
+	if (ret < 0)
+		goto free_source;
+	ret = simd_check_buffer_init(&sink_opt, samples, out_bytes);
+	if (ret < 0)
+		goto free_sink_ref;
+
+	simd_check_random(source.data, source.size);
+
+	/* linear on the first run, then wrapping after 1 to all samples */
+	start = run ? SIMD_CHECK_SPARE + rand() % samples : 0;
+	simd_check_buffer_start(&source, start, in_bytes);
+	start = run ? SIMD_CHECK_SPARE + rand() % samples : 0;
+	simd_check_buffer_start(&sink_ref, start, out_bytes);
+	simd_check_buffer_start(&sink_opt, start, out_bytes);
+
+	ref->func(&dev, &sink_ref.buffer, &source.buffer, frames);
+	opt->func(&dev, &sink_opt.buffer, &source.buffer, frames);
+
+	if (memcmp(sink_ref.data, sink_opt.data,
+		   sink_ref.size + SIMD_CHECK_GUARD))
+		ret = -EINVAL;
+
+	free(sink_opt.data);
+free_sink_ref:
+	free(sink_ref.data);
+free_source:
+	free(source.data);
+	return ret;
+}
+
+static int simd_check_volume(void *ref, void *opt, const char *lib)
+{
+	const struct comp_func_map *ref_map = dlsym(ref, "func_map");
+	const size_t *ref_count = dlsym(ref, "func_count");
+	const struct comp_func_map *map = dlsym(opt, "func_map");
+	const size_t *count = dlsym(opt, "func_count");
+	struct simd_check_volume vol;
+	char what[SIMD_CHECK_WHAT_SIZE];
+	int failed = 0;
+	int cases = 0;
+	size_t i;
+	size_t j;
+	int ret;
+
+	if (!ref_map || !ref_count || !map || !count) {
+		fprintf(stderr, "error: %s has no func_map\n", lib);
+		return -EINVAL;
+	}
+
+	for (i = 0; i < *ref_count; i++) {
+		for (j = 0; j < *count; j++)
+			if (map[j].source == ref_map[i].source &&
+			    map[j].sink == ref_map[i].sink)
+				break;
+
+		if (j == *count) {
+			fprintf(stderr, "error: %s has no %u to %u function\n",
+				lib, ref_map[i].source, ref_map[i].sink);
+			failed++;
+			continue;
+		}
+
+		vol.ref = &ref_map[i];
+		vol.opt = &map[j];
+		sprintf(what, "%u to %u", ref_map[i].source, ref_map[i].sink);
+		ret = simd_check_matrix(lib, what, simd_check_volume_run, &vol,
+					&cases);
+		if (ret < 0)
+			return ret;
+		failed += ret;
+	}
+
+	printf("%s: %d cases, %d failed\n", lib, cases, failed);
+	return failed ? -EINVAL : 0;
+}
+
+struct simd_check_mix {
+	const struct mixer_func_map *ref;
+	const struct mixer_func_map *opt;
+};
+
+static int32_t simd_check_mix_gain(int source, int run)
+{
+	switch ((run + source) % 4) {
+	case 0:
+		return MIXER_GAIN_UNITY;
+	case 1:
+		/* saturates the sink */
+		return MIXER_GAIN_MAX;
+	case 2:
+		return 0;
+	default:
+		return rand() % (MIXER_GAIN_MAX + 1);
+	}
+}
+
+/* mixes run + 1 sources with both modules and saturates to the sink */
+static int simd_check_mix_run(const void *ctx, int channels, int frames,
+			      int run)
+{
+	const struct simd_check_mix *mix = ctx;
+	int sample_bytes = mix->ref->frame_fmt == SOF_IPC_FRAME_S16_LE ?
+		sizeof(int16_t) : sizeof(int32_t);
+	uint32_t samples = channels * frames;
+	size_t src_bytes = (samples + SIMD_CHECK_SPARE) * sample_bytes;
+	size_t acc_bytes = (samples + SIMD_CHECK_SPARE) * sample_bytes * 2 +
+		SIMD_CHECK_GUARD;
+	uint8_t *src = malloc(src_bytes * SIMD_CHECK_MIX_SOURCES);
+	uint8_t *acc_ref = malloc(acc_bytes);
+	uint8_t *acc_opt = malloc(acc_bytes);
+	uint8_t *sink_ref = malloc(src_bytes + SIMD_CHECK_GUARD);
+	uint8_t *sink_opt = malloc(src_bytes + SIMD_CHECK_GUARD);
+	const uint8_t *x;
+	int32_t gain;
+	int offset;
+	int ret = -ENOMEM;
+	int i;
+
+	if (!src || !acc_ref || !acc_opt || !sink_ref || !sink_opt)
+		goto out;
+
+	simd_check_random(src, src_bytes * SIMD_CHECK_MIX_SOURCES);
+	memset(acc_ref, SIMD_CHECK_FILL, acc_bytes);
+	memset(acc_opt, SIMD_CHECK_FILL, acc_bytes);
+	memset(sink_ref, SIMD_CHECK_FILL, src_bytes + SIMD_CHECK_GUARD);
+	memset(sink_opt, SIMD_CHECK_FILL, src_bytes + SIMD_CHECK_GUARD);
+
+	/* unaligned sources after the first run */
+	for (i = 0; i <= run % SIMD_CHECK_MIX_SOURCES; i++) {
+		offset = run ? rand() % SIMD_CHECK_SPARE : 0;
+		x = src + i * src_bytes + offset * sample_bytes;
+		gain = simd_check_mix_gain(i, run);
+		mix->ref->acc_func(acc_ref, x, gain, samples, !i);
+		mix->opt->acc_func(acc_opt, x, gain, samples, !i);
+	}
+
+	offset = run ? rand() % SIMD_CHECK_SPARE : 0;
+	mix->ref->sat_func(sink_ref + offset * sample_bytes, acc_ref, samples);
+	mix->opt->sat_func(sink_opt + offset * sample_bytes, acc_opt, samples);
+
+	ret = memcmp(acc_ref, acc_opt, acc_bytes) ||
+		memcmp(sink_ref, sink_opt, src_bytes + SIMD_CHECK_GUARD) ?
+		-EINVAL : 0;
+
+out:
+	free(src);
+	free(acc_ref);
+	free(acc_opt);
+	free(sink_ref);
+	free(sink_opt);
+	return ret;
+}
+
+static int simd_check_mixer(void *ref, void *opt, const char *lib)
+{
+	const struct mixer_func_map *ref_map = dlsym(ref, "mixer_func_map");
+	const size_t *ref_count = dlsym(ref, "mixer_func_count");
+	const struct mixer_func_map *map = dlsym(opt, "mixer_func_map");
+	const size_t *count = dlsym(opt, "mixer_func_count");
+	struct simd_check_mix mix;
+	char what[SIMD_CHECK_WHAT_SIZE];
+	int failed = 0;
+	int cases = 0;
+	size_t i;
+	size_t j;
+	int ret;
+
+	if (!ref_map || !ref_count || !map || !count) {
+		fprintf(stderr, "error: %s has no mixer_func_map\n", lib);
+		return -EINVAL;
+	}
+
+	for (i = 0; i < *ref_count; i++) {
+		for (j = 0; j < *count; j++)
+			if (map[j].frame_fmt == ref_map[i].frame_fmt)
+				break;
+
+		if (j == *count) {
+			fprintf(stderr, "error: %s has no format %u\n", lib,
+				ref_map[i].frame_fmt);
+			failed++;
+			continue;
+		}
+
+		mix.ref = &ref_map[i];
+		mix.opt = &map[j];
+		sprintf(what, "mixing format %u", ref_map[i].frame_fmt);
+		ret = simd_check_matrix(lib, what, simd_check_mix_run, &mix,
+					&cases);
+		if (ret < 0)
+			return ret;
+		failed += ret;
+	}
+
+	printf("%s: %d cases, %d failed\n", lib, cases, failed);
+	return failed ? -EINVAL : 0;
+}
+
+/* random coefficients, 16 or 32 bits as the module is built with */
+static uint8_t simd_check_src_coefs[SIMD_CHECK_SRC_TAPS * sizeof(int32_t)];
+
+/* stages shaped like the coefficient tables, the last one has sub-filters
+ * with taps left after the full vectors
+ */
+static struct src_stage simd_check_src_stages[] = {
+	/* idm, odm, sub-filters, sub-filter length, filter length, blk_in,
+	 * blk_out, halfband, shift, coefficients
+	 */
+	{1, 0, 1, 200, 200, 2, 1, 0, 1, simd_check_src_coefs},
+	{1, 3, 20, 24, 480, 7, 20, 0, 0, simd_check_src_coefs},
+	{19, 20, 21, 52, 1092, 20, 21, 0, 0, simd_check_src_coefs},
+	{2, 1, 3, 13, 39, 6, 3, 0, 0, simd_check_src_coefs},
+};
+
+struct simd_check_src_func {
+	const char *name;
+	int sample_bytes; /* of the source and sink */
+};
+
+static const struct simd_check_src_func simd_check_src_funcs[] = {
+	{"src_polyphase_stage_cir", sizeof(int32_t)},
+	{"src_polyphase_stage_cir_s16", sizeof(int16_t)},
+};
+
+/* delay lines, source and sink of a stage in one block ended by a guard */
+struct simd_check_src {
+	struct src_state state;
+	struct src_stage_prm prm;
+	uint8_t *data;
+	size_t size;
+};
+
+/* lays out a stage of times blocks of nch channels in src->data */
+static int simd_check_src_init(struct simd_check_src *src,
+			       struct src_stage *stage, int sample_bytes,
+			       int nch, int times)
+{
+	int fir_frames = stage->subfilter_length + stage->blk_in +
+		(stage->num_of_subfilters - 1) * stage->idm;
+	int out_frames = 1 + (stage->num_of_subfilters - 1) * stage->odm;
+	int x_frames = times * stage->blk_in + SIMD_CHECK_SPARE;
+	int y_frames = times * stage->num_of_subfilters + SIMD_CHECK_SPARE;
+	uint8_t *ptr;
+
+	memset(src, 0, sizeof(*src));
+	src->state.fir_delay_size = fir_frames * nch;
+	src->state.out_delay_size = out_frames * nch;
+	src->prm.x_size = x_frames * nch * sample_bytes;
+	src->prm.y_size = y_frames * nch * sample_bytes;
+	src->size = (src->state.fir_delay_size + src->state.out_delay_size) *
+		sizeof(int32_t) + src->prm.x_size + src->prm.y_size;
+	src->data = malloc(src->size + SIMD_CHECK_GUARD);
+	if (!src->data)
+		return -ENOMEM;
+
+	ptr = src->data;
+	src->state.fir_delay = (int32_t *)ptr;
+	ptr += src->state.fir_delay_size * sizeof(int32_t);
+	src->state.out_delay = (int32_t *)ptr;
+	ptr += src->state.out_delay_size * sizeof(int32_t);
+	src->prm.x_rptr = ptr;
+	src->prm.x_end_addr = ptr + src->prm.x_size;
+	ptr += src->prm.x_size;
+	src->prm.y_addr = ptr;
+	src->prm.y_wptr = ptr;
+	src->prm.y_end_addr = ptr + src->prm.y_size;
+
+	src->prm.nch = nch;
+	src->prm.times = times;
+	src->prm.state = &src->state;
+	src->prm.stage = stage;
+	return 0;
+}
+
+/* same stage as src in the block of copy, with the same data */
+static void simd_check_src_copy(struct simd_check_src *copy,
+				const struct simd_check_src *src)
+{
+	uint8_t *data = copy->data;
+	ptrdiff_t offset = data - src->data;
+
+	*copy = *src;
+	copy->data = data;
+	memcpy(copy->data, src->data, src->size + SIMD_CHECK_GUARD);
+	copy->state.fir_delay = (int32_t *)((uint8_t *)src->state.fir_delay +
+					    offset);
+	copy->state.out_delay = (int32_t *)((uint8_t *)src->state.out_delay +
+					    offset);
+	copy->state.fir_wp = (int32_t *)((uint8_t *)src->state.fir_wp +
+					 offset);
+	copy->state.out_rp = (int32_t *)((uint8_t *)src->state.out_rp +
+					 offset);
+	copy->prm.x_rptr = (uint8_t *)src->prm.x_rptr + offset;
+	copy->prm.x_end_addr = (uint8_t *)src->prm.x_end_addr + offset;
+	copy->prm.y_addr = (uint8_t *)src->prm.y_addr + offset;
+	copy->prm.y_wptr = (uint8_t *)src->prm.y_wptr + offset;
+	copy->prm.y_end_addr = (uint8_t *)src->prm.y_end_addr + offset;
+	copy->prm.state = &copy->state;
+}
+
+/*
+ * Random delay lines and source, all of them wrap at a random frame after
+ * the first run. Odd runs of the 32 bit stage take s24 data and the later
+ * runs have headroom, so the full scale first run is not the only one and
+ * not every output saturates.
+ */
+static void simd_check_src_data(struct simd_check_src *src, int sample_bytes,
+				int run)
+{
+	int nch = src->prm.nch;
+	int fir_frames = src->state.fir_delay_size / nch;
+	int out_frames = src->state.out_delay_size / nch;
+	int x_frames = src->prm.x_size / sample_bytes / nch;
+	int y_frames = src->prm.y_size / sample_bytes / nch;
+	int headroom = (run / 2) * (sample_bytes == sizeof(int16_t) ? 4 : 8);
+
+	memset(src->data, SIMD_CHECK_FILL, src->size + SIMD_CHECK_GUARD);
+	simd_check_random(src->data, src->size - src->prm.y_size);
+	simd_check_random(simd_check_src_coefs, sizeof(simd_check_src_coefs));
+
+	/* s->shift of the 32 bit stage is 8 for s24 */
+	src->prm.shift = sample_bytes == sizeof(int32_t) && (run & 1) ? 8 : 0;
+	simd_check_shift((uint8_t *)src->state.fir_delay,
+			 src->state.fir_delay_size +
+			 src->state.out_delay_size, sizeof(int32_t),
+			 (run / 2) * 8);
+	simd_check_shift(src->prm.x_rptr, x_frames * nch, sample_bytes,
+			 headroom + src->prm.shift);
+
+	/* the write pointer is at the last sample of a frame */
+	src->state.fir_wp = src->state.fir_delay +
+		(run ? rand() % fir_frames : fir_frames - 1) * nch + nch - 1;
+	src->state.out_rp = src->state.out_delay +
+		(run ? rand() % out_frames : 0) * nch;
+	src->prm.x_rptr = (uint8_t *)src->prm.x_rptr +
+		(run ? rand() % x_frames : 0) * nch * sample_bytes;
+	src->prm.y_wptr = (uint8_t *)src->prm.y_wptr +
+		(run ? rand() % y_frames : 0) * nch * sample_bytes;
+}
+
+/* stage function of both modules on a stage, blocks are the frames */
+struct simd_check_src_case {
+	void (*ref)(struct src_stage_prm *s);
+	void (*opt)(struct src_stage_prm *s);
+	struct src_stage *stage;
+	int sample_bytes;
+};
+
+/* runs one stage function of both modules on the same data */
+static int simd_check_src_run(const void *ctx, int nch, int times, int run)
+{
+	const struct simd_check_src_case *sc = ctx;
+	struct src_stage *stage = sc->stage;
+	int sample_bytes = sc->sample_bytes;
+	struct simd_check_src src_ref;
+	struct simd_check_src src_opt;
+	int ret;
+
+	ret = simd_check_src_init(&src_ref, stage, sample_bytes, nch, times);
+	if (ret < 0)
+		return ret;
+	ret = simd_check_src_init(&src_opt, stage, sample_bytes, nch, times);
+	if (ret < 0)
+		goto free_ref;
+
+	simd_check_src_data(&src_ref, sample_bytes, run);
+	simd_check_src_copy(&src_opt, &src_ref);
+
+	sc->ref(&src_ref.prm);
+	sc->opt(&src_opt.prm);
+
+	/* delay lines, sink and guard */
+	if (memcmp(src_ref.data, src_opt.data, src_ref.size + SIMD_CHECK_GUARD))
+		ret = -EINVAL;
+
+	free(src_opt.data);
+free_ref:
+	free(src_ref.data);
+	return ret;
+}
+
+static int simd_check_src(void *ref, void *opt, const char *lib)
+{
+	const struct simd_check_src_func *func;
+	struct simd_check_src_case sc;
+	char what[SIMD_CHECK_WHAT_SIZE];
+	int failed = 0;
+	int cases = 0;
+	int ret;
+	int st;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(simd_check_src_funcs); i++) {
+		func = &simd_check_src_funcs[i];
+		sc.ref = dlsym(ref, func->name);
+		sc.opt = dlsym(opt, func->name);
+		sc.sample_bytes = func->sample_bytes;
+		if (!sc.ref || !sc.opt) {
+			fprintf(stderr, "error: %s has no %s\n", lib,
+				func->name);
+			return -EINVAL;
+		}
+
+		for (st = 0; st < ARRAY_SIZE(simd_check_src_stages); st++) {
+			sc.stage = &simd_check_src_stages[st];
+			sprintf(what, "%s stage %d", func->name, st);
+			ret = simd_check_matrix(lib, what, simd_check_src_run,
+						&sc, &cases);
+			if (ret < 0)
+				return ret;
+			failed += ret;
+		}
+	}
+
+	printf("%s: %d cases, %d failed\n", lib, cases, failed);
+	return failed ? -EINVAL : 0;
+}
+
+/* taps of the channel filters, zero is a channel without a response and
+ * the others leave taps after the full vectors or are the longest filter
+ */
+static const int simd_check_fir_lengths[] = {
+	1, 3, 0, 4, 7, 8, 16, 37, SOF_EQ_FIR_MAX_LENGTH
+};
+
+struct simd_check_fir_func {
+	const char *name;
+	uint16_t fmt; /* of the source and sink */
+};
+
+static const struct simd_check_fir_func simd_check_fir_funcs[] = {
+	{"eq_fir_s16", SOF_IPC_FRAME_S16_LE},
+	{"eq_fir_s24", SOF_IPC_FRAME_S24_4LE},
+	{"eq_fir_s32", SOF_IPC_FRAME_S32_LE},
+};
+
+/* block FIR of a module and the setup of its filters */
+struct simd_check_fir {
+	void (*func)(struct fir_state_32x16 fir[], struct comp_buffer *source,
+		     struct comp_buffer *sink, int frames, int nch);
+	void (*reset)(struct fir_state_32x16 *fir);
+	size_t (*init_coef)(struct fir_state_32x16 *fir,
+			    struct sof_eq_fir_coef_data *config);
+	void (*init_delay)(struct fir_state_32x16 *fir, int32_t **data);
+};
+
+struct simd_check_fir_case {
+	struct simd_check_fir ref;
+	struct simd_check_fir opt;
+	uint16_t fmt;
+};
+
+static int simd_check_fir_get(void *handle, const char *lib,
+			      const char *name, struct simd_check_fir *fir)
+{
+	fir->func = dlsym(handle, name);
+	fir->reset = dlsym(handle, "fir_reset");
+	fir->init_coef = dlsym(handle, "fir_init_coef");
+	fir->init_delay = dlsym(handle, "fir_init_delay");
+	if (!fir->func || !fir->reset || !fir->init_coef ||
+	    !fir->init_delay) {
+		fprintf(stderr, "error: %s has no %s\n", lib, name);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* sets up the channel filters of a module from the configs */
+static void simd_check_fir_init(const struct simd_check_fir *fir,
+				struct fir_state_32x16 state[],
+				uint8_t *config, size_t config_size,
+				int32_t *delay, int channels)
+{
+	struct sof_eq_fir_coef_data *coef;
+	int ch;
+
+	for (ch = 0; ch < channels; ch++) {
+		coef = (struct sof_eq_fir_coef_data *)(config +
+						       ch * config_size);
+		fir->reset(&state[ch]);
+		if (coef->length) {
+			fir->init_coef(&state[ch], coef);
+			fir->init_delay(&state[ch], &delay);
+		}
+	}
+}
+
+/* random coefficients and output shifts of the channel filters */
+static void simd_check_fir_config(uint8_t *config, size_t config_size,
+				  int channels, int run)
+{
+	const int lengths = ARRAY_SIZE(simd_check_fir_lengths);
+	struct sof_eq_fir_coef_data *coef;
+	int length;
+	int ch;
+
+	for (ch = 0; ch < channels; ch++) {
+		coef = (struct sof_eq_fir_coef_data *)(config +
+						       ch * config_size);
+		length = simd_check_fir_lengths[(run + ch) % lengths];
+		coef->length = length;
+		coef->out_shift = (run + ch) % 3;
+		simd_check_random((uint8_t *)(coef + 1),
+				  length * sizeof(int16_t));
+	}
+}
+
+/*
+ * Filters the frames with both modules, a second time with new data that
+ * starts from the history of the first call. The first run is full scale,
+ * the later ones have more headroom so that not every output saturates.
+ */
+static int simd_check_fir_run(const void *ctx, int channels, int frames,
+			      int run)
+{
+	const struct simd_check_fir_case *fc = ctx;
+	struct fir_state_32x16 fir_ref[PLATFORM_MAX_CHANNELS];
+	struct fir_state_32x16 fir_opt[PLATFORM_MAX_CHANNELS];
+	struct simd_check_buffer source;
+	struct simd_check_buffer sink_ref;
+	struct simd_check_buffer sink_opt;
+	size_t config_size = sizeof(struct sof_eq_fir_coef_data) +
+		SOF_EQ_FIR_MAX_LENGTH * sizeof(int16_t);
+	size_t delay_size = FIR_DELAY_LENGTH(SOF_EQ_FIR_MAX_LENGTH) *
+		channels * sizeof(int32_t);
+	uint8_t *config = malloc(config_size * channels);
+	int32_t *delay_ref = malloc(delay_size);
+	int32_t *delay_opt = malloc(delay_size);
+	uint32_t samples = channels * frames;
+	int sample_bytes = simd_check_sample_bytes(fc->fmt);
+	uint32_t start;
+	int call;
+	int ret = -ENOMEM;
+
+	if (!config || !delay_ref || !delay_opt)
+		goto free_config;
+
+	simd_check_fir_config(config, config_size, channels, run);
+	simd_check_fir_init(&fc->ref, fir_ref, config, config_size, delay_ref,
+			    channels);
+	simd_check_fir_init(&fc->opt, fir_opt, config, config_size, delay_opt,
+			    channels);
+
+	ret = simd_check_buffer_init(&source, samples, sample_bytes);
+	if (ret < 0)
+		goto free_config;
+	ret = simd_check_buffer_init(&sink_ref, samples, sample_bytes);
+	if (ret < 0)
+		goto free_source;
+	ret = simd_check_buffer_init(&sink_opt, samples, sample_bytes);
+	if (ret < 0)
+		goto free_sink_ref;
+
+	/* linear on the first run, then wrapping after 1 to all samples */
+	start = run ? SIMD_CHECK_SPARE + rand() % samples : 0;
+	simd_check_buffer_start(&source, start, sample_bytes);
+	start = run ? SIMD_CHECK_SPARE + rand() % samples : 0;
+	simd_check_buffer_start(&sink_ref, start, sample_bytes);
+	simd_check_buffer_start(&sink_opt, start, sample_bytes);
+
+	for (call = 0; call < SIMD_CHECK_FIR_CALLS; call++) {
+		simd_check_random(source.data, source.size);
+		simd_check_shift(source.data, source.size / sample_bytes,
+				 sample_bytes, run * sample_bytes * 2);
+
+		fc->ref.func(fir_ref, &source.buffer, &sink_ref.buffer, frames,
+			     channels);
+		fc->opt.func(fir_opt, &source.buffer, &sink_opt.buffer, frames,
+			     channels);
+
+		if (memcmp(sink_ref.data, sink_opt.data,
+			   sink_ref.size + SIMD_CHECK_GUARD))
+			ret = -EINVAL;
+	}
+
+	free(sink_opt.data);
+free_sink_ref:
+	free(sink_ref.data);
+free_source:
+	free(source.data);
+free_config:
+	free(config);
+	free(delay_ref);
+	free(delay_opt);
+	return ret;
+}
+
+static int simd_check_fir(void *ref, void *opt, const char *lib)
+{
+	const struct simd_check_fir_func *func;
+	struct simd_check_fir_case fc;
+	int failed = 0;
+	int cases = 0;
+	int ret;
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(simd_check_fir_funcs); i++) {
+		func = &simd_check_fir_funcs[i];
+		if (simd_check_fir_get(ref, lib, func->name, &fc.ref) < 0 ||
+		    simd_check_fir_get(opt, lib, func->name, &fc.opt) < 0)
+			return -EINVAL;
+
+		fc.fmt = func->fmt;
+		ret = simd_check_matrix(lib, func->name, simd_check_fir_run,
+					&fc, &cases);
+		if (ret < 0)
+			return ret;
+		failed += ret;
+	}
+
+	printf("%s: %d FIR cases, %d failed\n", lib, cases, failed);
+	return failed ? -EINVAL : 0;
+}
+
+/* FFT of the FIR module, the radix-4 stages have the SIMD back ends */
+struct simd_check_fft {
+	struct fft_plan *(*plan_new)(uint32_t size);
+	void (*plan_free)(struct fft_plan *plan);
+	void (*execute)(struct fft_plan *plan, struct icomplex32 *data,
+			int ifft, int scale);
+	void (*real_execute)(struct fft_plan *plan, struct icomplex32 *data,
+			     int ifft, int scale);
+};
+
+static int simd_check_fft_get(void *handle, const char *lib,
+			      struct simd_check_fft *fft)
+{
+	fft->plan_new = dlsym(handle, "fft_plan_new");
+	fft->plan_free = dlsym(handle, "fft_plan_free");
+	fft->execute = dlsym(handle, "fft_execute_32");
+	fft->real_execute = dlsym(handle, "fft_real_execute_32");
+	if (!fft->plan_new || !fft->plan_free || !fft->execute ||
+	    !fft->real_execute) {
+		fprintf(stderr, "error: %s has no FFT\n", lib);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* full scale input on the first run, then with headroom for no scaling */
+static void simd_check_fft_data(struct icomplex32 *data, uint32_t count,
+				uint32_t len, int run)
+{
+	uint32_t i;
+
+	simd_check_random((uint8_t *)data, count * sizeof(*data));
+	if (!run)
+		return;
+
+	for (i = 0; i < count; i++) {
+		data[i].real >>= len;
+		data[i].imag >>= len;
+	}
+}
+
+/* runs complex and real transforms of both modules on the same data */
+static int simd_check_fft_run(const struct simd_check_fft *ref,
+			      const struct simd_check_fft *opt,
+			      uint32_t size, int ifft, int scale, int run)
+{
+	struct fft_plan *ref_plan = ref->plan_new(size);
+	struct fft_plan *opt_plan = opt->plan_new(size);
+	size_t bytes = (size + 1) * sizeof(struct icomplex32) +
+		SIMD_CHECK_GUARD;
+	uint8_t *ref_data = malloc(bytes);
+	uint8_t *opt_data = malloc(bytes);
+	int ret = -ENOMEM;
+
+	if (!ref_plan || !opt_plan || !ref_data || !opt_data)
+		goto out;
+
+	memset(ref_data, SIMD_CHECK_FILL, bytes);
+	simd_check_fft_data((struct icomplex32 *)ref_data, size,
+			    ref_plan->len, run);
+	memcpy(opt_data, ref_data, bytes);
+	ref->execute(ref_plan, (struct icomplex32 *)ref_data, ifft, scale);
+	opt->execute(opt_plan, (struct icomplex32 *)opt_data, ifft, scale);
+	ret = memcmp(ref_data, opt_data, bytes) ? -EINVAL : 0;
+
+	/* the real transform takes size / 2 + 1 elements */
+	memset(ref_data, SIMD_CHECK_FILL, bytes);
+	simd_check_fft_data((struct icomplex32 *)ref_data, size / 2 + 1,
+			    ref_plan->len, run);
+	memcpy(opt_data, ref_data, bytes);
+	ref->real_execute(ref_plan, (struct icomplex32 *)ref_data, ifft,
+			  scale);
+	opt->real_execute(opt_plan, (struct icomplex32 *)opt_data, ifft,
+			  scale);
+	if (memcmp(ref_data, opt_data, bytes))
+		ret = -EINVAL;
+
+out:
+	free(ref_data);
+	free(opt_data);
+	if (ref_plan)
+		ref->plan_free(ref_plan);
+	if (opt_plan)
+		opt->plan_free(opt_plan);
+	return ret;
+}
+
+/* checks one FFT size, returns the failed cases */
+static int simd_check_fft_size(const char *lib,
+			       const struct simd_check_fft *ref,
+			       const struct simd_check_fft *opt,
+			       uint32_t size, int *cases)
+{
+	int failed = 0;
+	int mode;
+	int run;
+	int ret;
+
+	/* mode bit 0 is the inverse transform and bit 1 the scaling */
+	for (mode = 0; mode < 4; mode++) {
+		for (run = 0; run < SIMD_CHECK_FFT_RUNS; run++) {
+			ret = simd_check_fft_run(ref, opt, size, mode & 1,
+						 mode >> 1, run);
+			if (ret == -ENOMEM)
+				return ret;
+
+			(*cases)++;
+			if (!ret)
+				continue;
+
+			fprintf(stderr, "error: %s FFT differs, size %u",
+				lib, size);
+			fprintf(stderr, " ifft %d scale %d run %d\n",
+				mode & 1, mode >> 1, run);
+			failed++;
+		}
+	}
+
+	return failed;
+}
+
+static int simd_check_fft(void *ref, void *opt, const char *lib)
+{
+	struct simd_check_fft ref_fft;
+	struct simd_check_fft fft;
+	uint32_t size;
+	int failed = 0;
+	int cases = 0;
+	int ret;
+
+	if (simd_check_fft_get(ref, lib, &ref_fft) < 0 ||
+	    simd_check_fft_get(opt, lib, &fft) < 0)
+		return -EINVAL;
+
+	for (size = FFT_SIZE_MIN; size <= FFT_SIZE_MAX; size *= 2) {
+		ret = simd_check_fft_size(lib, &ref_fft, &fft, size, &cases);
+		if (ret < 0)
+			return ret;
+		failed += ret;
+	}
+
+	printf("%s: %d FFT cases, %d failed\n", lib, cases, failed);
+	return failed ? -EINVAL : 0;
+}
+
+/* biquads {a2, a1, b2, b1, b0, shift, gain} of a 50 Hz high-pass with
+ * +20 dB gain that saturates, a 1 kHz low-pass, a +12 dB peak at 3 kHz
+ * and a -12 dB notch at 200 Hz, the last two with attenuating shifts
+ */
+static const int32_t simd_check_iir_biquads[][SOF_EQ_IIR_NBIQUAD_DF2T] = {
+	{-1063849117, 2137545158, 535660909, -1071321817, 535660909,
+	 -4, 20432},
+	{-892260367, 1949182770, 4204855, 8409711, 4204855,
+	 0, 16384},
+	{-885823389, 1810402193, 605724225, -1810402193, 1353840988,
+	 1, 16384},
+	{-1046062543, 2119077963, 1056425823, -2119077963, 1063378544,
+	 2, 23170},
+};
+
+struct simd_check_iir_response {
+	uint32_t sections; /* biquads of the response */
+	uint32_t in_series; /* biquads in series in a section */
+};
+
+/* responses of the channels, a lane group mixes them so that the shorter
+ * ones are padded, zero sections is a channel without a response
+ */
+static const struct simd_check_iir_response simd_check_iir_responses[] = {
+	{1, 1},
+	{4, 2},
+	{0, 0},
+	{2, 2},
+	{6, 3},
+	{3, 1},
+};
+
+/* channel parallel DF2T of a module and the setup of its lanes */
+struct simd_check_iir {
+	void (*func)(struct iir_lanes_df2t *iir, int32_t x[], int32_t y[],
+		     int frames);
+	void (*reset)(struct iir_state_df2t *iir);
+	size_t (*init_coef)(struct iir_state_df2t *iir,
+			    struct sof_eq_iir_header_df2t *config);
+	int (*init_lanes)(struct iir_lanes_df2t *lanes,
+			  struct iir_state_df2t iir[], int nch);
+	void (*init_delay_lanes)(struct iir_lanes_df2t *lanes,
+				 struct iir_state_df2t iir[],
+				 int64_t **delay);
+};
+
+struct simd_check_iir_case {
+	struct simd_check_iir ref;
+	struct simd_check_iir opt;
+};
+
+/* channel filters and lane groups of a module */
+struct simd_check_iir_state {
+	struct iir_state_df2t iir[PLATFORM_MAX_CHANNELS];
+	struct iir_lanes_df2t lanes[PLATFORM_MAX_CHANNELS / IIR_DF2T_LANES];
+	int64_t *delay; /* delay lines followed by the coefficients */
+	size_t size;
+};
+
+static int simd_check_iir_get(void *handle, const char *lib,
+			      struct simd_check_iir *iir)
+{
+	iir->func = dlsym(handle, "iir_df2t_lanes");
+	iir->reset = dlsym(handle, "iir_reset_df2t");
+	iir->init_coef = dlsym(handle, "iir_init_coef_df2t");
+	iir->init_lanes = dlsym(handle, "iir_init_coef_lanes_df2t");
+	iir->init_delay_lanes = dlsym(handle, "iir_init_delay_lanes_df2t");
+	if (!iir->func || !iir->reset || !iir->init_coef ||
+	    !iir->init_lanes || !iir->init_delay_lanes) {
+		fprintf(stderr, "error: %s has no iir_df2t_lanes\n", lib);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* responses of the channels, the biquads differ between channels */
+static void simd_check_iir_config(uint8_t *config, size_t config_size,
+				  int channels, int run)
+{
+	const int responses = ARRAY_SIZE(simd_check_iir_responses);
+	const int biquads = ARRAY_SIZE(simd_check_iir_biquads);
+	const struct simd_check_iir_response *response;
+	struct sof_eq_iir_header_df2t *eq;
+	int32_t *coef;
+	int ch;
+	int i;
+
+	for (ch = 0; ch < channels; ch++) {
+		eq = (struct sof_eq_iir_header_df2t *)(config +
+						       ch * config_size);
+		response = &simd_check_iir_responses[(run + ch) % responses];
+		memset(eq, 0, config_size);
+		eq->num_sections = response->sections;
+		eq->num_sections_in_series = response->in_series;
+
+		coef = (int32_t *)(eq + 1);
+		for (i = 0; i < response->sections; i++)
+			memcpy(coef + i * SOF_EQ_IIR_NBIQUAD_DF2T,
+			       simd_check_iir_biquads[(ch + i) % biquads],
+			       sizeof(simd_check_iir_biquads[0]));
+	}
+}
+
+/* sets up the lane groups of a module like the eq_iir component does */
+static int simd_check_iir_init(const struct simd_check_iir *fn,
+			       struct simd_check_iir_state *st,
+			       uint8_t *config, size_t config_size,
+			       int channels)
+{
+	struct sof_eq_iir_header_df2t *eq;
+	int64_t *delay;
+	int nch;
+	int ret;
+	int ch;
+	int g;
+
+	for (ch = 0; ch < channels; ch++) {
+		eq = (struct sof_eq_iir_header_df2t *)(config +
+						       ch * config_size);
+		fn->reset(&st->iir[ch]);
+		if (eq->num_sections)
+			fn->init_coef(&st->iir[ch], eq);
+	}
+
+	st->size = 0;
+	for (g = 0; g * IIR_DF2T_LANES < channels; g++) {
+		nch = MIN(channels - g * IIR_DF2T_LANES, IIR_DF2T_LANES);
+		ret = fn->init_lanes(&st->lanes[g],
+				     &st->iir[g * IIR_DF2T_LANES], nch);
+		if (ret < 0)
+			return ret;
+		st->size += ret;
+	}
+
+	st->delay = calloc(1, st->size);
+	if (!st->delay)
+		return -ENOMEM;
+
+	delay = st->delay;
+	for (g = 0; g * IIR_DF2T_LANES < channels; g++)
+		fn->init_delay_lanes(&st->lanes[g],
+				     &st->iir[g * IIR_DF2T_LANES], &delay);
+
+	return 0;
+}
+
+/*
+ * Filters the frames of every lane group with both modules in blocks as
+ * the eq_iir component does. The first run is full scale and saturates,
+ * the later ones have more headroom. The outputs of the used lanes, the
+ * delay lines and the coefficients must match.
+ */
+static int simd_check_iir_run(const void *ctx, int channels, int frames,
+			      int run)
+{
+	const struct simd_check_iir_case *ic = ctx;
+	struct simd_check_iir_state *ref = malloc(sizeof(*ref));
+	struct simd_check_iir_state *opt = malloc(sizeof(*opt));
+	int32_t x_ref[IIR_BLOCK_FRAMES * IIR_DF2T_LANES];
+	int32_t x_opt[IIR_BLOCK_FRAMES * IIR_DF2T_LANES];
+	int32_t y_ref[IIR_BLOCK_FRAMES * IIR_DF2T_LANES];
+	int32_t y_opt[IIR_BLOCK_FRAMES * IIR_DF2T_LANES];
+	size_t config_size = sizeof(struct sof_eq_iir_header_df2t) +
+		SOF_EQ_IIR_DF2T_BIQUADS_MAX * SOF_EQ_IIR_NBIQUAD_DF2T *
+		sizeof(int32_t);
+	uint8_t *config = malloc(config_size * channels);
+	struct iir_lanes_df2t *lanes;
+	int remaining;
+	int ret = -ENOMEM;
+	int n;
+	int g;
+	int i;
+
+	if (!ref || !opt || !config)
+		goto free_config;
+
+	ref->delay = NULL;
+	opt->delay = NULL;
+	simd_check_iir_config(config, config_size, channels, run);
+	ret = simd_check_iir_init(&ic->ref, ref, config, config_size,
+				  channels);
+	if (ret < 0)
+		goto free_delay;
+	ret = simd_check_iir_init(&ic->opt, opt, config, config_size,
+				  channels);
+	if (ret < 0)
+		goto free_delay;
+
+	for (g = 0; g * IIR_DF2T_LANES < channels; g++) {
+		lanes = &ref->lanes[g];
+		for (remaining = frames; remaining; remaining -= n) {
+			n = MIN(remaining, IIR_BLOCK_FRAMES);
+			simd_check_random((uint8_t *)x_ref, sizeof(x_ref));
+			for (i = 0; i < ARRAY_SIZE(x_ref); i++)
+				if (i % IIR_DF2T_LANES < lanes->channels)
+					x_ref[i] >>= run * 4;
+				else
+					x_ref[i] = 0;
+			memcpy(x_opt, x_ref, sizeof(x_ref));
+
+			ic->ref.func(&ref->lanes[g], x_ref, y_ref, n);
+			ic->opt.func(&opt->lanes[g], x_opt, y_opt, n);
+
+			for (i = 0; i < n * IIR_DF2T_LANES; i++)
+				if (i % IIR_DF2T_LANES < lanes->channels &&
+				    y_ref[i] != y_opt[i])
+					ret = -EINVAL;
+		}
+	}
+
+	if (ref->size != opt->size ||
+	    memcmp(ref->delay, opt->delay, ref->size))
+		ret = -EINVAL;
+
+free_delay:
+	free(ref->delay);
+	free(opt->delay);
+free_config:
+	free(config);
+	free(ref);
+	free(opt);
+	return ret;
+}
+
+static int simd_check_iir(void *ref, void *opt, const char *lib)
+{
+	struct simd_check_iir_case ic;
+	int cases = 0;
+	int ret;
+
+	if (simd_check_iir_get(ref, lib, &ic.ref) < 0 ||
+	    simd_check_iir_get(opt, lib, &ic.opt) < 0)
+		return -EINVAL;
+
+	ret = simd_check_matrix(lib, "iir_df2t_lanes", simd_check_iir_run, &ic,
+				&cases);
+	if (ret < 0)
+		return ret;
+
+	printf("%s: %d cases, %d failed\n", lib, cases, ret);
+	return ret ? -EINVAL : 0;
+}
+
+/* module and the check of its optimized builds against the generic one */
+struct simd_check {
+	const char *module;
+	int (*check)(void *ref, void *opt, const char *lib);
+};
+
+static const struct simd_check simd_checks[] = {
+	{"volume", simd_check_volume},
+	{"src", simd_check_src},
+	{"mixer", simd_check_mixer},
+	{"eq_fir", simd_check_fir},
+	{"eq_fir", simd_check_fft},
+	{"eq_iir", simd_check_iir},
+};
+
+static int simd_check_module(const struct simd_check *check)
+{
+	char lib[SIMD_CHECK_LIB_SIZE];
+	void *ref;
+	void *opt;
+	int ret = 0;
+	int i;
+
+	ref = simd_check_open(check->module, NULL, lib);
+	if (!ref)
+		return -EINVAL;
+
+	for (i = 0; i < ARRAY_SIZE(simd_check_opts); i++) {
+		opt = simd_check_open(check->module, &simd_check_opts[i], lib);
+		if (opt && check->check(ref, opt, lib) < 0)
+			ret = -EINVAL;
+	}
+
+	return ret;
+}
+
+/* the modules must find the component driver list on load */
+int tb_simd_check(void)
+{
+	int ret = 0;
+	int i;
+
+	srand(1);
+
+	for (i = 0; i < ARRAY_SIZE(simd_checks); i++)
+		if (simd_check_module(&simd_checks[i]) < 0)
+			ret = -EINVAL;
+
+	return ret;
+}
@@ -33,12 +33,23 @@
 #include <sof/list.h>
 #include <getopt.h>
 #include <dlfcn.h>
+#include <unistd.h>
 #include "testbench/common_test.h"
+#include "testbench/core.h"
 #include "testbench/topology.h"
 #include "testbench/trace.h"
 #include "testbench/file.h"
+#include "testbench/profiler.h"
 
-#define TESTBENCH_NCH 2 /* Stereo */
+
+/* scheduling decisions made by the EDF scheduler benchmark */
+#define TESTBENCH_SCHED_BENCH_DECISIONS 100000
+
+/* timer ticks run by the LL scheduler benchmark */
+#define TESTBENCH_SCHED_BENCH_TICKS 10000
+
+/* how often main checks for EOF while cores run the pipelines */
+#define TESTBENCH_POLL_US 1000
 
 /* shared library look up table */
 struct shared_lib_table lib_table[NUM_WIDGETS_SUPPORTED] = {
@@ -106,10 +117,25 @@ static void print_usage(char *executable)
 	printf("-t <tplg_file> -b <input_format> ");
 	printf("-a <comp1=comp1_library,comp2=comp2_library>\n");
 	printf("input_format should be S16_LE, S32_LE, S24_LE or FLOAT_LE\n");
+	printf("raw and .wav files are memory mapped, .wav inputs set ");
+	printf("input_format, rate and channels from their header\n");
 	printf("Example Usage:\n");
 	printf("%s -i in.txt -o out.txt -t test.tplg ", executable);
 	printf("-r 48000 -R 96000 ");
 	printf("-b S16_LE -a vol=libsof_volume.so\n");
+	printf("%s -S <num_tasks> runs the EDF and LL scheduler benchmarks\n",
+	       executable);
+	printf("-T <num_cores> runs every pipeline on a worker thread of its ");
+	printf("core\n");
+	printf("-B <manifest> runs one job per manifest line ");
+	printf("\"<input_file> <output_file> <input_format>\" ");
+	printf("on -j <num_workers> threads\n");
+	printf("-P <period_us> prints a flat profile of the pipeline run, ");
+	printf("sampled with SIGPROF, as samples per function without call ");
+	printf("stacks and not in a perf format\n");
+	printf("%s -V checks the x86 SIMD builds of the modules ",
+	       executable);
+	printf("bit exactly against the generic ones\n");
 }
 
 /* free components */
@@ -142,11 +168,222 @@ static void free_comps(void)
 	}
 }
 
+#if CONFIG_COMP_PERF
+static const char *comp_type_name(uint32_t type)
+{
+	switch (type) {
+	case SOF_COMP_HOST:
+		return "host";
+	case SOF_COMP_DAI:
+		return "dai";
+	case SOF_COMP_VOLUME:
+		return "volume";
+	case SOF_COMP_MIXER:
+		return "mixer";
+	case SOF_COMP_MUX:
+		return "mux";
+	case SOF_COMP_SRC:
+		return "src";
+	case SOF_COMP_TONE:
+		return "tone";
+	case SOF_COMP_SWITCH:
+		return "switch";
+	case SOF_COMP_EQ_IIR:
+		return "eq_iir";
+	case SOF_COMP_EQ_FIR:
+		return "eq_fir";
+	case SOF_COMP_KPB:
+		return "kpb";
+	case SOF_COMP_SELECTOR:
+		return "selector";
+	case SOF_COMP_FILEREAD:
+	case SOF_COMP_FILEWRITE:
+		return "file";
+	default:
+		return "unknown";
+	}
+}
+
+/* print execution time of each component and of the pipeline periods,
+ * library builds count the time in nanoseconds
+ */
+static void print_perf(struct pipeline *p)
+{
+	struct list_item *clist;
+	struct ipc_comp_dev *icd;
+	struct comp_dev *cd;
+	uint64_t total = 0;
+
+	list_for_item(clist, &sof.ipc->shared_ctx->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type == COMP_TYPE_COMPONENT)
+			total += icd->cd->perf_copy.total;
+	}
+
+	printf("Component execution time:\n");
+	printf("%6s %-10s %8s %9s %9s %9s %6s %12s\n", "id", "type",
+	       "copies", "min ns", "avg ns", "max ns", "load", "bytes");
+
+	list_for_item(clist, &sof.ipc->shared_ctx->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type != COMP_TYPE_COMPONENT)
+			continue;
+
+		cd = icd->cd;
+		printf("%6u %-10s %8u %9u %9u %9u %5.1f%% %12llu\n",
+		       cd->comp.id, comp_type_name(cd->comp.type),
+		       cd->perf_copy.count, cd->perf_copy.min,
+		       perf_cnt_avg(&cd->perf_copy), cd->perf_copy.max,
+		       total ? 100.0 * cd->perf_copy.total / total : 0.0,
+		       (unsigned long long)cd->perf_bytes);
+	}
+
+	printf("Pipeline periods: %u, avg %u ns, max %u ns, ",
+	       p->perf_period.count, perf_cnt_avg(&p->perf_period),
+	       p->perf_period.max);
+	printf("budget %u ns, overruns %u\n", p->perf_budget,
+	       p->perf_overruns);
+}
+#endif
+
+static uint64_t tb_time_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+struct tb_pipe_start {
+	struct pipeline *p;
+	struct testbench_prm *tp;
+};
+
+static int tb_pipeline_start_core(void *data)
+{
+	struct tb_pipe_start *start = data;
+
+	return tb_pipeline_start(sof.ipc, start->tp->channels,
+				 &start->p->ipc_pipe, start->tp);
+}
+
+static int tb_pipeline_stop_core(void *data)
+{
+	struct pipeline *p = data;
+	int ret;
+
+	ret = pipeline_trigger(p, p->sched_comp, COMP_TRIGGER_STOP);
+	if (ret < 0)
+		return ret;
+
+	return pipeline_reset(p, p->sched_comp);
+}
+
+/* start or stop every pipeline of the topology from its own core */
+static int tb_pipelines_trigger(struct testbench_prm *tp, int start)
+{
+	struct list_item *clist;
+	struct ipc_comp_dev *icd;
+	struct tb_pipe_start ps = { .tp = tp };
+	int ret;
+
+	list_for_item(clist, &sof.ipc->shared_ctx->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type != COMP_TYPE_PIPELINE)
+			continue;
+
+		ps.p = icd->pipeline;
+		if (start)
+			ret = tb_core_call(ps.p->ipc_pipe.core,
+					   tb_pipeline_start_core, &ps);
+		else
+			ret = tb_core_call(ps.p->ipc_pipe.core,
+					   tb_pipeline_stop_core, ps.p);
+		if (ret < 0) {
+			fprintf(stderr, "error: pipeline %u on core %u\n",
+				ps.p->ipc_pipe.pipeline_id,
+				ps.p->ipc_pipe.core);
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+/* every fileread comp of the topology reached the end of its input */
+static int tb_files_eof(void)
+{
+	struct list_item *clist;
+	struct ipc_comp_dev *icd;
+	struct file_comp_data *fcd;
+
+	list_for_item(clist, &sof.ipc->shared_ctx->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type != COMP_TYPE_COMPONENT ||
+		    icd->cd->comp.type != SOF_COMP_FILEREAD)
+			continue;
+
+		fcd = comp_get_drvdata(icd->cd);
+		if (fcd->fs.mode == FILE_READ && !fcd->fs.reached_eof)
+			return 0;
+	}
+
+	return 1;
+}
+
+/* run the topology on the core workers until all input is consumed */
+static int tb_pipelines_run(struct testbench_prm *tp)
+{
+	if (tb_pipelines_trigger(tp, 1) < 0)
+		return -EINVAL;
+
+	while (!tb_files_eof()) {
+		if (tb_cores_idle()) {
+			printf("warning: pipelines stopped before EOF\n");
+			break;
+		}
+		usleep(TESTBENCH_POLL_US);
+	}
+
+	return tb_pipelines_trigger(tp, 0);
+}
+
+/* per core load and the buffers whose lock was taken across cores */
+static void print_cores(uint64_t elapsed_ns)
+{
+	struct tb_core_stats stats;
+	struct list_item *clist;
+	struct ipc_comp_dev *icd;
+	int i;
+
+	printf("Core execution:\n");
+	printf("%6s %10s %12s %12s %6s\n", "core", "runs", "virtual us",
+	       "busy us", "load");
+
+	for (i = 0; i < tb_cores_count(); i++) {
+		tb_core_get_stats(i, &stats);
+		printf("%6d %10llu %12llu %12llu %5.1f%%\n", i,
+		       (unsigned long long)stats.runs,
+		       (unsigned long long)stats.time,
+		       (unsigned long long)stats.busy_ns / 1000,
+		       elapsed_ns ? 100.0 * stats.busy_ns / elapsed_ns : 0.0);
+	}
+
+	list_for_item(clist, &sof.ipc->shared_ctx->comp_list) {
+		icd = container_of(clist, struct ipc_comp_dev, list);
+		if (icd->type == COMP_TYPE_BUFFER && icd->cb->lock.contended)
+			printf("Buffer %u lock contended %u times\n",
+			       icd->cb->ipc_buffer.comp.id,
+			       icd->cb->lock.contended);
+	}
+}
+
 static void parse_input_args(int argc, char **argv, struct testbench_prm *tp)
 {
+	const char *options = "hdi:o:t:b:a:r:R:S:T:B:j:P:V";
 	int option = 0;
 
-	while ((option = getopt(argc, argv, "hdi:o:t:b:a:r:R:")) != -1) {
+	while ((option = getopt(argc, argv, options)) != -1) {
 		switch (option) {
 		/* input sample file */
 		case 'i':
@@ -183,6 +420,36 @@ static void parse_input_args(int argc, char **argv, struct testbench_prm *tp)
 			tp->fs_out = atoi(optarg);
 			break;
 
+		/* scheduler benchmarks task count */
+		case 'S':
+			tp->sched_bench_tasks = atoi(optarg);
+			break;
+
+		/* virtual cores with a worker thread each */
+		case 'T':
+			tp->num_cores = atoi(optarg);
+			break;
+
+		/* batch manifest */
+		case 'B':
+			tp->batch_file = strdup(optarg);
+			break;
+
+		/* batch worker threads */
+		case 'j':
+			tp->batch_workers = atoi(optarg);
+			break;
+
+		/* sampling profiler period */
+		case 'P':
+			tp->profile_period = atoi(optarg);
+			break;
+
+		/* SIMD module check */
+		case 'V':
+			tp->simd_check = 1;
+			break;
+
 		/* enable debug prints */
 		case 'd':
 			debug = 1;
@@ -206,7 +473,7 @@ int main(int argc, char **argv)
 	struct comp_dev *cd;
 	struct file_comp_data *frcd, *fwcd;
 	char pipeline[DEBUG_MSG_LEN];
-	clock_t tic, toc;
+	uint64_t tic, toc;
 	double c_realtime, t_exec;
 	int n_in, n_out, ret;
 	int i;
@@ -214,10 +481,60 @@ int main(int argc, char **argv)
 	/* initialize input and output sample rates */
 	tp.fs_in = 0;
 	tp.fs_out = 0;
+	tp.channels = TESTBENCH_NCH;
+	tp.sched_bench_tasks = 0;
+	tp.num_cores = 0;
+	tp.batch_file = NULL;
+	tp.batch_workers = 0;
+	tp.profile_period = 0;
+	tp.simd_check = 0;
 
 	/* command line arguments*/
 	parse_input_args(argc, argv, &tp);
 
+	/* scheduler benchmarks need no topology */
+	if (tp.sched_bench_tasks) {
+		if (tb_sched_bench(tp.sched_bench_tasks,
+				   TESTBENCH_SCHED_BENCH_DECISIONS) < 0 ||
+		    tb_ll_sched_bench(tp.sched_bench_tasks,
+				      TESTBENCH_SCHED_BENCH_TICKS) < 0) {
+			fprintf(stderr, "error: scheduler benchmark\n");
+			exit(EXIT_FAILURE);
+		}
+		exit(EXIT_SUCCESS);
+	}
+
+	/* modules register their drivers on load, so init the firmware */
+	if (tp.simd_check) {
+		if (tb_pipeline_setup(&sof) < 0 || tb_simd_check() < 0) {
+			fprintf(stderr, "error: SIMD module check\n");
+			exit(EXIT_FAILURE);
+		}
+		exit(EXIT_SUCCESS);
+	}
+
+	/* batch jobs bring their own files, pipelines run on the workers */
+	if (tp.batch_file) {
+		if (!tp.tplg_file || tp.num_cores) {
+			print_usage(argv[0]);
+			exit(EXIT_FAILURE);
+		}
+
+		if (tb_pipeline_setup(&sof) < 0) {
+			fprintf(stderr, "error: pipeline init\n");
+			exit(EXIT_FAILURE);
+		}
+
+		ret = tb_batch_run(&sof, lib_table, &tp);
+		free(tp.batch_file);
+		free(tp.tplg_file);
+		exit(ret < 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+	}
+
+	/* a WAV input brings its own format, rate and channels */
+	if (tp.input_file && tb_file_params(&tp) < 0)
+		exit(EXIT_FAILURE);
+
 	/* check args */
 	if (!tp.tplg_file || !tp.input_file || !tp.output_file || !tp.bits_in) {
 		print_usage(argv[0]);
@@ -230,6 +547,12 @@ int main(int argc, char **argv)
 		exit(EXIT_FAILURE);
 	}
 
+	/* start the core workers before any pipeline is triggered */
+	if (tp.num_cores && tb_cores_init(tp.num_cores) < 0) {
+		fprintf(stderr, "error: cores init\n");
+		exit(EXIT_FAILURE);
+	}
+
 	/* parse topology file and create pipeline */
 	if (parse_topology(&sof, lib_table, &tp, &fr_id, &fw_id, &sched_id,
 			   pipeline) < 0) {
@@ -255,15 +578,38 @@ int main(int argc, char **argv)
 	if (!tp.fs_out)
 		tp.fs_out = ipc_pipe->period * ipc_pipe->frames_per_sched;
 
+	cd = pcm_dev->cd;
+
+	if (tp.profile_period && tb_profiler_start(tp.profile_period) < 0) {
+		fprintf(stderr, "error: profiler start\n");
+		exit(EXIT_FAILURE);
+	}
+
+	/* threaded cores start, run and stop all pipelines themselves */
+	if (tp.num_cores) {
+		tb_enable_trace(false); /* reduce trace output */
+		tic = tb_time_ns();
+
+		ret = tb_pipelines_run(&tp);
+
+		toc = tb_time_ns();
+		tb_profiler_stop();
+		tb_enable_trace(true);
+		if (ret < 0) {
+			fprintf(stderr, "error: threaded pipelines\n");
+			exit(EXIT_FAILURE);
+		}
+		goto summary;
+	}
+
 	/* set pipeline params and trigger start */
-	if (tb_pipeline_start(sof.ipc, TESTBENCH_NCH, ipc_pipe, &tp) < 0) {
+	if (tb_pipeline_start(sof.ipc, tp.channels, ipc_pipe, &tp) < 0) {
 		fprintf(stderr, "error: pipeline params\n");
 		exit(EXIT_FAILURE);
 	}
 
-	cd = pcm_dev->cd;
 	tb_enable_trace(false); /* reduce trace output */
-	tic = clock();
+	tic = tb_time_ns();
 
 	while (frcd->fs.reached_eof == 0)
 		pipeline_schedule_copy(p, 0);
@@ -272,7 +618,8 @@ int main(int argc, char **argv)
 		printf("warning: possible pipeline xrun\n");
 
 	/* reset and free pipeline */
-	toc = clock();
+	toc = tb_time_ns();
+	tb_profiler_stop();
 	tb_enable_trace(true);
 	ret = pipeline_reset(p, cd);
 	if (ret < 0) {
@@ -280,13 +627,11 @@ int main(int argc, char **argv)
 		exit(EXIT_FAILURE);
 	}
 
+summary:
 	n_in = frcd->fs.n;
 	n_out = fwcd->fs.n;
-	t_exec = (double)(toc - tic) / CLOCKS_PER_SEC;
-	c_realtime = (double)n_out / TESTBENCH_NCH / tp.fs_out / t_exec;
-
-	/* free all components/buffers in pipeline */
-	free_comps();
+	t_exec = (double)(toc - tic) / 1e9;
+	c_realtime = (double)n_out / tp.channels / tp.fs_out / t_exec;
 
 	/* print test summary */
 	printf("==========================================================\n");
@@ -302,6 +647,18 @@ int main(int argc, char **argv)
 	printf("Output sample count: %d\n", n_out);
 	printf("Total execution time: %.2f us, %.2f x realtime\n",
 	       1e3 * t_exec, c_realtime);
+#if CONFIG_COMP_PERF
+	print_perf(p);
+#endif
+	if (tp.num_cores) {
+		print_cores(toc - tic);
+		tb_cores_free();
+	}
+	tb_print_heap_stats();
+	tb_profiler_print();
+
+	/* free all components/buffers in pipeline */
+	free_comps();
 
 	/* free all other data */
 	free(tp.bits_in);
@@ -39,6 +39,7 @@
 #include <sof/string.h>
 #include <dlfcn.h>
 #include <sof/audio/component.h>
+#include <sof/audio/pipeline.h>
 #include "testbench/topology.h"
 #include "testbench/file.h"
 
@@ -46,6 +47,64 @@ FILE *file;
 char pipeline_string[DEBUG_MSG_LEN];
 struct shared_lib_table *lib_table;
 
+/* filewrite comps loaded so far, see load_filewrite() */
+static int filewrite_count;
+
+/* IPC messages are recorded instead of sent while this is set */
+static struct tplg_record *tplg_rec;
+
+static int tplg_ipc_send(struct sof *sof, uint32_t cmd, void *msg)
+{
+	switch (cmd) {
+	case SOF_IPC_TPLG_COMP_NEW:
+		return ipc_comp_new(sof->ipc, msg);
+	case SOF_IPC_TPLG_BUFFER_NEW:
+		return ipc_buffer_new(sof->ipc, msg);
+	case SOF_IPC_TPLG_PIPE_NEW:
+		return ipc_pipeline_new(sof->ipc, msg);
+	case SOF_IPC_TPLG_COMP_CONNECT:
+		return ipc_comp_connect(sof->ipc, msg);
+	case SOF_IPC_TPLG_PIPE_COMPLETE:
+		return ipc_pipeline_complete(sof->ipc, *(uint32_t *)msg);
+	default:
+		return -EINVAL;
+	}
+}
+
+/* send a topology IPC message or append a copy of it to the record */
+static int tplg_ipc(struct sof *sof, uint32_t cmd, void *msg, size_t size)
+{
+	struct tplg_msg *m;
+
+	if (!tplg_rec)
+		return tplg_ipc_send(sof, cmd, msg);
+
+	m = realloc(tplg_rec->msg, (tplg_rec->count + 1) * sizeof(*m));
+	if (!m)
+		return -ENOMEM;
+	tplg_rec->msg = m;
+
+	m = &tplg_rec->msg[tplg_rec->count];
+	m->data = malloc(size);
+	if (!m->data)
+		return -ENOMEM;
+	memcpy(m->data, msg, size);
+	m->cmd = cmd;
+	m->size = size;
+	tplg_rec->count++;
+
+	if (size > tplg_rec->max_size)
+		tplg_rec->max_size = size;
+
+	if (cmd == SOF_IPC_TPLG_PIPE_NEW &&
+	    ((struct sof_ipc_pipe_new *)msg)->pipeline_id >=
+	    tplg_rec->num_pipelines)
+		tplg_rec->num_pipelines =
+			((struct sof_ipc_pipe_new *)msg)->pipeline_id + 1;
+
+	return 0;
+}
+
 /*
  * Register component driver
  * Only needed once per component type
@@ -153,6 +212,7 @@ static int load_graph(struct sof *sof, struct comp_info *temp_comp_list,
 {
 	struct sof_ipc_pipe_comp_connect connection;
 	struct snd_soc_tplg_dapm_graph_elem *graph_elem;
+	uint32_t comp_id;
 	size_t size;
 	int i, j, ret = 0;
 
@@ -164,6 +224,10 @@ static int load_graph(struct sof *sof, struct comp_info *temp_comp_list,
 		return -EINVAL;
 	}
 
+	/* one line per pipeline in the test summary */
+	if (pipeline_string[0])
+		strcat(pipeline_string, "\n");
+
 	/* set up component connections */
 	connection.source_id = -1;
 	connection.sink_id = -1;
@@ -192,7 +256,8 @@ static int load_graph(struct sof *sof, struct comp_info *temp_comp_list,
 
 		/* connect source and sink */
 		if (connection.source_id != -1 && connection.sink_id != -1)
-			if (ipc_comp_connect(sof->ipc, &connection) < 0) {
+			if (tplg_ipc(sof, SOF_IPC_TPLG_COMP_CONNECT,
+				     &connection, sizeof(connection)) < 0) {
 				fprintf(stderr, "error: comp connect\n");
 				return -EINVAL;
 			}
@@ -201,8 +266,11 @@ static int load_graph(struct sof *sof, struct comp_info *temp_comp_list,
 	/* pipeline complete after pipeline connections are established */
 	for (i = 0; i < num_comps; i++) {
 		if (temp_comp_list[i].pipeline_id == pipeline_id &&
-		    temp_comp_list[i].type == SND_SOC_TPLG_DAPM_SCHEDULER)
-			ipc_pipeline_complete(sof->ipc, temp_comp_list[i].id);
+		    temp_comp_list[i].type == SND_SOC_TPLG_DAPM_SCHEDULER) {
+			comp_id = temp_comp_list[i].id;
+			tplg_ipc(sof, SOF_IPC_TPLG_PIPE_COMPLETE, &comp_id,
+				 sizeof(comp_id));
+		}
 	}
 
 	free(graph_elem);
@@ -233,7 +301,8 @@ static int load_buffer(struct sof *sof, int comp_id, int pipeline_id, int size)
 			       size);
 
 	/* create buffer component */
-	if (ipc_buffer_new(sof->ipc, &buffer) < 0) {
+	if (tplg_ipc(sof, SOF_IPC_TPLG_BUFFER_NEW, &buffer,
+		     sizeof(buffer)) < 0) {
 		fprintf(stderr, "error: buffer new\n");
 		return -EINVAL;
 	}
@@ -293,7 +362,8 @@ static int load_fileread(struct sof *sof, int comp_id, int pipeline_id,
 	fileread.config.hdr.size = sizeof(struct sof_ipc_comp_config);
 
 	/* create fileread component */
-	if (ipc_comp_new(sof->ipc, (struct sof_ipc_comp *)&fileread) < 0) {
+	if (tplg_ipc(sof, SOF_IPC_TPLG_COMP_NEW, &fileread,
+		     sizeof(fileread)) < 0) {
 		fprintf(stderr, "error: comp register\n");
 		return -EINVAL;
 	}
@@ -312,6 +382,9 @@ static int load_filewrite(struct sof *sof, int comp_id, int pipeline_id,
 	size_t total_array_size = 0, read_size;
 	int ret = 0;
 
+	/* write the input format unless the topology sets another one */
+	filewrite.config.frame_fmt = find_format(tp->bits_in);
+
 	/* allocate memory for vendor tuple array */
 	array = (struct snd_soc_tplg_vendor_array *)malloc(size);
 	if (!array) {
@@ -340,8 +413,19 @@ static int load_filewrite(struct sof *sof, int comp_id, int pipeline_id,
 		total_array_size += array->size;
 	}
 
-	/* configure filewrite */
-	filewrite.fn = strdup(tp->output_file);
+	/* configure filewrite, the pipelines after the first one in a
+	 * multi-pipeline topology write to <output_file>.<pipeline_id>
+	 */
+	if (filewrite_count++) {
+		filewrite.fn = malloc(strlen(tp->output_file) + 12);
+		if (!filewrite.fn) {
+			fprintf(stderr, "error: mem alloc\n");
+			return -EINVAL;
+		}
+		sprintf(filewrite.fn, "%s.%d", tp->output_file, pipeline_id);
+	} else {
+		filewrite.fn = strdup(tp->output_file);
+	}
 	filewrite.comp.id = comp_id;
 	filewrite.mode = FILE_WRITE;
 	*fw_id = comp_id;
@@ -351,7 +435,8 @@ static int load_filewrite(struct sof *sof, int comp_id, int pipeline_id,
 	filewrite.config.hdr.size = sizeof(struct sof_ipc_comp_config);
 
 	/* create filewrite component */
-	if (ipc_comp_new(sof->ipc, (struct sof_ipc_comp *)&filewrite) < 0) {
+	if (tplg_ipc(sof, SOF_IPC_TPLG_COMP_NEW, &filewrite,
+		     sizeof(filewrite)) < 0) {
 		fprintf(stderr, "error: comp register\n");
 		return -EINVAL;
 	}
@@ -404,7 +489,7 @@ static int load_pga(struct sof *sof, int comp_id, int pipeline_id,
 	volume.config.hdr.size = sizeof(struct sof_ipc_comp_config);
 
 	/* load volume component */
-	if (ipc_comp_new(sof->ipc, (struct sof_ipc_comp *)&volume) < 0) {
+	if (tplg_ipc(sof, SOF_IPC_TPLG_COMP_NEW, &volume, sizeof(volume)) < 0) {
 		fprintf(stderr, "error: comp register\n");
 		return -EINVAL;
 	}
@@ -457,7 +542,8 @@ static int load_pipeline(struct sof *sof, struct sof_ipc_pipe_new *pipeline,
 	}
 
 	/* Create pipeline */
-	if (ipc_pipeline_new(sof->ipc, pipeline) < 0) {
+	if (tplg_ipc(sof, SOF_IPC_TPLG_PIPE_NEW, pipeline,
+		     sizeof(*pipeline)) < 0) {
 		fprintf(stderr, "error: pipeline new\n");
 		return -EINVAL;
 	}
@@ -650,7 +736,7 @@ static int load_src(struct sof *sof, int comp_id, int pipeline_id,
 	src.config.hdr.size = sizeof(struct sof_ipc_comp_config);
 
 	/* load src component */
-	if (ipc_comp_new(sof->ipc, (struct sof_ipc_comp *)&src) < 0) {
+	if (tplg_ipc(sof, SOF_IPC_TPLG_COMP_NEW, &src, sizeof(src)) < 0) {
 		fprintf(stderr, "error: new src comp\n");
 		return -EINVAL;
 	}
@@ -871,6 +957,9 @@ finish:
 	debug_print("topology parsing end\n");
 	strcpy(pipeline_msg, pipeline_string);
 
+	if (tplg_rec)
+		tplg_rec->num_comps = next_comp_id;
+
 	/* free all data */
 	free(hdr);
 
@@ -882,6 +971,199 @@ finish:
 	return 0;
 }
 
+/* parse topology file once into IPC messages for tplg_instantiate() */
+int tplg_record(struct sof *sof, struct shared_lib_table *library_table,
+		struct testbench_prm *tp, struct tplg_record *rec)
+{
+	struct testbench_prm rec_tp = *tp;
+	int ret;
+
+	memset(rec, 0, sizeof(*rec));
+
+	/* file comps can't use float, it marks formats each instance sets */
+	rec_tp.bits_in = "FLOAT_LE";
+
+	tplg_rec = rec;
+	ret = parse_topology(sof, library_table, &rec_tp, &rec->fr_id,
+			     &rec->fw_id, &rec->sched_id, rec->pipeline_msg);
+	tplg_rec = NULL;
+
+	return ret;
+}
+
+void tplg_record_free(struct tplg_record *rec)
+{
+	int i;
+
+	for (i = 0; i < rec->count; i++)
+		free(rec->msg[i].data);
+
+	free(rec->msg);
+	rec->msg = NULL;
+	rec->count = 0;
+}
+
+/* offset the IDs of a recorded message and point file comps to the files
+ * of this instance
+ */
+static int tplg_msg_patch(void *msg, uint32_t cmd, struct testbench_prm *tp,
+			  uint32_t id_base, uint32_t pipeline_base,
+			  int *filewrites, char *fn, size_t fn_size)
+{
+	struct sof_ipc_comp *comp = msg;
+	struct sof_ipc_comp_file *file = msg;
+	struct sof_ipc_buffer *buffer = msg;
+	struct sof_ipc_pipe_new *pipe = msg;
+	struct sof_ipc_pipe_comp_connect *connect = msg;
+
+	switch (cmd) {
+	case SOF_IPC_TPLG_COMP_NEW:
+		comp->id += id_base;
+		comp->pipeline_id += pipeline_base;
+		if (comp->type != SOF_COMP_FILEREAD)
+			break;
+
+		/* both file comps use the fileread type */
+		if (file->config.frame_fmt == SOF_IPC_FRAME_FLOAT)
+			file->config.frame_fmt = find_format(tp->bits_in);
+
+		if (file->mode == FILE_READ)
+			file->fn = tp->input_file;
+		else if ((*filewrites)++) {
+			snprintf(fn, fn_size, "%s.%d", tp->output_file,
+				 comp->pipeline_id - pipeline_base);
+			file->fn = fn;
+		} else {
+			file->fn = tp->output_file;
+		}
+		break;
+	case SOF_IPC_TPLG_BUFFER_NEW:
+		buffer->comp.id += id_base;
+		buffer->comp.pipeline_id += pipeline_base;
+		break;
+	case SOF_IPC_TPLG_PIPE_NEW:
+		pipe->comp_id += id_base;
+		pipe->sched_id += id_base;
+		pipe->pipeline_id += pipeline_base;
+		break;
+	case SOF_IPC_TPLG_COMP_CONNECT:
+		connect->source_id += id_base;
+		connect->sink_id += id_base;
+		break;
+	case SOF_IPC_TPLG_PIPE_COMPLETE:
+		*(uint32_t *)msg += id_base;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* append a patched message to the batch as a firmware topology command */
+static size_t tplg_batch_add(uint8_t *batch, uint32_t cmd, void *msg,
+			     size_t size)
+{
+	struct sof_ipc_cmd_hdr *hdr = (struct sof_ipc_cmd_hdr *)batch;
+	struct sof_ipc_pipe_ready ready;
+
+	/* pipeline complete is recorded as the bare scheduling comp ID */
+	if (cmd == SOF_IPC_TPLG_PIPE_COMPLETE) {
+		ready.comp_id = *(uint32_t *)msg;
+		msg = &ready;
+		size = sizeof(ready);
+	}
+
+	memcpy(batch, msg, size);
+	hdr->cmd = SOF_IPC_GLB_TPLG_MSG | cmd;
+	hdr->size = size;
+
+	return size;
+}
+
+/*
+ * Create one independent copy of a recorded topology. Instance n uses comp
+ * IDs from n * rec->num_comps and pipeline IDs from n * rec->num_pipelines,
+ * its fileread and filewrite comps use the files in tp. The instance is
+ * sent as one topology batch, the same path the firmware uses for it.
+ */
+int tplg_instantiate(struct sof *sof, struct tplg_record *rec,
+		     struct testbench_prm *tp, int instance)
+{
+	uint32_t id_base = instance * rec->num_comps;
+	uint32_t pipeline_base = instance * rec->num_pipelines;
+	size_t fn_size = strlen(tp->output_file) + 12;
+	size_t max_size = MAX(rec->max_size,
+			      sizeof(struct sof_ipc_pipe_ready));
+	size_t size = 0;
+	uint32_t done;
+	int filewrites = 0;
+	uint8_t *batch;
+	char *fn;
+	void *msg;
+	int ret = 0;
+	int i;
+
+	/* file names must stay valid until the whole batch has run */
+	msg = malloc(rec->max_size);
+	batch = malloc(rec->count * max_size);
+	fn = malloc(rec->count * fn_size);
+	if (!msg || !batch || !fn) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	for (i = 0; i < rec->count; i++) {
+		memcpy(msg, rec->msg[i].data, rec->msg[i].size);
+
+		ret = tplg_msg_patch(msg, rec->msg[i].cmd, tp, id_base,
+				     pipeline_base, &filewrites,
+				     fn + filewrites * fn_size, fn_size);
+		if (ret < 0)
+			goto out;
+
+		size += tplg_batch_add(batch + size, rec->msg[i].cmd, msg,
+				       rec->msg[i].size);
+	}
+
+	ret = ipc_tplg_batch(sof->ipc, batch, size, rec->count, &done);
+	if (ret < 0)
+		fprintf(stderr, "error: topology instance %d command %d\n",
+			instance, done);
+
+out:
+	free(fn);
+	free(batch);
+	free(msg);
+	return ret;
+}
+
+/* free pipelines first, they disconnect the comps and buffers */
+void tplg_instance_free(struct sof *sof, struct tplg_record *rec,
+			int instance)
+{
+	struct ipc_comp_dev *icd;
+	uint32_t id_base = instance * rec->num_comps;
+	uint32_t id;
+
+	for (id = id_base; id < id_base + rec->num_comps; id++) {
+		icd = ipc_get_comp(sof->ipc, id);
+		if (icd && icd->type == COMP_TYPE_PIPELINE)
+			ipc_pipeline_free(sof->ipc, id);
+	}
+
+	for (id = id_base; id < id_base + rec->num_comps; id++) {
+		icd = ipc_get_comp(sof->ipc, id);
+		if (!icd)
+			continue;
+
+		if (icd->type == COMP_TYPE_COMPONENT)
+			ipc_comp_free(sof->ipc, id);
+		else if (icd->type == COMP_TYPE_BUFFER)
+			ipc_buffer_free(sof->ipc, id);
+	}
+}
+
 /* parse vendor tokens in topology */
 int sof_parse_tokens(void *object, const struct sof_topology_token *tokens,
 		     int count, struct snd_soc_tplg_vendor_array *array,
@@ -1034,6 +1316,20 @@ enum sof_ipc_frame find_format(const char *name)
 	return SOF_IPC_FRAME_S32_LE;
 }
 
+/* ALSA name of a frame format, the reverse of find_format() */
+const char *find_format_name(enum sof_ipc_frame frame)
+{
+	int i;
+
+	/* ALSA names come last in the table */
+	for (i = ARRAY_SIZE(sof_frames) - 1; i >= 0; i--) {
+		if (sof_frames[i].frame == frame)
+			return sof_frames[i].name;
+	}
+
+	return "S32_LE";
+}
+
 int get_token_uint32_t(void *elem, void *object, uint32_t offset,
 		       uint32_t size)
 {